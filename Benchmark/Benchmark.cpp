@@ -0,0 +1,243 @@
+#include "BenchmarkSuites.h"
+#include <Lumos/Core/Application.h>
+#include <Lumos/Core/CoreSystem.h>
+#include <Lumos/Core/CommandLine.h>
+#include <Lumos/Core/Engine.h>
+#include <Lumos/Core/Version.h>
+#include <Lumos/Core/DataStructures/MapBenchmark.h>
+#include <Lumos/Scene/Scene.h>
+#include <Lumos/Scene/SceneManager.h>
+#include <Lumos/Scene/Serialisation/SceneBinarySerialiser.h>
+#include <Lumos/Maths/Random.h>
+#include <Lumos/Maths/MathsUtilities.h>
+#include <Lumos/Utilities/Timer.h>
+#include <Lumos/Utilities/TimeStep.h>
+
+#if defined(LUMOS_PLATFORM_WINDOWS)
+#include <Lumos/Platform/Windows/WindowsOS.h>
+#elif defined(LUMOS_PLATFORM_LINUX)
+#include <Lumos/Platform/Unix/UnixOS.h>
+#elif defined(LUMOS_PLATFORM_MACOS)
+#include <Lumos/Platform/MacOS/MacOSOS.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+using namespace Lumos;
+
+// Headless runner for the engine's CPU subsystems.
+// Every suite is built from a fixed seed and stepped with a fixed timestep, so two runs with the same
+// options do the same work and report the same checksums. Only the timings should differ.
+//
+// Options:
+//  --suite=<name>      Run a single suite, all suites by default
+//  --count=<n>         Workload size, each suite has its own default
+//  --frames=<n>        Timed frames per suite (300)
+//  --warmup=<n>        Untimed frames before measuring (30)
+//  --timestep=<ms>     Fixed simulation timestep (16.667)
+//  --seed=<n>          Random seed (1234)
+//  --output=<path>     JSON results (benchmark_results.json)
+//  --selftest          Also run the maths tests, scene binary round trip and hash map benchmark
+class BenchmarkApplication : public Application
+{
+    friend class Application;
+
+public:
+    explicit BenchmarkApplication()
+        : Application()
+    {
+        Application::SetInstance(this);
+    }
+
+    ~BenchmarkApplication()
+    {
+    }
+};
+
+Application* Lumos::CreateApplication()
+{
+    return new BenchmarkApplication();
+}
+
+struct BenchmarkResult
+{
+    std::string Name;
+    uint32_t Count  = 0;
+    double SetupMS  = 0.0;
+    double MeanMS   = 0.0;
+    double MedianMS = 0.0;
+    double P95MS    = 0.0;
+    double MinMS    = 0.0;
+    double MaxMS    = 0.0;
+    double TotalMS  = 0.0;
+    double Checksum = 0.0;
+};
+
+static int64_t OptionInt(CommandLine* cmdLine, const char* name, int64_t defaultValue)
+{
+    String8 value = cmdLine->OptionString(Str8C((char*)name));
+    return value.size ? cmdLine->OptionInt64(Str8C((char*)name)) : defaultValue;
+}
+
+static BenchmarkResult RunSuite(BenchmarkSuite* suite, uint32_t count, uint64_t seed, uint32_t warmupFrames, uint32_t frameCount, double timeStepMS)
+{
+    BenchmarkResult result;
+    result.Name  = suite->GetName();
+    result.Count = count;
+
+    auto sceneManager = Application::Get().GetSceneManager();
+    sceneManager->EnqueueScene(new Scene(result.Name));
+    sceneManager->SwitchScene((int)sceneManager->SceneCount() - 1);
+    sceneManager->ApplySceneSwitch();
+
+    Scene* scene = sceneManager->GetCurrentScene();
+    Random32 random((uint32_t)seed);
+
+    TimeStamp start = Timer::Now();
+    suite->Setup(scene, count, random);
+    result.SetupMS = Timer::Duration(start, Timer::Now(), 1000.0);
+
+    TimeStep& timeStep = Engine::GetTimeStep();
+    TDArray<double> frameTimes;
+    frameTimes.Reserve(frameCount);
+
+    for(uint32_t frame = 0; frame < warmupFrames + frameCount; frame++)
+    {
+        timeStep.OnUpdate(timeStepMS);
+
+        start = Timer::Now();
+        suite->Step(scene, timeStep);
+        double frameMS = Timer::Duration(start, Timer::Now(), 1000.0);
+
+        if(frame >= warmupFrames)
+            frameTimes.PushBack(frameMS);
+    }
+
+    result.Checksum = suite->GetChecksum(scene);
+    suite->Release(scene);
+
+    if(!frameTimes.Empty())
+    {
+        std::sort(frameTimes.Data(), frameTimes.Data() + frameTimes.Size());
+        for(double frameMS : frameTimes)
+            result.TotalMS += frameMS;
+
+        size_t frames   = frameTimes.Size();
+        result.MeanMS   = result.TotalMS / frames;
+        result.MedianMS = frameTimes[frames / 2];
+        result.P95MS    = frameTimes[Maths::Min(frames - 1, (size_t)(frames * 0.95))];
+        result.MinMS    = frameTimes.Front();
+        result.MaxMS    = frameTimes.Back();
+    }
+
+    LINFO("%-12s count %-7u setup %8.2fms  mean %7.3fms  median %7.3fms  p95 %7.3fms  max %7.3fms  checksum %.6f",
+          result.Name.c_str(), result.Count, result.SetupMS, result.MeanMS, result.MedianMS, result.P95MS, result.MaxMS, result.Checksum);
+
+    return result;
+}
+
+static bool WriteResults(const std::string& path, const TDArray<BenchmarkResult>& results, uint64_t seed, uint32_t warmupFrames, uint32_t frameCount, double timeStepMS)
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if(!file)
+    {
+        LERROR("Failed to write benchmark results to %s", path.c_str());
+        return false;
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "    \"version\": \"%d.%d.%d\",\n", LumosVersion.major, LumosVersion.minor, LumosVersion.patch);
+    fprintf(file, "    \"seed\": %llu,\n", (unsigned long long)seed);
+    fprintf(file, "    \"frames\": %u,\n", frameCount);
+    fprintf(file, "    \"warmup\": %u,\n", warmupFrames);
+    fprintf(file, "    \"timestepMS\": %.4f,\n", timeStepMS);
+    fprintf(file, "    \"suites\": [\n");
+
+    for(size_t i = 0; i < results.Size(); i++)
+    {
+        const BenchmarkResult& result = results[i];
+        fprintf(file, "        {\n");
+        fprintf(file, "            \"name\": \"%s\",\n", result.Name.c_str());
+        fprintf(file, "            \"count\": %u,\n", result.Count);
+        fprintf(file, "            \"setupMS\": %.4f,\n", result.SetupMS);
+        fprintf(file, "            \"meanMS\": %.4f,\n", result.MeanMS);
+        fprintf(file, "            \"medianMS\": %.4f,\n", result.MedianMS);
+        fprintf(file, "            \"p95MS\": %.4f,\n", result.P95MS);
+        fprintf(file, "            \"minMS\": %.4f,\n", result.MinMS);
+        fprintf(file, "            \"maxMS\": %.4f,\n", result.MaxMS);
+        fprintf(file, "            \"totalMS\": %.4f,\n", result.TotalMS);
+        fprintf(file, "            \"checksum\": %.9g\n", result.Checksum);
+        fprintf(file, "        }%s\n", i + 1 < results.Size() ? "," : "");
+    }
+
+    fprintf(file, "    ]\n");
+    fprintf(file, "}\n");
+    fclose(file);
+
+    LINFO("Benchmark results written to %s", path.c_str());
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if(!Internal::CoreSystem::Init(argc, argv))
+        return 0;
+
+    // The OS is only needed for paths and time, it isn't initialised so no window is created
+#if defined(LUMOS_PLATFORM_WINDOWS)
+    auto os = new WindowsOS();
+#elif defined(LUMOS_PLATFORM_LINUX)
+    auto os = new UnixOS();
+#elif defined(LUMOS_PLATFORM_MACOS)
+    auto os = new MacOSOS();
+#endif
+    OS::SetInstance(os);
+
+    CreateApplication();
+    Application::Get().InitHeadless();
+
+    CommandLine* cmdLine  = Internal::CoreSystem::GetCmdLine();
+    uint32_t frameCount   = (uint32_t)OptionInt(cmdLine, "frames", 300);
+    uint32_t warmupFrames = (uint32_t)OptionInt(cmdLine, "warmup", 30);
+    int64_t count         = OptionInt(cmdLine, "count", 0);
+    uint64_t seed         = (uint64_t)OptionInt(cmdLine, "seed", 1234);
+    String8 suiteName     = cmdLine->OptionString(Str8Lit("suite"));
+    String8 outputPath    = cmdLine->OptionString(Str8Lit("output"));
+    double timeStepMS     = cmdLine->OptionString(Str8Lit("timestep")).size ? cmdLine->OptionDouble(Str8Lit("timestep")) : 1000.0 / 60.0;
+
+    if(cmdLine->OptionBool(Str8Lit("selftest")))
+    {
+        Maths::TestMaths();
+        TestSceneBinaryRoundTrip(std::filesystem::temp_directory_path().string() + "/");
+        BenchmarkHashMaps();
+    }
+
+    TDArray<BenchmarkSuite*> suites = CreateBenchmarkSuites();
+    TDArray<BenchmarkResult> results;
+
+    for(auto suite : suites)
+    {
+        if(suiteName.size && !Str8Match(suiteName, Str8C((char*)suite->GetName())))
+            continue;
+
+        uint32_t suiteCount = count > 0 ? (uint32_t)count : suite->GetDefaultCount();
+        results.PushBack(RunSuite(suite, suiteCount, seed, warmupFrames, frameCount, timeStepMS));
+    }
+
+    if(results.Empty())
+        LERROR("No benchmark suite named %s", ToStdString(suiteName).c_str());
+    else
+        WriteResults(outputPath.size ? ToStdString(outputPath) : "benchmark_results.json", results, seed, warmupFrames, frameCount, timeStepMS);
+
+    for(auto suite : suites)
+        delete suite;
+
+    Application::Get().OnQuit();
+    Application::Release();
+    delete os;
+
+    Internal::CoreSystem::Shutdown();
+    return results.Empty() ? 1 : 0;
+}
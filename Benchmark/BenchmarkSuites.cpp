@@ -0,0 +1,389 @@
+#include "BenchmarkSuites.h"
+#include <Lumos/Core/Application.h>
+#include <Lumos/Core/OS/FileSystem.h>
+#include <Lumos/Scene/Scene.h>
+#include <Lumos/Scene/Entity.h>
+#include <Lumos/Scene/Component/RigidBody3DComponent.h>
+#include <Lumos/Maths/Transform.h>
+#include <Lumos/Maths/Random.h>
+#include <Lumos/Maths/MathsUtilities.h>
+#include <Lumos/Physics/LumosPhysicsEngine/LumosPhysicsEngine.h>
+#include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/SphereCollisionShape.h>
+#include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/CuboidCollisionShape.h>
+#include <Lumos/Graphics/ParticleManager.h>
+#include <Lumos/Graphics/Light.h>
+#include <Lumos/Graphics/Renderers/LightClusterGrid.h>
+#include <Lumos/Scripting/Lua/LuaManager.h>
+#include <Lumos/Scripting/Lua/LuaScriptComponent.h>
+#include <Lumos/AI/AStar.h>
+#include <Lumos/AI/PathEdge.h>
+#include <Lumos/Utilities/TimeStep.h>
+
+#include <sol/sol.hpp>
+#include <cstdio>
+
+namespace Lumos
+{
+    // Chains of parented transforms, with every root turning each frame so the whole chain is dirty
+    class TransformHierarchySuite : public BenchmarkSuite
+    {
+    public:
+        const char* GetName() const override { return "transforms"; }
+        uint32_t GetDefaultCount() const override { return 10000; }
+
+        void Setup(Scene* scene, uint32_t count, Random32& random) override
+        {
+            uint32_t chainCount = Maths::Max(1u, count / ChainDepth);
+            for(uint32_t chain = 0; chain < chainCount; chain++)
+            {
+                Entity parent = scene->CreateEntity("Root");
+                parent.AddComponent<Maths::Transform>(Vec3(random(-100.0f, 100.0f), 0.0f, random(-100.0f, 100.0f)));
+                m_Roots.PushBack(parent);
+
+                for(uint32_t depth = 1; depth < ChainDepth; depth++)
+                {
+                    Entity child = scene->CreateEntity("Child");
+                    child.AddComponent<Maths::Transform>(Vec3(random(0.5f, 1.5f), random(0.5f, 1.5f), 0.0f));
+                    child.SetParent(parent);
+                    parent = child;
+                }
+            }
+
+            scene->UpdateSceneGraph();
+        }
+
+        void Step(Scene* scene, const TimeStep& timeStep) override
+        {
+            float angle = (float)timeStep.GetElapsedSeconds() * 45.0f;
+            for(auto& root : m_Roots)
+                root.GetTransform().SetLocalOrientation(Quat(0.0f, angle, 0.0f));
+
+            scene->UpdateSceneGraph();
+        }
+
+        void Release(Scene* scene) override
+        {
+            m_Roots.Clear();
+        }
+
+        double GetChecksum(Scene* scene) override
+        {
+            double sum = 0.0;
+            auto view  = scene->GetRegistry().view<Maths::Transform>();
+            for(auto entity : view)
+            {
+                Vec3 position = view.get<Maths::Transform>(entity).GetWorldPosition();
+                sum += position.x + position.y + position.z;
+            }
+            return sum;
+        }
+
+    private:
+        static const uint32_t ChainDepth = 16;
+        TDArray<Entity> m_Roots;
+    };
+
+    // Spheres dropped in a jittered grid onto a static floor
+    class RigidBodySuite : public BenchmarkSuite
+    {
+    public:
+        const char* GetName() const override { return "physics3d"; }
+        uint32_t GetDefaultCount() const override { return 1000; }
+
+        void Setup(Scene* scene, uint32_t count, Random32& random) override
+        {
+            RigidBody3DProperties floorProperties;
+            floorProperties.Static   = true;
+            floorProperties.Mass     = 0.0f;
+            floorProperties.Position = Vec3(0.0f, -1.0f, 0.0f);
+            floorProperties.Shape    = CreateSharedPtr<CuboidCollisionShape>(Vec3(200.0f, 1.0f, 200.0f));
+            scene->CreateEntity("Floor").AddComponent<RigidBody3DComponent>(floorProperties);
+
+            auto sphereShape = CreateSharedPtr<SphereCollisionShape>(0.5f);
+            uint32_t side    = Maths::Max(1u, (uint32_t)Maths::Ceil(Maths::Pow((float)count, 1.0f / 3.0f)));
+            for(uint32_t i = 0; i < count; i++)
+            {
+                uint32_t x = i % side;
+                uint32_t y = (i / side) / side;
+                uint32_t z = (i / side) % side;
+
+                RigidBody3DProperties properties;
+                properties.Mass     = 1.0f;
+                properties.Shape    = sphereShape;
+                properties.Position = Vec3(x * 1.5f + random(-0.2f, 0.2f), 2.0f + y * 1.5f, z * 1.5f + random(-0.2f, 0.2f));
+                scene->CreateEntity("Body").AddComponent<RigidBody3DComponent>(properties);
+            }
+        }
+
+        void Step(Scene* scene, const TimeStep& timeStep) override
+        {
+            Application::Get().GetSystem<LumosPhysicsEngine>()->OnUpdate(timeStep, scene);
+        }
+
+        double GetChecksum(Scene* scene) override
+        {
+            double sum = 0.0;
+            auto view  = scene->GetRegistry().view<RigidBody3DComponent>();
+            for(auto entity : view)
+            {
+                const Vec3& position = view.get<RigidBody3DComponent>(entity).GetRigidBody()->GetPosition();
+                sum += position.x + position.y + position.z;
+            }
+            return sum;
+        }
+    };
+
+    // Emitters of ParticlesPerEmitter particles each, simulated on the CPU as the renderer does
+    class ParticleSuite : public BenchmarkSuite
+    {
+    public:
+        const char* GetName() const override { return "particles"; }
+        uint32_t GetDefaultCount() const override { return 100000; }
+
+        void Setup(Scene* scene, uint32_t count, Random32& random) override
+        {
+            uint32_t emitterCount = Maths::Max(1u, count / ParticlesPerEmitter);
+            for(uint32_t i = 0; i < emitterCount; i++)
+            {
+                Entity entity = scene->CreateEntity("Emitter");
+                entity.AddComponent<Maths::Transform>(Vec3(random(-50.0f, 50.0f), random(0.0f, 10.0f), random(-50.0f, 50.0f)));
+
+                auto& emitter = entity.AddComponent<ParticleEmitter>(ParticlesPerEmitter);
+                emitter.SetNumLaunchParticles(ParticlesPerEmitter / 16);
+                emitter.SetParticleRate(0.01f);
+            }
+        }
+
+        void Step(Scene* scene, const TimeStep& timeStep) override
+        {
+            auto group = scene->GetRegistry().group<ParticleEmitter>(entt::get<Maths::Transform>);
+            for(auto entity : group)
+            {
+                const auto& [emitter, transform] = group.get<ParticleEmitter, Maths::Transform>(entity);
+                emitter.Update((float)timeStep.GetSeconds(), transform.GetWorldPosition());
+            }
+        }
+
+        double GetChecksum(Scene* scene) override
+        {
+            // Respawning uses the global random generator, so only the live particle count is stable
+            double alive = 0.0;
+            auto view    = scene->GetRegistry().view<ParticleEmitter>();
+            for(auto entity : view)
+            {
+                auto& emitter       = view.get<ParticleEmitter>(entity);
+                Particle* particles = emitter.GetParticles();
+                for(uint32_t i = 0; i < emitter.GetParticleCount(); i++)
+                    alive += particles[i].Life > 0.0f ? 1.0 : 0.0;
+            }
+            return alive;
+        }
+
+    private:
+        static const uint32_t ParticlesPerEmitter = 1024;
+    };
+
+    // Point and spot lights orbiting inside the view, binned into the clustered lighting grid
+    class LightClusterSuite : public BenchmarkSuite
+    {
+    public:
+        const char* GetName() const override { return "lights"; }
+        uint32_t GetDefaultCount() const override { return Graphics::MAX_LIGHTS; }
+
+        void Setup(Scene* scene, uint32_t count, Random32& random) override
+        {
+            count = Maths::Min(count, Graphics::MAX_LIGHTS);
+            m_Lights.Reserve(count);
+            m_Origins.Reserve(count);
+
+            for(uint32_t i = 0; i < count; i++)
+            {
+                Vec3 origin              = Vec3(random(-60.0f, 60.0f), random(-10.0f, 10.0f), random(-200.0f, -5.0f));
+                Graphics::LightType type = (i % 4 == 0) ? Graphics::LightType::SpotLight : Graphics::LightType::PointLight;
+
+                m_Lights.EmplaceBack(Vec3(0.0f, -1.0f, 0.0f), Vec4(1.0f), 1000.0f, type, origin, random(2.0f, 12.0f), 45.0f);
+                m_Origins.PushBack(origin);
+            }
+
+            m_Grid.SetProjection(Mat4::Perspective(0.1f, 500.0f, 16.0f / 9.0f, 60.0f), 0.1f, 500.0f);
+        }
+
+        void Step(Scene* scene, const TimeStep& timeStep) override
+        {
+            float time = (float)timeStep.GetElapsedSeconds();
+            for(uint32_t i = 0; i < m_Lights.Size(); i++)
+            {
+                const Vec3& origin   = m_Origins[i];
+                m_Lights[i].Position = Vec4(origin.x + Maths::Sin(time + i) * 4.0f, origin.y, origin.z + Maths::Cos(time + i) * 4.0f, 1.0f);
+            }
+
+            m_Grid.Build(Mat4(1.0f), m_Lights.Data(), (uint32_t)m_Lights.Size(), 0);
+        }
+
+        void Release(Scene* scene) override
+        {
+            m_Lights.Clear();
+            m_Origins.Clear();
+        }
+
+        double GetChecksum(Scene* scene) override
+        {
+            return (double)m_Grid.GetLightIndexCount();
+        }
+
+    private:
+        Graphics::LightClusterGrid m_Grid;
+        TDArray<Graphics::Light> m_Lights;
+        TDArray<Vec3> m_Origins;
+    };
+
+    // Entities running the same small script through LuaManager's batched update
+    class LuaScriptSuite : public BenchmarkSuite
+    {
+    public:
+        const char* GetName() const override { return "lua"; }
+        uint32_t GetDefaultCount() const override { return 1000; }
+
+        void Setup(Scene* scene, uint32_t count, Random32& random) override
+        {
+            m_ScriptPath = FileSystem::GetWorkingDirectory() + "/LumosBenchmarkScript.lua";
+            FileSystem::WriteTextFile(m_ScriptPath,
+                                      "local phase = 0\n"
+                                      "function OnInit()\n"
+                                      "    phase = math.random()\n"
+                                      "end\n"
+                                      "function OnUpdate(dt)\n"
+                                      "    local sum = 0\n"
+                                      "    for i = 1, 32 do\n"
+                                      "        sum = sum + math.sin(phase + i * dt)\n"
+                                      "    end\n"
+                                      "    _G.BenchmarkTotal = (_G.BenchmarkTotal or 0) + sum\n"
+                                      "end\n");
+
+            // Scripts seed from Lua's generator, so reseed it for repeatable runs
+            auto& state             = LuaManager::Get().GetState();
+            state["BenchmarkTotal"] = 0.0;
+            state["math"]["randomseed"](random(0u, 0xFFFFu));
+
+            for(uint32_t i = 0; i < count; i++)
+                scene->CreateEntity("Script").AddComponent<LuaScriptComponent>(m_ScriptPath, scene);
+
+            LuaManager::Get().OnInit(scene);
+        }
+
+        void Step(Scene* scene, const TimeStep& timeStep) override
+        {
+            LuaManager::Get().OnUpdate(scene);
+        }
+
+        void Release(Scene* scene) override
+        {
+            scene->GetRegistry().clear<LuaScriptComponent>();
+            std::remove(m_ScriptPath.c_str());
+        }
+
+        double GetChecksum(Scene* scene) override
+        {
+            return LuaManager::Get().GetState().get_or("BenchmarkTotal", 0.0);
+        }
+
+    private:
+        std::string m_ScriptPath;
+    };
+
+    // A* over a grid with some blocked edges, count queries per frame between fixed random pairs
+    class PathQuerySuite : public BenchmarkSuite
+    {
+    public:
+        const char* GetName() const override { return "pathfinding"; }
+        uint32_t GetDefaultCount() const override { return 64; }
+
+        void Setup(Scene* scene, uint32_t count, Random32& random) override
+        {
+            for(uint32_t y = 0; y < GridSize; y++)
+            {
+                for(uint32_t x = 0; x < GridSize; x++)
+                    m_Nodes.PushBack(new PathNode(Vec3((float)x, 0.0f, (float)y)));
+            }
+
+            for(uint32_t y = 0; y < GridSize; y++)
+            {
+                for(uint32_t x = 0; x < GridSize; x++)
+                {
+                    PathNode* node = m_Nodes[y * GridSize + x];
+                    if(x + 1 < GridSize)
+                        AddEdge(node, m_Nodes[y * GridSize + x + 1], random);
+                    if(y + 1 < GridSize)
+                        AddEdge(node, m_Nodes[(y + 1) * GridSize + x], random);
+                }
+            }
+
+            m_AStar = new AStar(m_Nodes);
+
+            uint32_t nodeCount = GridSize * GridSize;
+            for(uint32_t i = 0; i < count; i++)
+            {
+                m_Queries.PushBack(m_Nodes[random(0u, nodeCount - 1)]);
+                m_Queries.PushBack(m_Nodes[random(0u, nodeCount - 1)]);
+            }
+        }
+
+        void Step(Scene* scene, const TimeStep& timeStep) override
+        {
+            m_TotalCost = 0.0;
+            for(uint32_t i = 0; i + 1 < m_Queries.Size(); i += 2)
+            {
+                if(m_AStar->FindPath(m_Queries[i], m_Queries[i + 1]))
+                    m_TotalCost += m_AStar->PathCost();
+            }
+        }
+
+        void Release(Scene* scene) override
+        {
+            delete m_AStar;
+            m_AStar = nullptr;
+
+            for(auto edge : m_Edges)
+                delete edge;
+            for(auto node : m_Nodes)
+                delete node;
+
+            m_Edges.Clear();
+            m_Nodes.Clear();
+            m_Queries.Clear();
+        }
+
+        double GetChecksum(Scene* scene) override
+        {
+            return m_TotalCost;
+        }
+
+    private:
+        void AddEdge(PathNode* a, PathNode* b, Random32& random)
+        {
+            PathEdge* edge = new PathEdge(a, b);
+            edge->SetTraversable(random(0u, 9u) != 0);
+            m_Edges.PushBack(edge);
+        }
+
+        static const uint32_t GridSize = 64;
+
+        TDArray<PathNode*> m_Nodes;
+        TDArray<PathEdge*> m_Edges;
+        TDArray<PathNode*> m_Queries;
+        AStar* m_AStar     = nullptr;
+        double m_TotalCost = 0.0;
+    };
+
+    TDArray<BenchmarkSuite*> CreateBenchmarkSuites()
+    {
+        TDArray<BenchmarkSuite*> suites;
+        suites.PushBack(new TransformHierarchySuite());
+        suites.PushBack(new RigidBodySuite());
+        suites.PushBack(new ParticleSuite());
+        suites.PushBack(new LightClusterSuite());
+        suites.PushBack(new LuaScriptSuite());
+        suites.PushBack(new PathQuerySuite());
+        return suites;
+    }
+}
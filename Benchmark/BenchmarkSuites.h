@@ -0,0 +1,31 @@
+#pragma once
+#include <Lumos/Core/Core.h>
+#include <Lumos/Core/DataStructures/TDArray.h>
+
+namespace Lumos
+{
+    class Scene;
+    class TimeStep;
+    class Random32;
+
+    // One synthetic workload. Setup builds it from a seeded generator so every run does identical work,
+    // Step is the part that is timed each frame.
+    class BenchmarkSuite
+    {
+    public:
+        virtual ~BenchmarkSuite() = default;
+
+        virtual const char* GetName() const = 0;
+        virtual uint32_t GetDefaultCount() const = 0;
+
+        virtual void Setup(Scene* scene, uint32_t count, Random32& random) = 0;
+        virtual void Step(Scene* scene, const TimeStep& timeStep)          = 0;
+        virtual void Release(Scene* scene) { }
+
+        // Summary of the simulated state, used to check runs with the same settings did the same work
+        virtual double GetChecksum(Scene* scene) = 0;
+    };
+
+    // Transforms in deep hierarchies, rigid bodies, particles, lights, Lua scripts and path queries
+    TDArray<BenchmarkSuite*> CreateBenchmarkSuites();
+}
@@ -8,6 +8,7 @@
 #include "Editor.h"
 
 #include <Lumos/Core/Engine.h>
+#include <Lumos/Core/Telemetry.h>
 #include <Lumos/Core/OS/Window.h>
 #include <Lumos/Graphics/Renderers/SceneRenderer.h>
 #include <Lumos/ImGui/ImGuiUtilities.h>
@@ -186,6 +187,44 @@ namespace Lumos
                     ImGui::TreePop();
                 }
 
+                if(ImGui::TreeNodeEx("Telemetry", 0))
+                {
+                    TDArray<TelemetryStats> telemetryStats;
+                    Telemetry::GetAllStats(telemetryStats);
+
+                    if(ImGui::BeginTable("Telemetry", 5, ImGuiTableFlags_NoSavedSettings | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_RowBg))
+                    {
+                        ImGui::TableSetupColumn("Name");
+                        ImGui::TableSetupColumn("Last");
+                        ImGui::TableSetupColumn("Average");
+                        ImGui::TableSetupColumn("P95");
+                        ImGui::TableSetupColumn("Max");
+                        ImGui::TableHeadersRow();
+
+                        // Scopes in milliseconds, counters as values per frame
+                        for(auto& stats : telemetryStats)
+                        {
+                            const char* format = stats.IsCounter ? "%.0f" : "%.3f ms";
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn();
+                            ImGui::TextUnformatted(stats.Name);
+                            ImGui::TableNextColumn();
+                            ImGui::Text(format, stats.Last);
+                            ImGui::TableNextColumn();
+                            ImGui::Text(format, stats.Average);
+                            ImGui::TableNextColumn();
+                            ImGui::Text(format, stats.P95);
+                            ImGui::TableNextColumn();
+                            ImGui::Text(format, stats.Max);
+                        }
+                        ImGui::EndTable();
+                    }
+
+                    if(ImGui::Button("Dump Telemetry"))
+                        Telemetry::Dump("Telemetry.json");
+                    ImGui::TreePop();
+                }
+
                 ImGui::Text("Scene : %s", Application::Get().GetSceneManager()->GetCurrentScene()->GetSceneName().c_str());
                 ImGui::TreePop();
             }
@@ -29,6 +29,7 @@
 #include <Lumos/Audio/AudioManager.h>
 #include <Lumos/Scene/Scene.h>
 #include <Lumos/Scene/SceneManager.h>
+#include <Lumos/Scene/SceneBVH.h>
 #include <Lumos/Scene/Entity.h>
 #include <Lumos/Scene/EntityManager.h>
 #include <Lumos/Events/ApplicationEvent.h>
@@ -2461,38 +2462,21 @@ namespace Lumos
         LUMOS_PROFILE_FUNCTION();
         auto scene                  = Application::Get().GetSceneManager()->GetCurrentScene();
         auto& registry              = scene->GetRegistry();
-        float closestEntityDist     = Maths::M_INFINITY;
         Entity currentClosestEntity = {};
 
-        auto group = registry.group<Graphics::ModelComponent>(entt::get<Maths::Transform>);
-
         static Timer timer;
         static float timeSinceLastSelect = 0.0f;
 
-        for(auto entity : group)
-        {
-            const auto& [model, trans] = group.get<Graphics::ModelComponent, Maths::Transform>(entity);
-
-            auto& meshes = model.ModelRef->GetMeshes();
-
-            for(auto mesh : meshes)
-            {
-                auto& worldTransform = trans.GetWorldMatrix();
+        // The BVH is refreshed with the scene graph, which Play and Preview already update every frame
+        SceneBVH* sceneBVH = scene->GetSceneBVH();
+        if(Application::Get().GetEditorState() == EditorState::Paused)
+            scene->UpdateSceneGraph();
 
-                auto bbCopy = mesh->GetBoundingBox().Transformed(worldTransform);
-                float distance;
-                ray.Intersects(bbCopy, distance);
+        // Models are tested against their triangles, sprites against their bounds
+        SceneRayHit hit;
+        if(sceneBVH->Raycast(ray, Maths::M_INFINITY, hit))
+            currentClosestEntity = { hit.Entity, scene };
 
-                if(distance < Maths::M_INFINITY)
-                {
-                    if(distance < closestEntityDist)
-                    {
-                        closestEntityDist    = distance;
-                        currentClosestEntity = { entity, scene };
-                    }
-                }
-            }
-        }
         if(!hoveredOnly)
             if(!m_SelectedEntities.empty())
             {
@@ -2500,11 +2484,11 @@ namespace Lumos
                 {
                     if(timer.GetElapsedS() - timeSinceLastSelect < 1.0f)
                     {
-                        auto& trans = registry.get<Maths::Transform>(currentClosestEntity);
-                        auto& model = registry.get<Graphics::ModelComponent>(currentClosestEntity);
-                        auto bb     = model.ModelRef->GetMeshes().Front()->GetBoundingBox().Transformed(trans.GetWorldMatrix());
+                        auto trans = registry.try_get<Maths::Transform>(currentClosestEntity);
+                        auto bb    = sceneBVH->GetBounds(currentClosestEntity);
 
-                        FocusCamera(trans.GetWorldPosition(), Maths::Distance(bb.Max(), bb.Min()), 2.0f);
+                        if(trans && bb)
+                            FocusCamera(trans->GetWorldPosition(), Maths::Distance(bb->Max(), bb->Min()), 2.0f);
                     }
                     else
                     {
@@ -2524,49 +2508,6 @@ namespace Lumos
                 return;
             }
 
-        auto spriteGroup = registry.group<Graphics::Sprite>(entt::get<Maths::Transform>);
-
-        for(auto entity : spriteGroup)
-        {
-            const auto& [sprite, trans] = spriteGroup.get<Graphics::Sprite, Maths::Transform>(entity);
-
-            auto& worldTransform = trans.GetWorldMatrix();
-            auto bb              = Maths::BoundingBox(Maths::Rect(sprite.GetPosition(), sprite.GetPosition() + sprite.GetScale()));
-            bb.Transform(trans.GetWorldMatrix());
-
-            float distance;
-            ray.Intersects(bb, distance);
-            if(distance < Maths::M_INFINITY)
-            {
-                if(distance < closestEntityDist)
-                {
-                    closestEntityDist    = distance;
-                    currentClosestEntity = { entity, scene };
-                }
-            }
-        }
-
-        auto animSpriteGroup = registry.group<Graphics::AnimatedSprite>(entt::get<Maths::Transform>);
-
-        for(auto entity : animSpriteGroup)
-        {
-            const auto& [sprite, trans] = animSpriteGroup.get<Graphics::AnimatedSprite, Maths::Transform>(entity);
-
-            auto& worldTransform = trans.GetWorldMatrix();
-            auto bb              = Maths::BoundingBox(Maths::Rect(sprite.GetPosition(), sprite.GetPosition() + sprite.GetScale()));
-            bb.Transform(trans.GetWorldMatrix());
-            float distance;
-            ray.Intersects(bb, distance);
-            if(distance < Maths::M_INFINITY)
-            {
-                if(distance < closestEntityDist)
-                {
-                    closestEntityDist    = distance;
-                    currentClosestEntity = { entity, scene };
-                }
-            }
-        }
-
         /*       if (hoveredOnly)
                {
                    if(IsSelected(currentClosestEntity))
@@ -3033,24 +2974,26 @@ namespace Lumos
     void Editor::CacheScene()
     {
         LUMOS_PROFILE_FUNCTION();
-        Application::Get().GetCurrentScene()->Serialise(m_TempSceneSaveFilePath, false);
+        m_PlayModeSnapshot.Capture(Application::Get().GetCurrentScene());
     }
 
     void Editor::LoadCachedScene()
     {
         LUMOS_PROFILE_FUNCTION();
 
-        if(FileSystem::FileExists(m_TempSceneSaveFilePath + Application::Get().GetCurrentScene()->GetSceneName() + ".lsn"))
+        Scene* scene = Application::Get().GetCurrentScene();
+        if(m_PlayModeSnapshot.IsValid(scene))
         {
-            Application::Get().GetCurrentScene()->Deserialise(m_TempSceneSaveFilePath, false);
+            m_PlayModeSnapshot.Restore(scene);
+            m_PlayModeSnapshot.Clear();
         }
         else
         {
             std::string physicalPath;
-            if(Lumos::FileSystem::Get().ResolvePhysicalPath("//Assets/Scenes/" + Application::Get().GetCurrentScene()->GetSceneName() + ".lsn", physicalPath))
+            if(Lumos::FileSystem::Get().ResolvePhysicalPath("//Assets/Scenes/" + scene->GetSceneName() + ".lsn", physicalPath))
             {
                 auto newPath = StringUtilities::RemoveName(physicalPath);
-                Application::Get().GetCurrentScene()->Deserialise(newPath, false);
+                scene->Deserialise(newPath, false);
             }
         }
     }
@@ -6,6 +6,7 @@
 #include <Lumos/ImGui/ImGuiUtilities.h>
 #include <Lumos/Core/Application.h>
 #include <Lumos/Scene/Entity.h>
+#include <Lumos/Scene/SceneSnapshot.h>
 #include <Lumos/Maths/Vector3.h>
 #include <imgui/imgui.h>
 
@@ -319,6 +320,7 @@ namespace Lumos
         SharedPtr<Graphics::GridRenderer> m_GridRenderer;
 
         std::string m_TempSceneSaveFilePath;
+        SceneSnapshot m_PlayModeSnapshot;
         int m_AutoSaveSettingsTime = 15000;
         String8 m_EditorScriptPath;
 
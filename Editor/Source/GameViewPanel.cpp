@@ -235,6 +235,9 @@ namespace Lumos
                 ImGui::Text("Num Rendered Objects %u", SceneRendererStats.NumRenderedObjects);
                 ImGui::Text("Num Shadow Objects %u", SceneRendererStats.NumShadowObjects);
                 ImGui::Text("Num Draw Calls  %u", SceneRendererStats.NumDrawCalls);
+                ImGui::Text("Num Instanced Objects %u", SceneRendererStats.NumInstancedObjects);
+                ImGui::Text("Num Lights %u (%u cluster refs)", SceneRendererStats.NumLights, SceneRendererStats.NumClusterLightRefs);
+                ImGui::Text("UI Widgets Rebuilt %u", SceneRendererStats.UIWidgetsRebuilt);
                 ImGui::Text("Used GPU Memory : %.1f mb | Total : %.1f mb", stats.UsedGPUMemory * 0.000001f, stats.TotalGPUMemory * 0.000001f);
 
                 if(ImGui::BeginPopupContextWindow())
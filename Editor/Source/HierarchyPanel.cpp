@@ -36,7 +36,6 @@ namespace Lumos
     ImGuiTextFilter m_HierarchyFilter;
     Entity m_DoubleClicked;
     Entity m_HadRecentDroppedEntity;
-    Entity m_CurrentPrevious;
 
     HierarchyPanel::HierarchyPanel()
     {
@@ -53,459 +52,545 @@ namespace Lumos
         ArenaRelease(m_StringArena);
     }
 
-    void HierarchyPanel::DrawNode(Entity node)
+    void HierarchyPanel::OnNewScene(Scene* scene)
     {
-        LUMOS_PROFILE_FUNCTION_LOW();
-        bool show = true;
+        m_OpenEntities.Clear();
+        m_CachedScene = nullptr;
+        m_TreeDirty   = true;
+    }
 
-        if(!node.Valid())
-            return;
-        bool visible = ImGui::IsRectVisible(ImVec2(ImGui::GetContentRegionMax().x, ImGui::GetTextLineHeightWithSpacing()));
-        if(!visible)
+    bool HierarchyPanel::IsOpen(entt::entity entity) const
+    {
+        return m_OpenEntities.Contains((uint32_t)entity);
+    }
+
+    void HierarchyPanel::SetOpen(entt::entity entity, bool open)
+    {
+        if(open)
+            m_OpenEntities.Insert((uint32_t)entity, true);
+        else
+            m_OpenEntities.Remove((uint32_t)entity);
+        m_RowsDirty = true;
+    }
+
+    uint32_t HierarchyPanel::AddNode(entt::registry& registry, entt::entity entity, uint32_t parent, uint32_t depth)
+    {
+        uint32_t index      = (uint32_t)m_Nodes.Size();
+        HierarchyNode& node = m_Nodes.EmplaceBack();
+        node.Entity         = entity;
+        node.Parent         = parent;
+        node.Depth          = depth;
+        node.HasChildren    = false;
+        node.LastChild      = true;
+
+        auto hierarchyComponent = registry.try_get<Hierarchy>(entity);
+        entt::entity child      = hierarchyComponent ? hierarchyComponent->First() : entt::null;
+        uint32_t lastChild      = InvalidNode;
+        while(child != entt::null && registry.valid(child))
         {
-            ImGui::NewLine();
+            if(lastChild != InvalidNode)
+                m_Nodes[lastChild].LastChild = false;
+            lastChild = AddNode(registry, child, index, depth + 1);
+
+            auto childHierarchy = registry.try_get<Hierarchy>(child);
+            child               = childHierarchy ? childHierarchy->Next() : entt::null;
+        }
+
+        // m_Nodes may have grown, so index rather than keeping the reference
+        m_Nodes[index].HasChildren = lastChild != InvalidNode;
+        m_Nodes[index].SubtreeEnd  = (uint32_t)m_Nodes.Size();
+        return index;
+    }
+
+    void HierarchyPanel::UpdateTree(Scene* scene)
+    {
+        auto& registry = scene->GetRegistry();
+        u64 version    = SceneGraph::GetHierarchyVersion(registry);
+
+        // Registries without a scene graph have no version to compare, so they're rebuilt every frame
+        if(!m_TreeDirty && scene == m_CachedScene && version == m_CachedVersion && version != 0)
             return;
+
+        LUMOS_PROFILE_FUNCTION();
+        m_CachedScene   = scene;
+        m_CachedVersion = version;
+        m_TreeDirty     = false;
+        m_FilterDirty   = true;
+        m_RowsDirty     = true;
+
+        m_Nodes.Clear();
+        for(auto [entity] : registry.storage<entt::entity>().each())
+        {
+            auto hierarchyComponent = registry.try_get<Hierarchy>(entity);
+            if(!hierarchyComponent || hierarchyComponent->Parent() == entt::null)
+                AddNode(registry, entity, InvalidNode, 0);
         }
+    }
 
-        Entity nodeEntity = { node, Application::Get().GetSceneManager()->GetCurrentScene() };
+    void HierarchyPanel::UpdateFilter(Scene* scene)
+    {
+        std::string filter = m_HierarchyFilter.InputBuf;
+        if(!m_FilterDirty && filter == m_LastFilter)
+            return;
 
-        String8 name = PushStr8Copy(m_StringArena, node.GetName().c_str());
+        LUMOS_PROFILE_FUNCTION();
 
-        if(visible && m_HierarchyFilter.IsActive())
+        // Typing more of a single term can only remove matches, so only the current matches are tested again.
+        // Commas and '-' make terms that can add matches, those go through the whole tree
+        bool narrowing = !m_FilterDirty && !m_LastFilter.empty() && filter.size() > m_LastFilter.size() && filter.compare(0, m_LastFilter.size(), m_LastFilter) == 0
+                         && filter.find_first_of(",-") == std::string::npos;
+
+        m_FilterDirty = false;
+        m_LastFilter  = filter;
+        m_RowsDirty   = true;
+
+        if(!m_HierarchyFilter.IsActive())
+            return;
+
+        m_FilterFlags.Resize(m_Nodes.Size());
+        for(uint32_t i = 0; i < m_Nodes.Size(); i++)
         {
-            if(!m_HierarchyFilter.PassFilter((const char*)name.str))
+            if(narrowing && !(m_FilterFlags[i] & FilterMatch))
             {
-                show = false;
+                m_FilterFlags[i] = 0;
+                continue;
             }
+
+            Entity entity    = { m_Nodes[i].Entity, scene };
+            m_FilterFlags[i] = (entity.Valid() && m_HierarchyFilter.PassFilter(entity.GetName().c_str())) ? FilterMatch | FilterShown : 0;
         }
 
-        if(show)
+        // Children come after their parents, so walking backwards passes a match up to every ancestor
+        for(uint32_t i = (uint32_t)m_Nodes.Size(); i-- > 0;)
         {
-            // ImGui::PushID((int)node);
-            ImGuiUtilities::PushID();
-            auto hierarchyComponent = node.TryGetComponent<Hierarchy>();
-            bool noChildren         = true;
-
-            if(hierarchyComponent != nullptr && hierarchyComponent->First() != entt::null)
-                noChildren = false;
+            if((m_FilterFlags[i] & FilterShown) && m_Nodes[i].Parent != InvalidNode)
+                m_FilterFlags[m_Nodes[i].Parent] |= FilterShown;
+        }
+    }
 
-            ImGuiTreeNodeFlags nodeFlags = ((m_Editor->IsSelected(node)) ? ImGuiTreeNodeFlags_Selected : 0);
+    void HierarchyPanel::UpdateRows()
+    {
+        if(!m_RowsDirty)
+            return;
 
-            nodeFlags |= ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_FramePadding | ImGuiTreeNodeFlags_AllowOverlap | ImGuiTreeNodeFlags_SpanAvailWidth;
+        LUMOS_PROFILE_FUNCTION();
+        m_RowsDirty = false;
+        m_Rows.Clear();
 
-            if(noChildren)
+        // While filtering every ancestor of a match is shown open
+        bool filtering = m_HierarchyFilter.IsActive();
+        for(uint32_t i = 0; i < m_Nodes.Size();)
+        {
+            if(filtering && !(m_FilterFlags[i] & FilterShown))
             {
-                nodeFlags |= ImGuiTreeNodeFlags_Leaf;
+                i = m_Nodes[i].SubtreeEnd;
+                continue;
             }
 
-            bool active = visible && Entity(node, m_Editor->GetCurrentScene()).Active();
+            m_Rows.PushBack(i);
+            bool open = m_Nodes[i].HasChildren && (filtering || IsOpen(m_Nodes[i].Entity));
+            i         = open ? i + 1 : m_Nodes[i].SubtreeEnd;
+        }
+    }
 
-            if(!active)
-                ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled));
+    void HierarchyPanel::DrawTreeLines(uint32_t nodeIndex, const ImVec2& rowStart)
+    {
+        const HierarchyNode& node = m_Nodes[nodeIndex];
+        if(node.Depth == 0)
+            return;
 
-            bool dragging      = false;
-            bool doubleClicked = false;
-            if(node == m_DoubleClicked)
-            {
-                doubleClicked = true;
-            }
+        const ImColor TreeLineColor = ImColor(128, 128, 128, 128);
+        const float SmallOffsetX    = 6.0f * Application::Get().GetWindowDPI();
+        ImDrawList* drawList        = ImGui::GetWindowDrawList();
 
-            if(doubleClicked)
-                ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, { 1.0f, 2.0f });
+        // Each row draws its own part of the lines, so rows the clipper skips cost nothing
+        float top      = rowStart.y;
+        float bottom   = rowStart.y + m_RowHeight;
+        float midpoint = rowStart.y + ImGui::GetFrameHeight() * 0.5f;
+        float lineX    = rowStart.x - m_IndentPerLevel + SmallOffsetX;
 
-            if(m_HadRecentDroppedEntity == node)
-            {
-                ImGui::SetNextItemOpen(true);
-                m_HadRecentDroppedEntity = {};
-            }
+        float horizontalSize = (node.HasChildren ? 0.4f : 1.0f) * 20.0f * Application::Get().GetWindowDPI();
+        drawList->AddLine(ImVec2(lineX, midpoint), ImVec2(lineX + horizontalSize, midpoint), TreeLineColor);
+        drawList->AddLine(ImVec2(lineX, top), ImVec2(lineX, node.LastChild ? midpoint : bottom), TreeLineColor);
 
-            String8 icon  = Str8C((char*)ICON_MDI_CUBE_OUTLINE);
-            auto& iconMap = m_Editor->GetComponentIconMap();
+        // Ancestors with siblings still to come keep their line running past this row
+        uint32_t ancestor = node.Parent;
+        while(ancestor != InvalidNode && m_Nodes[ancestor].Depth > 0)
+        {
+            lineX -= m_IndentPerLevel;
+            if(!m_Nodes[ancestor].LastChild)
+                drawList->AddLine(ImVec2(lineX, top), ImVec2(lineX, bottom), TreeLineColor);
+            ancestor = m_Nodes[ancestor].Parent;
+        }
+    }
 
-            if(!visible)
-            {
-                icon = Str8C((char*)ICON_MDI_CUBE_OUTLINE);
-            }
-            else if(node.HasComponent<Camera>())
-            {
-                if(iconMap.find(typeid(Camera).hash_code()) != iconMap.end())
-                    icon = Str8C((char*)iconMap[typeid(Camera).hash_code()]);
-            }
-            else if(node.HasComponent<LuaScriptComponent>())
-            {
-                if(iconMap.find(typeid(LuaScriptComponent).hash_code()) != iconMap.end())
-                    icon = Str8C((char*)iconMap[typeid(LuaScriptComponent).hash_code()]);
-            }
-            else if(node.HasComponent<SoundComponent>())
-            {
-                if(iconMap.find(typeid(SoundComponent).hash_code()) != iconMap.end())
-                    icon = Str8C((char*)iconMap[typeid(SoundComponent).hash_code()]);
-            }
-            else if(node.HasComponent<RigidBody2DComponent>())
-            {
-                if(iconMap.find(typeid(RigidBody2DComponent).hash_code()) != iconMap.end())
-                    icon = Str8C((char*)iconMap[typeid(RigidBody2DComponent).hash_code()]);
-            }
-            else if(node.HasComponent<Graphics::Light>())
-            {
-                if(iconMap.find(typeid(Graphics::Light).hash_code()) != iconMap.end())
-                    icon = Str8C((char*)iconMap[typeid(Graphics::Light).hash_code()]);
-            }
-            else if(node.HasComponent<Graphics::Environment>())
-            {
-                if(iconMap.find(typeid(Graphics::Environment).hash_code()) != iconMap.end())
-                    icon = Str8C((char*)iconMap[typeid(Graphics::Environment).hash_code()]);
-            }
-            else if(node.HasComponent<Graphics::Sprite>())
-            {
-                if(iconMap.find(typeid(Graphics::Sprite).hash_code()) != iconMap.end())
-                    icon = Str8C((char*)iconMap[typeid(Graphics::Sprite).hash_code()]);
-            }
-            else if(node.HasComponent<TextComponent>())
-            {
-                if(iconMap.find(typeid(TextComponent).hash_code()) != iconMap.end())
-                    icon = Str8C((char*)iconMap[typeid(TextComponent).hash_code()]);
-            }
+    void HierarchyPanel::DrawNode(uint32_t nodeIndex, Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const HierarchyNode& treeNode = m_Nodes[nodeIndex];
+        Entity node                   = { treeNode.Entity, scene };
+        float indent                  = treeNode.Depth * m_IndentPerLevel;
 
-            ImGui::PushStyleColor(ImGuiCol_Text, ImGuiUtilities::GetIconColour());
+        // Destroyed earlier this frame, the tree is rebuilt next frame. Keep the row height so the clipper stays in step
+        if(!node.Valid())
+        {
+            ImGui::Dummy(ImVec2(0.0f, ImGui::GetFrameHeight()));
+            return;
+        }
 
-            bool nodeOpen = ImGui::TreeNodeEx((void*)(intptr_t)node.GetID(), nodeFlags, "%s", (const char*)icon.str);
-            {
-                if(ImGui::BeginDragDropSource())
-                {
+        if(indent > 0.0f)
+            ImGui::Indent(indent);
 
-                    if(!m_Editor->IsSelected(node))
-                    {
-                        /*      m_Editor->ClearSelected();
-                              m_Editor->SetSelected(node);*/
+        DrawTreeLines(nodeIndex, ImGui::GetCursorScreenPos());
 
-                        auto selected = node.GetHandle();
-                        ImGui::TextUnformatted(Entity(node, Application::Get().GetSceneManager()->GetCurrentScene()).GetName().c_str());
-                        ImGui::SetDragDropPayload("Drag_Entity", &selected, sizeof(entt::entity));
-                    }
-                    else
-                    {
-                        auto selected = m_Editor->GetSelected();
-                        for(auto e : selected)
-                        {
-                            ImGui::TextUnformatted(Entity(e, Application::Get().GetSceneManager()->GetCurrentScene()).GetName().c_str());
-                        }
+        String8 name = PushStr8Copy(m_StringArena, node.GetName().c_str());
 
-                        ImGui::SetDragDropPayload("Drag_Entity", selected.data(), selected.size() * sizeof(entt::entity));
-                    }
+        // Rows are keyed by entity rather than draw order so popups and rename survive scrolling
+        ImGui::PushID((int)(uint32_t)treeNode.Entity);
+        bool filtering = m_HierarchyFilter.IsActive();
 
-                    ImGui::EndDragDropSource();
-                }
+        ImGuiTreeNodeFlags nodeFlags = ((m_Editor->IsSelected(node)) ? ImGuiTreeNodeFlags_Selected : 0);
 
-                // Allow clicking of icon and text. Need twice as they are separated
-                if(ImGui::IsMouseReleased(ImGuiMouseButton_Left) && ImGui::IsItemHovered() && !ImGui::IsItemToggledOpen())
-                {
-                    bool ctrlDown = Input::Get().GetKeyHeld(Lumos::InputCode::Key::LeftControl) || Input::Get().GetKeyHeld(Lumos::InputCode::Key::RightControl) || Input::Get().GetKeyHeld(Lumos::InputCode::Key::LeftSuper);
-                    if(!ctrlDown)
-                        m_Editor->ClearSelected();
+        nodeFlags |= ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_FramePadding | ImGuiTreeNodeFlags_AllowOverlap | ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen;
 
-                    if(!m_Editor->IsSelected(node))
-                        m_Editor->SetSelected(node);
-                    else
-                        m_Editor->UnSelect(node);
-                }
-                else if(m_DoubleClicked == node && ImGui::IsMouseClicked(ImGuiMouseButton_Left) && !ImGui::IsItemHovered(ImGuiHoveredFlags_None))
-                    m_DoubleClicked = {};
-            }
+        if(!treeNode.HasChildren)
+        {
+            nodeFlags |= ImGuiTreeNodeFlags_Leaf;
+        }
 
-            if(visible && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left) && ImGui::IsItemHovered(ImGuiHoveredFlags_None))
-            {
-                m_DoubleClicked = node;
-                if(Application::Get().GetEditorState() == EditorState::Preview)
-                {
-                    auto transform = node.TryGetComponent<Maths::Transform>();
-                    if(transform)
-                        m_Editor->FocusCamera(transform->GetWorldPosition(), 2.0f, 2.0f);
-                }
-            }
+        bool active = node.Active();
 
-            bool hovered = ImGui::IsItemHovered(ImGuiHoveredFlags_None);
+        if(!active)
+            ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled));
 
-            ImGui::PopStyleColor();
-            ImGui::SameLine();
-            if(!doubleClicked)
-            {
-                bool isPrefab = false;
-                if(node.HasComponent<PrefabComponent>())
-                    isPrefab = true;
-                else
-                {
-                    auto Parent = nodeEntity.GetParent();
-                    while(Parent && Parent.Valid())
-                    {
-                        if(Parent.HasComponent<PrefabComponent>())
-                        {
-                            isPrefab = true;
-                            Parent   = {};
-                        }
-                        else
-                        {
-                            Parent = Parent.GetParent();
-                        }
-                    }
-                }
+        bool doubleClicked = false;
+        if(node == m_DoubleClicked)
+        {
+            doubleClicked = true;
+        }
 
-                if(isPrefab)
-                    ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_CheckMark));
-                ImGui::TextUnformatted((const char*)name.str);
-                if(isPrefab)
-                    ImGui::PopStyleColor();
-            }
+        if(doubleClicked)
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, { 1.0f, 2.0f });
 
-            if(doubleClicked)
-            {
-                String8 nameBuffer = { 0 };
-                nameBuffer.str     = PushArray(m_StringArena, uint8_t, INPUT_BUF_SIZE);
-                nameBuffer.size    = INPUT_BUF_SIZE;
+        if(m_HadRecentDroppedEntity == node)
+        {
+            SetOpen(node, true);
+            m_HadRecentDroppedEntity = {};
+        }
 
-                MemoryCopy(nameBuffer.str, name.str, name.size);
+        bool wasOpen = treeNode.HasChildren && (filtering || IsOpen(node));
+        ImGui::SetNextItemOpen(wasOpen);
 
-                ImGui::PushItemWidth(-1);
-                if(ImGui::InputText("##Name", (char*)nameBuffer.str, INPUT_BUF_SIZE, 0))
-                    node.GetOrAddComponent<NameComponent>((const char*)nameBuffer.str);
-                ImGui::PopStyleVar();
-            }
+        String8 icon  = Str8C((char*)ICON_MDI_CUBE_OUTLINE);
+        auto& iconMap = m_Editor->GetComponentIconMap();
 
-            if(!active)
-                ImGui::PopStyleColor();
+        if(node.HasComponent<Camera>())
+        {
+            if(iconMap.find(typeid(Camera).hash_code()) != iconMap.end())
+                icon = Str8C((char*)iconMap[typeid(Camera).hash_code()]);
+        }
+        else if(node.HasComponent<LuaScriptComponent>())
+        {
+            if(iconMap.find(typeid(LuaScriptComponent).hash_code()) != iconMap.end())
+                icon = Str8C((char*)iconMap[typeid(LuaScriptComponent).hash_code()]);
+        }
+        else if(node.HasComponent<SoundComponent>())
+        {
+            if(iconMap.find(typeid(SoundComponent).hash_code()) != iconMap.end())
+                icon = Str8C((char*)iconMap[typeid(SoundComponent).hash_code()]);
+        }
+        else if(node.HasComponent<RigidBody2DComponent>())
+        {
+            if(iconMap.find(typeid(RigidBody2DComponent).hash_code()) != iconMap.end())
+                icon = Str8C((char*)iconMap[typeid(RigidBody2DComponent).hash_code()]);
+        }
+        else if(node.HasComponent<Graphics::Light>())
+        {
+            if(iconMap.find(typeid(Graphics::Light).hash_code()) != iconMap.end())
+                icon = Str8C((char*)iconMap[typeid(Graphics::Light).hash_code()]);
+        }
+        else if(node.HasComponent<Graphics::Environment>())
+        {
+            if(iconMap.find(typeid(Graphics::Environment).hash_code()) != iconMap.end())
+                icon = Str8C((char*)iconMap[typeid(Graphics::Environment).hash_code()]);
+        }
+        else if(node.HasComponent<Graphics::Sprite>())
+        {
+            if(iconMap.find(typeid(Graphics::Sprite).hash_code()) != iconMap.end())
+                icon = Str8C((char*)iconMap[typeid(Graphics::Sprite).hash_code()]);
+        }
+        else if(node.HasComponent<TextComponent>())
+        {
+            if(iconMap.find(typeid(TextComponent).hash_code()) != iconMap.end())
+                icon = Str8C((char*)iconMap[typeid(TextComponent).hash_code()]);
+        }
 
-            bool deleteEntity = false;
+        ImGui::PushStyleColor(ImGuiCol_Text, ImGuiUtilities::GetIconColour());
 
-            if(ImGui::BeginPopupContextItem((const char*)name.str))
+        bool nodeOpen = ImGui::TreeNodeEx((void*)(intptr_t)node.GetID(), nodeFlags, "%s", (const char*)icon.str);
+        {
+            if(ImGui::BeginDragDropSource())
             {
-                if(ImGui::Selectable("Copy"))
-                {
-                    if(!m_Editor->IsSelected(node))
-                    {
-                        m_Editor->SetCopiedEntity(node);
-                    }
-                    for(auto entity : m_Editor->GetSelected())
-                        m_Editor->SetCopiedEntity(entity);
-                }
 
-                if(ImGui::Selectable("Cut"))
+                if(!m_Editor->IsSelected(node))
                 {
-                    for(auto entity : m_Editor->GetSelected())
-                        m_Editor->SetCopiedEntity(entity, true);
+                    auto selected = node.GetHandle();
+                    ImGui::TextUnformatted(node.GetName().c_str());
+                    ImGui::SetDragDropPayload("Drag_Entity", &selected, sizeof(entt::entity));
                 }
-
-                if(m_Editor->GetCopiedEntity().size() > 0 && ((Entity)m_Editor->GetCopiedEntity().front()).Valid())
+                else
                 {
-                    if(ImGui::Selectable("Paste"))
+                    auto selected = m_Editor->GetSelected();
+                    for(auto e : selected)
                     {
-                        for(auto entity : m_Editor->GetCopiedEntity())
-                        {
-                            auto scene          = Application::Get().GetSceneManager()->GetCurrentScene();
-                            Entity copiedEntity = { entity, scene };
-                            if(!copiedEntity.Valid())
-                            {
-                                m_Editor->SetCopiedEntity(Entity());
-                            }
-                            else
-                            {
-                                scene->DuplicateEntity(copiedEntity, { node, scene });
-
-                                if(m_Editor->GetCutCopyEntity())
-                                    deleteEntity = true;
-                            }
-                        }
+                        ImGui::TextUnformatted(Entity(e, scene).GetName().c_str());
                     }
-                }
-                else
-                {
-                    ImGui::TextDisabled("Paste");
+
+                    ImGui::SetDragDropPayload("Drag_Entity", selected.data(), selected.size() * sizeof(entt::entity));
                 }
 
-                ImGui::Separator();
+                ImGui::EndDragDropSource();
+            }
 
-                if(ImGui::Selectable("Duplicate"))
-                {
-                    auto scene = Application::Get().GetSceneManager()->GetCurrentScene();
-                    scene->DuplicateEntity({ node, scene });
-                }
-                if(ImGui::Selectable("Delete"))
-                    deleteEntity = true;
-                // if(m_Editor->IsSelected(node))
-                //   m_Editor->UnSelect(node);
-                ImGui::Separator();
-                if(ImGui::Selectable("Rename"))
-                    m_DoubleClicked = node;
-                ImGui::Separator();
+            // Allow clicking of icon and text. Need twice as they are separated
+            if(ImGui::IsMouseReleased(ImGuiMouseButton_Left) && ImGui::IsItemHovered() && !ImGui::IsItemToggledOpen())
+            {
+                bool ctrlDown = Input::Get().GetKeyHeld(Lumos::InputCode::Key::LeftControl) || Input::Get().GetKeyHeld(Lumos::InputCode::Key::RightControl) || Input::Get().GetKeyHeld(Lumos::InputCode::Key::LeftSuper);
+                if(!ctrlDown)
+                    m_Editor->ClearSelected();
 
-                if(ImGui::Selectable("Add Child"))
-                {
-                    auto scene = Application::Get().GetSceneManager()->GetCurrentScene();
-                    auto child = scene->CreateEntity();
-                    child.SetParent({ node, scene });
-                }
+                if(!m_Editor->IsSelected(node))
+                    m_Editor->SetSelected(node);
+                else
+                    m_Editor->UnSelect(node);
+            }
+            else if(m_DoubleClicked == node && ImGui::IsMouseClicked(ImGuiMouseButton_Left) && !ImGui::IsItemHovered(ImGuiHoveredFlags_None))
+                m_DoubleClicked = {};
+        }
 
-                if(ImGui::Selectable("Zoom to"))
+        // Open state lives in m_OpenEntities rather than ImGui storage so closed subtrees never reach the row list
+        if(treeNode.HasChildren && !filtering && nodeOpen != wasOpen)
+            SetOpen(node, nodeOpen);
+
+        if(ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left) && ImGui::IsItemHovered(ImGuiHoveredFlags_None))
+        {
+            m_DoubleClicked = node;
+            if(Application::Get().GetEditorState() == EditorState::Preview)
+            {
+                auto transform = node.TryGetComponent<Maths::Transform>();
+                if(transform)
+                    m_Editor->FocusCamera(transform->GetWorldPosition(), 2.0f, 2.0f);
+            }
+        }
+
+        ImGui::PopStyleColor();
+        ImGui::SameLine();
+        if(!doubleClicked)
+        {
+            bool isPrefab = false;
+            if(node.HasComponent<PrefabComponent>())
+                isPrefab = true;
+            else
+            {
+                auto Parent = node.GetParent();
+                while(Parent && Parent.Valid())
                 {
-                    // if(Application::Get().GetEditorState() == EditorState::Preview)
+                    if(Parent.HasComponent<PrefabComponent>())
                     {
-                        auto transform = node.TryGetComponent<Maths::Transform>();
-                        if(transform)
-                            m_Editor->FocusCamera(transform->GetWorldPosition(), 2.0f, 2.0f);
+                        isPrefab = true;
+                        Parent   = {};
+                    }
+                    else
+                    {
+                        Parent = Parent.GetParent();
                     }
                 }
-                ImGui::EndPopup();
             }
 
-            auto scene     = Application::Get().GetSceneManager()->GetCurrentScene();
-            auto& registry = scene->GetRegistry();
+            if(isPrefab)
+                ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_CheckMark));
+            ImGui::TextUnformatted((const char*)name.str);
+            if(isPrefab)
+                ImGui::PopStyleColor();
+        }
 
-            if(ImGui::BeginDragDropTarget())
-            {
-                const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("Drag_Entity");
-                if(payload)
-                {
-                    size_t count = payload->DataSize / sizeof(entt::entity);
+        if(doubleClicked)
+        {
+            String8 nameBuffer = { 0 };
+            nameBuffer.str     = PushArray(m_StringArena, uint8_t, INPUT_BUF_SIZE);
+            nameBuffer.size    = INPUT_BUF_SIZE;
 
-                    auto currentScene = m_Editor->GetCurrentScene();
-                    for(size_t i = 0; i < count; i++)
-                    {
-                        entt::entity droppedEntityID = *(((entt::entity*)payload->Data) + i);
-                        if(droppedEntityID != node.GetHandle())
-                        {
-                            auto hierarchyComponent = registry.try_get<Hierarchy>(droppedEntityID);
-                            if(hierarchyComponent)
-                                Hierarchy::Reparent(droppedEntityID, node, registry, *hierarchyComponent);
-                            else
-                            {
-                                registry.emplace<Hierarchy>(droppedEntityID, node);
-                            }
-                        }
-                    }
+            MemoryCopy(nameBuffer.str, name.str, name.size);
 
-                    m_HadRecentDroppedEntity = node;
-                }
-                ImGui::EndDragDropTarget();
+            ImGui::PushItemWidth(-1);
+            if(ImGui::InputText("##Name", (char*)nameBuffer.str, INPUT_BUF_SIZE, 0))
+            {
+                node.GetOrAddComponent<NameComponent>((const char*)nameBuffer.str);
+                m_FilterDirty = true;
             }
+            ImGui::PopStyleVar();
+        }
 
-            if(ImGui::IsItemClicked() && !deleteEntity)
-                m_Editor->SetSelected(node);
-            else if(m_DoubleClicked == node && ImGui::IsMouseClicked(ImGuiMouseButton_Left) && !ImGui::IsItemHovered(ImGuiHoveredFlags_None))
-                m_DoubleClicked = {};
+        if(!active)
+            ImGui::PopStyleColor();
+
+        bool deleteEntity = false;
 
-            if(ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left) && ImGui::IsItemHovered(ImGuiHoveredFlags_None))
+        if(ImGui::BeginPopupContextItem((const char*)name.str))
+        {
+            if(ImGui::Selectable("Copy"))
             {
-                m_DoubleClicked = node;
-                if(Application::Get().GetEditorState() == EditorState::Preview)
+                if(!m_Editor->IsSelected(node))
                 {
-                    auto transform = node.TryGetComponent<Maths::Transform>();
-                    if(transform)
-                        m_Editor->FocusCamera(transform->GetWorldPosition(), 2.0f, 2.0f);
+                    m_Editor->SetCopiedEntity(node);
                 }
+                for(auto entity : m_Editor->GetSelected())
+                    m_Editor->SetCopiedEntity(entity);
             }
 
-            if(deleteEntity)
+            if(ImGui::Selectable("Cut"))
             {
                 for(auto entity : m_Editor->GetSelected())
-                    nodeEntity.GetScene()->DestroyEntity(Entity(entity, Application::Get().GetSceneManager()->GetCurrentScene()));
-                if(nodeOpen)
-                    ImGui::TreePop();
-
-                ImGuiUtilities::PopID();
-                return;
+                    m_Editor->SetCopiedEntity(entity, true);
             }
 
-            if(m_SelectUp)
+            if(m_Editor->GetCopiedEntity().size() > 0 && ((Entity)m_Editor->GetCopiedEntity().front()).Valid())
             {
-                if(!m_Editor->GetSelected().empty() && m_Editor->GetSelected().front() == node && m_CurrentPrevious.Valid())
+                if(ImGui::Selectable("Paste"))
                 {
-                    m_SelectUp = false;
-                    m_Editor->SetSelected(m_CurrentPrevious);
+                    for(auto entity : m_Editor->GetCopiedEntity())
+                    {
+                        Entity copiedEntity = { entity, scene };
+                        if(!copiedEntity.Valid())
+                        {
+                            m_Editor->SetCopiedEntity(Entity());
+                        }
+                        else
+                        {
+                            scene->DuplicateEntity(copiedEntity, node);
+
+                            if(m_Editor->GetCutCopyEntity())
+                                deleteEntity = true;
+                        }
+                    }
                 }
             }
-
-            if(m_SelectDown)
+            else
             {
-                if(!m_Editor->GetSelected().empty() && m_CurrentPrevious.Valid() && m_CurrentPrevious == m_Editor->GetSelected().front())
-                {
-                    m_SelectDown = false;
-                    m_Editor->SetSelected(node);
-                }
+                ImGui::TextDisabled("Paste");
             }
 
-            m_CurrentPrevious = node;
+            ImGui::Separator();
 
-#if 1
-            bool showButton = true; // hovered || !active;
-
-            if(showButton)
+            if(ImGui::Selectable("Duplicate"))
             {
-                ImGui::SameLine(ImGui::GetWindowContentRegionMax().x - ImGui::CalcTextSize(ICON_MDI_EYE).x * 2.0f);
-                ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.7f, 0.7f, 0.7f, 0.0f));
-                if(ImGui::Button(active ? ICON_MDI_EYE : ICON_MDI_EYE_OFF))
-                {
-                    auto& activeComponent = node.GetOrAddComponent<ActiveComponent>();
-
-                    activeComponent.active = !active;
-                }
-                ImGui::PopStyleColor();
+                scene->DuplicateEntity(node);
             }
-#endif
+            if(ImGui::Selectable("Delete"))
+                deleteEntity = true;
+            ImGui::Separator();
+            if(ImGui::Selectable("Rename"))
+                m_DoubleClicked = node;
+            ImGui::Separator();
 
-            if(nodeOpen == false)
+            if(ImGui::Selectable("Add Child"))
             {
-                ImGuiUtilities::PopID();
-                return;
+                auto child = scene->CreateEntity();
+                child.SetParent(node);
+                SetOpen(node, true);
             }
 
-            const ImColor TreeLineColor = ImColor(128, 128, 128, 128);
-            const float SmallOffsetX    = 6.0f * Application::Get().GetWindowDPI();
-            ImDrawList* drawList        = ImGui::GetWindowDrawList();
+            if(ImGui::Selectable("Zoom to"))
+            {
+                auto transform = node.TryGetComponent<Maths::Transform>();
+                if(transform)
+                    m_Editor->FocusCamera(transform->GetWorldPosition(), 2.0f, 2.0f);
+            }
+            ImGui::EndPopup();
+        }
 
-            ImVec2 verticalLineStart = ImGui::GetCursorScreenPos();
-            verticalLineStart.x += SmallOffsetX; // to nicely line up with the arrow symbol
-            ImVec2 verticalLineEnd = verticalLineStart;
+        auto& registry = scene->GetRegistry();
 
-            if(visible && !noChildren)
+        if(ImGui::BeginDragDropTarget())
+        {
+            const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("Drag_Entity");
+            if(payload)
             {
-                entt::entity child = hierarchyComponent->First();
-                while(child != entt::null && registry.valid(child))
-                {
-                    float HorizontalTreeLineSize = 20.0f * Application::Get().GetWindowDPI(); // chosen arbitrarily
-                    auto currentPos              = ImGui::GetCursorScreenPos();
-                    ImGui::Indent(10.0f);
+                size_t count = payload->DataSize / sizeof(entt::entity);
 
-                    auto childHerarchyComponent = registry.try_get<Hierarchy>(child);
-
-                    if(childHerarchyComponent)
+                for(size_t i = 0; i < count; i++)
+                {
+                    entt::entity droppedEntityID = *(((entt::entity*)payload->Data) + i);
+                    if(droppedEntityID != node.GetHandle())
                     {
-                        entt::entity firstChild = childHerarchyComponent->First();
-                        if(firstChild != entt::null && registry.valid(firstChild))
+                        auto hierarchyComponent = registry.try_get<Hierarchy>(droppedEntityID);
+                        if(hierarchyComponent)
+                            Hierarchy::Reparent(droppedEntityID, node, registry, *hierarchyComponent);
+                        else
                         {
-                            HorizontalTreeLineSize *= 0.4f;
+                            registry.emplace<Hierarchy>(droppedEntityID, node);
                         }
                     }
-                    auto scene = Application::Get().GetSceneManager()->GetCurrentScene();
-                    DrawNode(Entity(child, scene));
-                    ImGui::Unindent(10.0f);
+                }
 
-                    const ImRect childRect = ImRect(currentPos, currentPos + ImVec2(0.0f, ImGui::GetFontSize() + (ImGui::GetStyle().FramePadding.y * 2)));
+                m_HadRecentDroppedEntity = node;
+            }
+            ImGui::EndDragDropTarget();
+        }
 
-                    const float midpoint = (childRect.Min.y + childRect.Max.y) * 0.5f;
-                    drawList->AddLine(ImVec2(verticalLineStart.x, midpoint), ImVec2(verticalLineStart.x + HorizontalTreeLineSize, midpoint), TreeLineColor);
-                    verticalLineEnd.y = midpoint;
+        if(ImGui::IsItemClicked() && !deleteEntity)
+            m_Editor->SetSelected(node);
+        else if(m_DoubleClicked == node && ImGui::IsMouseClicked(ImGuiMouseButton_Left) && !ImGui::IsItemHovered(ImGuiHoveredFlags_None))
+            m_DoubleClicked = {};
 
-                    if(registry.valid(child))
-                    {
-                        auto hierarchyComponent = registry.try_get<Hierarchy>(child);
-                        child                   = hierarchyComponent ? hierarchyComponent->Next() : entt::null;
-                    }
-                }
+        if(deleteEntity)
+        {
+            for(auto entity : m_Editor->GetSelected())
+                scene->DestroyEntity(Entity(entity, scene));
+        }
+        else
+        {
+            ImGui::SameLine(ImGui::GetWindowContentRegionMax().x - ImGui::CalcTextSize(ICON_MDI_EYE).x * 2.0f);
+            ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.7f, 0.7f, 0.7f, 0.0f));
+            if(ImGui::Button(active ? ICON_MDI_EYE : ICON_MDI_EYE_OFF))
+            {
+                auto& activeComponent = node.GetOrAddComponent<ActiveComponent>();
+
+                activeComponent.active = !active;
             }
+            ImGui::PopStyleColor();
+        }
 
-            drawList->AddLine(verticalLineStart, verticalLineEnd, TreeLineColor);
+        ImGui::PopID();
 
-            ImGui::TreePop();
-            ImGuiUtilities::PopID();
+        if(indent > 0.0f)
+            ImGui::Unindent(indent);
+    }
+
+    void HierarchyPanel::SelectRow(int32_t direction)
+    {
+        if(m_Editor->GetSelected().empty() || m_Rows.Empty())
+            return;
+
+        entt::entity selected = m_Editor->GetSelected().front();
+        for(uint32_t row = 0; row < m_Rows.Size(); row++)
+        {
+            if(m_Nodes[m_Rows[row]].Entity != selected)
+                continue;
+
+            int32_t target = (int32_t)row + direction;
+            if(target < 0 || target >= (int32_t)m_Rows.Size())
+                return;
+
+            m_Editor->SetSelected(Entity(m_Nodes[m_Rows[target]].Entity, m_CachedScene));
+
+            // The row may be outside the clipped range, scroll so it gets drawn
+            float rowY = m_RowsStartY + target * m_RowHeight;
+            if(rowY < ImGui::GetScrollY())
+                ImGui::SetScrollY(rowY);
+            else if(rowY + m_RowHeight > ImGui::GetScrollY() + ImGui::GetWindowHeight())
+                ImGui::SetScrollY(rowY + m_RowHeight - ImGui::GetWindowHeight());
+            return;
         }
     }
 
@@ -537,10 +622,9 @@ namespace Lumos
     void HierarchyPanel::OnImGui()
     {
         LUMOS_PROFILE_FUNCTION();
-        auto flags        = ImGuiWindowFlags_NoCollapse;
-        m_CurrentPrevious = {};
-        m_SelectUp        = false;
-        m_SelectDown      = false;
+        auto flags   = ImGuiWindowFlags_NoCollapse;
+        m_SelectUp   = false;
+        m_SelectDown = false;
 
         m_SelectUp   = Input::Get().GetKeyPressed(Lumos::InputCode::Key::Up);
         m_SelectDown = Input::Get().GetKeyPressed(Lumos::InputCode::Key::Down);
@@ -791,16 +875,28 @@ ImGui::GetStyle().ChildBorderSize = backup_border_size;
 
                 auto scene = Application::Get().GetSceneManager()->GetCurrentScene();
 
-                for(auto [entity] : registry.storage<entt::entity>().each())
-                {
-                    if(registry.valid(entity))
-                    {
-                        auto hierarchyComponent = registry.try_get<Hierarchy>(entity);
+                UpdateTree(scene);
+                UpdateFilter(scene);
+                UpdateRows();
 
-                        if(!hierarchyComponent || hierarchyComponent->Parent() == entt::null)
-                            DrawNode({ entity, scene });
-                    }
+                m_IndentPerLevel = ImGui::GetStyle().IndentSpacing + 10.0f;
+                m_RowHeight      = ImGui::GetFrameHeightWithSpacing();
+                m_RowsStartY     = ImGui::GetCursorPosY();
+
+                if(m_SelectUp)
+                    SelectRow(-1);
+                else if(m_SelectDown)
+                    SelectRow(1);
+
+                // Only the rows on screen are drawn, off screen rows just advance the cursor
+                ImGuiListClipper clipper;
+                clipper.Begin((int)m_Rows.Size(), m_RowHeight);
+                while(clipper.Step())
+                {
+                    for(int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                        DrawNode(m_Rows[row], scene);
                 }
+                clipper.End();
 
                 // Only supports one scene
                 ImVec2 min_space = ImGui::GetWindowContentRegionMin();
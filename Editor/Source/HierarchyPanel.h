@@ -2,6 +2,12 @@
 
 #include "EditorPanel.h"
 #include "Core/OS/Memory.h"
+#include "Core/DataStructures/TDArray.h"
+#include "Core/DataStructures/Map.h"
+#include <entt/entity/fwd.hpp>
+#include <entt/entity/entity.hpp>
+
+struct ImVec2;
 
 namespace Lumos
 {
@@ -12,14 +18,62 @@ namespace Lumos
         HierarchyPanel();
         ~HierarchyPanel();
 
-        void DrawNode(Entity node);
         void OnImGui() override;
+        void OnNewScene(Scene* scene) override;
         bool IsParentOfEntity(Entity entity, Entity child);
 
     private:
+        static const uint32_t InvalidNode = ~0u;
+
+        enum FilterFlags : uint8_t
+        {
+            FilterMatch = 1, // The entity's own name passes the filter
+            FilterShown = 2  // The entity or one of its descendants passes
+        };
+
+        // Depth first, so a node's descendants are the nodes up to SubtreeEnd
+        struct HierarchyNode
+        {
+            entt::entity Entity;
+            uint32_t Parent;
+            uint32_t SubtreeEnd;
+            uint32_t Depth;
+            bool HasChildren;
+            bool LastChild;
+        };
+
+        // The flattened tree is only rebuilt when the scene's hierarchy version changes, the filter only
+        // re-runs when its text changes and the row list only when a node is opened or closed, so a frame
+        // with nothing changed just draws the rows the clipper says are on screen
+        void UpdateTree(Scene* scene);
+        uint32_t AddNode(entt::registry& registry, entt::entity entity, uint32_t parent, uint32_t depth);
+        void UpdateFilter(Scene* scene);
+        void UpdateRows();
+
+        void DrawNode(uint32_t nodeIndex, Scene* scene);
+        void DrawTreeLines(uint32_t nodeIndex, const ImVec2& rowStart);
+        bool IsOpen(entt::entity entity) const;
+        void SetOpen(entt::entity entity, bool open);
+        void SelectRow(int32_t direction);
+
         bool m_SelectUp;
         bool m_SelectDown;
 
         Arena* m_StringArena;
+
+        TDArray<HierarchyNode> m_Nodes;
+        TDArray<uint8_t> m_FilterFlags;
+        TDArray<uint32_t> m_Rows; // Node indices of the rows currently drawn, in order
+        FlatHashMap<uint32_t, bool> m_OpenEntities;
+        std::string m_LastFilter;
+
+        Scene* m_CachedScene   = nullptr;
+        u64 m_CachedVersion    = 0;
+        bool m_TreeDirty       = true;
+        bool m_FilterDirty     = true;
+        bool m_RowsDirty       = true;
+        float m_RowsStartY     = 0.0f;
+        float m_RowHeight      = 0.0f;
+        float m_IndentPerLevel = 0.0f;
     };
 }
@@ -41,6 +41,9 @@
 #include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/PyramidCollisionShape.h>
 #include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/CapsuleCollisionShape.h>
 #include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/HullCollisionShape.h>
+#include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/HeightFieldCollisionShape.h>
+#include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/MeshCollisionShape.h>
+#include <Lumos/Graphics/Terrain.h>
 #include <Lumos/Maths/MathsUtilities.h>
 #include <Lumos/Maths/Quaternion.h>
 #include <Lumos/Maths/Matrix4.h>
@@ -346,6 +349,53 @@ end
         }
     }
 
+    static void HeightFieldCollisionShapeInspector(Lumos::HeightFieldCollisionShape* shape, const Lumos::RigidBody3DComponent& phys, const Lumos::Graphics::ModelComponent* model)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        ImGui::AlignTextToFramePadding();
+        ImGui::TextUnformatted("Samples");
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+        ImGui::Text("%u x %u", shape->GetWidth(), shape->GetDepth());
+
+        if(ImGui::Button("Build From Terrain"))
+        {
+            const Lumos::Terrain* terrain = nullptr;
+            if(model && model->ModelRef && !model->ModelRef->GetMeshes().Empty())
+                terrain = dynamic_cast<const Lumos::Terrain*>(model->ModelRef->GetMeshes()[0].get());
+
+            if(terrain)
+            {
+                shape->BuildFromTerrain(terrain);
+                phys.GetRigidBody()->CollisionShapeUpdated();
+            }
+            else
+                LWARN("Height field needs a terrain model on the same entity");
+        }
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+    }
+
+    static void MeshCollisionShapeInspector(Lumos::MeshCollisionShape* shape, const Lumos::RigidBody3DComponent& phys, const Lumos::Graphics::ModelComponent* model)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        ImGui::AlignTextToFramePadding();
+        ImGui::TextUnformatted("Triangles");
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+        ImGui::Text("%u", shape->GetTriangleCount());
+
+        if(ImGui::Button("Build From Model"))
+        {
+            if(model && model->ModelRef && shape->BuildFromModel(model->ModelRef.get()))
+                phys.GetRigidBody()->CollisionShapeUpdated();
+            else if(!model || !model->ModelRef)
+                LWARN("Mesh collider needs a model on the same entity");
+        }
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+    }
+
     std::string CollisionShape2DTypeToString(Lumos::Shape shape)
     {
         LUMOS_PROFILE_FUNCTION();
@@ -391,6 +441,10 @@ end
             return "Capsule";
         case Lumos::CollisionShapeType::CollisionHull:
             return "Hull";
+        case Lumos::CollisionShapeType::CollisionHeightField:
+            return "HeightField";
+        case Lumos::CollisionShapeType::CollisionMesh:
+            return "Mesh";
         default:
             LERROR("Unsupported Collision shape");
             break;
@@ -412,6 +466,10 @@ end
             return Lumos::CollisionShapeType::CollisionCapsule;
         if(type == "Hull")
             return Lumos::CollisionShapeType::CollisionHull;
+        if(type == "HeightField")
+            return Lumos::CollisionShapeType::CollisionHeightField;
+        if(type == "Mesh")
+            return Lumos::CollisionShapeType::CollisionMesh;
         LERROR("Unsupported Collision shape %s", type.c_str());
         return Lumos::CollisionShapeType::CollisionSphere;
     }
@@ -605,6 +663,7 @@ end
         auto velocity        = phys.GetRigidBody()->GetLinearVelocity();
         auto elasticity      = phys.GetRigidBody()->GetElasticity();
         auto angularFactor   = phys.GetRigidBody()->GetAngularFactor();
+        auto isContinuous    = phys.GetRigidBody()->GetIsContinuous();
         auto collisionShape  = phys.GetRigidBody()->GetCollisionShape();
         auto uuid            = phys.GetRigidBody()->GetUUID();
 
@@ -650,11 +709,14 @@ end
         if(Lumos::ImGuiUtilities::Property("Angular Factor", angularFactor))
             phys.GetRigidBody()->SetAngularFactor(angularFactor);
 
+        if(Lumos::ImGuiUtilities::Property("Continuous Collision", isContinuous))
+            phys.GetRigidBody()->SetIsContinuous(isContinuous);
+
         ImGui::Columns(1);
         ImGui::Separator();
         ImGui::PopStyleVar();
 
-        const char* shapes[5]     = { "Sphere", "Cuboid", "Pyramid", "Capsule", "Hull" };
+        const char* shapes[7]     = { "Sphere", "Cuboid", "Pyramid", "Capsule", "Hull", "HeightField", "Mesh" };
         int selectedIndex         = 0;
         const char* shape_current = collisionShape ? CollisionShapeTypeToString(collisionShape->GetType()) : "";
         int index                 = 0;
@@ -668,7 +730,7 @@ end
             index++;
         }
 
-        bool updated = Lumos::ImGuiUtilities::PropertyDropdown("Collision Shape", shapes, 5, &selectedIndex);
+        bool updated = Lumos::ImGuiUtilities::PropertyDropdown("Collision Shape", shapes, 7, &selectedIndex);
 
         if(updated)
             phys.GetRigidBody()->SetCollisionShape(StringToCollisionShapeType(shapes[selectedIndex]));
@@ -692,6 +754,12 @@ end
             case Lumos::CollisionShapeType::CollisionHull:
                 HullCollisionShapeInspector(reinterpret_cast<Lumos::HullCollisionShape*>(collisionShape.get()), phys);
                 break;
+            case Lumos::CollisionShapeType::CollisionHeightField:
+                HeightFieldCollisionShapeInspector(reinterpret_cast<Lumos::HeightFieldCollisionShape*>(collisionShape.get()), phys, reg.try_get<Lumos::Graphics::ModelComponent>(e));
+                break;
+            case Lumos::CollisionShapeType::CollisionMesh:
+                MeshCollisionShapeInspector(reinterpret_cast<Lumos::MeshCollisionShape*>(collisionShape.get()), phys, reg.try_get<Lumos::Graphics::ModelComponent>(e));
+                break;
             default:
                 ImGui::NextColumn();
                 ImGui::PushItemWidth(-1);
@@ -851,6 +919,7 @@ end
         auto volume            = soundNode->GetVolume();
         auto referenceDistance = soundNode->GetReferenceDistance();
         auto rollOffFactor     = soundNode->GetRollOffFactor();
+        auto priority          = soundNode->GetPriority();
 
         ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(2, 2));
         ImGui::Columns(2);
@@ -898,6 +967,15 @@ end
             updated = true;
         }
 
+        if(Lumos::ImGuiUtilities::Property("Priority", priority, 0, 255))
+        {
+            soundNode->SetPriority(priority);
+            updated = true;
+        }
+
+        bool isVirtual = soundNode->IsVirtual();
+        Lumos::ImGuiUtilities::Property("Virtual", isVirtual, Lumos::ImGuiUtilities::PropertyFlag::ReadOnly);
+
         ImGui::Separator();
         auto soundPointer = soundNode->GetSound();
 
@@ -18,6 +18,9 @@
 #include <Lumos/ImGui/ImGuiManager.h>
 #include <Lumos/Core/Thread.h>
 #include <Lumos/Core/Asset/AssetManager.h>
+#include <Lumos/Utilities/LoadImage.h>
+#include <Lumos/Utilities/CombineHash.h>
+#include <stb_image_write.h>
 
 #ifdef LUMOS_PLATFORM_WINDOWS
 #include <Windows.h>
@@ -97,6 +100,11 @@ namespace Lumos
         { FileType::Audio, ICON_MDI_MICROPHONE },
     };
 
+    static const uint32_t ThumbnailSize         = 128;
+    static const uint32_t MaxThumbnailsInFlight = 8;
+    static const double ThumbnailRetryDelay     = 2.0;
+    static const float DirectoryPollInterval    = 1.0f;
+
     ResourcePanel::ResourcePanel()
     {
         LUMOS_PROFILE_FUNCTION();
@@ -121,12 +129,9 @@ namespace Lumos
         FileSystem::Get().ResolvePhysicalPath("//Assets", assetsBasePath);
         m_AssetPath = PushStr8Copy(m_Arena, Str8C((char*)std::filesystem::path(assetsBasePath).string().c_str()));
 
-        String8 baseDirectoryHandle = ProcessDirectory(m_BasePath, nullptr, true);
-        m_BaseProjectDir            = m_Directories[baseDirectoryHandle];
+        m_BaseProjectDir = AddEntry(Str8Lit("//Assets"), nullptr, false);
         ChangeDirectory(m_BaseProjectDir);
 
-        m_CurrentDir = m_BaseProjectDir;
-
         m_UpdateNavigationPath = true;
         m_IsDragging           = false;
         m_IsInListView         = false;
@@ -145,6 +150,24 @@ namespace Lumos
         m_Refresh     = false;
     }
 
+    ResourcePanel::~ResourcePanel()
+    {
+        System::JobSystem::Wait(m_IndexContext);
+        System::JobSystem::Wait(m_PollContext);
+        System::JobSystem::Wait(m_ThumbnailContext);
+
+        for(DirectoryIndex* index : m_CompletedIndices)
+            delete index;
+
+        for(ThumbnailRequest* request : m_CompletedThumbnails)
+        {
+            delete[] request->Pixels;
+            delete request;
+        }
+
+        ArenaRelease(m_Arena);
+    }
+
     void ResourcePanel::ChangeDirectory(DirectoryInformation* directory)
     {
         if(!directory)
@@ -155,22 +178,32 @@ namespace Lumos
         m_UpdateNavigationPath = true;
 
         if(!m_CurrentDir->Opened)
-        {
-            ProcessDirectory(m_CurrentDir->AssetPath, m_CurrentDir->Parent, true);
-        }
+            RequestIndex(m_CurrentDir);
     }
 
     void ResourcePanel::RemoveDirectory(DirectoryInformation* directory, bool removeFromParent)
     {
         if(directory->Parent && removeFromParent)
         {
-            directory->Parent->Children.Clear();
+            directory->Parent->Children.RemoveIf([directory](DirectoryInformation* child)
+                                                 { return child == directory; });
         }
 
         for(auto& subdir : directory->Children)
             RemoveDirectory(subdir, false);
 
-        m_Directories.erase(m_Directories.find(directory->AssetPath));
+        // ApplyIndex moves the panel back to the folder being listed if the current one was removed
+        if(m_CurrentDir == directory)
+            m_CurrentDir = nullptr;
+        if(m_PreviousDirectory == directory)
+            m_PreviousDirectory = nullptr;
+        if(m_CurrentSelected == directory)
+            m_CurrentSelected = nullptr;
+        m_UpdateNavigationPath = true;
+
+        auto found = m_Directories.find(directory->AssetPath);
+        if(found != m_Directories.end())
+            m_Directories.erase(found);
     }
 
     bool IsHidden(const std::filesystem::path& filePath)
@@ -189,80 +222,424 @@ namespace Lumos
         return false; // Return false by default if any error occurs
     }
 
-    String8 ResourcePanel::ProcessDirectory(String8 directoryPath, DirectoryInformation* parent, bool processChildren)
+    static int64_t GetModifiedTime(const std::filesystem::path& path)
     {
-        const auto& directory = m_Directories[directoryPath];
-        if(directory && directory->Opened)
-            return directory->AssetPath;
+        std::error_code error;
+        auto time = std::filesystem::last_write_time(path, error);
+        return error ? 0 : (int64_t)time.time_since_epoch().count();
+    }
 
-        ArenaTemp temp       = ScratchBegin(&m_Arena, 1);
-        String8 absolutePath = StringUtilities::RelativeToAbsolutePath(temp.arena, directoryPath, Str8Lit("//Assets"), m_BasePath);
-        auto stdPath         = std::filesystem::path(std::string((const char*)absolutePath.str, absolutePath.size));
+    static FileType GetFileType(String8 assetPath)
+    {
+        String8 extension      = StringUtilities::Str8PathSkipLastPeriod(assetPath);
+        const auto& fileTypeIt = s_FileTypes.find(std::string((const char*)extension.str, extension.size));
+        return fileTypeIt != s_FileTypes.end() ? fileTypeIt->second : FileType::Unknown;
+    }
 
-        SharedPtr<DirectoryInformation> directoryInfo = directory ? directory : CreateSharedPtr<DirectoryInformation>(directoryPath, !std::filesystem::is_directory(stdPath));
-        directoryInfo->Parent                         = parent;
+    // Runs on a worker, so it only touches the filesystem and the index it was given
+    static void IndexDirectory(DirectoryIndex& index)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        std::filesystem::path path(index.AbsolutePath);
+        index.ModifiedTime = GetModifiedTime(path);
+
+        if(index.CheckModifiedTime && index.ModifiedTime == index.KnownModifiedTime)
+        {
+            index.Unchanged = true;
+            return;
+        }
 
-        // TODO: create paths at max size and use free list
-        directoryInfo->AssetPath = StringUtilities::AbsolutePathToRelativeFileSystemPath(m_Arena, directoryPath, m_BasePath, Str8Lit("//Assets"));
+        uint64_t hash = 0;
+        try
+        {
+            for(auto& entry : std::filesystem::directory_iterator(path))
+            {
+                bool hidden = IsHidden(entry.path());
+                if(!index.ShowHidden && hidden)
+                    continue;
 
-        String8 extension = StringUtilities::Str8PathSkipLastPeriod(directoryInfo->AssetPath);
+                std::error_code error;
+                DirectoryIndexEntry& indexed = index.Entries.EmplaceBack();
+                indexed.Path                 = entry.path().generic_string();
+                indexed.IsDirectory          = entry.is_directory(error);
+                indexed.Hidden               = hidden;
+                indexed.ModifiedTime         = GetModifiedTime(entry.path());
 
+                if(!indexed.IsDirectory)
+                {
+                    uint64_t fileSize = entry.file_size(error);
+                    indexed.FileSize  = error ? 0 : fileSize;
+                }
+                else
+                {
+                    // Folders without subfolders are drawn as leaves in the tree
+                    for(auto& child : std::filesystem::directory_iterator(entry.path(), error))
+                    {
+                        if(child.is_directory(error))
+                        {
+                            indexed.HasSubdirectories = true;
+                            break;
+                        }
+                    }
+                }
+
+                HashCombine(hash, indexed.Path, indexed.ModifiedTime, indexed.FileSize);
+            }
+        }
+        catch(const std::filesystem::filesystem_error& ex)
+        {
+            LERROR("Error indexing directory: %s", ex.what());
+        }
+
+        index.ContentHash = hash;
+    }
+
+    // The loader scales images larger than the thumbnail size down while decoding
+    static bool LoadThumbnailImage(const std::string& path, ThumbnailRequest& request)
+    {
+        ImageLoadDesc desc = {};
+        desc.filePath      = path.c_str();
+        desc.maxWidth      = ThumbnailSize;
+        desc.maxHeight     = ThumbnailSize;
+
+        if(!LoadImageFromFile(desc) || desc.isHDR)
+        {
+            delete[] desc.outPixels;
+            return false;
+        }
+
+        request.Pixels = desc.outPixels;
+        request.Width  = desc.outWidth;
+        request.Height = desc.outHeight;
+        return true;
+    }
+
+    // Runs on a worker. A thumbnail cached for this write time of the asset is read back directly, otherwise it is
+    // made from the source image and written to the cache for the next session
+    static void GenerateThumbnail(ThumbnailRequest& request)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        std::error_code error;
+        if(!request.StaleCachePath.empty())
+            std::filesystem::remove(request.StaleCachePath, error);
+
+        if(std::filesystem::exists(request.CachePath, error) && LoadThumbnailImage(request.CachePath, request))
+            return;
+
+        std::filesystem::path sourcePath(request.SourcePath);
+        if(!std::filesystem::exists(sourcePath, error) || (request.RequiresFreshSource && GetModifiedTime(sourcePath) < request.AssetModifiedTime))
+        {
+            request.SourceMissing = true;
+            return;
+        }
+
+        if(!LoadThumbnailImage(request.SourcePath, request))
+            return;
+
+        std::filesystem::create_directories(std::filesystem::path(request.CachePath).parent_path(), error);
+        if(!stbi_write_png(request.CachePath.c_str(), (int)request.Width, (int)request.Height, 4, request.Pixels, (int)request.Width * 4))
+            LWARN("Failed to write thumbnail cache %s", request.CachePath.c_str());
+    }
+
+    DirectoryInformation* ResourcePanel::AddEntry(String8 assetPath, DirectoryInformation* parent, bool isFile)
+    {
+        SharedPtr<DirectoryInformation> entry = CreateSharedPtr<DirectoryInformation>(PushStr8Copy(m_Arena, assetPath), isFile);
+        entry->Parent                         = parent;
+        entry->Hidden                         = Str8Match(entry->AssetPath, Str8Lit("//Assets/Cache"));
+        m_Directories[entry->AssetPath]       = entry;
+        return entry.get();
+    }
+
+    void ResourcePanel::RequestIndex(DirectoryInformation* directory)
+    {
+        if(!directory || directory->IsFile || directory->Indexing)
+            return;
+
+        ArenaTemp temp       = ScratchBegin(&m_Arena, 1);
+        String8 absolutePath = StringUtilities::RelativeToAbsolutePath(temp.arena, directory->AssetPath, Str8Lit("//Assets"), m_BasePath);
+
+        DirectoryIndex* index = new DirectoryIndex();
+        index->AssetPath      = ToStdString(directory->AssetPath);
+        index->AbsolutePath   = ToStdString(absolutePath);
+        index->ShowHidden     = m_ShowHiddenFiles;
+        index->Generation     = m_IndexGeneration;
         ScratchEnd(temp);
 
-        if(std::filesystem::is_directory(stdPath))
+        directory->Indexing = true;
+        System::JobSystem::Execute(m_IndexContext, [this, index](JobDispatchArgs args)
+                                   {
+                                       IndexDirectory(*index);
+                                       std::scoped_lock<std::mutex> lock(m_CompletedMutex);
+                                       m_CompletedIndices.PushBack(index); });
+    }
+
+    void ResourcePanel::ApplyIndex(DirectoryIndex& index)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        auto found = m_Directories.find(Str8StdS(index.AssetPath));
+        if(found == m_Directories.end() || !found->second)
+            return;
+
+        DirectoryInformation* directory = found->second.get();
+        directory->Indexing             = false;
+        directory->ModifiedTime         = index.ModifiedTime;
+
+        if(index.Unchanged || (directory->Opened && directory->ContentHash == index.ContentHash))
+            return;
+
+        directory->ContentHash = index.ContentHash;
+        directory->Opened      = true;
+        directory->Leaf        = true;
+        m_IndexStamp++;
+
+        ArenaTemp temp = ScratchBegin(&m_Arena, 1);
+
+        // Entries still on disk are kept with their thumbnails and listings, only new paths are allocated
+        TDArray<String8> assetPaths(index.Entries.Size());
+        TDArray<DirectoryInformation*> entries(index.Entries.Size(), nullptr);
+        for(size_t i = 0; i < index.Entries.Size(); i++)
         {
-            directoryInfo->IsFile = false;
-            directoryInfo->Leaf   = true;
-            for(auto& entry : std::filesystem::directory_iterator(stdPath))
+            assetPaths[i] = StringUtilities::AbsolutePathToRelativeFileSystemPath(temp.arena, Str8StdS(index.Entries[i].Path), m_BasePath, Str8Lit("//Assets"));
+
+            auto existing = m_Directories.find(assetPaths[i]);
+            if(existing != m_Directories.end() && existing->second && existing->second->Parent == directory && existing->second->IsFile != index.Entries[i].IsDirectory)
+            {
+                entries[i]             = existing->second.get();
+                entries[i]->IndexStamp = m_IndexStamp;
+            }
+        }
+
+        TDArray<DirectoryInformation*> previousChildren = std::move(directory->Children);
+        directory->Children.Clear();
+        for(DirectoryInformation* child : previousChildren)
+        {
+            if(child->IndexStamp != m_IndexStamp)
+                RemoveDirectory(child, false);
+        }
+
+        for(size_t i = 0; i < index.Entries.Size(); i++)
+        {
+            const DirectoryIndexEntry& indexed = index.Entries[i];
+            DirectoryInformation* entry        = entries[i] ? entries[i] : AddEntry(assetPaths[i], directory, !indexed.IsDirectory);
+            entry->Hidden                      = indexed.Hidden || Str8Match(entry->AssetPath, Str8Lit("//Assets/Cache"));
+
+            if(indexed.IsDirectory)
             {
-                if(!m_ShowHiddenFiles && IsHidden(entry.path()))
+                // The folder's own write time is only set when it is listed, so the poll still notices changes inside it
+                entry->Leaf     = !indexed.HasSubdirectories;
+                directory->Leaf = false;
+            }
+            else
+            {
+                // Cached thumbnails are keyed by write time, so an edited file gets a new one
+                if(entry->ModifiedTime != indexed.ModifiedTime)
                 {
+                    // Any thumbnail requested for the old write time has a cache file nothing will read again
+                    if(entry->ThumbnailStatus != ThumbnailState::None)
+                        entry->StaleThumbnailTime = entry->ModifiedTime;
+
+                    entry->Thumbnail.reset();
+                    entry->ThumbnailStatus    = ThumbnailState::None;
+                    entry->ThumbnailRetryTime = 0.0;
+                }
+
+                entry->ModifiedTime = indexed.ModifiedTime;
+                entry->Type         = GetFileType(entry->AssetPath);
+                entry->FileSize     = indexed.FileSize;
+                entry->Opened       = true;
+                entry->Leaf         = true;
+
+                ImVec4 fileTypeColor        = { 1.0f, 1.0f, 1.0f, 1.0f };
+                const auto& fileTypeColorIt = s_TypeColors.find(entry->Type);
+                if(fileTypeColorIt != s_TypeColors.end())
+                    fileTypeColor = fileTypeColorIt->second;
+
+                entry->FileTypeColour = fileTypeColor;
+            }
+
+            directory->Children.PushBack(entry);
+        }
+
+        ScratchEnd(temp);
+
+        if(!m_CurrentDir)
+            ChangeDirectory(directory);
+
+        // After the index is rebuilt, list the folders down to the one that was open before
+        if(!m_PendingDirectoryPath.empty())
+        {
+            for(DirectoryInformation* child : directory->Children)
+            {
+                if(child->IsFile)
                     continue;
+
+                std::string childPath = ToStdString(child->AssetPath);
+                if(m_PendingDirectoryPath == childPath)
+                {
+                    m_PendingDirectoryPath.clear();
+                    ChangeDirectory(child);
+                    break;
                 }
 
-                if(Str8Match(directoryInfo->AssetPath, Str8Lit("//Assets/Cache")))
+                if(m_PendingDirectoryPath.compare(0, childPath.size() + 1, childPath + "/") == 0)
                 {
-                    directoryInfo->Hidden = true;
-                    continue;
+                    RequestIndex(child);
+                    break;
                 }
+            }
+        }
+    }
+
+    void ResourcePanel::ProcessCompletedJobs()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        TDArray<DirectoryIndex*> indices;
+        TDArray<ThumbnailRequest*> thumbnails;
+        {
+            std::scoped_lock<std::mutex> lock(m_CompletedMutex);
+            indices    = std::move(m_CompletedIndices);
+            thumbnails = std::move(m_CompletedThumbnails);
+        }
+
+        // Results from before a project change belong to entries that no longer exist
+        for(DirectoryIndex* index : indices)
+        {
+            if(index->Generation == m_IndexGeneration)
+                ApplyIndex(*index);
+            delete index;
+        }
 
-                if(entry.is_directory())
-                    directoryInfo->Leaf = false;
+        for(ThumbnailRequest* request : thumbnails)
+        {
+            m_ThumbnailsInFlight--;
 
-                if(processChildren)
+            auto found = request->Generation == m_IndexGeneration ? m_Directories.find(Str8StdS(request->AssetPath)) : m_Directories.end();
+            if(found != m_Directories.end() && found->second && found->second->ModifiedTime == request->AssetModifiedTime)
+            {
+                DirectoryInformation* entry = found->second.get();
+                if(request->Pixels)
                 {
-                    directoryInfo->Opened = true;
+                    Graphics::TextureDesc desc;
+                    desc.minFilter = Graphics::TextureFilter::LINEAR;
+                    desc.magFilter = Graphics::TextureFilter::LINEAR;
+                    desc.wrap      = Graphics::TextureWrap::CLAMP;
 
-                    String8 subdirHandle = ProcessDirectory(PushStr8Copy(m_Arena, Str8C((char*)entry.path().generic_string().c_str())), directoryInfo, false);
-                    directoryInfo->Children.PushBack(m_Directories[subdirHandle].get());
+                    entry->Thumbnail       = SharedPtr<Graphics::Texture2D>(Graphics::Texture2D::CreateFromSource(request->Width, request->Height, request->Pixels, desc));
+                    entry->ThumbnailStatus = ThumbnailState::Ready;
                 }
+                else if(request->SourceMissing)
+                {
+                    // Models and materials need a preview rendered by the editor first, which only does one at a time
+                    if(entry->Type == FileType::Model || entry->Type == FileType::Material)
+                        m_Editor->RequestThumbnail(entry->AssetPath);
+
+                    entry->ThumbnailStatus    = ThumbnailState::None;
+                    entry->ThumbnailRetryTime = ImGui::GetTime() + ThumbnailRetryDelay;
+                }
+                else
+                    entry->ThumbnailStatus = ThumbnailState::Failed;
             }
+
+            delete[] request->Pixels;
+            delete request;
         }
-        else
+    }
+
+    void ResourcePanel::PollDirectories()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_PollTimer += ImGui::GetIO().DeltaTime;
+        if(m_PollTimer < DirectoryPollInterval || System::JobSystem::IsBusy(m_PollContext))
+            return;
+
+        m_PollTimer = 0.0f;
+        m_PollRequests.Clear();
+
+        // A folder's write time changes when entries are added, removed or renamed, so most folders cost a single
+        // stat. The current folder is always listed so files edited in place are picked up too
+        ArenaTemp temp = ScratchBegin(&m_Arena, 1);
+        for(auto& [path, directory] : m_Directories)
         {
-            auto fileType          = FileType::Unknown;
-            const auto& fileTypeIt = s_FileTypes.find(std::string((const char*)extension.str, extension.size));
-            if(fileTypeIt != s_FileTypes.end())
-                fileType = fileTypeIt->second;
-
-            directoryInfo->IsFile   = true;
-            directoryInfo->Type     = fileType;
-            directoryInfo->FileSize = std::filesystem::exists(stdPath) ? std::filesystem::file_size(stdPath) : 0;
-            directoryInfo->Hidden   = std::filesystem::exists(stdPath) ? IsHidden(stdPath) : true;
-            directoryInfo->Opened   = true;
-            directoryInfo->Leaf     = true;
-
-            ImVec4 fileTypeColor        = { 1.0f, 1.0f, 1.0f, 1.0f };
-            const auto& fileTypeColorIt = s_TypeColors.find(fileType);
-            if(fileTypeColorIt != s_TypeColors.end())
-                fileTypeColor = fileTypeColorIt->second;
-
-            directoryInfo->FileTypeColour = fileTypeColor;
+            if(!directory || directory->IsFile || !directory->Opened || directory->Indexing || directory->Hidden)
+                continue;
+
+            DirectoryIndex* index    = new DirectoryIndex();
+            index->AssetPath         = ToStdString(directory->AssetPath);
+            index->AbsolutePath      = ToStdString(StringUtilities::RelativeToAbsolutePath(temp.arena, directory->AssetPath, Str8Lit("//Assets"), m_BasePath));
+            index->KnownModifiedTime = directory->ModifiedTime;
+            index->CheckModifiedTime = directory.get() != m_CurrentDir;
+            index->ShowHidden        = m_ShowHiddenFiles;
+            index->Generation        = m_IndexGeneration;
+
+            directory->Indexing = true;
+            m_PollRequests.PushBack(index);
         }
+        ScratchEnd(temp);
 
-        if(!directory)
-            m_Directories[directoryInfo->AssetPath] = directoryInfo;
-        return directoryInfo->AssetPath;
+        if(m_PollRequests.Empty())
+            return;
+
+        System::JobSystem::Dispatch(m_PollContext, (uint32_t)m_PollRequests.Size(), 8, [this](JobDispatchArgs args)
+                                    {
+                                        DirectoryIndex* index = m_PollRequests[args.jobIndex];
+                                        IndexDirectory(*index);
+                                        std::scoped_lock<std::mutex> lock(m_CompletedMutex);
+                                        m_CompletedIndices.PushBack(index); });
+    }
+
+    void ResourcePanel::RequestThumbnail(DirectoryInformation* entry)
+    {
+        if(entry->ThumbnailStatus != ThumbnailState::None || m_ThumbnailsInFlight >= MaxThumbnailsInFlight || ImGui::GetTime() < entry->ThumbnailRetryTime)
+            return;
+
+        ArenaTemp temp             = ScratchBegin(&m_Arena, 1);
+        ThumbnailRequest* request  = new ThumbnailRequest();
+        request->AssetPath         = ToStdString(entry->AssetPath);
+        request->AssetModifiedTime = entry->ModifiedTime;
+        request->Generation        = m_IndexGeneration;
+
+        switch(entry->Type)
+        {
+        case FileType::Texture:
+        {
+            request->SourcePath = ToStdString(StringUtilities::RelativeToAbsolutePath(temp.arena, entry->AssetPath, Str8Lit("//Assets"), m_BasePath));
+            break;
+        }
+        case FileType::Scene:
+        {
+            String8 fileName    = PushStr8Copy(temp.arena, StringUtilities::GetFileName(entry->AssetPath));
+            request->SourcePath = ToStdString(PushStr8F(temp.arena, "%s/Scenes/Cache/%s.png", (const char*)m_BasePath.str, (const char*)fileName.str));
+            break;
+        }
+        default:
+        {
+            String8 thumbnailPath;
+            String8 thumbnailAssetPath;
+            CreateThumbnailPath(temp.arena, entry, thumbnailAssetPath, thumbnailPath);
+
+            request->SourcePath          = ToStdString(thumbnailPath);
+            request->RequiresFreshSource = true;
+            break;
+        }
+        }
+
+        // Named <path>_<write time> with a hash that is stable between runs, so a session finds the previous one's
+        // thumbnails and a rewritten asset's old thumbnail can be found and replaced
+        uint64_t pathHash  = StringUtilities::BasicHashFromString(entry->AssetPath);
+        request->CachePath = ToStdString(PushStr8F(temp.arena, "%s/Cache/Thumbnails/%016llx_%016llx.png", (const char*)m_BasePath.str, (unsigned long long)pathHash, (unsigned long long)request->AssetModifiedTime));
+        if(entry->StaleThumbnailTime != 0 && entry->StaleThumbnailTime != entry->ModifiedTime)
+            request->StaleCachePath = ToStdString(PushStr8F(temp.arena, "%s/Cache/Thumbnails/%016llx_%016llx.png", (const char*)m_BasePath.str, (unsigned long long)pathHash, (unsigned long long)entry->StaleThumbnailTime));
+        entry->StaleThumbnailTime = 0;
+        ScratchEnd(temp);
+
+        entry->ThumbnailStatus = ThumbnailState::Pending;
+        m_ThumbnailsInFlight++;
+
+        System::JobSystem::Execute(m_ThumbnailContext, [this, request](JobDispatchArgs args)
+                                   {
+                                       GenerateThumbnail(*request);
+                                       std::scoped_lock<std::mutex> lock(m_CompletedMutex);
+                                       m_CompletedThumbnails.PushBack(request); });
     }
 
     void ResourcePanel::DrawFolder(DirectoryInformation* dirInfo, bool defaultOpen)
@@ -289,6 +666,9 @@ namespace Lumos
             nodeFlags |= ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_AllowOverlap | ImGuiTreeNodeFlags_SpanAvailWidth;
 
             bool isOpen = ImGui::TreeNodeEx((void*)(intptr_t)(dirInfo), nodeFlags, "");
+            if(isOpen && !dirInfo->Leaf && !dirInfo->Opened)
+                RequestIndex(dirInfo);
+
             if(ImGui::IsItemClicked())
             {
                 ChangeDirectory(dirInfo);
@@ -367,6 +747,9 @@ namespace Lumos
             bool vertical    = windowSize.y > windowSize.x;
             static bool Init = false;
 
+            ProcessCompletedJobs();
+            PollDirectories();
+
             if(m_Refresh)
             {
                 Refresh();
@@ -635,8 +1018,6 @@ namespace Lumos
                         m_GridItemsPerRow = (int)floor(xAvail / (m_GridSize + ImGui::GetStyle().ItemSpacing.x));
                         m_GridItemsPerRow = Maths::Max(1, m_GridItemsPerRow);
 
-                        textureCreated = false;
-
                         ImGuiUtilities::PushID();
 
                         if(m_IsInListView)
@@ -838,79 +1219,14 @@ namespace Lumos
                 switch(CurrentEnty->Type)
                 {
                 case FileType::Texture:
-                {
-                    if(CurrentEnty->Thumbnail)
-                    {
-                        textureId = CurrentEnty->Thumbnail;
-                    }
-                    else if(!textureCreated)
-                    {
-                        textureCreated              = true;
-                        std::string assetPathString = std::string((const char*)CurrentEnty->AssetPath.str, CurrentEnty->AssetPath.size);
-                        if(!m_Editor->GetAssetManager()->AssetExists(assetPathString))
-                            CurrentEnty->Thumbnail = m_Editor->GetAssetManager()->LoadTextureAsset(assetPathString, true);
-                        else
-                            CurrentEnty->Thumbnail = m_Editor->GetAssetManager()->GetAssetData(assetPathString).As<Graphics::Texture2D>();
-                        textureId = CurrentEnty->Thumbnail ? CurrentEnty->Thumbnail : m_FileIcon;
-                    }
-                    break;
-                }
                 case FileType::Scene:
-                {
-                    ArenaTemp scratch                       = ArenaTempBegin(m_Arena);
-                    String8 fileName                        = PushStr8Copy(scratch.arena, StringUtilities::GetFileName(CurrentEnty->AssetPath));
-                    String8 sceneScreenShotPath             = PushStr8F(scratch.arena, "%s/Scenes/Cache/%s.png", (const char*)m_BasePath.str, (const char*)fileName.str);
-                    std::string sceneScreenShotPathtdString = std::string((const char*)sceneScreenShotPath.str, sceneScreenShotPath.size);
-                    if(std::filesystem::exists(std::filesystem::path(sceneScreenShotPathtdString)))
-                    {
-                        textureCreated                   = true;
-                        String8 sceneScreenShotAssetPath = PushStr8F(scratch.arena, "%s/Scenes/Cache/%s.png", (const char*)Str8Lit("//Assets").str, (const char*)fileName.str);
-
-                        if(!m_Editor->GetAssetManager()->AssetExists(std::string((const char*)sceneScreenShotAssetPath.str, sceneScreenShotAssetPath.size)))
-                            CurrentEnty->Thumbnail = m_Editor->GetAssetManager()->LoadTextureAsset(std::string((const char*)sceneScreenShotAssetPath.str, sceneScreenShotAssetPath.size), true);
-                        else
-                            CurrentEnty->Thumbnail = m_Editor->GetAssetManager()->GetAssetData(std::string((const char*)sceneScreenShotAssetPath.str, sceneScreenShotAssetPath.size)).As<Graphics::Texture2D>();
-                        textureId = CurrentEnty->Thumbnail ? CurrentEnty->Thumbnail : m_FileIcon;
-                    }
-                    ArenaTempEnd(scratch);
-                    break;
-                }
                 case FileType::Material:
                 case FileType::Model:
                 {
                     if(CurrentEnty->Thumbnail)
-                    {
                         textureId = CurrentEnty->Thumbnail;
-                    }
-                    else if(!textureCreated)
-                    {
-                        textureCreated    = true;
-                        ArenaTemp scratch = ArenaTempBegin(m_Arena);
-
-                        String8 thumbnailPath;
-                        String8 thumbnailAssetPath;
-                        CreateThumbnailPath(scratch.arena, CurrentEnty, thumbnailAssetPath, thumbnailPath);
-
-                        std::string thumbnailpathStdString = std::string((const char*)thumbnailPath.str, thumbnailPath.size);
-                        if(std::filesystem::exists(std::filesystem::path(thumbnailpathStdString)))
-                        {
-                            std::string thumbnailAssetPathStdString = std::string((const char*)thumbnailAssetPath.str, thumbnailAssetPath.size);
-
-                            textureCreated = true;
-                            if(!m_Editor->GetAssetManager()->AssetExists(thumbnailpathStdString))
-                                CurrentEnty->Thumbnail = m_Editor->GetAssetManager()->LoadTextureAsset(thumbnailAssetPathStdString, true);
-                            else
-                                CurrentEnty->Thumbnail = m_Editor->GetAssetManager()->GetAssetData(thumbnailAssetPathStdString).As<Graphics::Texture2D>();
-                            textureId = CurrentEnty->Thumbnail ? CurrentEnty->Thumbnail : m_FileIcon;
-                        }
-                        else
-                        {
-                            m_Editor->RequestThumbnail(CurrentEnty->AssetPath);
-                            textureId = m_FileIcon;
-                        }
-
-                        ArenaTempEnd(scratch);
-                    }
+                    else
+                        RequestThumbnail(CurrentEnty);
                     break;
                 }
                 default:
@@ -1190,39 +1506,43 @@ namespace Lumos
 
     void ResourcePanel::Refresh()
     {
-        ArenaTemp temp      = ScratchBegin(&m_Arena, 1);
-        String8 currentPath = PushStr8Copy(temp.arena, m_CurrentDir->AssetPath);
+        ArenaTemp temp   = ScratchBegin(&m_Arena, 1);
+        String8 basePath = PushStr8F(temp.arena, "%sAssets", Application::Get().GetProjectSettings().m_ProjectRoot.c_str());
+        bool newProject  = !Str8Match(basePath, m_BasePath);
+        ScratchEnd(temp);
 
-        ArenaClear(m_Arena);
-        m_Directories.clear();
+        if(newProject)
+        {
+            ResetIndex();
+            return;
+        }
 
-        m_BasePath                  = PushStr8F(m_Arena, "%sAssets", Application::Get().GetProjectSettings().m_ProjectRoot.c_str());
-        String8 baseDirectoryHandle = ProcessDirectory(m_BasePath, nullptr, true);
-        m_BaseProjectDir            = m_Directories[baseDirectoryHandle];
-        ChangeDirectory(m_BaseProjectDir);
+        for(auto& [path, directory] : m_Directories)
+        {
+            if(directory && !directory->IsFile && directory->Opened && !directory->Hidden)
+                RequestIndex(directory.get());
+        }
+    }
 
-        m_UpdateNavigationPath = true;
+    void ResourcePanel::ResetIndex()
+    {
+        // Jobs still running for the old project are dropped by generation when they complete
+        m_PendingDirectoryPath = m_CurrentDir ? ToStdString(m_CurrentDir->AssetPath) : std::string();
+        m_IndexGeneration++;
 
-        m_BaseProjectDir    = m_Directories[baseDirectoryHandle];
-        m_PreviousDirectory = nullptr;
+        ArenaClear(m_Arena);
+        m_Directories.clear();
+        m_BreadCrumbData.Clear();
         m_CurrentDir        = nullptr;
+        m_PreviousDirectory = nullptr;
+        m_CurrentSelected   = nullptr;
 
-        bool dirFound = false;
-        for(auto dir : m_Directories)
-        {
-            if(Str8Match(dir.first, currentPath))
-            {
-                m_CurrentDir = dir.second;
-                dirFound     = true;
-                break;
-            }
-        }
-        if(!dirFound)
-            ChangeDirectory(m_BaseProjectDir);
-        else
-            ChangeDirectory(m_CurrentDir);
+        m_BasePath       = PushStr8F(m_Arena, "%sAssets", Application::Get().GetProjectSettings().m_ProjectRoot.c_str());
+        m_BaseProjectDir = AddEntry(Str8Lit("//Assets"), nullptr, false);
+        ChangeDirectory(m_BaseProjectDir);
 
-        ScratchEnd(temp);
+        if(m_PendingDirectoryPath == "//Assets")
+            m_PendingDirectoryPath.clear();
     }
 
     void ResourcePanel::CreateThumbnailPath(Arena* arena, DirectoryInformation* directoryInfo, String8& assetPath, String8& AbsolutePath)
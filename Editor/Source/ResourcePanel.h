@@ -3,6 +3,8 @@
 #include "EditorPanel.h"
 #include <Lumos/Core/String.h>
 #include <Lumos/Core/DataStructures/TDArray.h>
+#include <Lumos/Core/JobSystem.h>
+#include <mutex>
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -31,6 +33,14 @@ namespace Lumos
         Font
     };
 
+    enum class ThumbnailState : uint8_t
+    {
+        None = 0,
+        Pending,
+        Ready,
+        Failed
+    };
+
     struct DirectoryInformation
     {
         DirectoryInformation* Parent;
@@ -42,10 +52,19 @@ namespace Lumos
         uint64_t FileSize;
         ImVec4 FileTypeColour;
 
-        bool Hidden = false;
-        bool IsFile = true;
-        bool Opened = false;
-        bool Leaf   = true;
+        int64_t ModifiedTime = 0; // Folders store their own write time, which changes when entries are added or removed
+        uint64_t ContentHash = 0; // Folders only, hash of the names, sizes and write times of the last listing
+        uint32_t IndexStamp  = 0;
+
+        ThumbnailState ThumbnailStatus = ThumbnailState::None;
+        double ThumbnailRetryTime      = 0.0;
+        int64_t StaleThumbnailTime     = 0; // Write time of a cached thumbnail replaced by an edit, removed with the next request
+
+        bool Hidden   = false;
+        bool IsFile   = true;
+        bool Opened   = false;
+        bool Leaf     = true;
+        bool Indexing = false;
 
     public:
         DirectoryInformation(String8 path, bool isF)
@@ -60,14 +79,53 @@ namespace Lumos
         }
     };
 
+    // Listing of one folder, filled on a worker and merged into the panel on the UI thread
+    struct DirectoryIndexEntry
+    {
+        std::string Path; // Absolute, with generic separators
+        int64_t ModifiedTime   = 0;
+        uint64_t FileSize      = 0;
+        bool IsDirectory       = false;
+        bool HasSubdirectories = false;
+        bool Hidden            = false;
+    };
+
+    struct DirectoryIndex
+    {
+        std::string AssetPath;
+        std::string AbsolutePath;
+        int64_t KnownModifiedTime = 0;
+        bool CheckModifiedTime    = false; // Skip the listing if the folder's write time hasn't changed
+        bool ShowHidden           = false;
+        uint32_t Generation       = 0;
+
+        int64_t ModifiedTime = 0;
+        uint64_t ContentHash = 0;
+        bool Unchanged       = false;
+        TDArray<DirectoryIndexEntry> Entries;
+    };
+
+    struct ThumbnailRequest
+    {
+        std::string AssetPath;
+        std::string SourcePath; // Image the thumbnail is made from, the texture itself or a rendered preview
+        std::string CachePath;
+        std::string StaleCachePath; // Thumbnail of the asset's previous write time, no longer read
+        int64_t AssetModifiedTime = 0;
+        bool RequiresFreshSource  = false; // Previews rendered before the asset was last saved are stale
+        uint32_t Generation       = 0;
+
+        uint8_t* Pixels    = nullptr;
+        uint32_t Width     = 0;
+        uint32_t Height    = 0;
+        bool SourceMissing = false;
+    };
+
     class ResourcePanel : public EditorPanel
     {
     public:
         ResourcePanel();
-        ~ResourcePanel()
-        {
-            ArenaRelease(m_Arena);
-        }
+        ~ResourcePanel();
 
         void OnImGui() override;
 
@@ -99,11 +157,14 @@ namespace Lumos
         static bool MoveFile(String8 filePath, String8 movePath);
 
         // String8 StripExtras(String8& filename);
-        String8 ProcessDirectory(String8 directoryPath, DirectoryInformation* parent, bool processChildren);
+        void RequestIndex(DirectoryInformation* directory);
 
         void ChangeDirectory(DirectoryInformation* directory);
         void RemoveDirectory(DirectoryInformation* directory, bool removeFromParent = true);
         void OnNewProject() override;
+
+        // Re-lists every opened folder in the background, keeping thumbnails of files that haven't changed.
+        // Only a change of project rebuilds the index from scratch
         void Refresh();
         void QueueRefresh() { m_Refresh = true; }
 
@@ -114,6 +175,13 @@ namespace Lumos
 
         void CreateThumbnailPath(Arena* arena, DirectoryInformation* directoryInfo, String8& assetPath, String8& AbsolutePath);
 
+        void ResetIndex();
+        void ApplyIndex(DirectoryIndex& index);
+        void ProcessCompletedJobs();
+        void PollDirectories();
+        void RequestThumbnail(DirectoryInformation* entry);
+        DirectoryInformation* AddEntry(String8 assetPath, DirectoryInformation* parent, bool isFile);
+
         float MinGridSize = 50;
         float MaxGridSize = 400;
         String8 m_MovePath;
@@ -130,8 +198,6 @@ namespace Lumos
 
         ImGuiTextFilter m_Filter;
 
-        bool textureCreated = false;
-
         String8 m_BasePath;
         String8 m_AssetPath;
 
@@ -139,10 +205,10 @@ namespace Lumos
 
         bool m_UpdateNavigationPath = true;
 
-        DirectoryInformation* m_CurrentDir;
-        DirectoryInformation* m_BaseProjectDir;
-        DirectoryInformation* m_NextDirectory;
-        DirectoryInformation* m_PreviousDirectory;
+        DirectoryInformation* m_CurrentDir        = nullptr;
+        DirectoryInformation* m_BaseProjectDir    = nullptr;
+        DirectoryInformation* m_NextDirectory     = nullptr;
+        DirectoryInformation* m_PreviousDirectory = nullptr;
 
         struct cmp_str
         {
@@ -171,7 +237,7 @@ namespace Lumos
         SharedPtr<Graphics::Texture2D> m_FolderIcon;
         SharedPtr<Graphics::Texture2D> m_FileIcon;
 
-        DirectoryInformation* m_CurrentSelected;
+        DirectoryInformation* m_CurrentSelected = nullptr;
 
         String8 m_RequestedThumbnailPath;
         String8 m_CopiedPath;
@@ -179,5 +245,20 @@ namespace Lumos
 
         Arena* m_Arena;
         TDArray<String8> m_StringFreeList;
+
+        // Workers only read their own request and hand it back through the completed lists
+        System::JobSystem::Context m_IndexContext;
+        System::JobSystem::Context m_PollContext;
+        System::JobSystem::Context m_ThumbnailContext;
+        std::mutex m_CompletedMutex;
+        TDArray<DirectoryIndex*> m_CompletedIndices;
+        TDArray<ThumbnailRequest*> m_CompletedThumbnails;
+        TDArray<DirectoryIndex*> m_PollRequests; // Read by the poll jobs, only rebuilt once they have finished
+
+        std::string m_PendingDirectoryPath; // Folder to return to once a rebuilt index reaches it
+        uint32_t m_IndexGeneration    = 0;
+        uint32_t m_IndexStamp         = 0;
+        uint32_t m_ThumbnailsInFlight = 0;
+        float m_PollTimer             = 0.0f;
     };
 }
@@ -52,6 +52,12 @@ project "LumosEditor"
 		"ozz_base"
 	}
 
+	if _OPTIONS["luajit"] then
+		removelinks { "lua" }
+		links { "luajit" }
+		libdirs { "%{LibraryDir.luajit}" }
+	end
+
 	defines
 	{
 		"IMGUI_USER_CONFIG=\"../../Lumos/Source/Lumos/ImGui/ImConfig.h\"",
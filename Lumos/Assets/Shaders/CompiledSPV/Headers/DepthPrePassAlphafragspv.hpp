@@ -3,9 +3,9 @@
 #include <array>
 #include <cstdint>
 
-constexpr uint32_t spirv_DepthPrePassAlphafragspv_size = 5524;
-constexpr std::array<uint32_t, 1381> spirv_DepthPrePassAlphafragspv = {
-    0x07230203, 0x00010000, 0x000D000A, 0x00000061, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+constexpr uint32_t spirv_DepthPrePassAlphafragspv_size = 6084;
+constexpr std::array<uint32_t, 1521> spirv_DepthPrePassAlphafragspv = {
+    0x07230203, 0x00010000, 0x000D000A, 0x00000071, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
 0x00000001, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
 0x0007000F, 0x00000004, 0x00000004, 0x6E69616D, 0x00000000, 0x00000014, 0x0000002C, 0x00030010, 
 0x00000004, 0x00000007, 0x00030003, 0x00000002, 0x000001C2, 0x00090004, 0x415F4C47, 0x735F4252, 
@@ -49,90 +49,103 @@ constexpr std::array<uint32_t, 1381> spirv_DepthPrePassAlphafragspv = {
 0x00000003, 0x65746E69, 0x7469736E, 0x00000079, 0x00050006, 0x00000054, 0x00000004, 0x69646172, 
 0x00007375, 0x00050006, 0x00000054, 0x00000005, 0x65707974, 0x00000000, 0x00050006, 0x00000054, 
 0x00000006, 0x6C676E61, 0x00000065, 0x00070005, 0x00000059, 0x66696E55, 0x536D726F, 0x656E6563, 
-0x61746144, 0x00000000, 0x00050006, 0x00000059, 0x00000000, 0x6867696C, 0x00007374, 0x00070006, 
-0x00000059, 0x00000001, 0x64616853, 0x7254776F, 0x66736E61, 0x006D726F, 0x00060006, 0x00000059, 
-0x00000002, 0x77656956, 0x7274614D, 0x00007869, 0x00060006, 0x00000059, 0x00000003, 0x6867694C, 
-0x65695674, 0x00000077, 0x00060006, 0x00000059, 0x00000004, 0x73616942, 0x7274614D, 0x00007869, 
-0x00070006, 0x00000059, 0x00000005, 0x656D6163, 0x6F506172, 0x69746973, 0x00006E6F, 0x00060006, 
-0x00000059, 0x00000006, 0x696C7053, 0x70654474, 0x00736874, 0x00060006, 0x00000059, 0x00000007, 
-0x6867694C, 0x7A695374, 0x00000065, 0x00070006, 0x00000059, 0x00000008, 0x5378614D, 0x6F646168, 
-0x73694477, 0x00000074, 0x00060006, 0x00000059, 0x00000009, 0x64616853, 0x6146776F, 0x00006564, 
-0x00060006, 0x00000059, 0x0000000A, 0x63736143, 0x46656461, 0x00656461, 0x00060006, 0x00000059, 
-0x0000000B, 0x6867694C, 0x756F4374, 0x0000746E, 0x00060006, 0x00000059, 0x0000000C, 0x64616853, 
-0x6F43776F, 0x00746E75, 0x00050006, 0x00000059, 0x0000000D, 0x65646F4D, 0x00000000, 0x00060006, 
-0x00000059, 0x0000000E, 0x4D766E45, 0x6F437069, 0x00746E75, 0x00060006, 0x00000059, 0x0000000F, 
-0x74696E49, 0x426C6169, 0x00736169, 0x00050006, 0x00000059, 0x00000010, 0x74646957, 0x00000068, 
-0x00050006, 0x00000059, 0x00000011, 0x67696548, 0x00007468, 0x00070006, 0x00000059, 0x00000012, 
-0x64616873, 0x6E45776F, 0x656C6261, 0x00000064, 0x00050005, 0x0000005B, 0x63535F75, 0x44656E65, 
-0x00617461, 0x00060005, 0x0000005E, 0x656E6F42, 0x6E617254, 0x726F6673, 0x0000736D, 0x00070006, 
-0x0000005E, 0x00000000, 0x656E6F42, 0x6E617254, 0x726F6673, 0x0000736D, 0x00070005, 0x00000060, 
-0x6F425F75, 0x7254656E, 0x66736E61, 0x736D726F, 0x00000000, 0x00040047, 0x0000000C, 0x00000022, 
-0x00000001, 0x00040047, 0x0000000C, 0x00000021, 0x00000000, 0x00040047, 0x00000014, 0x0000001E, 
-0x00000000, 0x00050048, 0x0000001F, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000001F, 
-0x00000001, 0x00000023, 0x00000010, 0x00050048, 0x0000001F, 0x00000002, 0x00000023, 0x00000014, 
-0x00050048, 0x0000001F, 0x00000003, 0x00000023, 0x00000018, 0x00050048, 0x0000001F, 0x00000004, 
-0x00000023, 0x0000001C, 0x00050048, 0x0000001F, 0x00000005, 0x00000023, 0x00000020, 0x00050048, 
-0x0000001F, 0x00000006, 0x00000023, 0x00000024, 0x00050048, 0x0000001F, 0x00000007, 0x00000023, 
-0x00000028, 0x00050048, 0x0000001F, 0x00000008, 0x00000023, 0x0000002C, 0x00050048, 0x0000001F, 
-0x00000009, 0x00000023, 0x00000030, 0x00050048, 0x0000001F, 0x0000000A, 0x00000023, 0x00000034, 
-0x00050048, 0x0000001F, 0x0000000B, 0x00000023, 0x00000038, 0x00050048, 0x0000001F, 0x0000000C, 
-0x00000023, 0x0000003C, 0x00030047, 0x0000001F, 0x00000002, 0x00040047, 0x00000021, 0x00000022, 
-0x00000001, 0x00040047, 0x00000021, 0x00000021, 0x00000006, 0x00040047, 0x0000002C, 0x0000001E, 
-0x00000000, 0x00040048, 0x0000003C, 0x00000000, 0x00000005, 0x00050048, 0x0000003C, 0x00000000, 
-0x00000023, 0x00000000, 0x00050048, 0x0000003C, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 
-0x0000003C, 0x00000002, 0x00040047, 0x0000003E, 0x00000022, 0x00000000, 0x00040047, 0x0000003E, 
-0x00000021, 0x00000000, 0x00040047, 0x00000040, 0x00000006, 0x00000040, 0x00040048, 0x00000041, 
-0x00000000, 0x00000005, 0x00050048, 0x00000041, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 
-0x00000041, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x00000041, 0x00000002, 0x00040047, 
-0x00000043, 0x00000022, 0x00000000, 0x00040047, 0x00000043, 0x00000021, 0x00000001, 0x00040047, 
-0x00000044, 0x00000022, 0x00000001, 0x00040047, 0x00000044, 0x00000021, 0x00000001, 0x00040047, 
-0x00000045, 0x00000022, 0x00000001, 0x00040047, 0x00000045, 0x00000021, 0x00000002, 0x00040047, 
-0x00000046, 0x00000022, 0x00000001, 0x00040047, 0x00000046, 0x00000021, 0x00000003, 0x00040047, 
-0x00000047, 0x00000022, 0x00000001, 0x00040047, 0x00000047, 0x00000021, 0x00000004, 0x00040047, 
-0x00000048, 0x00000022, 0x00000001, 0x00040047, 0x00000048, 0x00000021, 0x00000005, 0x00040047, 
-0x0000004C, 0x00000022, 0x00000002, 0x00040047, 0x0000004C, 0x00000021, 0x00000000, 0x00040047, 
-0x00000050, 0x00000022, 0x00000002, 0x00040047, 0x00000050, 0x00000021, 0x00000001, 0x00040047, 
-0x00000051, 0x00000022, 0x00000002, 0x00040047, 0x00000051, 0x00000021, 0x00000002, 0x00040047, 
-0x00000052, 0x00000022, 0x00000002, 0x00040047, 0x00000052, 0x00000021, 0x00000003, 0x00040047, 
-0x00000053, 0x00000022, 0x00000002, 0x00040047, 0x00000053, 0x00000021, 0x00000004, 0x00050048, 
-0x00000054, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000054, 0x00000001, 0x00000023, 
-0x00000010, 0x00050048, 0x00000054, 0x00000002, 0x00000023, 0x00000020, 0x00050048, 0x00000054, 
-0x00000003, 0x00000023, 0x00000030, 0x00050048, 0x00000054, 0x00000004, 0x00000023, 0x00000034, 
-0x00050048, 0x00000054, 0x00000005, 0x00000023, 0x00000038, 0x00050048, 0x00000054, 0x00000006, 
-0x00000023, 0x0000003C, 0x00040047, 0x00000056, 0x00000006, 0x00000040, 0x00040047, 0x00000057, 
-0x00000006, 0x00000040, 0x00040047, 0x00000058, 0x00000006, 0x00000010, 0x00050048, 0x00000059, 
-0x00000000, 0x00000023, 0x00000000, 0x00040048, 0x00000059, 0x00000001, 0x00000005, 0x00050048, 
-0x00000059, 0x00000001, 0x00000023, 0x00000800, 0x00050048, 0x00000059, 0x00000001, 0x00000007, 
-0x00000010, 0x00040048, 0x00000059, 0x00000002, 0x00000005, 0x00050048, 0x00000059, 0x00000002, 
-0x00000023, 0x00000900, 0x00050048, 0x00000059, 0x00000002, 0x00000007, 0x00000010, 0x00040048, 
-0x00000059, 0x00000003, 0x00000005, 0x00050048, 0x00000059, 0x00000003, 0x00000023, 0x00000940, 
-0x00050048, 0x00000059, 0x00000003, 0x00000007, 0x00000010, 0x00040048, 0x00000059, 0x00000004, 
-0x00000005, 0x00050048, 0x00000059, 0x00000004, 0x00000023, 0x00000980, 0x00050048, 0x00000059, 
-0x00000004, 0x00000007, 0x00000010, 0x00050048, 0x00000059, 0x00000005, 0x00000023, 0x000009C0, 
-0x00050048, 0x00000059, 0x00000006, 0x00000023, 0x000009D0, 0x00050048, 0x00000059, 0x00000007, 
-0x00000023, 0x00000A10, 0x00050048, 0x00000059, 0x00000008, 0x00000023, 0x00000A14, 0x00050048, 
-0x00000059, 0x00000009, 0x00000023, 0x00000A18, 0x00050048, 0x00000059, 0x0000000A, 0x00000023, 
-0x00000A1C, 0x00050048, 0x00000059, 0x0000000B, 0x00000023, 0x00000A20, 0x00050048, 0x00000059, 
-0x0000000C, 0x00000023, 0x00000A24, 0x00050048, 0x00000059, 0x0000000D, 0x00000023, 0x00000A28, 
-0x00050048, 0x00000059, 0x0000000E, 0x00000023, 0x00000A2C, 0x00050048, 0x00000059, 0x0000000F, 
-0x00000023, 0x00000A30, 0x00050048, 0x00000059, 0x00000010, 0x00000023, 0x00000A34, 0x00050048, 
-0x00000059, 0x00000011, 0x00000023, 0x00000A38, 0x00050048, 0x00000059, 0x00000012, 0x00000023, 
-0x00000A3C, 0x00030047, 0x00000059, 0x00000002, 0x00040047, 0x0000005B, 0x00000022, 0x00000002, 
-0x00040047, 0x0000005B, 0x00000021, 0x00000005, 0x00040047, 0x0000005D, 0x00000006, 0x00000040, 
-0x00040048, 0x0000005E, 0x00000000, 0x00000005, 0x00050048, 0x0000005E, 0x00000000, 0x00000023, 
-0x00000000, 0x00050048, 0x0000005E, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x0000005E, 
-0x00000002, 0x00040047, 0x00000060, 0x00000022, 0x00000003, 0x00040047, 0x00000060, 0x00000021, 
-0x00000000, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00030016, 0x00000006, 
-0x00000020, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00090019, 0x00000009, 0x00000006, 
-0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x0000000A, 
-0x00000009, 0x00040020, 0x0000000B, 0x00000000, 0x0000000A, 0x0004003B, 0x0000000B, 0x0000000C, 
-0x00000000, 0x00040017, 0x0000000E, 0x00000006, 0x00000003, 0x00040017, 0x0000000F, 0x00000006, 
-0x00000002, 0x00040017, 0x00000010, 0x00000006, 0x00000004, 0x00040018, 0x00000011, 0x0000000E, 
-0x00000003, 0x0007001E, 0x00000012, 0x0000000E, 0x0000000F, 0x00000010, 0x0000000E, 0x00000011, 
-0x00040020, 0x00000013, 0x00000001, 0x00000012, 0x0004003B, 0x00000013, 0x00000014, 0x00000001, 
-0x00040015, 0x00000015, 0x00000020, 0x00000001, 0x0004002B, 0x00000015, 0x00000016, 0x00000001, 
-0x00040020, 0x00000017, 0x00000001, 0x0000000F, 0x00040015, 0x0000001B, 0x00000020, 0x00000000, 
-0x0004002B, 0x0000001B, 0x0000001C, 0x00000003, 0x000F001E, 0x0000001F, 0x00000010, 0x00000006, 
+0x61746144, 0x00000000, 0x00070006, 0x00000059, 0x00000000, 0x64616853, 0x7254776F, 0x66736E61, 
+0x006D726F, 0x00060006, 0x00000059, 0x00000001, 0x77656956, 0x7274614D, 0x00007869, 0x00060006, 
+0x00000059, 0x00000002, 0x6867694C, 0x65695674, 0x00000077, 0x00060006, 0x00000059, 0x00000003, 
+0x73616942, 0x7274614D, 0x00007869, 0x00080006, 0x00000059, 0x00000004, 0x6A6F7250, 0x69746365, 
+0x614D6E6F, 0x78697274, 0x00000000, 0x00070006, 0x00000059, 0x00000005, 0x656D6163, 0x6F506172, 
+0x69746973, 0x00006E6F, 0x00060006, 0x00000059, 0x00000006, 0x696C7053, 0x70654474, 0x00736874, 
+0x00070006, 0x00000059, 0x00000007, 0x73756C43, 0x50726574, 0x6D617261, 0x00000073, 0x00060006, 
+0x00000059, 0x00000008, 0x6867694C, 0x7A695374, 0x00000065, 0x00070006, 0x00000059, 0x00000009, 
+0x5378614D, 0x6F646168, 0x73694477, 0x00000074, 0x00060006, 0x00000059, 0x0000000A, 0x64616853, 
+0x6146776F, 0x00006564, 0x00060006, 0x00000059, 0x0000000B, 0x63736143, 0x46656461, 0x00656461, 
+0x00060006, 0x00000059, 0x0000000C, 0x6867694C, 0x756F4374, 0x0000746E, 0x00060006, 0x00000059, 
+0x0000000D, 0x64616853, 0x6F43776F, 0x00746E75, 0x00050006, 0x00000059, 0x0000000E, 0x65646F4D, 
+0x00000000, 0x00060006, 0x00000059, 0x0000000F, 0x4D766E45, 0x6F437069, 0x00746E75, 0x00060006, 
+0x00000059, 0x00000010, 0x74696E49, 0x426C6169, 0x00736169, 0x00050006, 0x00000059, 0x00000011, 
+0x74646957, 0x00000068, 0x00050006, 0x00000059, 0x00000012, 0x67696548, 0x00007468, 0x00070006, 
+0x00000059, 0x00000013, 0x64616873, 0x6E45776F, 0x656C6261, 0x00000064, 0x00090006, 0x00000059, 
+0x00000014, 0x65726944, 0x6F697463, 0x4C6C616E, 0x74686769, 0x6E756F43, 0x00000074, 0x00050005, 
+0x0000005B, 0x63535F75, 0x44656E65, 0x00617461, 0x00050005, 0x00000063, 0x6867694C, 0x74614474, 
+0x00000061, 0x00050006, 0x00000063, 0x00000000, 0x6867696C, 0x00007374, 0x00050005, 0x00000065, 
+0x694C5F75, 0x44746867, 0x00617461, 0x00070005, 0x00000069, 0x6867694C, 0x756C4374, 0x72657473, 
+0x61746144, 0x00000000, 0x00060006, 0x00000069, 0x00000000, 0x73756C43, 0x73726574, 0x00000000, 
+0x00060005, 0x0000006B, 0x694C5F75, 0x43746867, 0x7473756C, 0x00737265, 0x00060005, 0x0000006E, 
+0x6867694C, 0x646E4974, 0x61447865, 0x00006174, 0x00050006, 0x0000006E, 0x00000000, 0x69646E49, 
+0x00736563, 0x00060005, 0x00000070, 0x694C5F75, 0x49746867, 0x6369646E, 0x00007365, 0x00040047, 
+0x0000000C, 0x00000022, 0x00000001, 0x00040047, 0x0000000C, 0x00000021, 0x00000000, 0x00040047, 
+0x00000014, 0x0000001E, 0x00000000, 0x00050048, 0x0000001F, 0x00000000, 0x00000023, 0x00000000, 
+0x00050048, 0x0000001F, 0x00000001, 0x00000023, 0x00000010, 0x00050048, 0x0000001F, 0x00000002, 
+0x00000023, 0x00000014, 0x00050048, 0x0000001F, 0x00000003, 0x00000023, 0x00000018, 0x00050048, 
+0x0000001F, 0x00000004, 0x00000023, 0x0000001C, 0x00050048, 0x0000001F, 0x00000005, 0x00000023, 
+0x00000020, 0x00050048, 0x0000001F, 0x00000006, 0x00000023, 0x00000024, 0x00050048, 0x0000001F, 
+0x00000007, 0x00000023, 0x00000028, 0x00050048, 0x0000001F, 0x00000008, 0x00000023, 0x0000002C, 
+0x00050048, 0x0000001F, 0x00000009, 0x00000023, 0x00000030, 0x00050048, 0x0000001F, 0x0000000A, 
+0x00000023, 0x00000034, 0x00050048, 0x0000001F, 0x0000000B, 0x00000023, 0x00000038, 0x00050048, 
+0x0000001F, 0x0000000C, 0x00000023, 0x0000003C, 0x00030047, 0x0000001F, 0x00000002, 0x00040047, 
+0x00000021, 0x00000022, 0x00000001, 0x00040047, 0x00000021, 0x00000021, 0x00000006, 0x00040047, 
+0x0000002C, 0x0000001E, 0x00000000, 0x00040048, 0x0000003C, 0x00000000, 0x00000005, 0x00050048, 
+0x0000003C, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000003C, 0x00000000, 0x00000007, 
+0x00000010, 0x00030047, 0x0000003C, 0x00000002, 0x00040047, 0x0000003E, 0x00000022, 0x00000000, 
+0x00040047, 0x0000003E, 0x00000021, 0x00000000, 0x00040047, 0x00000040, 0x00000006, 0x00000040, 
+0x00040048, 0x00000041, 0x00000000, 0x00000005, 0x00050048, 0x00000041, 0x00000000, 0x00000023, 
+0x00000000, 0x00050048, 0x00000041, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x00000041, 
+0x00000002, 0x00040047, 0x00000043, 0x00000022, 0x00000000, 0x00040047, 0x00000043, 0x00000021, 
+0x00000001, 0x00040047, 0x00000044, 0x00000022, 0x00000001, 0x00040047, 0x00000044, 0x00000021, 
+0x00000001, 0x00040047, 0x00000045, 0x00000022, 0x00000001, 0x00040047, 0x00000045, 0x00000021, 
+0x00000002, 0x00040047, 0x00000046, 0x00000022, 0x00000001, 0x00040047, 0x00000046, 0x00000021, 
+0x00000003, 0x00040047, 0x00000047, 0x00000022, 0x00000001, 0x00040047, 0x00000047, 0x00000021, 
+0x00000004, 0x00040047, 0x00000048, 0x00000022, 0x00000001, 0x00040047, 0x00000048, 0x00000021, 
+0x00000005, 0x00040047, 0x0000004C, 0x00000022, 0x00000002, 0x00040047, 0x0000004C, 0x00000021, 
+0x00000000, 0x00040047, 0x00000050, 0x00000022, 0x00000002, 0x00040047, 0x00000050, 0x00000021, 
+0x00000001, 0x00040047, 0x00000051, 0x00000022, 0x00000002, 0x00040047, 0x00000051, 0x00000021, 
+0x00000002, 0x00040047, 0x00000052, 0x00000022, 0x00000002, 0x00040047, 0x00000052, 0x00000021, 
+0x00000003, 0x00040047, 0x00000053, 0x00000022, 0x00000002, 0x00040047, 0x00000053, 0x00000021, 
+0x00000004, 0x00050048, 0x00000054, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000054, 
+0x00000001, 0x00000023, 0x00000010, 0x00050048, 0x00000054, 0x00000002, 0x00000023, 0x00000020, 
+0x00050048, 0x00000054, 0x00000003, 0x00000023, 0x00000030, 0x00050048, 0x00000054, 0x00000004, 
+0x00000023, 0x00000034, 0x00050048, 0x00000054, 0x00000005, 0x00000023, 0x00000038, 0x00050048, 
+0x00000054, 0x00000006, 0x00000023, 0x0000003C, 0x00040047, 0x00000057, 0x00000006, 0x00000040, 
+0x00040047, 0x00000058, 0x00000006, 0x00000010, 0x00040048, 0x00000059, 0x00000000, 0x00000005, 
+0x00050048, 0x00000059, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000059, 0x00000000, 
+0x00000007, 0x00000010, 0x00040048, 0x00000059, 0x00000001, 0x00000005, 0x00050048, 0x00000059, 
+0x00000001, 0x00000023, 0x00000100, 0x00050048, 0x00000059, 0x00000001, 0x00000007, 0x00000010, 
+0x00040048, 0x00000059, 0x00000002, 0x00000005, 0x00050048, 0x00000059, 0x00000002, 0x00000023, 
+0x00000140, 0x00050048, 0x00000059, 0x00000002, 0x00000007, 0x00000010, 0x00040048, 0x00000059, 
+0x00000003, 0x00000005, 0x00050048, 0x00000059, 0x00000003, 0x00000023, 0x00000180, 0x00050048, 
+0x00000059, 0x00000003, 0x00000007, 0x00000010, 0x00040048, 0x00000059, 0x00000004, 0x00000005, 
+0x00050048, 0x00000059, 0x00000004, 0x00000023, 0x000001C0, 0x00050048, 0x00000059, 0x00000004, 
+0x00000007, 0x00000010, 0x00050048, 0x00000059, 0x00000005, 0x00000023, 0x00000200, 0x00050048, 
+0x00000059, 0x00000006, 0x00000023, 0x00000210, 0x00050048, 0x00000059, 0x00000007, 0x00000023, 
+0x00000250, 0x00050048, 0x00000059, 0x00000008, 0x00000023, 0x00000260, 0x00050048, 0x00000059, 
+0x00000009, 0x00000023, 0x00000264, 0x00050048, 0x00000059, 0x0000000A, 0x00000023, 0x00000268, 
+0x00050048, 0x00000059, 0x0000000B, 0x00000023, 0x0000026C, 0x00050048, 0x00000059, 0x0000000C, 
+0x00000023, 0x00000270, 0x00050048, 0x00000059, 0x0000000D, 0x00000023, 0x00000274, 0x00050048, 
+0x00000059, 0x0000000E, 0x00000023, 0x00000278, 0x00050048, 0x00000059, 0x0000000F, 0x00000023, 
+0x0000027C, 0x00050048, 0x00000059, 0x00000010, 0x00000023, 0x00000280, 0x00050048, 0x00000059, 
+0x00000011, 0x00000023, 0x00000284, 0x00050048, 0x00000059, 0x00000012, 0x00000023, 0x00000288, 
+0x00050048, 0x00000059, 0x00000013, 0x00000023, 0x0000028C, 0x00050048, 0x00000059, 0x00000014, 
+0x00000023, 0x00000290, 0x00030047, 0x00000059, 0x00000002, 0x00040047, 0x0000005B, 0x00000022, 
+0x00000002, 0x00040047, 0x0000005B, 0x00000021, 0x00000005, 0x00040047, 0x00000062, 0x00000006, 
+0x00000040, 0x00040048, 0x00000063, 0x00000000, 0x00000018, 0x00050048, 0x00000063, 0x00000000, 
+0x00000023, 0x00000000, 0x00030047, 0x00000063, 0x00000003, 0x00040047, 0x00000065, 0x00000022, 
+0x00000002, 0x00040047, 0x00000065, 0x00000021, 0x00000006, 0x00040047, 0x00000068, 0x00000006, 
+0x00000008, 0x00040048, 0x00000069, 0x00000000, 0x00000018, 0x00050048, 0x00000069, 0x00000000, 
+0x00000023, 0x00000000, 0x00030047, 0x00000069, 0x00000003, 0x00040047, 0x0000006B, 0x00000022, 
+0x00000002, 0x00040047, 0x0000006B, 0x00000021, 0x00000007, 0x00040047, 0x0000006D, 0x00000006, 
+0x00000004, 0x00040048, 0x0000006E, 0x00000000, 0x00000018, 0x00050048, 0x0000006E, 0x00000000, 
+0x00000023, 0x00000000, 0x00030047, 0x0000006E, 0x00000003, 0x00040047, 0x00000070, 0x00000022, 
+0x00000002, 0x00040047, 0x00000070, 0x00000021, 0x00000008, 0x00020013, 0x00000002, 0x00030021, 
+0x00000003, 0x00000002, 0x00030016, 0x00000006, 0x00000020, 0x00040020, 0x00000007, 0x00000007, 
+0x00000006, 0x00090019, 0x00000009, 0x00000006, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 
+0x00000001, 0x00000000, 0x0003001B, 0x0000000A, 0x00000009, 0x00040020, 0x0000000B, 0x00000000, 
+0x0000000A, 0x0004003B, 0x0000000B, 0x0000000C, 0x00000000, 0x00040017, 0x0000000E, 0x00000006, 
+0x00000003, 0x00040017, 0x0000000F, 0x00000006, 0x00000002, 0x00040017, 0x00000010, 0x00000006, 
+0x00000004, 0x00040018, 0x00000011, 0x0000000E, 0x00000003, 0x0007001E, 0x00000012, 0x0000000E, 
+0x0000000F, 0x00000010, 0x0000000E, 0x00000011, 0x00040020, 0x00000013, 0x00000001, 0x00000012, 
+0x0004003B, 0x00000013, 0x00000014, 0x00000001, 0x00040015, 0x00000015, 0x00000020, 0x00000001, 
+0x0004002B, 0x00000015, 0x00000016, 0x00000001, 0x00040020, 0x00000017, 0x00000001, 0x0000000F, 
+0x00040015, 0x0000001B, 0x00000020, 0x00000000, 0x000F001E, 0x0000001F, 0x00000010, 0x00000006, 
 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
 0x00000006, 0x00000006, 0x00000006, 0x00040020, 0x00000020, 0x00000002, 0x0000001F, 0x0004003B, 
 0x00000020, 0x00000021, 0x00000002, 0x0004002B, 0x00000015, 0x00000022, 0x0000000B, 0x00040020, 
@@ -154,28 +167,33 @@ constexpr std::array<uint32_t, 1381> spirv_DepthPrePassAlphafragspv = {
 0x0000004F, 0x00000050, 0x00000000, 0x0004003B, 0x0000004F, 0x00000051, 0x00000000, 0x0004003B, 
 0x0000000B, 0x00000052, 0x00000000, 0x0004003B, 0x0000000B, 0x00000053, 0x00000000, 0x0009001E, 
 0x00000054, 0x00000010, 0x00000010, 0x00000010, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-0x0004002B, 0x0000001B, 0x00000055, 0x00000020, 0x0004001C, 0x00000056, 0x00000054, 0x00000055, 
 0x0004001C, 0x00000057, 0x0000003B, 0x0000003F, 0x0004001C, 0x00000058, 0x00000010, 0x0000003F, 
-0x0015001E, 0x00000059, 0x00000056, 0x00000057, 0x0000003B, 0x0000003B, 0x0000003B, 0x00000010, 
-0x00000058, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000015, 0x00000015, 0x00000015, 
-0x00000015, 0x00000006, 0x00000006, 0x00000006, 0x00000015, 0x00040020, 0x0000005A, 0x00000002, 
-0x00000059, 0x0004003B, 0x0000005A, 0x0000005B, 0x00000002, 0x0004002B, 0x0000001B, 0x0000005C, 
-0x00000064, 0x0004001C, 0x0000005D, 0x0000003B, 0x0000005C, 0x0003001E, 0x0000005E, 0x0000005D, 
-0x00040020, 0x0000005F, 0x00000002, 0x0000005E, 0x0004003B, 0x0000005F, 0x00000060, 0x00000002, 
-0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200F8, 0x00000005, 0x0004003B, 
-0x00000007, 0x00000008, 0x00000007, 0x0004003D, 0x0000000A, 0x0000000D, 0x0000000C, 0x00050041, 
-0x00000017, 0x00000018, 0x00000014, 0x00000016, 0x0004003D, 0x0000000F, 0x00000019, 0x00000018, 
-0x00050057, 0x00000010, 0x0000001A, 0x0000000D, 0x00000019, 0x00050051, 0x00000006, 0x0000001D, 
-0x0000001A, 0x00000003, 0x0003003E, 0x00000008, 0x0000001D, 0x0004003D, 0x00000006, 0x0000001E, 
-0x00000008, 0x00050041, 0x00000023, 0x00000024, 0x00000021, 0x00000022, 0x0004003D, 0x00000006, 
-0x00000025, 0x00000024, 0x000500B8, 0x00000026, 0x00000027, 0x0000001E, 0x00000025, 0x000300F7, 
-0x00000029, 0x00000000, 0x000400FA, 0x00000027, 0x00000028, 0x00000029, 0x000200F8, 0x00000028, 
-0x000100FC, 0x000200F8, 0x00000029, 0x00050041, 0x0000002E, 0x0000002F, 0x00000014, 0x0000002D, 
-0x0004003D, 0x0000000E, 0x00000030, 0x0000002F, 0x0005008E, 0x0000000E, 0x00000032, 0x00000030, 
-0x00000031, 0x00060050, 0x0000000E, 0x00000033, 0x00000031, 0x00000031, 0x00000031, 0x00050081, 
-0x0000000E, 0x00000034, 0x00000032, 0x00000033, 0x0006000C, 0x0000000E, 0x00000035, 0x00000001, 
-0x00000045, 0x00000034, 0x00050051, 0x00000006, 0x00000037, 0x00000035, 0x00000000, 0x00050051, 
-0x00000006, 0x00000038, 0x00000035, 0x00000001, 0x00050051, 0x00000006, 0x00000039, 0x00000035, 
-0x00000002, 0x00070050, 0x00000010, 0x0000003A, 0x00000037, 0x00000038, 0x00000039, 0x00000036, 
-0x0003003E, 0x0000002C, 0x0000003A, 0x000100FD, 0x00010038, 
+0x0017001E, 0x00000059, 0x00000057, 0x0000003B, 0x0000003B, 0x0000003B, 0x0000003B, 0x00000010, 
+0x00000058, 0x00000010, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000015, 0x00000015, 
+0x00000015, 0x00000015, 0x00000006, 0x00000006, 0x00000006, 0x00000015, 0x00000015, 0x00040020, 
+0x0000005A, 0x00000002, 0x00000059, 0x0004003B, 0x0000005A, 0x0000005B, 0x00000002, 0x0004002B, 
+0x0000001B, 0x00000061, 0x00001000, 0x0004001C, 0x00000062, 0x00000054, 0x00000061, 0x0003001E, 
+0x00000063, 0x00000062, 0x00040020, 0x00000064, 0x00000002, 0x00000063, 0x0004003B, 0x00000064, 
+0x00000065, 0x00000002, 0x00040017, 0x00000066, 0x0000001B, 0x00000002, 0x0004002B, 0x0000001B, 
+0x00000067, 0x00000D80, 0x0004001C, 0x00000068, 0x00000066, 0x00000067, 0x0003001E, 0x00000069, 
+0x00000068, 0x00040020, 0x0000006A, 0x00000002, 0x00000069, 0x0004003B, 0x0000006A, 0x0000006B, 
+0x00000002, 0x0004002B, 0x0000001B, 0x0000006C, 0x00020000, 0x0004001C, 0x0000006D, 0x0000001B, 
+0x0000006C, 0x0003001E, 0x0000006E, 0x0000006D, 0x00040020, 0x0000006F, 0x00000002, 0x0000006E, 
+0x0004003B, 0x0000006F, 0x00000070, 0x00000002, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 
+0x00000003, 0x000200F8, 0x00000005, 0x0004003B, 0x00000007, 0x00000008, 0x00000007, 0x0004003D, 
+0x0000000A, 0x0000000D, 0x0000000C, 0x00050041, 0x00000017, 0x00000018, 0x00000014, 0x00000016, 
+0x0004003D, 0x0000000F, 0x00000019, 0x00000018, 0x00050057, 0x00000010, 0x0000001A, 0x0000000D, 
+0x00000019, 0x00050051, 0x00000006, 0x0000001D, 0x0000001A, 0x00000003, 0x0003003E, 0x00000008, 
+0x0000001D, 0x0004003D, 0x00000006, 0x0000001E, 0x00000008, 0x00050041, 0x00000023, 0x00000024, 
+0x00000021, 0x00000022, 0x0004003D, 0x00000006, 0x00000025, 0x00000024, 0x000500B8, 0x00000026, 
+0x00000027, 0x0000001E, 0x00000025, 0x000300F7, 0x00000029, 0x00000000, 0x000400FA, 0x00000027, 
+0x00000028, 0x00000029, 0x000200F8, 0x00000028, 0x000100FC, 0x000200F8, 0x00000029, 0x00050041, 
+0x0000002E, 0x0000002F, 0x00000014, 0x0000002D, 0x0004003D, 0x0000000E, 0x00000030, 0x0000002F, 
+0x0005008E, 0x0000000E, 0x00000032, 0x00000030, 0x00000031, 0x00060050, 0x0000000E, 0x00000033, 
+0x00000031, 0x00000031, 0x00000031, 0x00050081, 0x0000000E, 0x00000034, 0x00000032, 0x00000033, 
+0x0006000C, 0x0000000E, 0x00000035, 0x00000001, 0x00000045, 0x00000034, 0x00050051, 0x00000006, 
+0x00000037, 0x00000035, 0x00000000, 0x00050051, 0x00000006, 0x00000038, 0x00000035, 0x00000001, 
+0x00050051, 0x00000006, 0x00000039, 0x00000035, 0x00000002, 0x00070050, 0x00000010, 0x0000003A, 
+0x00000037, 0x00000038, 0x00000039, 0x00000036, 0x0003003E, 0x0000002C, 0x0000003A, 0x000100FD, 
+0x00010038, 
     };
\ No newline at end of file
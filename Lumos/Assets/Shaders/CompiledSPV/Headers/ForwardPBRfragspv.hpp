@@ -3,9 +3,9 @@
 #include <array>
 #include <cstdint>
 
-constexpr uint32_t spirv_ForwardPBRfragspv_size = 50980;
-constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
-    0x07230203, 0x00010000, 0x000D000A, 0x00000817, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+constexpr uint32_t spirv_ForwardPBRfragspv_size = 53320;
+constexpr std::array<uint32_t, 13330> spirv_ForwardPBRfragspv = {
+    0x07230203, 0x00010000, 0x000D000A, 0x00000880, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
 0x00000001, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
 0x0008000F, 0x00000004, 0x00000004, 0x6E69616D, 0x00000000, 0x00000204, 0x00000314, 0x000006AF, 
 0x00030010, 0x00000004, 0x00000007, 0x00030003, 0x00000002, 0x000001C2, 0x00090004, 0x415F4C47, 
@@ -177,425 +177,453 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x7469736E, 0x00000079, 0x00050006, 0x000002C2, 0x00000004, 0x69646172, 0x00007375, 0x00050006, 
 0x000002C2, 0x00000005, 0x65707974, 0x00000000, 0x00050006, 0x000002C2, 0x00000006, 0x6C676E61, 
 0x00000065, 0x00070005, 0x000002C9, 0x66696E55, 0x536D726F, 0x656E6563, 0x61746144, 0x00000000, 
-0x00050006, 0x000002C9, 0x00000000, 0x6867696C, 0x00007374, 0x00070006, 0x000002C9, 0x00000001, 
-0x64616853, 0x7254776F, 0x66736E61, 0x006D726F, 0x00060006, 0x000002C9, 0x00000002, 0x77656956, 
-0x7274614D, 0x00007869, 0x00060006, 0x000002C9, 0x00000003, 0x6867694C, 0x65695674, 0x00000077, 
-0x00060006, 0x000002C9, 0x00000004, 0x73616942, 0x7274614D, 0x00007869, 0x00070006, 0x000002C9, 
-0x00000005, 0x656D6163, 0x6F506172, 0x69746973, 0x00006E6F, 0x00060006, 0x000002C9, 0x00000006, 
-0x696C7053, 0x70654474, 0x00736874, 0x00060006, 0x000002C9, 0x00000007, 0x6867694C, 0x7A695374, 
-0x00000065, 0x00070006, 0x000002C9, 0x00000008, 0x5378614D, 0x6F646168, 0x73694477, 0x00000074, 
-0x00060006, 0x000002C9, 0x00000009, 0x64616853, 0x6146776F, 0x00006564, 0x00060006, 0x000002C9, 
-0x0000000A, 0x63736143, 0x46656461, 0x00656461, 0x00060006, 0x000002C9, 0x0000000B, 0x6867694C, 
-0x756F4374, 0x0000746E, 0x00060006, 0x000002C9, 0x0000000C, 0x64616853, 0x6F43776F, 0x00746E75, 
-0x00050006, 0x000002C9, 0x0000000D, 0x65646F4D, 0x00000000, 0x00060006, 0x000002C9, 0x0000000E, 
-0x4D766E45, 0x6F437069, 0x00746E75, 0x00060006, 0x000002C9, 0x0000000F, 0x74696E49, 0x426C6169, 
-0x00736169, 0x00050006, 0x000002C9, 0x00000010, 0x74646957, 0x00000068, 0x00050006, 0x000002C9, 
-0x00000011, 0x67696548, 0x00007468, 0x00070006, 0x000002C9, 0x00000012, 0x64616873, 0x6E45776F, 
-0x656C6261, 0x00000064, 0x00050005, 0x000002CB, 0x63535F75, 0x44656E65, 0x00617461, 0x00040005, 
-0x000002CF, 0x73616962, 0x00000000, 0x00040005, 0x000002DB, 0x6967616D, 0x00000063, 0x00040005, 
-0x000002EC, 0x73616962, 0x00000000, 0x00040005, 0x000002ED, 0x61726170, 0x0000006D, 0x00040005, 
-0x000002EF, 0x61726170, 0x0000006D, 0x00040005, 0x000002F1, 0x61726170, 0x0000006D, 0x00030005, 
-0x000002F4, 0x006D7573, 0x00040005, 0x000002F5, 0x73696F6E, 0x00000065, 0x00040005, 0x000002F6, 
-0x61726170, 0x0000006D, 0x00090005, 0x000002FA, 0x53766E69, 0x72617571, 0x6F6F5265, 0x6D615374, 
-0x73656C70, 0x6E756F43, 0x00000074, 0x00050005, 0x000002FB, 0x6F6F6C66, 0x50646572, 0x0000736F, 
-0x00040005, 0x00000300, 0x65646E69, 0x00000078, 0x00040005, 0x00000302, 0x61726170, 0x0000006D, 
-0x00040005, 0x00000304, 0x61726170, 0x0000006D, 0x00030005, 0x0000030A, 0x00000069, 0x00040005, 
-0x00000312, 0x7366666F, 0x00007465, 0x00060005, 0x00000314, 0x465F6C67, 0x43676172, 0x64726F6F, 
-0x00000000, 0x00040005, 0x00000315, 0x61726170, 0x0000006D, 0x00040005, 0x00000319, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000031B, 0x61726170, 0x0000006D, 0x00040005, 0x0000031D, 0x61726170, 
-0x0000006D, 0x00030005, 0x00000322, 0x0000007A, 0x00060005, 0x0000033E, 0x63736163, 0x49656461, 
-0x7865646E, 0x00000000, 0x00040005, 0x0000033F, 0x77656976, 0x00736F50, 0x00030005, 0x00000349, 
-0x00000069, 0x00060005, 0x00000365, 0x64616873, 0x6944776F, 0x6E617473, 0x00006563, 0x00070005, 
-0x00000369, 0x6E617274, 0x69746973, 0x69446E6F, 0x6E617473, 0x00006563, 0x00040005, 0x0000036C, 
-0x77656976, 0x00736F50, 0x00050005, 0x00000375, 0x74736964, 0x65636E61, 0x00000000, 0x00050005, 
-0x00000383, 0x64616873, 0x6F43776F, 0x0064726F, 0x00040005, 0x00000395, 0x5241454E, 0x00000000, 
-0x00050005, 0x00000397, 0x61527675, 0x73756964, 0x00000000, 0x00060005, 0x000003A2, 0x64616873, 
-0x6D41776F, 0x746E756F, 0x00000000, 0x00050005, 0x000003A3, 0x61685375, 0x4D776F64, 0x00007061, 
-0x00040005, 0x000003A4, 0x61726170, 0x0000006D, 0x00040005, 0x000003A6, 0x61726170, 0x0000006D, 
-0x00040005, 0x000003A8, 0x61726170, 0x0000006D, 0x00040005, 0x000003AA, 0x61726170, 0x0000006D, 
-0x00040005, 0x000003AC, 0x61726170, 0x0000006D, 0x00040005, 0x000003AE, 0x61726170, 0x0000006D, 
-0x00050005, 0x000003B1, 0x63736163, 0x46656461, 0x00656461, 0x00050005, 0x000003BE, 0x63736163, 
-0x4E656461, 0x00747865, 0x00060005, 0x000003D8, 0x64616873, 0x6D41776F, 0x746E756F, 0x00000031, 
-0x00040005, 0x000003D9, 0x61726170, 0x0000006D, 0x00040005, 0x000003DB, 0x61726170, 0x0000006D, 
-0x00040005, 0x000003DD, 0x61726170, 0x0000006D, 0x00040005, 0x000003DF, 0x61726170, 0x0000006D, 
-0x00040005, 0x000003E1, 0x61726170, 0x0000006D, 0x00040005, 0x000003E3, 0x61726170, 0x0000006D, 
-0x00030005, 0x000003F1, 0x00000044, 0x00040005, 0x000003F3, 0x61726170, 0x0000006D, 0x00040005, 
-0x000003F5, 0x61726170, 0x0000006D, 0x00030005, 0x000003F8, 0x00000056, 0x00040005, 0x000003F9, 
-0x61726170, 0x0000006D, 0x00040005, 0x000003FB, 0x61726170, 0x0000006D, 0x00040005, 0x000003FD, 
-0x61726170, 0x0000006D, 0x00030005, 0x00000400, 0x00000046, 0x00040005, 0x00000402, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000040E, 0x61726170, 0x0000006D, 0x00040005, 0x00000410, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000412, 0x61726170, 0x0000006D, 0x00040005, 0x00000414, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000041A, 0x61726170, 0x0000006D, 0x00040005, 0x0000041C, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000041E, 0x61726170, 0x0000006D, 0x00040005, 0x00000420, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000425, 0x75736572, 0x0000746C, 0x00030005, 0x00000427, 0x00000069, 
-0x00040005, 0x00000433, 0x6867696C, 0x00000074, 0x00040005, 0x00000447, 0x756C6176, 0x00000065, 
-0x00030005, 0x0000044D, 0x0000004C, 0x00040005, 0x00000453, 0x74736964, 0x00000000, 0x00040005, 
-0x00000458, 0x65747461, 0x0000006E, 0x00050005, 0x0000045F, 0x65747461, 0x7461756E, 0x006E6F69, 
-0x00030005, 0x00000478, 0x0000004C, 0x00050005, 0x0000047E, 0x6F747563, 0x6E416666, 0x00656C67, 
-0x00040005, 0x00000482, 0x74736964, 0x00000000, 0x00040005, 0x00000487, 0x74656874, 0x00000061, 
-0x00040005, 0x0000048D, 0x69737065, 0x006E6F6C, 0x00050005, 0x00000493, 0x65747461, 0x7461756E, 
-0x006E6F69, 0x00040005, 0x000004A4, 0x746F446E, 0x0000004C, 0x00060005, 0x000004B4, 0x63736163, 
-0x49656461, 0x7865646E, 0x00000000, 0x00040005, 0x000004B5, 0x61726170, 0x0000006D, 0x00040005, 
-0x000004B8, 0x61726170, 0x0000006D, 0x00040005, 0x000004BA, 0x61726170, 0x0000006D, 0x00040005, 
-0x000004BC, 0x61726170, 0x0000006D, 0x00040005, 0x000004C0, 0x61726170, 0x0000006D, 0x00030005, 
-0x000004C5, 0x0000694C, 0x00050005, 0x000004C9, 0x6461724C, 0x636E6169, 0x00000065, 0x00030005, 
-0x000004D0, 0x0000684C, 0x00050005, 0x000004D6, 0x6867696C, 0x4C6F4E74, 0x00000000, 0x00040005, 
-0x000004DB, 0x61726170, 0x0000006D, 0x00030005, 0x000004DD, 0x00000068, 0x00050005, 0x000004E3, 
-0x64616873, 0x5F676E69, 0x00566F4E, 0x00040005, 0x000004E9, 0x61726170, 0x0000006D, 0x00030005, 
-0x000004EB, 0x00566F4E, 0x00030005, 0x000004ED, 0x004C6F4E, 0x00040005, 0x000004EE, 0x61726170, 
-0x0000006D, 0x00030005, 0x000004F1, 0x00486F4E, 0x00040005, 0x000004F6, 0x61726170, 0x0000006D, 
-0x00030005, 0x000004F8, 0x00486F4C, 0x00040005, 0x000004FC, 0x61726170, 0x0000006D, 0x00030005, 
-0x000004FE, 0x00006446, 0x00040005, 0x00000500, 0x61726170, 0x0000006D, 0x00040005, 0x00000502, 
-0x61726170, 0x0000006D, 0x00040005, 0x00000504, 0x61726170, 0x0000006D, 0x00030005, 0x00000507, 
-0x00007246, 0x00040005, 0x0000050B, 0x61726170, 0x0000006D, 0x00040005, 0x0000050D, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000050F, 0x61726170, 0x0000006D, 0x00040005, 0x00000511, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000514, 0x6F6C6F63, 0x00007275, 0x00040005, 0x0000051E, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000520, 0x61726170, 0x0000006D, 0x00050005, 0x0000052D, 0x61727269, 
-0x6E616964, 0x00006563, 0x00040005, 0x00000531, 0x72724975, 0x0070614D, 0x00030005, 0x00000537, 
-0x00000046, 0x00040005, 0x00000538, 0x61726170, 0x0000006D, 0x00040005, 0x0000053A, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000053D, 0x61726170, 0x0000006D, 0x00030005, 0x00000541, 0x0000646B, 
-0x00050005, 0x00000549, 0x66666964, 0x49657375, 0x00004C42, 0x00080005, 0x0000054F, 0x6E455F75, 
-0x64615276, 0x636E6169, 0x78655465, 0x6576654C, 0x0000736C, 0x00070005, 0x00000553, 0x63657073, 
-0x72616C75, 0x61727249, 0x6E616964, 0x00006563, 0x00040005, 0x00000554, 0x766E4575, 0x0070614D, 
-0x00050005, 0x0000055E, 0x63657073, 0x72616C75, 0x004C4249, 0x00050005, 0x00000571, 0x43786574, 
-0x756F6C6F, 0x00000072, 0x00050005, 0x0000057B, 0x6174656D, 0x63696C6C, 0x00000000, 0x00050005, 
-0x0000057C, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x0000058B, 0x00786574, 0x00030005, 
-0x000005AF, 0x00786574, 0x00050005, 0x000005CD, 0x6574616D, 0x6C616972, 0x00000000, 0x00050005, 
-0x000005E2, 0x6F4E5F75, 0x6C616D72, 0x0070614D, 0x00040005, 0x000005FB, 0x61726170, 0x0000006D, 
-0x00030005, 0x00000601, 0x00007675, 0x00040005, 0x0000060B, 0x6F617373, 0x00000000, 0x00050005, 
-0x0000060C, 0x41535375, 0x70614D4F, 0x00000000, 0x00040005, 0x0000061B, 0x61726170, 0x0000006D, 
-0x00050005, 0x00000620, 0x67756F72, 0x73656E68, 0x00003273, 0x00040005, 0x00000624, 0x75646E64, 
-0x00000000, 0x00040005, 0x00000628, 0x76646E64, 0x00000000, 0x00050005, 0x0000062C, 0x69726176, 
-0x65636E61, 0x00000000, 0x00070005, 0x00000634, 0x6E72656B, 0x6F526C65, 0x6E686775, 0x32737365, 
-0x00000000, 0x00070005, 0x00000639, 0x746C6966, 0x64657265, 0x67756F52, 0x73656E68, 0x00003273, 
-0x00040005, 0x0000063D, 0x61726170, 0x0000006D, 0x00040005, 0x00000647, 0x6F507377, 0x00000073, 
-0x00050005, 0x0000065A, 0x44524275, 0x54554C46, 0x00000000, 0x00050005, 0x00000664, 0x6C666572, 
-0x61746365, 0x0065636E, 0x00040005, 0x00000665, 0x61726170, 0x0000006D, 0x00030005, 0x00000669, 
-0x00003046, 0x00040005, 0x0000066C, 0x61726170, 0x0000006D, 0x00040005, 0x0000066F, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000681, 0x61726170, 0x0000006D, 0x00030005, 0x0000068B, 0x0000724C, 
-0x00070005, 0x00000695, 0x6867696C, 0x6E6F4374, 0x62697274, 0x6F697475, 0x0000006E, 0x00040005, 
-0x00000696, 0x61726170, 0x0000006D, 0x00040005, 0x00000699, 0x61726170, 0x0000006D, 0x00040005, 
-0x0000069B, 0x61726170, 0x0000006D, 0x00060005, 0x0000069E, 0x436C6269, 0x72746E6F, 0x74756269, 
-0x006E6F69, 0x00040005, 0x0000069F, 0x61726170, 0x0000006D, 0x00040005, 0x000006A2, 0x61726170, 
-0x0000006D, 0x00040005, 0x000006A4, 0x61726170, 0x0000006D, 0x00050005, 0x000006A7, 0x616E6966, 
-0x6C6F436C, 0x0072756F, 0x00050005, 0x000006AF, 0x4374756F, 0x756F6C6F, 0x00000072, 0x00060005, 
-0x000006EE, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 0x00040005, 0x000006EF, 0x61726170, 
-0x0000006D, 0x00030005, 0x0000070D, 0x004F4255, 0x00060006, 0x0000070D, 0x00000000, 0x6A6F7270, 
-0x77656956, 0x00000000, 0x00060005, 0x0000070F, 0x61435F75, 0x6172656D, 0x61746144, 0x00000000, 
-0x00050005, 0x00000711, 0x64616853, 0x6144776F, 0x00006174, 0x00080006, 0x00000711, 0x00000000, 
-0x4C726944, 0x74686769, 0x7274614D, 0x73656369, 0x00000000, 0x00050005, 0x00000713, 0x69445F75, 
-0x61685372, 0x00776F64, 0x00060005, 0x00000716, 0x656E6F42, 0x6E617254, 0x726F6673, 0x0000736D, 
-0x00070006, 0x00000716, 0x00000000, 0x656E6F42, 0x6E617254, 0x726F6673, 0x0000736D, 0x00070005, 
-0x00000718, 0x6F425F75, 0x7254656E, 0x66736E61, 0x736D726F, 0x00000000, 0x00050048, 0x000001E7, 
-0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000001E7, 0x00000001, 0x00000023, 0x00000010, 
-0x00050048, 0x000001E7, 0x00000002, 0x00000023, 0x00000014, 0x00050048, 0x000001E7, 0x00000003, 
-0x00000023, 0x00000018, 0x00050048, 0x000001E7, 0x00000004, 0x00000023, 0x0000001C, 0x00050048, 
-0x000001E7, 0x00000005, 0x00000023, 0x00000020, 0x00050048, 0x000001E7, 0x00000006, 0x00000023, 
-0x00000024, 0x00050048, 0x000001E7, 0x00000007, 0x00000023, 0x00000028, 0x00050048, 0x000001E7, 
-0x00000008, 0x00000023, 0x0000002C, 0x00050048, 0x000001E7, 0x00000009, 0x00000023, 0x00000030, 
-0x00050048, 0x000001E7, 0x0000000A, 0x00000023, 0x00000034, 0x00050048, 0x000001E7, 0x0000000B, 
-0x00000023, 0x00000038, 0x00050048, 0x000001E7, 0x0000000C, 0x00000023, 0x0000003C, 0x00030047, 
-0x000001E7, 0x00000002, 0x00040047, 0x000001E9, 0x00000022, 0x00000001, 0x00040047, 0x000001E9, 
-0x00000021, 0x00000006, 0x00040047, 0x000001FF, 0x00000022, 0x00000001, 0x00040047, 0x000001FF, 
-0x00000021, 0x00000000, 0x00040047, 0x00000204, 0x0000001E, 0x00000000, 0x00040047, 0x00000223, 
-0x00000022, 0x00000001, 0x00040047, 0x00000223, 0x00000021, 0x00000001, 0x00040047, 0x0000023F, 
-0x00000022, 0x00000001, 0x00040047, 0x0000023F, 0x00000021, 0x00000002, 0x00040047, 0x00000256, 
-0x00000022, 0x00000001, 0x00040047, 0x00000256, 0x00000021, 0x00000004, 0x00040047, 0x00000272, 
-0x00000022, 0x00000001, 0x00040047, 0x00000272, 0x00000021, 0x00000005, 0x00050048, 0x000002C2, 
-0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000002C2, 0x00000001, 0x00000023, 0x00000010, 
-0x00050048, 0x000002C2, 0x00000002, 0x00000023, 0x00000020, 0x00050048, 0x000002C2, 0x00000003, 
-0x00000023, 0x00000030, 0x00050048, 0x000002C2, 0x00000004, 0x00000023, 0x00000034, 0x00050048, 
-0x000002C2, 0x00000005, 0x00000023, 0x00000038, 0x00050048, 0x000002C2, 0x00000006, 0x00000023, 
-0x0000003C, 0x00040047, 0x000002C4, 0x00000006, 0x00000040, 0x00040047, 0x000002C7, 0x00000006, 
-0x00000040, 0x00040047, 0x000002C8, 0x00000006, 0x00000010, 0x00050048, 0x000002C9, 0x00000000, 
-0x00000023, 0x00000000, 0x00040048, 0x000002C9, 0x00000001, 0x00000005, 0x00050048, 0x000002C9, 
-0x00000001, 0x00000023, 0x00000800, 0x00050048, 0x000002C9, 0x00000001, 0x00000007, 0x00000010, 
-0x00040048, 0x000002C9, 0x00000002, 0x00000005, 0x00050048, 0x000002C9, 0x00000002, 0x00000023, 
-0x00000900, 0x00050048, 0x000002C9, 0x00000002, 0x00000007, 0x00000010, 0x00040048, 0x000002C9, 
-0x00000003, 0x00000005, 0x00050048, 0x000002C9, 0x00000003, 0x00000023, 0x00000940, 0x00050048, 
-0x000002C9, 0x00000003, 0x00000007, 0x00000010, 0x00040048, 0x000002C9, 0x00000004, 0x00000005, 
-0x00050048, 0x000002C9, 0x00000004, 0x00000023, 0x00000980, 0x00050048, 0x000002C9, 0x00000004, 
-0x00000007, 0x00000010, 0x00050048, 0x000002C9, 0x00000005, 0x00000023, 0x000009C0, 0x00050048, 
-0x000002C9, 0x00000006, 0x00000023, 0x000009D0, 0x00050048, 0x000002C9, 0x00000007, 0x00000023, 
-0x00000A10, 0x00050048, 0x000002C9, 0x00000008, 0x00000023, 0x00000A14, 0x00050048, 0x000002C9, 
-0x00000009, 0x00000023, 0x00000A18, 0x00050048, 0x000002C9, 0x0000000A, 0x00000023, 0x00000A1C, 
-0x00050048, 0x000002C9, 0x0000000B, 0x00000023, 0x00000A20, 0x00050048, 0x000002C9, 0x0000000C, 
-0x00000023, 0x00000A24, 0x00050048, 0x000002C9, 0x0000000D, 0x00000023, 0x00000A28, 0x00050048, 
-0x000002C9, 0x0000000E, 0x00000023, 0x00000A2C, 0x00050048, 0x000002C9, 0x0000000F, 0x00000023, 
-0x00000A30, 0x00050048, 0x000002C9, 0x00000010, 0x00000023, 0x00000A34, 0x00050048, 0x000002C9, 
-0x00000011, 0x00000023, 0x00000A38, 0x00050048, 0x000002C9, 0x00000012, 0x00000023, 0x00000A3C, 
-0x00030047, 0x000002C9, 0x00000002, 0x00040047, 0x000002CB, 0x00000022, 0x00000002, 0x00040047, 
-0x000002CB, 0x00000021, 0x00000005, 0x00040047, 0x00000314, 0x0000000B, 0x0000000F, 0x00040047, 
-0x000003A3, 0x00000022, 0x00000002, 0x00040047, 0x000003A3, 0x00000021, 0x00000000, 0x00040047, 
-0x00000531, 0x00000022, 0x00000002, 0x00040047, 0x00000531, 0x00000021, 0x00000002, 0x00040047, 
-0x00000554, 0x00000022, 0x00000002, 0x00040047, 0x00000554, 0x00000021, 0x00000001, 0x00040047, 
-0x000005E2, 0x00000022, 0x00000001, 0x00040047, 0x000005E2, 0x00000021, 0x00000003, 0x00040047, 
-0x0000060C, 0x00000022, 0x00000002, 0x00040047, 0x0000060C, 0x00000021, 0x00000004, 0x00040047, 
-0x0000065A, 0x00000022, 0x00000002, 0x00040047, 0x0000065A, 0x00000021, 0x00000003, 0x00040047, 
-0x000006AF, 0x0000001E, 0x00000000, 0x00040048, 0x0000070D, 0x00000000, 0x00000005, 0x00050048, 
-0x0000070D, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000070D, 0x00000000, 0x00000007, 
-0x00000010, 0x00030047, 0x0000070D, 0x00000002, 0x00040047, 0x0000070F, 0x00000022, 0x00000000, 
-0x00040047, 0x0000070F, 0x00000021, 0x00000000, 0x00040047, 0x00000710, 0x00000006, 0x00000040, 
-0x00040048, 0x00000711, 0x00000000, 0x00000005, 0x00050048, 0x00000711, 0x00000000, 0x00000023, 
-0x00000000, 0x00050048, 0x00000711, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x00000711, 
-0x00000002, 0x00040047, 0x00000713, 0x00000022, 0x00000000, 0x00040047, 0x00000713, 0x00000021, 
-0x00000001, 0x00040047, 0x00000715, 0x00000006, 0x00000040, 0x00040048, 0x00000716, 0x00000000, 
-0x00000005, 0x00050048, 0x00000716, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000716, 
-0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x00000716, 0x00000002, 0x00040047, 0x00000718, 
-0x00000022, 0x00000003, 0x00040047, 0x00000718, 0x00000021, 0x00000000, 0x00020013, 0x00000002, 
-0x00030021, 0x00000003, 0x00000002, 0x00030016, 0x00000006, 0x00000020, 0x00040020, 0x00000007, 
-0x00000007, 0x00000006, 0x00040021, 0x00000008, 0x00000006, 0x00000007, 0x00040017, 0x0000000C, 
-0x00000006, 0x00000003, 0x00040020, 0x0000000D, 0x00000007, 0x0000000C, 0x00040021, 0x0000000E, 
-0x0000000C, 0x0000000D, 0x00040017, 0x00000012, 0x00000006, 0x00000004, 0x00040020, 0x00000013, 
-0x00000007, 0x00000012, 0x00040021, 0x00000014, 0x00000012, 0x00000013, 0x00070021, 0x0000001B, 
-0x00000006, 0x00000007, 0x00000007, 0x0000000C, 0x0000000C, 0x00060021, 0x00000022, 0x0000000C, 
-0x0000000C, 0x00000007, 0x00000007, 0x00060021, 0x00000028, 0x00000006, 0x00000007, 0x00000007, 
-0x00000007, 0x00070021, 0x0000002E, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 
-0x00050021, 0x0000003A, 0x00000006, 0x00000007, 0x00000007, 0x00050021, 0x00000048, 0x0000000C, 
-0x00000012, 0x00000007, 0x00060021, 0x0000004D, 0x0000000C, 0x00000012, 0x00000007, 0x00000007, 
-0x00050021, 0x00000064, 0x0000000C, 0x0000000C, 0x00000007, 0x00060021, 0x00000069, 0x0000000C, 
-0x0000000D, 0x00000007, 0x00000007, 0x00030021, 0x0000006F, 0x00000012, 0x00030021, 0x00000072, 
-0x0000000C, 0x00030021, 0x00000075, 0x00000006, 0x00040017, 0x0000007D, 0x00000006, 0x00000002, 
-0x00040020, 0x0000007E, 0x00000007, 0x0000007D, 0x00040021, 0x0000007F, 0x00000006, 0x0000007E, 
-0x00040015, 0x00000083, 0x00000020, 0x00000001, 0x00040020, 0x00000084, 0x00000007, 0x00000083, 
-0x00060021, 0x00000085, 0x0000007D, 0x00000084, 0x00000007, 0x00000007, 0x00040021, 0x0000008B, 
-0x00000006, 0x00000013, 0x00050021, 0x0000008F, 0x00000006, 0x0000000D, 0x00000084, 0x00060021, 
-0x00000094, 0x00000006, 0x0000000D, 0x0000000D, 0x00000084, 0x00090019, 0x0000009D, 0x00000006, 
-0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x0000009E, 
-0x0000009D, 0x00040020, 0x0000009F, 0x00000000, 0x0000009E, 0x000A0021, 0x000000A0, 0x00000006, 
-0x0000009F, 0x00000013, 0x00000007, 0x0000000D, 0x0000000D, 0x0000000D, 0x00000084, 0x00040021, 
-0x000000AA, 0x00000083, 0x0000000D, 0x00070021, 0x000000AE, 0x00000006, 0x0000000D, 0x00000084, 
-0x0000000D, 0x0000000D, 0x000F001E, 0x000000B5, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 
-0x00000006, 0x0000000C, 0x0000000C, 0x00000006, 0x0000000C, 0x00000006, 0x0000000C, 0x0000000C, 
-0x0000007D, 0x0009001E, 0x000000B6, 0x00000012, 0x00000012, 0x00000012, 0x00000006, 0x00000006, 
-0x00000006, 0x00000006, 0x000A0021, 0x000000B7, 0x0000000C, 0x000000B5, 0x000000B6, 0x0000000C, 
-0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00070021, 0x000000C1, 0x0000000C, 0x000000B5, 
-0x00000007, 0x00000007, 0x00000007, 0x00040020, 0x000000D1, 0x00000007, 0x000000B5, 0x00060021, 
-0x000000D2, 0x0000000C, 0x0000000D, 0x0000000D, 0x000000D1, 0x00040020, 0x000000DD, 0x00000006, 
-0x00000006, 0x0004003B, 0x000000DD, 0x000000DE, 0x00000006, 0x0004002B, 0x00000006, 0x000000DF, 
-0x3F800000, 0x0004003B, 0x000000DD, 0x000000E0, 0x00000006, 0x0004002B, 0x00000006, 0x000000E1, 
-0x3FCF1BBD, 0x0004002B, 0x00000006, 0x000000EE, 0x400CCCCD, 0x0006002C, 0x0000000C, 0x000000EF, 
-0x000000EE, 0x000000EE, 0x000000EE, 0x00040015, 0x000000F7, 0x00000020, 0x00000000, 0x0004002B, 
-0x000000F7, 0x000000F8, 0x00000003, 0x0004002B, 0x00000006, 0x00000102, 0x00000000, 0x0004002B, 
-0x00000006, 0x0000011A, 0x3EA2F983, 0x0004002B, 0x00000006, 0x0000011D, 0x477FE000, 0x0004002B, 
-0x00000006, 0x00000132, 0x40A00000, 0x0004002B, 0x00000006, 0x00000139, 0x3F000000, 0x0004002B, 
-0x00000006, 0x0000013A, 0x40000000, 0x0004002B, 0x00000006, 0x0000017E, 0x3F7FF972, 0x0004002B, 
-0x00000006, 0x00000199, 0x3DCCCCCD, 0x0004002B, 0x00000006, 0x000001AE, 0x3E23D70A, 0x0004002B, 
-0x00000006, 0x000001CB, 0x41840000, 0x0006002C, 0x0000000C, 0x000001CC, 0x000001CB, 0x000001CB, 
-0x000001CB, 0x000F001E, 0x000001E7, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
+0x00070006, 0x000002C9, 0x00000000, 0x64616853, 0x7254776F, 0x66736E61, 0x006D726F, 0x00060006, 
+0x000002C9, 0x00000001, 0x77656956, 0x7274614D, 0x00007869, 0x00060006, 0x000002C9, 0x00000002, 
+0x6867694C, 0x65695674, 0x00000077, 0x00060006, 0x000002C9, 0x00000003, 0x73616942, 0x7274614D, 
+0x00007869, 0x00080006, 0x000002C9, 0x00000004, 0x6A6F7250, 0x69746365, 0x614D6E6F, 0x78697274, 
+0x00000000, 0x00070006, 0x000002C9, 0x00000005, 0x656D6163, 0x6F506172, 0x69746973, 0x00006E6F, 
+0x00060006, 0x000002C9, 0x00000006, 0x696C7053, 0x70654474, 0x00736874, 0x00070006, 0x000002C9, 
+0x00000007, 0x73756C43, 0x50726574, 0x6D617261, 0x00000073, 0x00060006, 0x000002C9, 0x00000008, 
+0x6867694C, 0x7A695374, 0x00000065, 0x00070006, 0x000002C9, 0x00000009, 0x5378614D, 0x6F646168, 
+0x73694477, 0x00000074, 0x00060006, 0x000002C9, 0x0000000A, 0x64616853, 0x6146776F, 0x00006564, 
+0x00060006, 0x000002C9, 0x0000000B, 0x63736143, 0x46656461, 0x00656461, 0x00060006, 0x000002C9, 
+0x0000000C, 0x6867694C, 0x756F4374, 0x0000746E, 0x00060006, 0x000002C9, 0x0000000D, 0x64616853, 
+0x6F43776F, 0x00746E75, 0x00050006, 0x000002C9, 0x0000000E, 0x65646F4D, 0x00000000, 0x00060006, 
+0x000002C9, 0x0000000F, 0x4D766E45, 0x6F437069, 0x00746E75, 0x00060006, 0x000002C9, 0x00000010, 
+0x74696E49, 0x426C6169, 0x00736169, 0x00050006, 0x000002C9, 0x00000011, 0x74646957, 0x00000068, 
+0x00050006, 0x000002C9, 0x00000012, 0x67696548, 0x00007468, 0x00070006, 0x000002C9, 0x00000013, 
+0x64616873, 0x6E45776F, 0x656C6261, 0x00000064, 0x00090006, 0x000002C9, 0x00000014, 0x65726944, 
+0x6F697463, 0x4C6C616E, 0x74686769, 0x6E756F43, 0x00000074, 0x00050005, 0x000002CB, 0x63535F75, 
+0x44656E65, 0x00617461, 0x00040005, 0x000002CF, 0x73616962, 0x00000000, 0x00040005, 0x000002DB, 
+0x6967616D, 0x00000063, 0x00040005, 0x000002EC, 0x73616962, 0x00000000, 0x00040005, 0x000002ED, 
+0x61726170, 0x0000006D, 0x00040005, 0x000002EF, 0x61726170, 0x0000006D, 0x00040005, 0x000002F1, 
+0x61726170, 0x0000006D, 0x00030005, 0x000002F4, 0x006D7573, 0x00040005, 0x000002F5, 0x73696F6E, 
+0x00000065, 0x00040005, 0x000002F6, 0x61726170, 0x0000006D, 0x00090005, 0x000002FA, 0x53766E69, 
+0x72617571, 0x6F6F5265, 0x6D615374, 0x73656C70, 0x6E756F43, 0x00000074, 0x00050005, 0x000002FB, 
+0x6F6F6C66, 0x50646572, 0x0000736F, 0x00040005, 0x00000300, 0x65646E69, 0x00000078, 0x00040005, 
+0x00000302, 0x61726170, 0x0000006D, 0x00040005, 0x00000304, 0x61726170, 0x0000006D, 0x00030005, 
+0x0000030A, 0x00000069, 0x00040005, 0x00000312, 0x7366666F, 0x00007465, 0x00060005, 0x00000314, 
+0x465F6C67, 0x43676172, 0x64726F6F, 0x00000000, 0x00040005, 0x00000315, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000319, 0x61726170, 0x0000006D, 0x00040005, 0x0000031B, 0x61726170, 0x0000006D, 
+0x00040005, 0x0000031D, 0x61726170, 0x0000006D, 0x00030005, 0x00000322, 0x0000007A, 0x00060005, 
+0x0000033E, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 0x00040005, 0x0000033F, 0x77656976, 
+0x00736F50, 0x00030005, 0x00000349, 0x00000069, 0x00060005, 0x00000365, 0x64616873, 0x6944776F, 
+0x6E617473, 0x00006563, 0x00070005, 0x00000369, 0x6E617274, 0x69746973, 0x69446E6F, 0x6E617473, 
+0x00006563, 0x00040005, 0x0000036C, 0x77656976, 0x00736F50, 0x00050005, 0x00000375, 0x74736964, 
+0x65636E61, 0x00000000, 0x00050005, 0x00000383, 0x64616873, 0x6F43776F, 0x0064726F, 0x00040005, 
+0x00000395, 0x5241454E, 0x00000000, 0x00050005, 0x00000397, 0x61527675, 0x73756964, 0x00000000, 
+0x00060005, 0x000003A2, 0x64616873, 0x6D41776F, 0x746E756F, 0x00000000, 0x00050005, 0x000003A3, 
+0x61685375, 0x4D776F64, 0x00007061, 0x00040005, 0x000003A4, 0x61726170, 0x0000006D, 0x00040005, 
+0x000003A6, 0x61726170, 0x0000006D, 0x00040005, 0x000003A8, 0x61726170, 0x0000006D, 0x00040005, 
+0x000003AA, 0x61726170, 0x0000006D, 0x00040005, 0x000003AC, 0x61726170, 0x0000006D, 0x00040005, 
+0x000003AE, 0x61726170, 0x0000006D, 0x00050005, 0x000003B1, 0x63736163, 0x46656461, 0x00656461, 
+0x00050005, 0x000003BE, 0x63736163, 0x4E656461, 0x00747865, 0x00060005, 0x000003D8, 0x64616873, 
+0x6D41776F, 0x746E756F, 0x00000031, 0x00040005, 0x000003D9, 0x61726170, 0x0000006D, 0x00040005, 
+0x000003DB, 0x61726170, 0x0000006D, 0x00040005, 0x000003DD, 0x61726170, 0x0000006D, 0x00040005, 
+0x000003DF, 0x61726170, 0x0000006D, 0x00040005, 0x000003E1, 0x61726170, 0x0000006D, 0x00040005, 
+0x000003E3, 0x61726170, 0x0000006D, 0x00030005, 0x000003F1, 0x00000044, 0x00040005, 0x000003F3, 
+0x61726170, 0x0000006D, 0x00040005, 0x000003F5, 0x61726170, 0x0000006D, 0x00030005, 0x000003F8, 
+0x00000056, 0x00040005, 0x000003F9, 0x61726170, 0x0000006D, 0x00040005, 0x000003FB, 0x61726170, 
+0x0000006D, 0x00040005, 0x000003FD, 0x61726170, 0x0000006D, 0x00030005, 0x00000400, 0x00000046, 
+0x00040005, 0x00000402, 0x61726170, 0x0000006D, 0x00040005, 0x0000040E, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000410, 0x61726170, 0x0000006D, 0x00040005, 0x00000412, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000414, 0x61726170, 0x0000006D, 0x00040005, 0x0000041A, 0x61726170, 0x0000006D, 
+0x00040005, 0x0000041C, 0x61726170, 0x0000006D, 0x00040005, 0x0000041E, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000420, 0x61726170, 0x0000006D, 0x00040005, 0x00000425, 0x75736572, 0x0000746C, 
+0x00030005, 0x00000427, 0x00000069, 0x00040005, 0x00000433, 0x6867696C, 0x00000074, 0x00040005, 
+0x00000447, 0x756C6176, 0x00000065, 0x00030005, 0x0000044D, 0x0000004C, 0x00040005, 0x00000453, 
+0x74736964, 0x00000000, 0x00040005, 0x00000458, 0x65747461, 0x0000006E, 0x00050005, 0x0000045F, 
+0x65747461, 0x7461756E, 0x006E6F69, 0x00030005, 0x00000478, 0x0000004C, 0x00050005, 0x0000047E, 
+0x6F747563, 0x6E416666, 0x00656C67, 0x00040005, 0x00000482, 0x74736964, 0x00000000, 0x00040005, 
+0x00000487, 0x74656874, 0x00000061, 0x00040005, 0x0000048D, 0x69737065, 0x006E6F6C, 0x00050005, 
+0x00000493, 0x65747461, 0x7461756E, 0x006E6F69, 0x00040005, 0x000004A4, 0x746F446E, 0x0000004C, 
+0x00060005, 0x000004B4, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 0x00040005, 0x000004B5, 
+0x61726170, 0x0000006D, 0x00040005, 0x000004B8, 0x61726170, 0x0000006D, 0x00040005, 0x000004BA, 
+0x61726170, 0x0000006D, 0x00040005, 0x000004BC, 0x61726170, 0x0000006D, 0x00040005, 0x000004C0, 
+0x61726170, 0x0000006D, 0x00030005, 0x000004C5, 0x0000694C, 0x00050005, 0x000004C9, 0x6461724C, 
+0x636E6169, 0x00000065, 0x00030005, 0x000004D0, 0x0000684C, 0x00050005, 0x000004D6, 0x6867696C, 
+0x4C6F4E74, 0x00000000, 0x00040005, 0x000004DB, 0x61726170, 0x0000006D, 0x00030005, 0x000004DD, 
+0x00000068, 0x00050005, 0x000004E3, 0x64616873, 0x5F676E69, 0x00566F4E, 0x00040005, 0x000004E9, 
+0x61726170, 0x0000006D, 0x00030005, 0x000004EB, 0x00566F4E, 0x00030005, 0x000004ED, 0x004C6F4E, 
+0x00040005, 0x000004EE, 0x61726170, 0x0000006D, 0x00030005, 0x000004F1, 0x00486F4E, 0x00040005, 
+0x000004F6, 0x61726170, 0x0000006D, 0x00030005, 0x000004F8, 0x00486F4C, 0x00040005, 0x000004FC, 
+0x61726170, 0x0000006D, 0x00030005, 0x000004FE, 0x00006446, 0x00040005, 0x00000500, 0x61726170, 
+0x0000006D, 0x00040005, 0x00000502, 0x61726170, 0x0000006D, 0x00040005, 0x00000504, 0x61726170, 
+0x0000006D, 0x00030005, 0x00000507, 0x00007246, 0x00040005, 0x0000050B, 0x61726170, 0x0000006D, 
+0x00040005, 0x0000050D, 0x61726170, 0x0000006D, 0x00040005, 0x0000050F, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000511, 0x61726170, 0x0000006D, 0x00040005, 0x00000514, 0x6F6C6F63, 0x00007275, 
+0x00040005, 0x0000051E, 0x61726170, 0x0000006D, 0x00040005, 0x00000520, 0x61726170, 0x0000006D, 
+0x00050005, 0x0000052D, 0x61727269, 0x6E616964, 0x00006563, 0x00040005, 0x00000531, 0x72724975, 
+0x0070614D, 0x00030005, 0x00000537, 0x00000046, 0x00040005, 0x00000538, 0x61726170, 0x0000006D, 
+0x00040005, 0x0000053A, 0x61726170, 0x0000006D, 0x00040005, 0x0000053D, 0x61726170, 0x0000006D, 
+0x00030005, 0x00000541, 0x0000646B, 0x00050005, 0x00000549, 0x66666964, 0x49657375, 0x00004C42, 
+0x00080005, 0x0000054F, 0x6E455F75, 0x64615276, 0x636E6169, 0x78655465, 0x6576654C, 0x0000736C, 
+0x00070005, 0x00000553, 0x63657073, 0x72616C75, 0x61727249, 0x6E616964, 0x00006563, 0x00040005, 
+0x00000554, 0x766E4575, 0x0070614D, 0x00050005, 0x0000055E, 0x63657073, 0x72616C75, 0x004C4249, 
+0x00050005, 0x00000571, 0x43786574, 0x756F6C6F, 0x00000072, 0x00050005, 0x0000057B, 0x6174656D, 
+0x63696C6C, 0x00000000, 0x00050005, 0x0000057C, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 
+0x0000058B, 0x00786574, 0x00030005, 0x000005AF, 0x00786574, 0x00050005, 0x000005CD, 0x6574616D, 
+0x6C616972, 0x00000000, 0x00050005, 0x000005E2, 0x6F4E5F75, 0x6C616D72, 0x0070614D, 0x00040005, 
+0x000005FB, 0x61726170, 0x0000006D, 0x00030005, 0x00000601, 0x00007675, 0x00040005, 0x0000060B, 
+0x6F617373, 0x00000000, 0x00050005, 0x0000060C, 0x41535375, 0x70614D4F, 0x00000000, 0x00040005, 
+0x0000061B, 0x61726170, 0x0000006D, 0x00050005, 0x00000620, 0x67756F72, 0x73656E68, 0x00003273, 
+0x00040005, 0x00000624, 0x75646E64, 0x00000000, 0x00040005, 0x00000628, 0x76646E64, 0x00000000, 
+0x00050005, 0x0000062C, 0x69726176, 0x65636E61, 0x00000000, 0x00070005, 0x00000634, 0x6E72656B, 
+0x6F526C65, 0x6E686775, 0x32737365, 0x00000000, 0x00070005, 0x00000639, 0x746C6966, 0x64657265, 
+0x67756F52, 0x73656E68, 0x00003273, 0x00040005, 0x0000063D, 0x61726170, 0x0000006D, 0x00040005, 
+0x00000647, 0x6F507377, 0x00000073, 0x00050005, 0x0000065A, 0x44524275, 0x54554C46, 0x00000000, 
+0x00050005, 0x00000664, 0x6C666572, 0x61746365, 0x0065636E, 0x00040005, 0x00000665, 0x61726170, 
+0x0000006D, 0x00030005, 0x00000669, 0x00003046, 0x00040005, 0x0000066C, 0x61726170, 0x0000006D, 
+0x00040005, 0x0000066F, 0x61726170, 0x0000006D, 0x00040005, 0x00000681, 0x61726170, 0x0000006D, 
+0x00030005, 0x0000068B, 0x0000724C, 0x00070005, 0x00000695, 0x6867696C, 0x6E6F4374, 0x62697274, 
+0x6F697475, 0x0000006E, 0x00040005, 0x00000696, 0x61726170, 0x0000006D, 0x00040005, 0x00000699, 
+0x61726170, 0x0000006D, 0x00040005, 0x0000069B, 0x61726170, 0x0000006D, 0x00060005, 0x0000069E, 
+0x436C6269, 0x72746E6F, 0x74756269, 0x006E6F69, 0x00040005, 0x0000069F, 0x61726170, 0x0000006D, 
+0x00040005, 0x000006A2, 0x61726170, 0x0000006D, 0x00040005, 0x000006A4, 0x61726170, 0x0000006D, 
+0x00050005, 0x000006A7, 0x616E6966, 0x6C6F436C, 0x0072756F, 0x00050005, 0x000006AF, 0x4374756F, 
+0x756F6C6F, 0x00000072, 0x00060005, 0x000006EE, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 
+0x00040005, 0x000006EF, 0x61726170, 0x0000006D, 0x00030005, 0x0000070D, 0x004F4255, 0x00060006, 
+0x0000070D, 0x00000000, 0x6A6F7270, 0x77656956, 0x00000000, 0x00060005, 0x0000070F, 0x61435F75, 
+0x6172656D, 0x61746144, 0x00000000, 0x00050005, 0x00000711, 0x64616853, 0x6144776F, 0x00006174, 
+0x00080006, 0x00000711, 0x00000000, 0x4C726944, 0x74686769, 0x7274614D, 0x73656369, 0x00000000, 
+0x00050005, 0x00000713, 0x69445F75, 0x61685372, 0x00776F64, 0x00050005, 0x0000081A, 0x6867694C, 
+0x74614474, 0x00000061, 0x00050006, 0x0000081A, 0x00000000, 0x6867696C, 0x00007374, 0x00050005, 
+0x0000081C, 0x694C5F75, 0x44746867, 0x00617461, 0x00070005, 0x00000820, 0x6867694C, 0x756C4374, 
+0x72657473, 0x61746144, 0x00000000, 0x00060006, 0x00000820, 0x00000000, 0x73756C43, 0x73726574, 
+0x00000000, 0x00060005, 0x00000822, 0x694C5F75, 0x43746867, 0x7473756C, 0x00737265, 0x00060005, 
+0x00000825, 0x6867694C, 0x646E4974, 0x61447865, 0x00006174, 0x00050006, 0x00000825, 0x00000000, 
+0x69646E49, 0x00736563, 0x00060005, 0x00000827, 0x694C5F75, 0x49746867, 0x6369646E, 0x00007365, 
+0x00080005, 0x00000836, 0x4C746547, 0x74686769, 0x73756C43, 0x28726574, 0x3B336676, 0x00000000, 
+0x00040005, 0x00000837, 0x6F507377, 0x00000073, 0x00040005, 0x0000085E, 0x61726170, 0x0000006D, 
+0x00050048, 0x000001E7, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000001E7, 0x00000001, 
+0x00000023, 0x00000010, 0x00050048, 0x000001E7, 0x00000002, 0x00000023, 0x00000014, 0x00050048, 
+0x000001E7, 0x00000003, 0x00000023, 0x00000018, 0x00050048, 0x000001E7, 0x00000004, 0x00000023, 
+0x0000001C, 0x00050048, 0x000001E7, 0x00000005, 0x00000023, 0x00000020, 0x00050048, 0x000001E7, 
+0x00000006, 0x00000023, 0x00000024, 0x00050048, 0x000001E7, 0x00000007, 0x00000023, 0x00000028, 
+0x00050048, 0x000001E7, 0x00000008, 0x00000023, 0x0000002C, 0x00050048, 0x000001E7, 0x00000009, 
+0x00000023, 0x00000030, 0x00050048, 0x000001E7, 0x0000000A, 0x00000023, 0x00000034, 0x00050048, 
+0x000001E7, 0x0000000B, 0x00000023, 0x00000038, 0x00050048, 0x000001E7, 0x0000000C, 0x00000023, 
+0x0000003C, 0x00030047, 0x000001E7, 0x00000002, 0x00040047, 0x000001E9, 0x00000022, 0x00000001, 
+0x00040047, 0x000001E9, 0x00000021, 0x00000006, 0x00040047, 0x000001FF, 0x00000022, 0x00000001, 
+0x00040047, 0x000001FF, 0x00000021, 0x00000000, 0x00040047, 0x00000204, 0x0000001E, 0x00000000, 
+0x00040047, 0x00000223, 0x00000022, 0x00000001, 0x00040047, 0x00000223, 0x00000021, 0x00000001, 
+0x00040047, 0x0000023F, 0x00000022, 0x00000001, 0x00040047, 0x0000023F, 0x00000021, 0x00000002, 
+0x00040047, 0x00000256, 0x00000022, 0x00000001, 0x00040047, 0x00000256, 0x00000021, 0x00000004, 
+0x00040047, 0x00000272, 0x00000022, 0x00000001, 0x00040047, 0x00000272, 0x00000021, 0x00000005, 
+0x00050048, 0x000002C2, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000002C2, 0x00000001, 
+0x00000023, 0x00000010, 0x00050048, 0x000002C2, 0x00000002, 0x00000023, 0x00000020, 0x00050048, 
+0x000002C2, 0x00000003, 0x00000023, 0x00000030, 0x00050048, 0x000002C2, 0x00000004, 0x00000023, 
+0x00000034, 0x00050048, 0x000002C2, 0x00000005, 0x00000023, 0x00000038, 0x00050048, 0x000002C2, 
+0x00000006, 0x00000023, 0x0000003C, 0x00040047, 0x000002C7, 0x00000006, 0x00000040, 0x00040047, 
+0x000002C8, 0x00000006, 0x00000010, 0x00040048, 0x000002C9, 0x00000000, 0x00000005, 0x00050048, 
+0x000002C9, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000002C9, 0x00000000, 0x00000007, 
+0x00000010, 0x00040048, 0x000002C9, 0x00000001, 0x00000005, 0x00050048, 0x000002C9, 0x00000001, 
+0x00000023, 0x00000100, 0x00050048, 0x000002C9, 0x00000001, 0x00000007, 0x00000010, 0x00040048, 
+0x000002C9, 0x00000002, 0x00000005, 0x00050048, 0x000002C9, 0x00000002, 0x00000023, 0x00000140, 
+0x00050048, 0x000002C9, 0x00000002, 0x00000007, 0x00000010, 0x00040048, 0x000002C9, 0x00000003, 
+0x00000005, 0x00050048, 0x000002C9, 0x00000003, 0x00000023, 0x00000180, 0x00050048, 0x000002C9, 
+0x00000003, 0x00000007, 0x00000010, 0x00040048, 0x000002C9, 0x00000004, 0x00000005, 0x00050048, 
+0x000002C9, 0x00000004, 0x00000023, 0x000001C0, 0x00050048, 0x000002C9, 0x00000004, 0x00000007, 
+0x00000010, 0x00050048, 0x000002C9, 0x00000005, 0x00000023, 0x00000200, 0x00050048, 0x000002C9, 
+0x00000006, 0x00000023, 0x00000210, 0x00050048, 0x000002C9, 0x00000007, 0x00000023, 0x00000250, 
+0x00050048, 0x000002C9, 0x00000008, 0x00000023, 0x00000260, 0x00050048, 0x000002C9, 0x00000009, 
+0x00000023, 0x00000264, 0x00050048, 0x000002C9, 0x0000000A, 0x00000023, 0x00000268, 0x00050048, 
+0x000002C9, 0x0000000B, 0x00000023, 0x0000026C, 0x00050048, 0x000002C9, 0x0000000C, 0x00000023, 
+0x00000270, 0x00050048, 0x000002C9, 0x0000000D, 0x00000023, 0x00000274, 0x00050048, 0x000002C9, 
+0x0000000E, 0x00000023, 0x00000278, 0x00050048, 0x000002C9, 0x0000000F, 0x00000023, 0x0000027C, 
+0x00050048, 0x000002C9, 0x00000010, 0x00000023, 0x00000280, 0x00050048, 0x000002C9, 0x00000011, 
+0x00000023, 0x00000284, 0x00050048, 0x000002C9, 0x00000012, 0x00000023, 0x00000288, 0x00050048, 
+0x000002C9, 0x00000013, 0x00000023, 0x0000028C, 0x00050048, 0x000002C9, 0x00000014, 0x00000023, 
+0x00000290, 0x00030047, 0x000002C9, 0x00000002, 0x00040047, 0x000002CB, 0x00000022, 0x00000002, 
+0x00040047, 0x000002CB, 0x00000021, 0x00000005, 0x00040047, 0x00000314, 0x0000000B, 0x0000000F, 
+0x00040047, 0x000003A3, 0x00000022, 0x00000002, 0x00040047, 0x000003A3, 0x00000021, 0x00000000, 
+0x00040047, 0x00000531, 0x00000022, 0x00000002, 0x00040047, 0x00000531, 0x00000021, 0x00000002, 
+0x00040047, 0x00000554, 0x00000022, 0x00000002, 0x00040047, 0x00000554, 0x00000021, 0x00000001, 
+0x00040047, 0x000005E2, 0x00000022, 0x00000001, 0x00040047, 0x000005E2, 0x00000021, 0x00000003, 
+0x00040047, 0x0000060C, 0x00000022, 0x00000002, 0x00040047, 0x0000060C, 0x00000021, 0x00000004, 
+0x00040047, 0x0000065A, 0x00000022, 0x00000002, 0x00040047, 0x0000065A, 0x00000021, 0x00000003, 
+0x00040047, 0x000006AF, 0x0000001E, 0x00000000, 0x00040048, 0x0000070D, 0x00000000, 0x00000005, 
+0x00050048, 0x0000070D, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000070D, 0x00000000, 
+0x00000007, 0x00000010, 0x00030047, 0x0000070D, 0x00000002, 0x00040047, 0x0000070F, 0x00000022, 
+0x00000000, 0x00040047, 0x0000070F, 0x00000021, 0x00000000, 0x00040047, 0x00000710, 0x00000006, 
+0x00000040, 0x00040048, 0x00000711, 0x00000000, 0x00000005, 0x00050048, 0x00000711, 0x00000000, 
+0x00000023, 0x00000000, 0x00050048, 0x00000711, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 
+0x00000711, 0x00000002, 0x00040047, 0x00000713, 0x00000022, 0x00000000, 0x00040047, 0x00000713, 
+0x00000021, 0x00000001, 0x00040047, 0x00000819, 0x00000006, 0x00000040, 0x00040048, 0x0000081A, 
+0x00000000, 0x00000018, 0x00050048, 0x0000081A, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 
+0x0000081A, 0x00000003, 0x00040047, 0x0000081C, 0x00000022, 0x00000002, 0x00040047, 0x0000081C, 
+0x00000021, 0x00000006, 0x00040047, 0x0000081F, 0x00000006, 0x00000008, 0x00040048, 0x00000820, 
+0x00000000, 0x00000018, 0x00050048, 0x00000820, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 
+0x00000820, 0x00000003, 0x00040047, 0x00000822, 0x00000022, 0x00000002, 0x00040047, 0x00000822, 
+0x00000021, 0x00000007, 0x00040047, 0x00000824, 0x00000006, 0x00000004, 0x00040048, 0x00000825, 
+0x00000000, 0x00000018, 0x00050048, 0x00000825, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 
+0x00000825, 0x00000003, 0x00040047, 0x00000827, 0x00000022, 0x00000002, 0x00040047, 0x00000827, 
+0x00000021, 0x00000008, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00030016, 
+0x00000006, 0x00000020, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040021, 0x00000008, 
+0x00000006, 0x00000007, 0x00040017, 0x0000000C, 0x00000006, 0x00000003, 0x00040020, 0x0000000D, 
+0x00000007, 0x0000000C, 0x00040021, 0x0000000E, 0x0000000C, 0x0000000D, 0x00040017, 0x00000012, 
+0x00000006, 0x00000004, 0x00040020, 0x00000013, 0x00000007, 0x00000012, 0x00040021, 0x00000014, 
+0x00000012, 0x00000013, 0x00070021, 0x0000001B, 0x00000006, 0x00000007, 0x00000007, 0x0000000C, 
+0x0000000C, 0x00060021, 0x00000022, 0x0000000C, 0x0000000C, 0x00000007, 0x00000007, 0x00060021, 
+0x00000028, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00070021, 0x0000002E, 0x00000006, 
+0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00050021, 0x0000003A, 0x00000006, 0x00000007, 
+0x00000007, 0x00050021, 0x00000048, 0x0000000C, 0x00000012, 0x00000007, 0x00060021, 0x0000004D, 
+0x0000000C, 0x00000012, 0x00000007, 0x00000007, 0x00050021, 0x00000064, 0x0000000C, 0x0000000C, 
+0x00000007, 0x00060021, 0x00000069, 0x0000000C, 0x0000000D, 0x00000007, 0x00000007, 0x00030021, 
+0x0000006F, 0x00000012, 0x00030021, 0x00000072, 0x0000000C, 0x00030021, 0x00000075, 0x00000006, 
+0x00040017, 0x0000007D, 0x00000006, 0x00000002, 0x00040020, 0x0000007E, 0x00000007, 0x0000007D, 
+0x00040021, 0x0000007F, 0x00000006, 0x0000007E, 0x00040015, 0x00000083, 0x00000020, 0x00000001, 
+0x00040020, 0x00000084, 0x00000007, 0x00000083, 0x00060021, 0x00000085, 0x0000007D, 0x00000084, 
+0x00000007, 0x00000007, 0x00040021, 0x0000008B, 0x00000006, 0x00000013, 0x00050021, 0x0000008F, 
+0x00000006, 0x0000000D, 0x00000084, 0x00060021, 0x00000094, 0x00000006, 0x0000000D, 0x0000000D, 
+0x00000084, 0x00090019, 0x0000009D, 0x00000006, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 
+0x00000001, 0x00000000, 0x0003001B, 0x0000009E, 0x0000009D, 0x00040020, 0x0000009F, 0x00000000, 
+0x0000009E, 0x000A0021, 0x000000A0, 0x00000006, 0x0000009F, 0x00000013, 0x00000007, 0x0000000D, 
+0x0000000D, 0x0000000D, 0x00000084, 0x00040021, 0x000000AA, 0x00000083, 0x0000000D, 0x00070021, 
+0x000000AE, 0x00000006, 0x0000000D, 0x00000084, 0x0000000D, 0x0000000D, 0x000F001E, 0x000000B5, 
+0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000000C, 0x0000000C, 0x00000006, 
+0x0000000C, 0x00000006, 0x0000000C, 0x0000000C, 0x0000007D, 0x0009001E, 0x000000B6, 0x00000012, 
+0x00000012, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x000A0021, 0x000000B7, 
+0x0000000C, 0x000000B5, 0x000000B6, 0x0000000C, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 
+0x00070021, 0x000000C1, 0x0000000C, 0x000000B5, 0x00000007, 0x00000007, 0x00000007, 0x00040020, 
+0x000000D1, 0x00000007, 0x000000B5, 0x00060021, 0x000000D2, 0x0000000C, 0x0000000D, 0x0000000D, 
+0x000000D1, 0x00040020, 0x000000DD, 0x00000006, 0x00000006, 0x0004003B, 0x000000DD, 0x000000DE, 
+0x00000006, 0x0004002B, 0x00000006, 0x000000DF, 0x3F800000, 0x0004003B, 0x000000DD, 0x000000E0, 
+0x00000006, 0x0004002B, 0x00000006, 0x000000E1, 0x3FCF1BBD, 0x0004002B, 0x00000006, 0x000000EE, 
+0x400CCCCD, 0x0006002C, 0x0000000C, 0x000000EF, 0x000000EE, 0x000000EE, 0x000000EE, 0x00040015, 
+0x000000F7, 0x00000020, 0x00000000, 0x0004002B, 0x000000F7, 0x000000F8, 0x00000003, 0x0004002B, 
+0x00000006, 0x00000102, 0x00000000, 0x0004002B, 0x00000006, 0x0000011A, 0x3EA2F983, 0x0004002B, 
+0x00000006, 0x0000011D, 0x477FE000, 0x0004002B, 0x00000006, 0x00000132, 0x40A00000, 0x0004002B, 
+0x00000006, 0x00000139, 0x3F000000, 0x0004002B, 0x00000006, 0x0000013A, 0x40000000, 0x0004002B, 
+0x00000006, 0x0000017E, 0x3F7FF972, 0x0004002B, 0x00000006, 0x00000199, 0x3DCCCCCD, 0x0004002B, 
+0x00000006, 0x000001AE, 0x3E23D70A, 0x0004002B, 0x00000006, 0x000001CB, 0x41840000, 0x0006002C, 
+0x0000000C, 0x000001CC, 0x000001CB, 0x000001CB, 0x000001CB, 0x000F001E, 0x000001E7, 0x00000012, 
 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-0x00040020, 0x000001E8, 0x00000002, 0x000001E7, 0x0004003B, 0x000001E8, 0x000001E9, 0x00000002, 
-0x0004002B, 0x00000083, 0x000001EA, 0x00000005, 0x00040020, 0x000001EB, 0x00000002, 0x00000006, 
-0x0004002B, 0x00000006, 0x000001EE, 0x3D4CCCCD, 0x00020014, 0x000001EF, 0x0004002B, 0x00000083, 
-0x000001F3, 0x00000000, 0x00040020, 0x000001F4, 0x00000002, 0x00000012, 0x00090019, 0x000001FC, 
-0x00000006, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 
-0x000001FD, 0x000001FC, 0x00040020, 0x000001FE, 0x00000000, 0x000001FD, 0x0004003B, 0x000001FE, 
-0x000001FF, 0x00000000, 0x00040018, 0x00000201, 0x0000000C, 0x00000003, 0x0007001E, 0x00000202, 
-0x0000000C, 0x0000007D, 0x00000012, 0x0000000C, 0x00000201, 0x00040020, 0x00000203, 0x00000001, 
-0x00000202, 0x0004003B, 0x00000203, 0x00000204, 0x00000001, 0x0004002B, 0x00000083, 0x00000205, 
-0x00000001, 0x00040020, 0x00000206, 0x00000001, 0x0000007D, 0x0004002B, 0x00000083, 0x00000210, 
-0x00000006, 0x0004002B, 0x00000083, 0x00000216, 0x00000002, 0x0004003B, 0x000001FE, 0x00000223, 
-0x00000000, 0x0004002B, 0x00000083, 0x0000022E, 0x00000007, 0x0004003B, 0x000001FE, 0x0000023F, 
-0x00000000, 0x0004002B, 0x000000F7, 0x00000244, 0x00000000, 0x0004002B, 0x00000083, 0x0000024A, 
-0x0000000A, 0x0004003B, 0x000001FE, 0x00000256, 0x00000000, 0x0004002B, 0x00000083, 0x00000260, 
-0x00000009, 0x0004002B, 0x00000083, 0x00000266, 0x00000004, 0x0004003B, 0x000001FE, 0x00000272, 
-0x00000000, 0x0004002B, 0x00000006, 0x0000027F, 0x414FD639, 0x0004002B, 0x00000006, 0x00000280, 
-0x429C774C, 0x0005002C, 0x0000007D, 0x00000281, 0x0000027F, 0x00000280, 0x0004002B, 0x00000006, 
-0x00000284, 0x472AEE8C, 0x0004002B, 0x00000006, 0x0000028A, 0x4019999A, 0x0004002B, 0x00000006, 
-0x000002AA, 0x4234A7F0, 0x0004002B, 0x00000006, 0x000002AB, 0x42BD5893, 0x0007002C, 0x00000012, 
-0x000002AC, 0x0000027F, 0x00000280, 0x000002AA, 0x000002AB, 0x0009001E, 0x000002C2, 0x00000012, 
-0x00000012, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0004002B, 0x000000F7, 
-0x000002C3, 0x00000020, 0x0004001C, 0x000002C4, 0x000002C2, 0x000002C3, 0x00040018, 0x000002C5, 
-0x00000012, 0x00000004, 0x0004002B, 0x000000F7, 0x000002C6, 0x00000004, 0x0004001C, 0x000002C7, 
-0x000002C5, 0x000002C6, 0x0004001C, 0x000002C8, 0x00000012, 0x000002C6, 0x0015001E, 0x000002C9, 
-0x000002C4, 0x000002C7, 0x000002C5, 0x000002C5, 0x000002C5, 0x00000012, 0x000002C8, 0x00000006, 
-0x00000006, 0x00000006, 0x00000006, 0x00000083, 0x00000083, 0x00000083, 0x00000083, 0x00000006, 
-0x00000006, 0x00000006, 0x00000083, 0x00040020, 0x000002CA, 0x00000002, 0x000002C9, 0x0004003B, 
-0x000002CA, 0x000002CB, 0x00000002, 0x0004002B, 0x00000083, 0x000002CC, 0x0000000F, 0x0004002B, 
-0x00000006, 0x000002DC, 0x3D897143, 0x0004002B, 0x00000006, 0x000002DD, 0x3BBF4590, 0x0004002B, 
-0x00000006, 0x000002DE, 0x4253EE82, 0x0006002C, 0x0000000C, 0x000002DF, 0x000002DC, 0x000002DD, 
-0x000002DE, 0x0004002B, 0x000000F7, 0x000002E0, 0x00000002, 0x0004002B, 0x00000006, 0x000002FD, 
-0x447A0000, 0x0004002B, 0x00000006, 0x00000301, 0x41800000, 0x0004002B, 0x00000083, 0x00000308, 
-0x00000010, 0x00040020, 0x00000313, 0x00000001, 0x00000012, 0x0004003B, 0x00000313, 0x00000314, 
-0x00000001, 0x0004002B, 0x00000006, 0x0000031F, 0x44800000, 0x0004002B, 0x00000006, 0x0000033A, 
-0x40800000, 0x00040020, 0x00000340, 0x00000002, 0x000002C5, 0x0004002B, 0x00000083, 0x00000350, 
-0x0000000C, 0x00040020, 0x00000351, 0x00000002, 0x00000083, 0x0004002B, 0x00000083, 0x00000366, 
-0x00000008, 0x0004002B, 0x00000006, 0x00000396, 0x3C23D70A, 0x0004002B, 0x00000006, 0x000003A0, 
-0x3B03126F, 0x0004003B, 0x0000009F, 0x000003A3, 0x00000000, 0x0006002C, 0x0000000C, 0x00000426, 
-0x00000102, 0x00000102, 0x00000102, 0x0004002B, 0x00000083, 0x0000042E, 0x0000000B, 0x00040020, 
-0x00000432, 0x00000007, 0x000000B6, 0x00040020, 0x00000435, 0x00000002, 0x000002C2, 0x0004002B, 
-0x00000083, 0x0000043F, 0x00000003, 0x0004002B, 0x00000006, 0x00000490, 0x3F666666, 0x0004002B, 
-0x00000083, 0x000004AB, 0x00000012, 0x00090019, 0x0000052E, 0x00000006, 0x00000003, 0x00000000, 
-0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x0000052F, 0x0000052E, 0x00040020, 
-0x00000530, 0x00000000, 0x0000052F, 0x0004003B, 0x00000530, 0x00000531, 0x00000000, 0x0004002B, 
-0x00000083, 0x00000550, 0x0000000E, 0x0004003B, 0x00000530, 0x00000554, 0x00000000, 0x0004002B, 
-0x000000F7, 0x00000564, 0x00000001, 0x00040020, 0x000005D7, 0x00000001, 0x0000000C, 0x0004002B, 
-0x00000006, 0x000005DE, 0x3D23D70A, 0x0004003B, 0x000001FE, 0x000005E2, 0x00000000, 0x00040020, 
-0x000005ED, 0x00000001, 0x00000201, 0x0004002B, 0x00000083, 0x00000606, 0x00000011, 0x0004003B, 
-0x000001FE, 0x0000060C, 0x00000000, 0x0004002B, 0x00000006, 0x00000618, 0x3D3851EC, 0x0004002B, 
-0x00000006, 0x00000637, 0x3CA3D70A, 0x0004002B, 0x00000006, 0x00000644, 0x3B04B5DD, 0x0004002B, 
-0x00000006, 0x00000657, 0x38D1B717, 0x0004003B, 0x000001FE, 0x0000065A, 0x00000000, 0x00040020, 
-0x000006AE, 0x00000003, 0x00000012, 0x0004003B, 0x000006AE, 0x000006AF, 0x00000003, 0x0004002B, 
-0x00000083, 0x000006B5, 0x0000000D, 0x0004002B, 0x00000006, 0x000006F9, 0x3F4CCCCD, 0x0004002B, 
-0x00000006, 0x000006FA, 0x3E4CCCCD, 0x0007002C, 0x00000012, 0x000006FB, 0x000006F9, 0x000006FA, 
-0x000006FA, 0x000000DF, 0x0007002C, 0x00000012, 0x000006FF, 0x000006FA, 0x000006F9, 0x000006FA, 
-0x000000DF, 0x0007002C, 0x00000012, 0x00000703, 0x000006FA, 0x000006FA, 0x000006F9, 0x000000DF, 
-0x0007002C, 0x00000012, 0x00000707, 0x000006F9, 0x000006F9, 0x000006FA, 0x000000DF, 0x0003001E, 
-0x0000070D, 0x000002C5, 0x00040020, 0x0000070E, 0x00000002, 0x0000070D, 0x0004003B, 0x0000070E, 
-0x0000070F, 0x00000002, 0x0004001C, 0x00000710, 0x000002C5, 0x000002C6, 0x0003001E, 0x00000711, 
-0x00000710, 0x00040020, 0x00000712, 0x00000002, 0x00000711, 0x0004003B, 0x00000712, 0x00000713, 
-0x00000002, 0x0004002B, 0x000000F7, 0x00000714, 0x00000064, 0x0004001C, 0x00000715, 0x000002C5, 
-0x00000714, 0x0003001E, 0x00000716, 0x00000715, 0x00040020, 0x00000717, 0x00000002, 0x00000716, 
-0x0004003B, 0x00000717, 0x00000718, 0x00000002, 0x0004002B, 0x00000006, 0x00000719, 0x40C90FDB, 
-0x0004002B, 0x00000006, 0x0000071A, 0x3727C5AC, 0x0006002C, 0x0000000C, 0x0000071B, 0x000005DE, 
-0x000005DE, 0x000005DE, 0x0007002C, 0x00000012, 0x0000071C, 0x00000139, 0x00000102, 0x00000102, 
-0x00000139, 0x0007002C, 0x00000012, 0x0000071D, 0x00000102, 0x00000139, 0x00000102, 0x00000139, 
-0x0007002C, 0x00000012, 0x0000071E, 0x00000102, 0x00000102, 0x000000DF, 0x00000102, 0x0007002C, 
-0x00000012, 0x0000071F, 0x00000102, 0x00000102, 0x00000102, 0x000000DF, 0x0007002C, 0x000002C5, 
-0x00000720, 0x0000071C, 0x0000071D, 0x0000071E, 0x0000071F, 0x0004002B, 0x000000F7, 0x00000721, 
-0x00000010, 0x0004001C, 0x00000722, 0x0000007D, 0x00000721, 0x0004002B, 0x00000006, 0x00000723, 
-0xBF7127FA, 0x0004002B, 0x00000006, 0x00000724, 0xBECC51E0, 0x0005002C, 0x0000007D, 0x00000725, 
-0x00000723, 0x00000724, 0x0004002B, 0x00000006, 0x00000726, 0x3F7211EE, 0x0004002B, 0x00000006, 
-0x00000727, 0xBF44D71B, 0x0005002C, 0x0000007D, 0x00000728, 0x00000726, 0x00000727, 0x0004002B, 
-0x00000006, 0x00000729, 0xBDC0E398, 0x0004002B, 0x00000006, 0x0000072A, 0xBF6DEC6B, 0x0005002C, 
-0x0000007D, 0x0000072B, 0x00000729, 0x0000072A, 0x0004002B, 0x00000006, 0x0000072C, 0x3EB09E84, 
-0x0004002B, 0x00000006, 0x0000072D, 0x3E967720, 0x0005002C, 0x0000007D, 0x0000072E, 0x0000072C, 
-0x0000072D, 0x0004002B, 0x00000006, 0x0000072F, 0xBF6A777E, 0x0004002B, 0x00000006, 0x00000730, 
-0x3EEA5988, 0x0005002C, 0x0000007D, 0x00000731, 0x0000072F, 0x00000730, 0x0004002B, 0x00000006, 
-0x00000732, 0xBF50C0D4, 0x0004002B, 0x00000006, 0x00000733, 0xBF610E50, 0x0005002C, 0x0000007D, 
-0x00000734, 0x00000732, 0x00000733, 0x0004002B, 0x00000006, 0x00000735, 0xBEC3FB24, 0x0004002B, 
-0x00000006, 0x00000736, 0x3E8DB498, 0x0005002C, 0x0000007D, 0x00000737, 0x00000735, 0x00000736, 
-0x0004002B, 0x00000006, 0x00000738, 0x3F798F60, 0x0004002B, 0x00000006, 0x00000739, 0x3F41A8EC, 
-0x0005002C, 0x0000007D, 0x0000073A, 0x00000738, 0x00000739, 0x0004002B, 0x00000006, 0x0000073B, 
-0x3EE2EF78, 0x0004002B, 0x00000006, 0x0000073C, 0xBF79A12C, 0x0005002C, 0x0000007D, 0x0000073D, 
-0x0000073B, 0x0000073C, 0x0004002B, 0x00000006, 0x0000073E, 0x3F099500, 0x0004002B, 0x00000006, 
-0x0000073F, 0xBEF28D4A, 0x0005002C, 0x0000007D, 0x00000740, 0x0000073E, 0x0000073F, 0x0004002B, 
-0x00000006, 0x00000741, 0xBE87AA08, 0x0004002B, 0x00000006, 0x00000742, 0xBED67E06, 0x0005002C, 
-0x0000007D, 0x00000743, 0x00000741, 0x00000742, 0x0004002B, 0x00000006, 0x00000744, 0x3F4ABEE2, 
-0x0004002B, 0x00000006, 0x00000745, 0x3E437BC8, 0x0005002C, 0x0000007D, 0x00000746, 0x00000744, 
-0x00000745, 0x0004002B, 0x00000006, 0x00000747, 0xBE77B198, 0x0004002B, 0x00000006, 0x00000748, 
-0x3F7F3FA8, 0x0005002C, 0x0000007D, 0x00000749, 0x00000747, 0x00000748, 0x0004002B, 0x00000006, 
-0x0000074A, 0xBF5068D4, 0x0004002B, 0x00000006, 0x0000074B, 0x3F6A148A, 0x0005002C, 0x0000007D, 
-0x0000074C, 0x0000074A, 0x0000074B, 0x0004002B, 0x00000006, 0x0000074D, 0x3E4CA330, 0x0004002B, 
-0x00000006, 0x0000074E, 0x3F495268, 0x0005002C, 0x0000007D, 0x0000074F, 0x0000074D, 0x0000074E, 
-0x0004002B, 0x00000006, 0x00000750, 0x3E134898, 0x0004002B, 0x00000006, 0x00000751, 0xBE106460, 
-0x0005002C, 0x0000007D, 0x00000752, 0x00000750, 0x00000751, 0x0013002C, 0x00000722, 0x00000753, 
-0x00000725, 0x00000728, 0x0000072B, 0x0000072E, 0x00000731, 0x00000734, 0x00000737, 0x0000073A, 
-0x0000073D, 0x00000740, 0x00000743, 0x00000746, 0x00000749, 0x0000074C, 0x0000074F, 0x00000752, 
-0x0004002B, 0x000000F7, 0x00000754, 0x00000040, 0x0004001C, 0x00000755, 0x0000007D, 0x00000754, 
-0x0004002B, 0x00000006, 0x00000756, 0xBF625322, 0x0004002B, 0x00000006, 0x00000757, 0x3DFEF391, 
-0x0005002C, 0x0000007D, 0x00000758, 0x00000756, 0x00000757, 0x0004002B, 0x00000006, 0x00000759, 
-0xBF36E169, 0x0004002B, 0x00000006, 0x0000075A, 0x3CE4E26D, 0x0005002C, 0x0000007D, 0x0000075B, 
-0x00000759, 0x0000075A, 0x0004002B, 0x00000006, 0x0000075C, 0xBF3F7953, 0x0004002B, 0x00000006, 
-0x0000075D, 0x3E696463, 0x0005002C, 0x0000007D, 0x0000075E, 0x0000075C, 0x0000075D, 0x0004002B, 
-0x00000006, 0x0000075F, 0xBF708A37, 0x0004002B, 0x00000006, 0x00000760, 0x3E797B31, 0x0005002C, 
-0x0000007D, 0x00000761, 0x0000075F, 0x00000760, 0x0004002B, 0x00000006, 0x00000762, 0xBF7C476F, 
-0x0004002B, 0x00000006, 0x00000763, 0x3D3A81DC, 0x0005002C, 0x0000007D, 0x00000764, 0x00000762, 
-0x00000763, 0x0004002B, 0x00000006, 0x00000765, 0xBF5C828C, 0x0004002B, 0x00000006, 0x00000766, 
-0xBE0B7DC8, 0x0005002C, 0x0000007D, 0x00000767, 0x00000765, 0x00000766, 0x0004002B, 0x00000006, 
-0x00000768, 0xBF61C66D, 0x0004002B, 0x00000006, 0x00000769, 0x3ECB3786, 0x0005002C, 0x0000007D, 
-0x0000076A, 0x00000768, 0x00000769, 0x0004002B, 0x00000006, 0x0000076B, 0xBEEF127F, 0x0004002B, 
-0x00000006, 0x0000076C, 0x3C6DFE76, 0x0005002C, 0x0000007D, 0x0000076D, 0x0000076B, 0x0000076C, 
-0x0004002B, 0x00000006, 0x0000076E, 0xBF0EE6A7, 0x0004002B, 0x00000006, 0x0000076F, 0x3E59C411, 
-0x0005002C, 0x0000007D, 0x00000770, 0x0000076E, 0x0000076F, 0x0004002B, 0x00000006, 0x00000771, 
-0xBF14151A, 0x0004002B, 0x00000006, 0x00000772, 0xBDC43E53, 0x0005002C, 0x0000007D, 0x00000773, 
-0x00000771, 0x00000772, 0x0004002B, 0x00000006, 0x00000774, 0xBF3D8213, 0x0004002B, 0x00000006, 
-0x00000775, 0xBDC3DA30, 0x0005002C, 0x0000007D, 0x00000776, 0x00000774, 0x00000775, 0x0004002B, 
-0x00000006, 0x00000777, 0xBF406E2B, 0x0004002B, 0x00000006, 0x00000778, 0x3EF1F927, 0x0005002C, 
-0x0000007D, 0x00000779, 0x00000777, 0x00000778, 0x0004002B, 0x00000006, 0x0000077A, 0xBF0D9B0B, 
-0x0004002B, 0x00000006, 0x0000077B, 0xBE790364, 0x0005002C, 0x0000007D, 0x0000077C, 0x0000077A, 
-0x0000077B, 0x0004002B, 0x00000006, 0x0000077D, 0xBF2CBD34, 0x0004002B, 0x00000006, 0x0000077E, 
-0xBEA95571, 0x0005002C, 0x0000007D, 0x0000077F, 0x0000077D, 0x0000077E, 0x0004002B, 0x00000006, 
-0x00000780, 0xBECE3737, 0x0004002B, 0x00000006, 0x00000781, 0xBDFA08C0, 0x0005002C, 0x0000007D, 
-0x00000782, 0x00000780, 0x00000781, 0x0004002B, 0x00000006, 0x00000783, 0xBEA3B9AE, 0x0004002B, 
-0x00000006, 0x00000784, 0xBE9FD439, 0x0005002C, 0x0000007D, 0x00000785, 0x00000783, 0x00000784, 
-0x0004002B, 0x00000006, 0x00000786, 0xBED3EDB7, 0x0004002B, 0x00000006, 0x00000787, 0xBEE127D4, 
-0x0005002C, 0x0000007D, 0x00000788, 0x00000786, 0x00000787, 0x0004002B, 0x00000006, 0x00000789, 
-0xBF7AA9C5, 0x0004002B, 0x00000006, 0x0000078A, 0xBE4E132B, 0x0005002C, 0x0000007D, 0x0000078B, 
-0x00000789, 0x0000078A, 0x0004002B, 0x00000006, 0x0000078C, 0xBF5D9696, 0x0004002B, 0x00000006, 
-0x0000078D, 0xBE93CFD5, 0x0005002C, 0x0000007D, 0x0000078E, 0x0000078C, 0x0000078D, 0x0004002B, 
-0x00000006, 0x0000078F, 0xBE798D8B, 0x0004002B, 0x00000006, 0x00000790, 0xBE3ED9E0, 0x0005002C, 
-0x0000007D, 0x00000791, 0x0000078F, 0x00000790, 0x0004002B, 0x00000006, 0x00000792, 0xBE96FFC1, 
-0x0004002B, 0x00000006, 0x00000793, 0xBD645804, 0x0005002C, 0x0000007D, 0x00000794, 0x00000792, 
-0x00000793, 0x0004002B, 0x00000006, 0x00000795, 0xBF1ABD5E, 0x0004002B, 0x00000006, 0x00000796, 
-0xBF0B5409, 0x0005002C, 0x0000007D, 0x00000797, 0x00000795, 0x00000796, 0x0004002B, 0x00000006, 
-0x00000798, 0xBED60B70, 0x0004002B, 0x00000006, 0x00000799, 0xBF167222, 0x0005002C, 0x0000007D, 
-0x0000079A, 0x00000798, 0x00000799, 0x0004002B, 0x00000006, 0x0000079B, 0xBF0C957D, 0x0004002B, 
-0x00000006, 0x0000079C, 0xBED4EDD5, 0x0005002C, 0x0000007D, 0x0000079D, 0x0000079B, 0x0000079C, 
-0x0004002B, 0x00000006, 0x0000079E, 0xBE73CB3E, 0x0004002B, 0x00000006, 0x0000079F, 0xBF1C9C5E, 
-0x0005002C, 0x0000007D, 0x000007A0, 0x0000079E, 0x0000079F, 0x0004002B, 0x00000006, 0x000007A1, 
-0xBE88B4C0, 0x0004002B, 0x00000006, 0x000007A2, 0xBEEB5E0F, 0x0005002C, 0x0000007D, 0x000007A3, 
-0x000007A1, 0x000007A2, 0x0004002B, 0x00000006, 0x000007A4, 0xBDCCCFF2, 0x0004002B, 0x00000006, 
-0x000007A5, 0xBE6A9D62, 0x0005002C, 0x0000007D, 0x000007A6, 0x000007A4, 0x000007A5, 0x0004002B, 
-0x00000006, 0x000007A7, 0xBDD0BFA1, 0x0004002B, 0x00000006, 0x000007A8, 0xBEC2C16E, 0x0005002C, 
-0x0000007D, 0x000007A9, 0x000007A7, 0x000007A8, 0x0004002B, 0x00000006, 0x000007AA, 0xBF2E749F, 
-0x0004002B, 0x00000006, 0x000007AB, 0xBF3365DC, 0x0005002C, 0x0000007D, 0x000007AC, 0x000007AA, 
-0x000007AB, 0x0004002B, 0x00000006, 0x000007AD, 0xBF4373F3, 0x0004002B, 0x00000006, 0x000007AE, 
-0xBF0B1B58, 0x0005002C, 0x0000007D, 0x000007AF, 0x000007AD, 0x000007AE, 0x0004002B, 0x00000006, 
-0x000007B0, 0xBF0C8D3B, 0x0004002B, 0x00000006, 0x000007B1, 0xBF403116, 0x0005002C, 0x0000007D, 
-0x000007B2, 0x000007B0, 0x000007B1, 0x0004002B, 0x00000006, 0x000007B3, 0xBF4F1D93, 0x0004002B, 
-0x00000006, 0x000007B4, 0xBED1461B, 0x0005002C, 0x0000007D, 0x000007B5, 0x000007B3, 0x000007B4, 
-0x0004002B, 0x00000006, 0x000007B6, 0xBEC6B980, 0x0004002B, 0x00000006, 0x000007B7, 0xBF4600B0, 
-0x0005002C, 0x0000007D, 0x000007B8, 0x000007B6, 0x000007B7, 0x0004002B, 0x00000006, 0x000007B9, 
-0xBEDBD945, 0x0004002B, 0x00000006, 0x000007BA, 0xBF6517A4, 0x0005002C, 0x0000007D, 0x000007BB, 
-0x000007B9, 0x000007BA, 0x0004002B, 0x00000006, 0x000007BC, 0xBE06C15D, 0x0004002B, 0x00000006, 
-0x000007BD, 0x3D853D21, 0x0005002C, 0x0000007D, 0x000007BE, 0x000007BC, 0x000007BD, 0x0004002B, 
-0x00000006, 0x000007BF, 0xBE8CCD10, 0x0004002B, 0x00000006, 0x000007C0, 0x3DD2C8C5, 0x0005002C, 
-0x0000007D, 0x000007C1, 0x000007BF, 0x000007C0, 0x0004002B, 0x00000006, 0x000007C2, 0xBDD953DF, 
-0x0004002B, 0x00000006, 0x000007C3, 0xBD8BEF07, 0x0005002C, 0x0000007D, 0x000007C4, 0x000007C2, 
-0x000007C3, 0x0004002B, 0x00000006, 0x000007C5, 0xBE96D3FA, 0x0004002B, 0x00000006, 0x000007C6, 
-0xBF643A54, 0x0005002C, 0x0000007D, 0x000007C7, 0x000007C5, 0x000007C6, 0x0004002B, 0x00000006, 
-0x000007C8, 0xBF21218A, 0x0004002B, 0x00000006, 0x000007C9, 0x3EC23F03, 0x0005002C, 0x0000007D, 
-0x000007CA, 0x000007C8, 0x000007C9, 0x0004002B, 0x00000006, 0x000007CB, 0xBED083FD, 0x0004002B, 
-0x00000006, 0x000007CC, 0x3EADF373, 0x0005002C, 0x0000007D, 0x000007CD, 0x000007CB, 0x000007CC, 
-0x0004002B, 0x00000006, 0x000007CE, 0x3D92BD3C, 0x0004002B, 0x00000006, 0x000007CF, 0xBEC4C0DF, 
-0x0005002C, 0x0000007D, 0x000007D0, 0x000007CE, 0x000007CF, 0x0004002B, 0x00000006, 0x000007D1, 
-0x3CB45F18, 0x0004002B, 0x00000006, 0x000007D2, 0xBE870FE0, 0x0005002C, 0x0000007D, 0x000007D3, 
-0x000007D1, 0x000007D2, 0x0004002B, 0x00000006, 0x000007D4, 0x3B7E36D2, 0x0004002B, 0x00000006, 
-0x000007D5, 0xBE0B56B8, 0x0005002C, 0x0000007D, 0x000007D6, 0x000007D4, 0x000007D5, 0x0004002B, 
-0x00000006, 0x000007D7, 0xBE0CD573, 0x0004002B, 0x00000006, 0x000007D8, 0xBF44916D, 0x0005002C, 
-0x0000007D, 0x000007D9, 0x000007D7, 0x000007D8, 0x0004002B, 0x00000006, 0x000007DA, 0xBD506141, 
-0x0004002B, 0x00000006, 0x000007DB, 0xBF67F413, 0x0005002C, 0x0000007D, 0x000007DC, 0x000007DA, 
-0x000007DB, 0x0004002B, 0x00000006, 0x000007DD, 0x3DE9BE90, 0x0004002B, 0x00000006, 0x000007DE, 
-0xBD8F77F2, 0x0005002C, 0x0000007D, 0x000007DF, 0x000007DD, 0x000007DE, 0x0004002B, 0x00000006, 
-0x000007E0, 0x3E273BC9, 0x0004002B, 0x00000006, 0x000007E1, 0xBE5E71CE, 0x0005002C, 0x0000007D, 
-0x000007E2, 0x000007E0, 0x000007E1, 0x0004002B, 0x00000006, 0x000007E3, 0xBDCD562A, 0x0004002B, 
-0x00000006, 0x000007E4, 0xBF1686A5, 0x0005002C, 0x0000007D, 0x000007E5, 0x000007E3, 0x000007E4, 
-0x0004002B, 0x00000006, 0x000007E6, 0xBBA1F080, 0x0004002B, 0x00000006, 0x000007E7, 0x3E006078, 
-0x0005002C, 0x0000007D, 0x000007E8, 0x000007E6, 0x000007E7, 0x0004002B, 0x00000006, 0x000007E9, 
-0x3D1098D4, 0x0004002B, 0x00000006, 0x000007EA, 0xBF1E8B1A, 0x0005002C, 0x0000007D, 0x000007EB, 
-0x000007E9, 0x000007EA, 0x0004002B, 0x00000006, 0x000007EC, 0x3E48576D, 0x0004002B, 0x00000006, 
-0x000007ED, 0xBEEB04EE, 0x0005002C, 0x0000007D, 0x000007EE, 0x000007EC, 0x000007ED, 0x0004002B, 
-0x00000006, 0x000007EF, 0x3E9BA1D3, 0x0004002B, 0x00000006, 0x000007F0, 0xBEB1565C, 0x0005002C, 
-0x0000007D, 0x000007F1, 0x000007EF, 0x000007F0, 0x0004002B, 0x00000006, 0x000007F2, 0xBF2D9924, 
-0x0004002B, 0x00000006, 0x000007F3, 0x3F2F62A6, 0x0005002C, 0x0000007D, 0x000007F4, 0x000007F2, 
-0x000007F3, 0x0004002B, 0x00000006, 0x000007F5, 0xBF20E001, 0x0004002B, 0x00000006, 0x000007F6, 
-0x3F020AD9, 0x0005002C, 0x0000007D, 0x000007F7, 0x000007F5, 0x000007F6, 0x0004002B, 0x00000006, 
-0x000007F8, 0xBF022B49, 0x0004002B, 0x00000006, 0x000007F9, 0x3EEAE1AC, 0x0005002C, 0x0000007D, 
-0x000007FA, 0x000007F8, 0x000007F9, 0x0004002B, 0x00000006, 0x000007FB, 0x3D039EF1, 0x0004002B, 
-0x00000006, 0x000007FC, 0xBF48331E, 0x0005002C, 0x0000007D, 0x000007FD, 0x000007FB, 0x000007FC, 
-0x0004002B, 0x00000006, 0x000007FE, 0x3DFB1316, 0x0004002B, 0x00000006, 0x000007FF, 0x3E8F8A6E, 
-0x0005002C, 0x0000007D, 0x00000800, 0x000007FE, 0x000007FF, 0x0004002B, 0x00000006, 0x00000801, 
-0xBD32C301, 0x0004002B, 0x00000006, 0x00000802, 0x3E9FCE10, 0x0005002C, 0x0000007D, 0x00000803, 
-0x00000801, 0x00000802, 0x0004002B, 0x00000006, 0x00000804, 0x3E082F51, 0x0004002B, 0x00000006, 
-0x00000805, 0x3DAE6D9C, 0x0005002C, 0x0000007D, 0x00000806, 0x00000804, 0x00000805, 0x0004002B, 
-0x00000006, 0x00000807, 0xBE44B76F, 0x0004002B, 0x00000006, 0x00000808, 0x3E925AAB, 0x0005002C, 
-0x0000007D, 0x00000809, 0x00000807, 0x00000808, 0x0004002B, 0x00000006, 0x0000080A, 0x3E3C0725, 
-0x0004002B, 0x00000006, 0x0000080B, 0xBF369707, 0x0005002C, 0x0000007D, 0x0000080C, 0x0000080A, 
-0x0000080B, 0x0004002B, 0x00000006, 0x0000080D, 0x3E87CAEA, 0x0004002B, 0x00000006, 0x0000080E, 
-0xBF18C261, 0x0005002C, 0x0000007D, 0x0000080F, 0x0000080D, 0x0000080E, 0x0004002B, 0x00000006, 
-0x00000810, 0xBC1DBEC2, 0x0004002B, 0x00000006, 0x00000811, 0xBEF75361, 0x0005002C, 0x0000007D, 
-0x00000812, 0x00000810, 0x00000811, 0x0004002B, 0x00000006, 0x00000813, 0xBC97AEDE, 0x0004002B, 
-0x00000006, 0x00000814, 0x3EDF1477, 0x0005002C, 0x0000007D, 0x00000815, 0x00000813, 0x00000814, 
-0x0043002C, 0x00000755, 0x00000816, 0x00000758, 0x0000075B, 0x0000075E, 0x00000761, 0x00000764, 
-0x00000767, 0x0000076A, 0x0000076D, 0x00000770, 0x00000773, 0x00000776, 0x00000779, 0x0000077C, 
-0x0000077F, 0x00000782, 0x00000785, 0x00000788, 0x0000078B, 0x0000078E, 0x00000791, 0x00000794, 
-0x00000797, 0x0000079A, 0x0000079D, 0x000007A0, 0x000007A3, 0x000007A6, 0x000007A9, 0x000007AC, 
-0x000007AF, 0x000007B2, 0x000007B5, 0x000007B8, 0x000007BB, 0x000007BE, 0x000007C1, 0x000007C4, 
-0x000007C7, 0x000007CA, 0x000007CD, 0x000007D0, 0x000007D3, 0x000007D6, 0x000007D9, 0x000007DC, 
-0x000007DF, 0x000007E2, 0x000007E5, 0x000007E8, 0x000007EB, 0x000007EE, 0x000007F1, 0x000007F4, 
-0x000007F7, 0x000007FA, 0x000007FD, 0x00000800, 0x00000803, 0x00000806, 0x00000809, 0x0000080C, 
-0x0000080F, 0x00000812, 0x00000815, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 
+0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00040020, 0x000001E8, 0x00000002, 0x000001E7, 
+0x0004003B, 0x000001E8, 0x000001E9, 0x00000002, 0x0004002B, 0x00000083, 0x000001EA, 0x00000005, 
+0x00040020, 0x000001EB, 0x00000002, 0x00000006, 0x0004002B, 0x00000006, 0x000001EE, 0x3D4CCCCD, 
+0x00020014, 0x000001EF, 0x0004002B, 0x00000083, 0x000001F3, 0x00000000, 0x00040020, 0x000001F4, 
+0x00000002, 0x00000012, 0x00090019, 0x000001FC, 0x00000006, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x000001FD, 0x000001FC, 0x00040020, 0x000001FE, 
+0x00000000, 0x000001FD, 0x0004003B, 0x000001FE, 0x000001FF, 0x00000000, 0x00040018, 0x00000201, 
+0x0000000C, 0x00000003, 0x0007001E, 0x00000202, 0x0000000C, 0x0000007D, 0x00000012, 0x0000000C, 
+0x00000201, 0x00040020, 0x00000203, 0x00000001, 0x00000202, 0x0004003B, 0x00000203, 0x00000204, 
+0x00000001, 0x0004002B, 0x00000083, 0x00000205, 0x00000001, 0x00040020, 0x00000206, 0x00000001, 
+0x0000007D, 0x0004002B, 0x00000083, 0x00000210, 0x00000006, 0x0004002B, 0x00000083, 0x00000216, 
+0x00000002, 0x0004003B, 0x000001FE, 0x00000223, 0x00000000, 0x0004002B, 0x00000083, 0x0000022E, 
+0x00000007, 0x0004003B, 0x000001FE, 0x0000023F, 0x00000000, 0x0004002B, 0x000000F7, 0x00000244, 
+0x00000000, 0x0004002B, 0x00000083, 0x0000024A, 0x0000000A, 0x0004003B, 0x000001FE, 0x00000256, 
+0x00000000, 0x0004002B, 0x00000083, 0x00000260, 0x00000009, 0x0004002B, 0x00000083, 0x00000266, 
+0x00000004, 0x0004003B, 0x000001FE, 0x00000272, 0x00000000, 0x0004002B, 0x00000006, 0x0000027F, 
+0x414FD639, 0x0004002B, 0x00000006, 0x00000280, 0x429C774C, 0x0005002C, 0x0000007D, 0x00000281, 
+0x0000027F, 0x00000280, 0x0004002B, 0x00000006, 0x00000284, 0x472AEE8C, 0x0004002B, 0x00000006, 
+0x0000028A, 0x4019999A, 0x0004002B, 0x00000006, 0x000002AA, 0x4234A7F0, 0x0004002B, 0x00000006, 
+0x000002AB, 0x42BD5893, 0x0007002C, 0x00000012, 0x000002AC, 0x0000027F, 0x00000280, 0x000002AA, 
+0x000002AB, 0x0009001E, 0x000002C2, 0x00000012, 0x00000012, 0x00000012, 0x00000006, 0x00000006, 
+0x00000006, 0x00000006, 0x00040018, 0x000002C5, 0x00000012, 0x00000004, 0x0004002B, 0x000000F7, 
+0x000002C6, 0x00000004, 0x0004001C, 0x000002C7, 0x000002C5, 0x000002C6, 0x0004001C, 0x000002C8, 
+0x00000012, 0x000002C6, 0x0017001E, 0x000002C9, 0x000002C7, 0x000002C5, 0x000002C5, 0x000002C5, 
+0x000002C5, 0x00000012, 0x000002C8, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
+0x00000083, 0x00000083, 0x00000083, 0x00000083, 0x00000006, 0x00000006, 0x00000006, 0x00000083, 
+0x00000083, 0x00040020, 0x000002CA, 0x00000002, 0x000002C9, 0x0004003B, 0x000002CA, 0x000002CB, 
+0x00000002, 0x0004002B, 0x00000083, 0x000002CC, 0x0000000F, 0x0004002B, 0x00000006, 0x000002DC, 
+0x3D897143, 0x0004002B, 0x00000006, 0x000002DD, 0x3BBF4590, 0x0004002B, 0x00000006, 0x000002DE, 
+0x4253EE82, 0x0006002C, 0x0000000C, 0x000002DF, 0x000002DC, 0x000002DD, 0x000002DE, 0x0004002B, 
+0x000000F7, 0x000002E0, 0x00000002, 0x0004002B, 0x00000006, 0x000002FD, 0x447A0000, 0x0004002B, 
+0x00000006, 0x00000301, 0x41800000, 0x0004002B, 0x00000083, 0x00000308, 0x00000010, 0x00040020, 
+0x00000313, 0x00000001, 0x00000012, 0x0004003B, 0x00000313, 0x00000314, 0x00000001, 0x0004002B, 
+0x00000006, 0x0000031F, 0x44800000, 0x0004002B, 0x00000006, 0x0000033A, 0x40800000, 0x00040020, 
+0x00000340, 0x00000002, 0x000002C5, 0x0004002B, 0x00000083, 0x00000350, 0x0000000C, 0x00040020, 
+0x00000351, 0x00000002, 0x00000083, 0x0004002B, 0x00000083, 0x00000366, 0x00000008, 0x0004002B, 
+0x00000006, 0x00000396, 0x3C23D70A, 0x0004002B, 0x00000006, 0x000003A0, 0x3B03126F, 0x0004003B, 
+0x0000009F, 0x000003A3, 0x00000000, 0x0006002C, 0x0000000C, 0x00000426, 0x00000102, 0x00000102, 
+0x00000102, 0x0004002B, 0x00000083, 0x0000042E, 0x0000000B, 0x00040020, 0x00000432, 0x00000007, 
+0x000000B6, 0x00040020, 0x00000435, 0x00000002, 0x000002C2, 0x0004002B, 0x00000083, 0x0000043F, 
+0x00000003, 0x0004002B, 0x00000006, 0x00000490, 0x3F666666, 0x0004002B, 0x00000083, 0x000004AB, 
+0x00000012, 0x00090019, 0x0000052E, 0x00000006, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 
+0x00000001, 0x00000000, 0x0003001B, 0x0000052F, 0x0000052E, 0x00040020, 0x00000530, 0x00000000, 
+0x0000052F, 0x0004003B, 0x00000530, 0x00000531, 0x00000000, 0x0004002B, 0x00000083, 0x00000550, 
+0x0000000E, 0x0004003B, 0x00000530, 0x00000554, 0x00000000, 0x0004002B, 0x000000F7, 0x00000564, 
+0x00000001, 0x00040020, 0x000005D7, 0x00000001, 0x0000000C, 0x0004002B, 0x00000006, 0x000005DE, 
+0x3D23D70A, 0x0004003B, 0x000001FE, 0x000005E2, 0x00000000, 0x00040020, 0x000005ED, 0x00000001, 
+0x00000201, 0x0004002B, 0x00000083, 0x00000606, 0x00000011, 0x0004003B, 0x000001FE, 0x0000060C, 
+0x00000000, 0x0004002B, 0x00000006, 0x00000618, 0x3D3851EC, 0x0004002B, 0x00000006, 0x00000637, 
+0x3CA3D70A, 0x0004002B, 0x00000006, 0x00000644, 0x3B04B5DD, 0x0004002B, 0x00000006, 0x00000657, 
+0x38D1B717, 0x0004003B, 0x000001FE, 0x0000065A, 0x00000000, 0x00040020, 0x000006AE, 0x00000003, 
+0x00000012, 0x0004003B, 0x000006AE, 0x000006AF, 0x00000003, 0x0004002B, 0x00000083, 0x000006B5, 
+0x0000000D, 0x0004002B, 0x00000006, 0x000006F9, 0x3F4CCCCD, 0x0004002B, 0x00000006, 0x000006FA, 
+0x3E4CCCCD, 0x0007002C, 0x00000012, 0x000006FB, 0x000006F9, 0x000006FA, 0x000006FA, 0x000000DF, 
+0x0007002C, 0x00000012, 0x000006FF, 0x000006FA, 0x000006F9, 0x000006FA, 0x000000DF, 0x0007002C, 
+0x00000012, 0x00000703, 0x000006FA, 0x000006FA, 0x000006F9, 0x000000DF, 0x0007002C, 0x00000012, 
+0x00000707, 0x000006F9, 0x000006F9, 0x000006FA, 0x000000DF, 0x0003001E, 0x0000070D, 0x000002C5, 
+0x00040020, 0x0000070E, 0x00000002, 0x0000070D, 0x0004003B, 0x0000070E, 0x0000070F, 0x00000002, 
+0x0004001C, 0x00000710, 0x000002C5, 0x000002C6, 0x0003001E, 0x00000711, 0x00000710, 0x00040020, 
+0x00000712, 0x00000002, 0x00000711, 0x0004003B, 0x00000712, 0x00000713, 0x00000002, 0x0004002B, 
+0x00000006, 0x00000719, 0x40C90FDB, 0x0004002B, 0x00000006, 0x0000071A, 0x3727C5AC, 0x0006002C, 
+0x0000000C, 0x0000071B, 0x000005DE, 0x000005DE, 0x000005DE, 0x0007002C, 0x00000012, 0x0000071C, 
+0x00000139, 0x00000102, 0x00000102, 0x00000139, 0x0007002C, 0x00000012, 0x0000071D, 0x00000102, 
+0x00000139, 0x00000102, 0x00000139, 0x0007002C, 0x00000012, 0x0000071E, 0x00000102, 0x00000102, 
+0x000000DF, 0x00000102, 0x0007002C, 0x00000012, 0x0000071F, 0x00000102, 0x00000102, 0x00000102, 
+0x000000DF, 0x0007002C, 0x000002C5, 0x00000720, 0x0000071C, 0x0000071D, 0x0000071E, 0x0000071F, 
+0x0004002B, 0x000000F7, 0x00000721, 0x00000010, 0x0004001C, 0x00000722, 0x0000007D, 0x00000721, 
+0x0004002B, 0x00000006, 0x00000723, 0xBF7127FA, 0x0004002B, 0x00000006, 0x00000724, 0xBECC51E0, 
+0x0005002C, 0x0000007D, 0x00000725, 0x00000723, 0x00000724, 0x0004002B, 0x00000006, 0x00000726, 
+0x3F7211EE, 0x0004002B, 0x00000006, 0x00000727, 0xBF44D71B, 0x0005002C, 0x0000007D, 0x00000728, 
+0x00000726, 0x00000727, 0x0004002B, 0x00000006, 0x00000729, 0xBDC0E398, 0x0004002B, 0x00000006, 
+0x0000072A, 0xBF6DEC6B, 0x0005002C, 0x0000007D, 0x0000072B, 0x00000729, 0x0000072A, 0x0004002B, 
+0x00000006, 0x0000072C, 0x3EB09E84, 0x0004002B, 0x00000006, 0x0000072D, 0x3E967720, 0x0005002C, 
+0x0000007D, 0x0000072E, 0x0000072C, 0x0000072D, 0x0004002B, 0x00000006, 0x0000072F, 0xBF6A777E, 
+0x0004002B, 0x00000006, 0x00000730, 0x3EEA5988, 0x0005002C, 0x0000007D, 0x00000731, 0x0000072F, 
+0x00000730, 0x0004002B, 0x00000006, 0x00000732, 0xBF50C0D4, 0x0004002B, 0x00000006, 0x00000733, 
+0xBF610E50, 0x0005002C, 0x0000007D, 0x00000734, 0x00000732, 0x00000733, 0x0004002B, 0x00000006, 
+0x00000735, 0xBEC3FB24, 0x0004002B, 0x00000006, 0x00000736, 0x3E8DB498, 0x0005002C, 0x0000007D, 
+0x00000737, 0x00000735, 0x00000736, 0x0004002B, 0x00000006, 0x00000738, 0x3F798F60, 0x0004002B, 
+0x00000006, 0x00000739, 0x3F41A8EC, 0x0005002C, 0x0000007D, 0x0000073A, 0x00000738, 0x00000739, 
+0x0004002B, 0x00000006, 0x0000073B, 0x3EE2EF78, 0x0004002B, 0x00000006, 0x0000073C, 0xBF79A12C, 
+0x0005002C, 0x0000007D, 0x0000073D, 0x0000073B, 0x0000073C, 0x0004002B, 0x00000006, 0x0000073E, 
+0x3F099500, 0x0004002B, 0x00000006, 0x0000073F, 0xBEF28D4A, 0x0005002C, 0x0000007D, 0x00000740, 
+0x0000073E, 0x0000073F, 0x0004002B, 0x00000006, 0x00000741, 0xBE87AA08, 0x0004002B, 0x00000006, 
+0x00000742, 0xBED67E06, 0x0005002C, 0x0000007D, 0x00000743, 0x00000741, 0x00000742, 0x0004002B, 
+0x00000006, 0x00000744, 0x3F4ABEE2, 0x0004002B, 0x00000006, 0x00000745, 0x3E437BC8, 0x0005002C, 
+0x0000007D, 0x00000746, 0x00000744, 0x00000745, 0x0004002B, 0x00000006, 0x00000747, 0xBE77B198, 
+0x0004002B, 0x00000006, 0x00000748, 0x3F7F3FA8, 0x0005002C, 0x0000007D, 0x00000749, 0x00000747, 
+0x00000748, 0x0004002B, 0x00000006, 0x0000074A, 0xBF5068D4, 0x0004002B, 0x00000006, 0x0000074B, 
+0x3F6A148A, 0x0005002C, 0x0000007D, 0x0000074C, 0x0000074A, 0x0000074B, 0x0004002B, 0x00000006, 
+0x0000074D, 0x3E4CA330, 0x0004002B, 0x00000006, 0x0000074E, 0x3F495268, 0x0005002C, 0x0000007D, 
+0x0000074F, 0x0000074D, 0x0000074E, 0x0004002B, 0x00000006, 0x00000750, 0x3E134898, 0x0004002B, 
+0x00000006, 0x00000751, 0xBE106460, 0x0005002C, 0x0000007D, 0x00000752, 0x00000750, 0x00000751, 
+0x0013002C, 0x00000722, 0x00000753, 0x00000725, 0x00000728, 0x0000072B, 0x0000072E, 0x00000731, 
+0x00000734, 0x00000737, 0x0000073A, 0x0000073D, 0x00000740, 0x00000743, 0x00000746, 0x00000749, 
+0x0000074C, 0x0000074F, 0x00000752, 0x0004002B, 0x000000F7, 0x00000754, 0x00000040, 0x0004001C, 
+0x00000755, 0x0000007D, 0x00000754, 0x0004002B, 0x00000006, 0x00000756, 0xBF625322, 0x0004002B, 
+0x00000006, 0x00000757, 0x3DFEF391, 0x0005002C, 0x0000007D, 0x00000758, 0x00000756, 0x00000757, 
+0x0004002B, 0x00000006, 0x00000759, 0xBF36E169, 0x0004002B, 0x00000006, 0x0000075A, 0x3CE4E26D, 
+0x0005002C, 0x0000007D, 0x0000075B, 0x00000759, 0x0000075A, 0x0004002B, 0x00000006, 0x0000075C, 
+0xBF3F7953, 0x0004002B, 0x00000006, 0x0000075D, 0x3E696463, 0x0005002C, 0x0000007D, 0x0000075E, 
+0x0000075C, 0x0000075D, 0x0004002B, 0x00000006, 0x0000075F, 0xBF708A37, 0x0004002B, 0x00000006, 
+0x00000760, 0x3E797B31, 0x0005002C, 0x0000007D, 0x00000761, 0x0000075F, 0x00000760, 0x0004002B, 
+0x00000006, 0x00000762, 0xBF7C476F, 0x0004002B, 0x00000006, 0x00000763, 0x3D3A81DC, 0x0005002C, 
+0x0000007D, 0x00000764, 0x00000762, 0x00000763, 0x0004002B, 0x00000006, 0x00000765, 0xBF5C828C, 
+0x0004002B, 0x00000006, 0x00000766, 0xBE0B7DC8, 0x0005002C, 0x0000007D, 0x00000767, 0x00000765, 
+0x00000766, 0x0004002B, 0x00000006, 0x00000768, 0xBF61C66D, 0x0004002B, 0x00000006, 0x00000769, 
+0x3ECB3786, 0x0005002C, 0x0000007D, 0x0000076A, 0x00000768, 0x00000769, 0x0004002B, 0x00000006, 
+0x0000076B, 0xBEEF127F, 0x0004002B, 0x00000006, 0x0000076C, 0x3C6DFE76, 0x0005002C, 0x0000007D, 
+0x0000076D, 0x0000076B, 0x0000076C, 0x0004002B, 0x00000006, 0x0000076E, 0xBF0EE6A7, 0x0004002B, 
+0x00000006, 0x0000076F, 0x3E59C411, 0x0005002C, 0x0000007D, 0x00000770, 0x0000076E, 0x0000076F, 
+0x0004002B, 0x00000006, 0x00000771, 0xBF14151A, 0x0004002B, 0x00000006, 0x00000772, 0xBDC43E53, 
+0x0005002C, 0x0000007D, 0x00000773, 0x00000771, 0x00000772, 0x0004002B, 0x00000006, 0x00000774, 
+0xBF3D8213, 0x0004002B, 0x00000006, 0x00000775, 0xBDC3DA30, 0x0005002C, 0x0000007D, 0x00000776, 
+0x00000774, 0x00000775, 0x0004002B, 0x00000006, 0x00000777, 0xBF406E2B, 0x0004002B, 0x00000006, 
+0x00000778, 0x3EF1F927, 0x0005002C, 0x0000007D, 0x00000779, 0x00000777, 0x00000778, 0x0004002B, 
+0x00000006, 0x0000077A, 0xBF0D9B0B, 0x0004002B, 0x00000006, 0x0000077B, 0xBE790364, 0x0005002C, 
+0x0000007D, 0x0000077C, 0x0000077A, 0x0000077B, 0x0004002B, 0x00000006, 0x0000077D, 0xBF2CBD34, 
+0x0004002B, 0x00000006, 0x0000077E, 0xBEA95571, 0x0005002C, 0x0000007D, 0x0000077F, 0x0000077D, 
+0x0000077E, 0x0004002B, 0x00000006, 0x00000780, 0xBECE3737, 0x0004002B, 0x00000006, 0x00000781, 
+0xBDFA08C0, 0x0005002C, 0x0000007D, 0x00000782, 0x00000780, 0x00000781, 0x0004002B, 0x00000006, 
+0x00000783, 0xBEA3B9AE, 0x0004002B, 0x00000006, 0x00000784, 0xBE9FD439, 0x0005002C, 0x0000007D, 
+0x00000785, 0x00000783, 0x00000784, 0x0004002B, 0x00000006, 0x00000786, 0xBED3EDB7, 0x0004002B, 
+0x00000006, 0x00000787, 0xBEE127D4, 0x0005002C, 0x0000007D, 0x00000788, 0x00000786, 0x00000787, 
+0x0004002B, 0x00000006, 0x00000789, 0xBF7AA9C5, 0x0004002B, 0x00000006, 0x0000078A, 0xBE4E132B, 
+0x0005002C, 0x0000007D, 0x0000078B, 0x00000789, 0x0000078A, 0x0004002B, 0x00000006, 0x0000078C, 
+0xBF5D9696, 0x0004002B, 0x00000006, 0x0000078D, 0xBE93CFD5, 0x0005002C, 0x0000007D, 0x0000078E, 
+0x0000078C, 0x0000078D, 0x0004002B, 0x00000006, 0x0000078F, 0xBE798D8B, 0x0004002B, 0x00000006, 
+0x00000790, 0xBE3ED9E0, 0x0005002C, 0x0000007D, 0x00000791, 0x0000078F, 0x00000790, 0x0004002B, 
+0x00000006, 0x00000792, 0xBE96FFC1, 0x0004002B, 0x00000006, 0x00000793, 0xBD645804, 0x0005002C, 
+0x0000007D, 0x00000794, 0x00000792, 0x00000793, 0x0004002B, 0x00000006, 0x00000795, 0xBF1ABD5E, 
+0x0004002B, 0x00000006, 0x00000796, 0xBF0B5409, 0x0005002C, 0x0000007D, 0x00000797, 0x00000795, 
+0x00000796, 0x0004002B, 0x00000006, 0x00000798, 0xBED60B70, 0x0004002B, 0x00000006, 0x00000799, 
+0xBF167222, 0x0005002C, 0x0000007D, 0x0000079A, 0x00000798, 0x00000799, 0x0004002B, 0x00000006, 
+0x0000079B, 0xBF0C957D, 0x0004002B, 0x00000006, 0x0000079C, 0xBED4EDD5, 0x0005002C, 0x0000007D, 
+0x0000079D, 0x0000079B, 0x0000079C, 0x0004002B, 0x00000006, 0x0000079E, 0xBE73CB3E, 0x0004002B, 
+0x00000006, 0x0000079F, 0xBF1C9C5E, 0x0005002C, 0x0000007D, 0x000007A0, 0x0000079E, 0x0000079F, 
+0x0004002B, 0x00000006, 0x000007A1, 0xBE88B4C0, 0x0004002B, 0x00000006, 0x000007A2, 0xBEEB5E0F, 
+0x0005002C, 0x0000007D, 0x000007A3, 0x000007A1, 0x000007A2, 0x0004002B, 0x00000006, 0x000007A4, 
+0xBDCCCFF2, 0x0004002B, 0x00000006, 0x000007A5, 0xBE6A9D62, 0x0005002C, 0x0000007D, 0x000007A6, 
+0x000007A4, 0x000007A5, 0x0004002B, 0x00000006, 0x000007A7, 0xBDD0BFA1, 0x0004002B, 0x00000006, 
+0x000007A8, 0xBEC2C16E, 0x0005002C, 0x0000007D, 0x000007A9, 0x000007A7, 0x000007A8, 0x0004002B, 
+0x00000006, 0x000007AA, 0xBF2E749F, 0x0004002B, 0x00000006, 0x000007AB, 0xBF3365DC, 0x0005002C, 
+0x0000007D, 0x000007AC, 0x000007AA, 0x000007AB, 0x0004002B, 0x00000006, 0x000007AD, 0xBF4373F3, 
+0x0004002B, 0x00000006, 0x000007AE, 0xBF0B1B58, 0x0005002C, 0x0000007D, 0x000007AF, 0x000007AD, 
+0x000007AE, 0x0004002B, 0x00000006, 0x000007B0, 0xBF0C8D3B, 0x0004002B, 0x00000006, 0x000007B1, 
+0xBF403116, 0x0005002C, 0x0000007D, 0x000007B2, 0x000007B0, 0x000007B1, 0x0004002B, 0x00000006, 
+0x000007B3, 0xBF4F1D93, 0x0004002B, 0x00000006, 0x000007B4, 0xBED1461B, 0x0005002C, 0x0000007D, 
+0x000007B5, 0x000007B3, 0x000007B4, 0x0004002B, 0x00000006, 0x000007B6, 0xBEC6B980, 0x0004002B, 
+0x00000006, 0x000007B7, 0xBF4600B0, 0x0005002C, 0x0000007D, 0x000007B8, 0x000007B6, 0x000007B7, 
+0x0004002B, 0x00000006, 0x000007B9, 0xBEDBD945, 0x0004002B, 0x00000006, 0x000007BA, 0xBF6517A4, 
+0x0005002C, 0x0000007D, 0x000007BB, 0x000007B9, 0x000007BA, 0x0004002B, 0x00000006, 0x000007BC, 
+0xBE06C15D, 0x0004002B, 0x00000006, 0x000007BD, 0x3D853D21, 0x0005002C, 0x0000007D, 0x000007BE, 
+0x000007BC, 0x000007BD, 0x0004002B, 0x00000006, 0x000007BF, 0xBE8CCD10, 0x0004002B, 0x00000006, 
+0x000007C0, 0x3DD2C8C5, 0x0005002C, 0x0000007D, 0x000007C1, 0x000007BF, 0x000007C0, 0x0004002B, 
+0x00000006, 0x000007C2, 0xBDD953DF, 0x0004002B, 0x00000006, 0x000007C3, 0xBD8BEF07, 0x0005002C, 
+0x0000007D, 0x000007C4, 0x000007C2, 0x000007C3, 0x0004002B, 0x00000006, 0x000007C5, 0xBE96D3FA, 
+0x0004002B, 0x00000006, 0x000007C6, 0xBF643A54, 0x0005002C, 0x0000007D, 0x000007C7, 0x000007C5, 
+0x000007C6, 0x0004002B, 0x00000006, 0x000007C8, 0xBF21218A, 0x0004002B, 0x00000006, 0x000007C9, 
+0x3EC23F03, 0x0005002C, 0x0000007D, 0x000007CA, 0x000007C8, 0x000007C9, 0x0004002B, 0x00000006, 
+0x000007CB, 0xBED083FD, 0x0004002B, 0x00000006, 0x000007CC, 0x3EADF373, 0x0005002C, 0x0000007D, 
+0x000007CD, 0x000007CB, 0x000007CC, 0x0004002B, 0x00000006, 0x000007CE, 0x3D92BD3C, 0x0004002B, 
+0x00000006, 0x000007CF, 0xBEC4C0DF, 0x0005002C, 0x0000007D, 0x000007D0, 0x000007CE, 0x000007CF, 
+0x0004002B, 0x00000006, 0x000007D1, 0x3CB45F18, 0x0004002B, 0x00000006, 0x000007D2, 0xBE870FE0, 
+0x0005002C, 0x0000007D, 0x000007D3, 0x000007D1, 0x000007D2, 0x0004002B, 0x00000006, 0x000007D4, 
+0x3B7E36D2, 0x0004002B, 0x00000006, 0x000007D5, 0xBE0B56B8, 0x0005002C, 0x0000007D, 0x000007D6, 
+0x000007D4, 0x000007D5, 0x0004002B, 0x00000006, 0x000007D7, 0xBE0CD573, 0x0004002B, 0x00000006, 
+0x000007D8, 0xBF44916D, 0x0005002C, 0x0000007D, 0x000007D9, 0x000007D7, 0x000007D8, 0x0004002B, 
+0x00000006, 0x000007DA, 0xBD506141, 0x0004002B, 0x00000006, 0x000007DB, 0xBF67F413, 0x0005002C, 
+0x0000007D, 0x000007DC, 0x000007DA, 0x000007DB, 0x0004002B, 0x00000006, 0x000007DD, 0x3DE9BE90, 
+0x0004002B, 0x00000006, 0x000007DE, 0xBD8F77F2, 0x0005002C, 0x0000007D, 0x000007DF, 0x000007DD, 
+0x000007DE, 0x0004002B, 0x00000006, 0x000007E0, 0x3E273BC9, 0x0004002B, 0x00000006, 0x000007E1, 
+0xBE5E71CE, 0x0005002C, 0x0000007D, 0x000007E2, 0x000007E0, 0x000007E1, 0x0004002B, 0x00000006, 
+0x000007E3, 0xBDCD562A, 0x0004002B, 0x00000006, 0x000007E4, 0xBF1686A5, 0x0005002C, 0x0000007D, 
+0x000007E5, 0x000007E3, 0x000007E4, 0x0004002B, 0x00000006, 0x000007E6, 0xBBA1F080, 0x0004002B, 
+0x00000006, 0x000007E7, 0x3E006078, 0x0005002C, 0x0000007D, 0x000007E8, 0x000007E6, 0x000007E7, 
+0x0004002B, 0x00000006, 0x000007E9, 0x3D1098D4, 0x0004002B, 0x00000006, 0x000007EA, 0xBF1E8B1A, 
+0x0005002C, 0x0000007D, 0x000007EB, 0x000007E9, 0x000007EA, 0x0004002B, 0x00000006, 0x000007EC, 
+0x3E48576D, 0x0004002B, 0x00000006, 0x000007ED, 0xBEEB04EE, 0x0005002C, 0x0000007D, 0x000007EE, 
+0x000007EC, 0x000007ED, 0x0004002B, 0x00000006, 0x000007EF, 0x3E9BA1D3, 0x0004002B, 0x00000006, 
+0x000007F0, 0xBEB1565C, 0x0005002C, 0x0000007D, 0x000007F1, 0x000007EF, 0x000007F0, 0x0004002B, 
+0x00000006, 0x000007F2, 0xBF2D9924, 0x0004002B, 0x00000006, 0x000007F3, 0x3F2F62A6, 0x0005002C, 
+0x0000007D, 0x000007F4, 0x000007F2, 0x000007F3, 0x0004002B, 0x00000006, 0x000007F5, 0xBF20E001, 
+0x0004002B, 0x00000006, 0x000007F6, 0x3F020AD9, 0x0005002C, 0x0000007D, 0x000007F7, 0x000007F5, 
+0x000007F6, 0x0004002B, 0x00000006, 0x000007F8, 0xBF022B49, 0x0004002B, 0x00000006, 0x000007F9, 
+0x3EEAE1AC, 0x0005002C, 0x0000007D, 0x000007FA, 0x000007F8, 0x000007F9, 0x0004002B, 0x00000006, 
+0x000007FB, 0x3D039EF1, 0x0004002B, 0x00000006, 0x000007FC, 0xBF48331E, 0x0005002C, 0x0000007D, 
+0x000007FD, 0x000007FB, 0x000007FC, 0x0004002B, 0x00000006, 0x000007FE, 0x3DFB1316, 0x0004002B, 
+0x00000006, 0x000007FF, 0x3E8F8A6E, 0x0005002C, 0x0000007D, 0x00000800, 0x000007FE, 0x000007FF, 
+0x0004002B, 0x00000006, 0x00000801, 0xBD32C301, 0x0004002B, 0x00000006, 0x00000802, 0x3E9FCE10, 
+0x0005002C, 0x0000007D, 0x00000803, 0x00000801, 0x00000802, 0x0004002B, 0x00000006, 0x00000804, 
+0x3E082F51, 0x0004002B, 0x00000006, 0x00000805, 0x3DAE6D9C, 0x0005002C, 0x0000007D, 0x00000806, 
+0x00000804, 0x00000805, 0x0004002B, 0x00000006, 0x00000807, 0xBE44B76F, 0x0004002B, 0x00000006, 
+0x00000808, 0x3E925AAB, 0x0005002C, 0x0000007D, 0x00000809, 0x00000807, 0x00000808, 0x0004002B, 
+0x00000006, 0x0000080A, 0x3E3C0725, 0x0004002B, 0x00000006, 0x0000080B, 0xBF369707, 0x0005002C, 
+0x0000007D, 0x0000080C, 0x0000080A, 0x0000080B, 0x0004002B, 0x00000006, 0x0000080D, 0x3E87CAEA, 
+0x0004002B, 0x00000006, 0x0000080E, 0xBF18C261, 0x0005002C, 0x0000007D, 0x0000080F, 0x0000080D, 
+0x0000080E, 0x0004002B, 0x00000006, 0x00000810, 0xBC1DBEC2, 0x0004002B, 0x00000006, 0x00000811, 
+0xBEF75361, 0x0005002C, 0x0000007D, 0x00000812, 0x00000810, 0x00000811, 0x0004002B, 0x00000006, 
+0x00000813, 0xBC97AEDE, 0x0004002B, 0x00000006, 0x00000814, 0x3EDF1477, 0x0005002C, 0x0000007D, 
+0x00000815, 0x00000813, 0x00000814, 0x0043002C, 0x00000755, 0x00000816, 0x00000758, 0x0000075B, 
+0x0000075E, 0x00000761, 0x00000764, 0x00000767, 0x0000076A, 0x0000076D, 0x00000770, 0x00000773, 
+0x00000776, 0x00000779, 0x0000077C, 0x0000077F, 0x00000782, 0x00000785, 0x00000788, 0x0000078B, 
+0x0000078E, 0x00000791, 0x00000794, 0x00000797, 0x0000079A, 0x0000079D, 0x000007A0, 0x000007A3, 
+0x000007A6, 0x000007A9, 0x000007AC, 0x000007AF, 0x000007B2, 0x000007B5, 0x000007B8, 0x000007BB, 
+0x000007BE, 0x000007C1, 0x000007C4, 0x000007C7, 0x000007CA, 0x000007CD, 0x000007D0, 0x000007D3, 
+0x000007D6, 0x000007D9, 0x000007DC, 0x000007DF, 0x000007E2, 0x000007E5, 0x000007E8, 0x000007EB, 
+0x000007EE, 0x000007F1, 0x000007F4, 0x000007F7, 0x000007FA, 0x000007FD, 0x00000800, 0x00000803, 
+0x00000806, 0x00000809, 0x0000080C, 0x0000080F, 0x00000812, 0x00000815, 0x0004002B, 0x00000083, 
+0x00000817, 0x00000013, 0x0004002B, 0x000000F7, 0x00000818, 0x00001000, 0x0004001C, 0x00000819, 
+0x000002C2, 0x00000818, 0x0003001E, 0x0000081A, 0x00000819, 0x00040020, 0x0000081B, 0x00000002, 
+0x0000081A, 0x0004003B, 0x0000081B, 0x0000081C, 0x00000002, 0x00040017, 0x0000081D, 0x000000F7, 
+0x00000002, 0x0004002B, 0x000000F7, 0x0000081E, 0x00000D80, 0x0004001C, 0x0000081F, 0x0000081D, 
+0x0000081E, 0x0003001E, 0x00000820, 0x0000081F, 0x00040020, 0x00000821, 0x00000002, 0x00000820, 
+0x0004003B, 0x00000821, 0x00000822, 0x00000002, 0x0004002B, 0x000000F7, 0x00000823, 0x00020000, 
+0x0004001C, 0x00000824, 0x000000F7, 0x00000823, 0x0003001E, 0x00000825, 0x00000824, 0x00040020, 
+0x00000826, 0x00000002, 0x00000825, 0x0004003B, 0x00000826, 0x00000827, 0x00000002, 0x00040020, 
+0x00000828, 0x00000002, 0x000000F7, 0x00040020, 0x00000829, 0x00000002, 0x0000081D, 0x00040021, 
+0x0000082A, 0x000000F7, 0x0000000D, 0x0004002B, 0x00000083, 0x0000082B, 0x00000014, 0x0004002B, 
+0x000000F7, 0x0000082C, 0x00000009, 0x0004002B, 0x000000F7, 0x0000082D, 0x0001FFFF, 0x0004002B, 
+0x00000006, 0x0000082E, 0x41B80000, 0x0005002C, 0x0000007D, 0x0000082F, 0x00000139, 0x00000139, 
+0x0004002B, 0x00000006, 0x00000830, 0x41100000, 0x0005002C, 0x0000007D, 0x00000831, 0x00000301, 
+0x00000830, 0x0005002C, 0x0000007D, 0x00000832, 0x00000102, 0x00000102, 0x0004002B, 0x00000006, 
+0x00000833, 0x41700000, 0x0004002B, 0x00000006, 0x00000834, 0x41000000, 0x0005002C, 0x0000007D, 
+0x00000835, 0x00000833, 0x00000834, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 
 0x000200F8, 0x00000005, 0x0004003B, 0x00000013, 0x00000571, 0x00000007, 0x0004003B, 0x00000007, 
 0x0000057B, 0x00000007, 0x0004003B, 0x00000007, 0x0000057C, 0x00000007, 0x0004003B, 0x0000000D, 
 0x0000058B, 0x00000007, 0x0004003B, 0x0000000D, 0x000005AF, 0x00000007, 0x0004003B, 0x000000D1, 
@@ -706,8 +734,8 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x0000007B, 0x000005FB, 0x00050041, 0x0000000D, 0x00000600, 0x000005CD, 0x000001EA, 0x0003003E, 
 0x00000600, 0x000005FF, 0x0004003D, 0x00000012, 0x00000602, 0x00000314, 0x0007004F, 0x0000007D, 
 0x00000603, 0x00000602, 0x00000602, 0x00000000, 0x00000001, 0x00050041, 0x000001EB, 0x00000604, 
-0x000002CB, 0x00000308, 0x0004003D, 0x00000006, 0x00000605, 0x00000604, 0x00050041, 0x000001EB, 
-0x00000607, 0x000002CB, 0x00000606, 0x0004003D, 0x00000006, 0x00000608, 0x00000607, 0x00050050, 
+0x000002CB, 0x00000606, 0x0004003D, 0x00000006, 0x00000605, 0x00000604, 0x00050041, 0x000001EB, 
+0x00000607, 0x000002CB, 0x000004AB, 0x0004003D, 0x00000006, 0x00000608, 0x00000607, 0x00050050, 
 0x0000007D, 0x00000609, 0x00000605, 0x00000608, 0x00050088, 0x0000007D, 0x0000060A, 0x00000603, 
 0x00000609, 0x0003003E, 0x00000601, 0x0000060A, 0x0004003D, 0x000001FD, 0x0000060D, 0x0000060C, 
 0x0004003D, 0x0000007D, 0x0000060E, 0x00000601, 0x00050057, 0x00000012, 0x0000060F, 0x0000060D, 
@@ -808,10 +836,10 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x00000000, 0x00050051, 0x00000006, 0x000006B2, 0x000006B0, 0x00000001, 0x00050051, 0x00000006, 
 0x000006B3, 0x000006B0, 0x00000002, 0x00070050, 0x00000012, 0x000006B4, 0x000006B1, 0x000006B2, 
 0x000006B3, 0x000000DF, 0x0003003E, 0x000006AF, 0x000006B4, 0x00050041, 0x00000351, 0x000006B6, 
-0x000002CB, 0x000006B5, 0x0004003D, 0x00000083, 0x000006B7, 0x000006B6, 0x000500AD, 0x000001EF, 
+0x000002CB, 0x00000550, 0x0004003D, 0x00000083, 0x000006B7, 0x000006B6, 0x000500AD, 0x000001EF, 
 0x000006B8, 0x000006B7, 0x000001F3, 0x000300F7, 0x000006BA, 0x00000000, 0x000400FA, 0x000006B8, 
 0x000006B9, 0x000006BA, 0x000200F8, 0x000006B9, 0x00050041, 0x00000351, 0x000006BB, 0x000002CB, 
-0x000006B5, 0x0004003D, 0x00000083, 0x000006BC, 0x000006BB, 0x000300F7, 0x000006C4, 0x00000000, 
+0x00000550, 0x0004003D, 0x00000083, 0x000006BC, 0x000006BB, 0x000300F7, 0x000006C4, 0x00000000, 
 0x001100FB, 0x000006BC, 0x000006C4, 0x00000001, 0x000006BD, 0x00000002, 0x000006BE, 0x00000003, 
 0x000006BF, 0x00000004, 0x000006C0, 0x00000005, 0x000006C1, 0x00000006, 0x000006C2, 0x00000007, 
 0x000006C3, 0x000200F8, 0x000006BD, 0x00050041, 0x00000013, 0x000006C5, 0x000005CD, 0x000001F3, 
@@ -1148,7 +1176,7 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x00000000, 0x00000094, 0x00030037, 0x0000000D, 0x00000095, 0x00030037, 0x0000000D, 0x00000096, 
 0x00030037, 0x00000084, 0x00000097, 0x000200F8, 0x00000099, 0x0004003B, 0x00000007, 0x000002C1, 
 0x00000007, 0x0004003B, 0x00000007, 0x000002CF, 0x00000007, 0x00050041, 0x000001EB, 0x000002CD, 
-0x000002CB, 0x000002CC, 0x0004003D, 0x00000006, 0x000002CE, 0x000002CD, 0x0003003E, 0x000002C1, 
+0x000002CB, 0x00000308, 0x0004003D, 0x00000006, 0x000002CE, 0x000002CD, 0x0003003E, 0x000002C1, 
 0x000002CE, 0x0004003D, 0x00000006, 0x000002D0, 0x000002C1, 0x0004003D, 0x0000000C, 0x000002D1, 
 0x00000096, 0x0004003D, 0x0000000C, 0x000002D2, 0x00000095, 0x00050094, 0x00000006, 0x000002D3, 
 0x000002D1, 0x000002D2, 0x00050083, 0x00000006, 0x000002D4, 0x000000DF, 0x000002D3, 0x00050085, 
@@ -1221,7 +1249,7 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x00000000, 0x000000AA, 0x00030037, 0x0000000D, 0x000000AB, 0x000200F8, 0x000000AD, 0x0004003B, 
 0x00000084, 0x0000033E, 0x00000007, 0x0004003B, 0x00000013, 0x0000033F, 0x00000007, 0x0004003B, 
 0x00000084, 0x00000349, 0x00000007, 0x0003003E, 0x0000033E, 0x000001F3, 0x00050041, 0x00000340, 
-0x00000341, 0x000002CB, 0x00000216, 0x0004003D, 0x000002C5, 0x00000342, 0x00000341, 0x0004003D, 
+0x00000341, 0x000002CB, 0x00000205, 0x0004003D, 0x000002C5, 0x00000342, 0x00000341, 0x0004003D, 
 0x0000000C, 0x00000343, 0x000000AB, 0x00050051, 0x00000006, 0x00000344, 0x00000343, 0x00000000, 
 0x00050051, 0x00000006, 0x00000345, 0x00000343, 0x00000001, 0x00050051, 0x00000006, 0x00000346, 
 0x00000343, 0x00000002, 0x00070050, 0x00000012, 0x00000347, 0x00000344, 0x00000345, 0x00000346, 
@@ -1229,7 +1257,7 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x00000348, 0x0003003E, 0x00000349, 0x000001F3, 0x000200F9, 0x0000034A, 0x000200F8, 0x0000034A, 
 0x000400F6, 0x0000034C, 0x0000034D, 0x00000000, 0x000200F9, 0x0000034E, 0x000200F8, 0x0000034E, 
 0x0004003D, 0x00000083, 0x0000034F, 0x00000349, 0x00050041, 0x00000351, 0x00000352, 0x000002CB, 
-0x00000350, 0x0004003D, 0x00000083, 0x00000353, 0x00000352, 0x00050082, 0x00000083, 0x00000354, 
+0x000006B5, 0x0004003D, 0x00000083, 0x00000353, 0x00000352, 0x00050082, 0x00000083, 0x00000354, 
 0x00000353, 0x00000205, 0x000500B1, 0x000001EF, 0x00000355, 0x0000034F, 0x00000354, 0x000400FA, 
 0x00000355, 0x0000034B, 0x0000034C, 0x000200F8, 0x0000034B, 0x00050041, 0x00000007, 0x00000356, 
 0x0000033F, 0x000002E0, 0x0004003D, 0x00000006, 0x00000357, 0x00000356, 0x0004003D, 0x00000083, 
@@ -1256,10 +1284,10 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x00000007, 0x0004003B, 0x00000007, 0x000003DB, 0x00000007, 0x0004003B, 0x0000000D, 0x000003DD, 
 0x00000007, 0x0004003B, 0x0000000D, 0x000003DF, 0x00000007, 0x0004003B, 0x0000000D, 0x000003E1, 
 0x00000007, 0x0004003B, 0x00000084, 0x000003E3, 0x00000007, 0x00050041, 0x000001EB, 0x00000367, 
-0x000002CB, 0x00000366, 0x0004003D, 0x00000006, 0x00000368, 0x00000367, 0x0003003E, 0x00000365, 
-0x00000368, 0x00050041, 0x000001EB, 0x0000036A, 0x000002CB, 0x00000260, 0x0004003D, 0x00000006, 
+0x000002CB, 0x00000260, 0x0004003D, 0x00000006, 0x00000368, 0x00000367, 0x0003003E, 0x00000365, 
+0x00000368, 0x00050041, 0x000001EB, 0x0000036A, 0x000002CB, 0x0000024A, 0x0004003D, 0x00000006, 
 0x0000036B, 0x0000036A, 0x0003003E, 0x00000369, 0x0000036B, 0x00050041, 0x00000340, 0x0000036D, 
-0x000002CB, 0x00000216, 0x0004003D, 0x000002C5, 0x0000036E, 0x0000036D, 0x0004003D, 0x0000000C, 
+0x000002CB, 0x00000205, 0x0004003D, 0x000002C5, 0x0000036E, 0x0000036D, 0x0004003D, 0x0000000C, 
 0x0000036F, 0x000000AF, 0x00050051, 0x00000006, 0x00000370, 0x0000036F, 0x00000000, 0x00050051, 
 0x00000006, 0x00000371, 0x0000036F, 0x00000001, 0x00050051, 0x00000006, 0x00000372, 0x0000036F, 
 0x00000002, 0x00070050, 0x00000012, 0x00000373, 0x00000370, 0x00000371, 0x00000372, 0x000000DF, 
@@ -1273,9 +1301,9 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x0000037F, 0x0000037E, 0x0000037D, 0x0003003E, 0x000000DE, 0x0000037F, 0x0004003D, 0x00000006, 
 0x00000380, 0x000000DE, 0x00050083, 0x00000006, 0x00000381, 0x000000DF, 0x00000380, 0x0008000C, 
 0x00000006, 0x00000382, 0x00000001, 0x0000002B, 0x00000381, 0x00000102, 0x000000DF, 0x0003003E, 
-0x000000DE, 0x00000382, 0x00050041, 0x00000340, 0x00000384, 0x000002CB, 0x00000266, 0x0004003D, 
+0x000000DE, 0x00000382, 0x00050041, 0x00000340, 0x00000384, 0x000002CB, 0x0000043F, 0x0004003D, 
 0x000002C5, 0x00000385, 0x00000384, 0x0004003D, 0x00000083, 0x00000386, 0x000000B0, 0x00060041, 
-0x00000340, 0x00000387, 0x000002CB, 0x00000205, 0x00000386, 0x0004003D, 0x000002C5, 0x00000388, 
+0x00000340, 0x00000387, 0x000002CB, 0x000001F3, 0x00000386, 0x0004003D, 0x000002C5, 0x00000388, 
 0x00000387, 0x00050092, 0x000002C5, 0x00000389, 0x00000385, 0x00000388, 0x0004003D, 0x0000000C, 
 0x0000038A, 0x000000AF, 0x00050051, 0x00000006, 0x0000038B, 0x0000038A, 0x00000000, 0x00050051, 
 0x00000006, 0x0000038C, 0x0000038A, 0x00000001, 0x00050051, 0x00000006, 0x0000038D, 0x0000038A, 
@@ -1285,7 +1313,7 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x000000F8, 0x0004003D, 0x00000006, 0x00000392, 0x00000391, 0x00050088, 0x00000006, 0x00000393, 
 0x000000DF, 0x00000392, 0x0005008E, 0x00000012, 0x00000394, 0x00000390, 0x00000393, 0x0003003E, 
 0x00000383, 0x00000394, 0x0003003E, 0x00000395, 0x00000396, 0x00050041, 0x000001EB, 0x00000398, 
-0x000002CB, 0x0000022E, 0x0004003D, 0x00000006, 0x00000399, 0x00000398, 0x0004003D, 0x00000006, 
+0x000002CB, 0x00000366, 0x0004003D, 0x00000006, 0x00000399, 0x00000398, 0x0004003D, 0x00000006, 
 0x0000039A, 0x00000395, 0x00050085, 0x00000006, 0x0000039B, 0x00000399, 0x0000039A, 0x00050041, 
 0x00000007, 0x0000039C, 0x00000383, 0x000002E0, 0x0004003D, 0x00000006, 0x0000039D, 0x0000039C, 
 0x00050088, 0x00000006, 0x0000039E, 0x0000039B, 0x0000039D, 0x0003003E, 0x00000397, 0x0000039E, 
@@ -1300,7 +1328,7 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x000003A4, 0x000003A6, 0x000003A8, 0x000003AA, 0x000003AC, 0x000003AE, 0x0003003E, 0x000003A2, 
 0x000003B0, 0x0004003D, 0x00000083, 0x000003B2, 0x000000B0, 0x00070041, 0x000001EB, 0x000003B3, 
 0x000002CB, 0x00000210, 0x000003B2, 0x00000244, 0x0004003D, 0x00000006, 0x000003B4, 0x000003B3, 
-0x00050041, 0x000001EB, 0x000003B5, 0x000002CB, 0x0000024A, 0x0004003D, 0x00000006, 0x000003B6, 
+0x00050041, 0x000001EB, 0x000003B5, 0x000002CB, 0x0000042E, 0x0004003D, 0x00000006, 0x000003B6, 
 0x000003B5, 0x00050081, 0x00000006, 0x000003B7, 0x000003B4, 0x000003B6, 0x0004003D, 0x00000083, 
 0x000003B8, 0x000000B0, 0x00070041, 0x000001EB, 0x000003B9, 0x000002CB, 0x00000210, 0x000003B8, 
 0x00000244, 0x0004003D, 0x00000006, 0x000003BA, 0x000003B9, 0x00050041, 0x00000007, 0x000003BB, 
@@ -1310,13 +1338,13 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x000003BF, 0x00000205, 0x0003003E, 0x000003BE, 0x000003C0, 0x0004003D, 0x00000006, 0x000003C1, 
 0x000003B1, 0x000500BA, 0x000001EF, 0x000003C2, 0x000003C1, 0x00000102, 0x000300F7, 0x000003C4, 
 0x00000000, 0x000400FA, 0x000003C2, 0x000003C3, 0x000003C4, 0x000200F8, 0x000003C3, 0x0004003D, 
-0x00000083, 0x000003C5, 0x000003BE, 0x00050041, 0x00000351, 0x000003C6, 0x000002CB, 0x00000350, 
+0x00000083, 0x000003C5, 0x000003BE, 0x00050041, 0x00000351, 0x000003C6, 0x000002CB, 0x000006B5, 
 0x0004003D, 0x00000083, 0x000003C7, 0x000003C6, 0x000500B1, 0x000001EF, 0x000003C8, 0x000003C5, 
 0x000003C7, 0x000200F9, 0x000003C4, 0x000200F8, 0x000003C4, 0x000700F5, 0x000001EF, 0x000003C9, 
 0x000003C2, 0x000000B4, 0x000003C8, 0x000003C3, 0x000300F7, 0x000003CB, 0x00000000, 0x000400FA, 
 0x000003C9, 0x000003CA, 0x000003CB, 0x000200F8, 0x000003CA, 0x00050041, 0x00000340, 0x000003CC, 
-0x000002CB, 0x00000266, 0x0004003D, 0x000002C5, 0x000003CD, 0x000003CC, 0x0004003D, 0x00000083, 
-0x000003CE, 0x000003BE, 0x00060041, 0x00000340, 0x000003CF, 0x000002CB, 0x00000205, 0x000003CE, 
+0x000002CB, 0x0000043F, 0x0004003D, 0x000002C5, 0x000003CD, 0x000003CC, 0x0004003D, 0x00000083, 
+0x000003CE, 0x000003BE, 0x00060041, 0x00000340, 0x000003CF, 0x000002CB, 0x000001F3, 0x000003CE, 
 0x0004003D, 0x000002C5, 0x000003D0, 0x000003CF, 0x00050092, 0x000002C5, 0x000003D1, 0x000003CD, 
 0x000003D0, 0x0004003D, 0x0000000C, 0x000003D2, 0x000000AF, 0x00050051, 0x00000006, 0x000003D3, 
 0x000003D2, 0x00000000, 0x00050051, 0x00000006, 0x000003D4, 0x000003D2, 0x00000001, 0x00050051, 
@@ -1380,223 +1408,268 @@ constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
 0x0003003E, 0x0000041E, 0x0000041F, 0x0004003D, 0x00000006, 0x00000421, 0x000000CE, 0x0003003E, 
 0x00000420, 0x00000421, 0x000B0039, 0x0000000C, 0x00000422, 0x000000BF, 0x000000C8, 0x000000C9, 
 0x000000CA, 0x0000041A, 0x0000041C, 0x0000041E, 0x00000420, 0x000200FE, 0x00000422, 0x00010038, 
-0x00050036, 0x0000000C, 0x000000D6, 0x00000000, 0x000000D2, 0x00030037, 0x0000000D, 0x000000D3, 
-0x00030037, 0x0000000D, 0x000000D4, 0x00030037, 0x000000D1, 0x000000D5, 0x000200F8, 0x000000D7, 
-0x0004003B, 0x0000000D, 0x00000425, 0x00000007, 0x0004003B, 0x00000084, 0x00000427, 0x00000007, 
-0x0004003B, 0x00000432, 0x00000433, 0x00000007, 0x0004003B, 0x00000007, 0x00000447, 0x00000007, 
-0x0004003B, 0x0000000D, 0x0000044D, 0x00000007, 0x0004003B, 0x00000007, 0x00000453, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000458, 0x00000007, 0x0004003B, 0x00000007, 0x0000045F, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000478, 0x00000007, 0x0004003B, 0x00000007, 0x0000047E, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000482, 0x00000007, 0x0004003B, 0x00000007, 0x00000487, 0x00000007, 
-0x0004003B, 0x00000007, 0x0000048D, 0x00000007, 0x0004003B, 0x00000007, 0x00000493, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004A4, 0x00000007, 0x0004003B, 0x00000084, 0x000004B4, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004B5, 0x00000007, 0x0004003B, 0x0000000D, 0x000004B8, 0x00000007, 
-0x0004003B, 0x00000084, 0x000004BA, 0x00000007, 0x0004003B, 0x0000000D, 0x000004BC, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004C0, 0x00000007, 0x0004003B, 0x0000000D, 0x000004C5, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004C9, 0x00000007, 0x0004003B, 0x0000000D, 0x000004D0, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004D6, 0x00000007, 0x0004003B, 0x00000007, 0x000004DB, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004DD, 0x00000007, 0x0004003B, 0x00000007, 0x000004E3, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004E9, 0x00000007, 0x0004003B, 0x00000007, 0x000004EB, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004ED, 0x00000007, 0x0004003B, 0x00000007, 0x000004EE, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004F1, 0x00000007, 0x0004003B, 0x00000007, 0x000004F6, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004F8, 0x00000007, 0x0004003B, 0x00000007, 0x000004FC, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004FE, 0x00000007, 0x0004003B, 0x00000007, 0x00000500, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000502, 0x00000007, 0x0004003B, 0x00000007, 0x00000504, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000507, 0x00000007, 0x0004003B, 0x00000007, 0x0000050B, 0x00000007, 
-0x0004003B, 0x00000007, 0x0000050D, 0x00000007, 0x0004003B, 0x00000007, 0x0000050F, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000511, 0x00000007, 0x0004003B, 0x0000000D, 0x00000514, 0x00000007, 
-0x0004003B, 0x00000007, 0x0000051E, 0x00000007, 0x0004003B, 0x00000007, 0x00000520, 0x00000007, 
-0x0003003E, 0x00000425, 0x00000426, 0x0003003E, 0x00000427, 0x000001F3, 0x000200F9, 0x00000428, 
-0x000200F8, 0x00000428, 0x000400F6, 0x0000042A, 0x0000042B, 0x00000000, 0x000200F9, 0x0000042C, 
-0x000200F8, 0x0000042C, 0x0004003D, 0x00000083, 0x0000042D, 0x00000427, 0x00050041, 0x00000351, 
-0x0000042F, 0x000002CB, 0x0000042E, 0x0004003D, 0x00000083, 0x00000430, 0x0000042F, 0x000500B1, 
-0x000001EF, 0x00000431, 0x0000042D, 0x00000430, 0x000400FA, 0x00000431, 0x00000429, 0x0000042A, 
-0x000200F8, 0x00000429, 0x0004003D, 0x00000083, 0x00000434, 0x00000427, 0x00060041, 0x00000435, 
-0x00000436, 0x000002CB, 0x000001F3, 0x00000434, 0x0004003D, 0x000002C2, 0x00000437, 0x00000436, 
-0x00050051, 0x00000012, 0x00000438, 0x00000437, 0x00000000, 0x00050041, 0x00000013, 0x00000439, 
-0x00000433, 0x000001F3, 0x0003003E, 0x00000439, 0x00000438, 0x00050051, 0x00000012, 0x0000043A, 
-0x00000437, 0x00000001, 0x00050041, 0x00000013, 0x0000043B, 0x00000433, 0x00000205, 0x0003003E, 
-0x0000043B, 0x0000043A, 0x00050051, 0x00000012, 0x0000043C, 0x00000437, 0x00000002, 0x00050041, 
-0x00000013, 0x0000043D, 0x00000433, 0x00000216, 0x0003003E, 0x0000043D, 0x0000043C, 0x00050051, 
-0x00000006, 0x0000043E, 0x00000437, 0x00000003, 0x00050041, 0x00000007, 0x00000440, 0x00000433, 
-0x0000043F, 0x0003003E, 0x00000440, 0x0000043E, 0x00050051, 0x00000006, 0x00000441, 0x00000437, 
-0x00000004, 0x00050041, 0x00000007, 0x00000442, 0x00000433, 0x00000266, 0x0003003E, 0x00000442, 
-0x00000441, 0x00050051, 0x00000006, 0x00000443, 0x00000437, 0x00000005, 0x00050041, 0x00000007, 
-0x00000444, 0x00000433, 0x000001EA, 0x0003003E, 0x00000444, 0x00000443, 0x00050051, 0x00000006, 
-0x00000445, 0x00000437, 0x00000006, 0x00050041, 0x00000007, 0x00000446, 0x00000433, 0x00000210, 
-0x0003003E, 0x00000446, 0x00000445, 0x0003003E, 0x00000447, 0x00000102, 0x00050041, 0x00000007, 
-0x00000448, 0x00000433, 0x000001EA, 0x0004003D, 0x00000006, 0x00000449, 0x00000448, 0x000500B4, 
-0x000001EF, 0x0000044A, 0x00000449, 0x0000013A, 0x000300F7, 0x0000044C, 0x00000000, 0x000400FA, 
-0x0000044A, 0x0000044B, 0x00000472, 0x000200F8, 0x0000044B, 0x00050041, 0x00000013, 0x0000044E, 
-0x00000433, 0x00000205, 0x0004003D, 0x00000012, 0x0000044F, 0x0000044E, 0x0008004F, 0x0000000C, 
-0x00000450, 0x0000044F, 0x0000044F, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 
-0x00000451, 0x000000D4, 0x00050083, 0x0000000C, 0x00000452, 0x00000450, 0x00000451, 0x0003003E, 
-0x0000044D, 0x00000452, 0x0004003D, 0x0000000C, 0x00000454, 0x0000044D, 0x0006000C, 0x00000006, 
-0x00000455, 0x00000001, 0x00000042, 0x00000454, 0x0003003E, 0x00000453, 0x00000455, 0x0004003D, 
-0x0000000C, 0x00000456, 0x0000044D, 0x0006000C, 0x0000000C, 0x00000457, 0x00000001, 0x00000045, 
-0x00000456, 0x0003003E, 0x0000044D, 0x00000457, 0x00050041, 0x00000007, 0x00000459, 0x00000433, 
-0x00000266, 0x0004003D, 0x00000006, 0x0000045A, 0x00000459, 0x0004003D, 0x00000006, 0x0000045B, 
-0x00000453, 0x0007000C, 0x00000006, 0x0000045C, 0x00000001, 0x0000001A, 0x0000045B, 0x0000013A, 
-0x00050081, 0x00000006, 0x0000045D, 0x0000045C, 0x000000DF, 0x00050088, 0x00000006, 0x0000045E, 
-0x0000045A, 0x0000045D, 0x0003003E, 0x00000458, 0x0000045E, 0x0004003D, 0x00000006, 0x00000460, 
-0x00000453, 0x0004003D, 0x00000006, 0x00000461, 0x00000453, 0x00050085, 0x00000006, 0x00000462, 
-0x00000460, 0x00000461, 0x00050041, 0x00000007, 0x00000463, 0x00000433, 0x00000266, 0x0004003D, 
-0x00000006, 0x00000464, 0x00000463, 0x00050041, 0x00000007, 0x00000465, 0x00000433, 0x00000266, 
-0x0004003D, 0x00000006, 0x00000466, 0x00000465, 0x00050085, 0x00000006, 0x00000467, 0x00000464, 
-0x00000466, 0x00050088, 0x00000006, 0x00000468, 0x00000462, 0x00000467, 0x00050083, 0x00000006, 
-0x00000469, 0x000000DF, 0x00000468, 0x0008000C, 0x00000006, 0x0000046A, 0x00000001, 0x0000002B, 
-0x00000469, 0x00000102, 0x000000DF, 0x0003003E, 0x0000045F, 0x0000046A, 0x0004003D, 0x00000006, 
-0x0000046B, 0x0000045F, 0x0003003E, 0x00000447, 0x0000046B, 0x0004003D, 0x0000000C, 0x0000046C, 
-0x0000044D, 0x00050051, 0x00000006, 0x0000046D, 0x0000046C, 0x00000000, 0x00050051, 0x00000006, 
-0x0000046E, 0x0000046C, 0x00000001, 0x00050051, 0x00000006, 0x0000046F, 0x0000046C, 0x00000002, 
-0x00070050, 0x00000012, 0x00000470, 0x0000046D, 0x0000046E, 0x0000046F, 0x000000DF, 0x00050041, 
-0x00000013, 0x00000471, 0x00000433, 0x00000216, 0x0003003E, 0x00000471, 0x00000470, 0x000200F9, 
-0x0000044C, 0x000200F8, 0x00000472, 0x00050041, 0x00000007, 0x00000473, 0x00000433, 0x000001EA, 
-0x0004003D, 0x00000006, 0x00000474, 0x00000473, 0x000500B4, 0x000001EF, 0x00000475, 0x00000474, 
-0x000000DF, 0x000300F7, 0x00000477, 0x00000000, 0x000400FA, 0x00000475, 0x00000476, 0x000004A3, 
-0x000200F8, 0x00000476, 0x00050041, 0x00000013, 0x00000479, 0x00000433, 0x00000205, 0x0004003D, 
-0x00000012, 0x0000047A, 0x00000479, 0x0008004F, 0x0000000C, 0x0000047B, 0x0000047A, 0x0000047A, 
-0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x0000047C, 0x000000D4, 0x00050083, 
-0x0000000C, 0x0000047D, 0x0000047B, 0x0000047C, 0x0003003E, 0x00000478, 0x0000047D, 0x00050041, 
-0x00000007, 0x0000047F, 0x00000433, 0x00000210, 0x0004003D, 0x00000006, 0x00000480, 0x0000047F, 
-0x00050083, 0x00000006, 0x00000481, 0x000000DF, 0x00000480, 0x0003003E, 0x0000047E, 0x00000481, 
-0x0004003D, 0x0000000C, 0x00000483, 0x00000478, 0x0006000C, 0x00000006, 0x00000484, 0x00000001, 
-0x00000042, 0x00000483, 0x0003003E, 0x00000482, 0x00000484, 0x0004003D, 0x0000000C, 0x00000485, 
-0x00000478, 0x0006000C, 0x0000000C, 0x00000486, 0x00000001, 0x00000045, 0x00000485, 0x0003003E, 
-0x00000478, 0x00000486, 0x0004003D, 0x0000000C, 0x00000488, 0x00000478, 0x00050041, 0x00000013, 
-0x00000489, 0x00000433, 0x00000216, 0x0004003D, 0x00000012, 0x0000048A, 0x00000489, 0x0008004F, 
-0x0000000C, 0x0000048B, 0x0000048A, 0x0000048A, 0x00000000, 0x00000001, 0x00000002, 0x00050094, 
-0x00000006, 0x0000048C, 0x00000488, 0x0000048B, 0x0003003E, 0x00000487, 0x0000048C, 0x0004003D, 
-0x00000006, 0x0000048E, 0x0000047E, 0x0004003D, 0x00000006, 0x0000048F, 0x0000047E, 0x00050085, 
-0x00000006, 0x00000491, 0x0000048F, 0x00000490, 0x00050083, 0x00000006, 0x00000492, 0x0000048E, 
-0x00000491, 0x0003003E, 0x0000048D, 0x00000492, 0x0004003D, 0x00000006, 0x00000494, 0x00000487, 
-0x0004003D, 0x00000006, 0x00000495, 0x0000047E, 0x00050083, 0x00000006, 0x00000496, 0x00000494, 
-0x00000495, 0x0004003D, 0x00000006, 0x00000497, 0x0000048D, 0x00050088, 0x00000006, 0x00000498, 
-0x00000496, 0x00000497, 0x0003003E, 0x00000493, 0x00000498, 0x00050041, 0x00000007, 0x00000499, 
-0x00000433, 0x00000266, 0x0004003D, 0x00000006, 0x0000049A, 0x00000499, 0x0004003D, 0x00000006, 
-0x0000049B, 0x00000482, 0x0007000C, 0x00000006, 0x0000049C, 0x00000001, 0x0000001A, 0x0000049B, 
-0x0000013A, 0x00050081, 0x00000006, 0x0000049D, 0x0000049C, 0x000000DF, 0x00050088, 0x00000006, 
-0x0000049E, 0x0000049A, 0x0000049D, 0x0004003D, 0x00000006, 0x0000049F, 0x00000493, 0x00050085, 
-0x00000006, 0x000004A0, 0x0000049F, 0x0000049E, 0x0003003E, 0x00000493, 0x000004A0, 0x0004003D, 
-0x00000006, 0x000004A1, 0x00000493, 0x0008000C, 0x00000006, 0x000004A2, 0x00000001, 0x0000002B, 
-0x000004A1, 0x00000102, 0x000000DF, 0x0003003E, 0x00000447, 0x000004A2, 0x000200F9, 0x00000477, 
-0x000200F8, 0x000004A3, 0x00050041, 0x0000000D, 0x000004A5, 0x000000D5, 0x00000210, 0x0004003D, 
-0x0000000C, 0x000004A6, 0x000004A5, 0x00050041, 0x00000013, 0x000004A7, 0x00000433, 0x00000216, 
-0x0004003D, 0x00000012, 0x000004A8, 0x000004A7, 0x0008004F, 0x0000000C, 0x000004A9, 0x000004A8, 
-0x000004A8, 0x00000000, 0x00000001, 0x00000002, 0x00050094, 0x00000006, 0x000004AA, 0x000004A6, 
-0x000004A9, 0x0003003E, 0x000004A4, 0x000004AA, 0x00050041, 0x00000351, 0x000004AC, 0x000002CB, 
-0x000004AB, 0x0004003D, 0x00000083, 0x000004AD, 0x000004AC, 0x000500AD, 0x000001EF, 0x000004AE, 
-0x000004AD, 0x000001F3, 0x0004003D, 0x00000006, 0x000004AF, 0x000004A4, 0x000500BA, 0x000001EF, 
-0x000004B0, 0x000004AF, 0x00000102, 0x000500A7, 0x000001EF, 0x000004B1, 0x000004AE, 0x000004B0, 
-0x000300F7, 0x000004B3, 0x00000000, 0x000400FA, 0x000004B1, 0x000004B2, 0x000004C4, 0x000200F8, 
-0x000004B2, 0x0004003D, 0x0000000C, 0x000004B6, 0x000000D4, 0x0003003E, 0x000004B5, 0x000004B6, 
-0x00050039, 0x00000083, 0x000004B7, 0x000000AC, 0x000004B5, 0x0003003E, 0x000004B4, 0x000004B7, 
-0x0004003D, 0x0000000C, 0x000004B9, 0x000000D4, 0x0003003E, 0x000004B8, 0x000004B9, 0x0004003D, 
-0x00000083, 0x000004BB, 0x000004B4, 0x0003003E, 0x000004BA, 0x000004BB, 0x00050041, 0x00000013, 
-0x000004BD, 0x00000433, 0x00000216, 0x0004003D, 0x00000012, 0x000004BE, 0x000004BD, 0x0008004F, 
-0x0000000C, 0x000004BF, 0x000004BE, 0x000004BE, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 
-0x000004BC, 0x000004BF, 0x00050041, 0x0000000D, 0x000004C1, 0x000000D5, 0x00000210, 0x0004003D, 
-0x0000000C, 0x000004C2, 0x000004C1, 0x0003003E, 0x000004C0, 0x000004C2, 0x00080039, 0x00000006, 
-0x000004C3, 0x000000B3, 0x000004B8, 0x000004BA, 0x000004BC, 0x000004C0, 0x0003003E, 0x00000447, 
-0x000004C3, 0x000200F9, 0x000004B3, 0x000200F8, 0x000004C4, 0x0003003E, 0x00000447, 0x000000DF, 
-0x000200F9, 0x000004B3, 0x000200F8, 0x000004B3, 0x000200F9, 0x00000477, 0x000200F8, 0x00000477, 
-0x000200F9, 0x0000044C, 0x000200F8, 0x0000044C, 0x00050041, 0x00000013, 0x000004C6, 0x00000433, 
-0x00000216, 0x0004003D, 0x00000012, 0x000004C7, 0x000004C6, 0x0008004F, 0x0000000C, 0x000004C8, 
-0x000004C7, 0x000004C7, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000004C5, 0x000004C8, 
-0x00050041, 0x00000013, 0x000004CA, 0x00000433, 0x000001F3, 0x0004003D, 0x00000012, 0x000004CB, 
-0x000004CA, 0x0008004F, 0x0000000C, 0x000004CC, 0x000004CB, 0x000004CB, 0x00000000, 0x00000001, 
-0x00000002, 0x00050041, 0x00000007, 0x000004CD, 0x00000433, 0x0000043F, 0x0004003D, 0x00000006, 
-0x000004CE, 0x000004CD, 0x0005008E, 0x0000000C, 0x000004CF, 0x000004CC, 0x000004CE, 0x0003003E, 
-0x000004C9, 0x000004CF, 0x0004003D, 0x0000000C, 0x000004D1, 0x000004C5, 0x00050041, 0x0000000D, 
-0x000004D2, 0x000000D5, 0x00000366, 0x0004003D, 0x0000000C, 0x000004D3, 0x000004D2, 0x00050081, 
-0x0000000C, 0x000004D4, 0x000004D1, 0x000004D3, 0x0006000C, 0x0000000C, 0x000004D5, 0x00000001, 
-0x00000045, 0x000004D4, 0x0003003E, 0x000004D0, 0x000004D5, 0x00050041, 0x0000000D, 0x000004D7, 
-0x000000D5, 0x00000210, 0x0004003D, 0x0000000C, 0x000004D8, 0x000004D7, 0x0004003D, 0x0000000C, 
-0x000004D9, 0x000004C5, 0x00050094, 0x00000006, 0x000004DA, 0x000004D8, 0x000004D9, 0x0003003E, 
-0x000004DB, 0x000004DA, 0x00050039, 0x00000006, 0x000004DC, 0x00000019, 0x000004DB, 0x0003003E, 
-0x000004D6, 0x000004DC, 0x00050041, 0x0000000D, 0x000004DE, 0x000000D5, 0x00000366, 0x0004003D, 
-0x0000000C, 0x000004DF, 0x000004DE, 0x0004003D, 0x0000000C, 0x000004E0, 0x000004C5, 0x00050081, 
-0x0000000C, 0x000004E1, 0x000004DF, 0x000004E0, 0x0006000C, 0x0000000C, 0x000004E2, 0x00000001, 
-0x00000045, 0x000004E1, 0x0003003E, 0x000004DD, 0x000004E2, 0x00050041, 0x0000000D, 0x000004E4, 
-0x000000D5, 0x00000210, 0x0004003D, 0x0000000C, 0x000004E5, 0x000004E4, 0x00050041, 0x0000000D, 
-0x000004E6, 0x000000D5, 0x00000366, 0x0004003D, 0x0000000C, 0x000004E7, 0x000004E6, 0x00050094, 
-0x00000006, 0x000004E8, 0x000004E5, 0x000004E7, 0x0003003E, 0x000004E9, 0x000004E8, 0x00050039, 
-0x00000006, 0x000004EA, 0x00000046, 0x000004E9, 0x0003003E, 0x000004E3, 0x000004EA, 0x0004003D, 
-0x00000006, 0x000004EC, 0x000004E3, 0x0003003E, 0x000004EB, 0x000004EC, 0x0004003D, 0x00000006, 
-0x000004EF, 0x000004D6, 0x0003003E, 0x000004EE, 0x000004EF, 0x00050039, 0x00000006, 0x000004F0, 
-0x00000019, 0x000004EE, 0x0003003E, 0x000004ED, 0x000004F0, 0x00050041, 0x0000000D, 0x000004F2, 
-0x000000D5, 0x00000210, 0x0004003D, 0x0000000C, 0x000004F3, 0x000004F2, 0x0004003D, 0x0000000C, 
-0x000004F4, 0x000004DD, 0x00050094, 0x00000006, 0x000004F5, 0x000004F3, 0x000004F4, 0x0003003E, 
-0x000004F6, 0x000004F5, 0x00050039, 0x00000006, 0x000004F7, 0x00000019, 0x000004F6, 0x0003003E, 
-0x000004F1, 0x000004F7, 0x0004003D, 0x0000000C, 0x000004F9, 0x000004C5, 0x0004003D, 0x0000000C, 
-0x000004FA, 0x000004DD, 0x00050094, 0x00000006, 0x000004FB, 0x000004F9, 0x000004FA, 0x0003003E, 
-0x000004FC, 0x000004FB, 0x00050039, 0x00000006, 0x000004FD, 0x00000019, 0x000004FC, 0x0003003E, 
-0x000004F8, 0x000004FD, 0x0004003D, 0x000000B5, 0x000004FF, 0x000000D5, 0x0004003D, 0x00000006, 
-0x00000501, 0x000004EB, 0x0003003E, 0x00000500, 0x00000501, 0x0004003D, 0x00000006, 0x00000503, 
-0x000004ED, 0x0003003E, 0x00000502, 0x00000503, 0x0004003D, 0x00000006, 0x00000505, 0x000004F8, 
-0x0003003E, 0x00000504, 0x00000505, 0x00080039, 0x0000000C, 0x00000506, 0x000000C6, 0x000004FF, 
-0x00000500, 0x00000502, 0x00000504, 0x0003003E, 0x000004FE, 0x00000506, 0x0004003D, 0x000000B5, 
-0x00000508, 0x000000D5, 0x0004003D, 0x000000B6, 0x00000509, 0x00000433, 0x0004003D, 0x0000000C, 
-0x0000050A, 0x000004DD, 0x0004003D, 0x00000006, 0x0000050C, 0x000004EB, 0x0003003E, 0x0000050B, 
-0x0000050C, 0x0004003D, 0x00000006, 0x0000050E, 0x000004ED, 0x0003003E, 0x0000050D, 0x0000050E, 
-0x0004003D, 0x00000006, 0x00000510, 0x000004F1, 0x0003003E, 0x0000050F, 0x00000510, 0x0004003D, 
-0x00000006, 0x00000512, 0x000004F8, 0x0003003E, 0x00000511, 0x00000512, 0x000B0039, 0x0000000C, 
-0x00000513, 0x000000CF, 0x00000508, 0x00000509, 0x0000050A, 0x0000050B, 0x0000050D, 0x0000050F, 
-0x00000511, 0x0003003E, 0x00000507, 0x00000513, 0x0004003D, 0x0000000C, 0x00000515, 0x000004FE, 
-0x0004003D, 0x0000000C, 0x00000516, 0x00000507, 0x00050081, 0x0000000C, 0x00000517, 0x00000515, 
-0x00000516, 0x0003003E, 0x00000514, 0x00000517, 0x0004003D, 0x0000000C, 0x00000518, 0x00000514, 
-0x0004003D, 0x0000000C, 0x00000519, 0x000004C9, 0x00050085, 0x0000000C, 0x0000051A, 0x00000518, 
-0x00000519, 0x0004003D, 0x00000006, 0x0000051B, 0x00000447, 0x0004003D, 0x00000006, 0x0000051C, 
-0x000004ED, 0x00050085, 0x00000006, 0x0000051D, 0x0000051B, 0x0000051C, 0x0004003D, 0x00000006, 
-0x0000051F, 0x000004ED, 0x0003003E, 0x0000051E, 0x0000051F, 0x00050041, 0x00000007, 0x00000521, 
-0x000000D5, 0x0000022E, 0x0004003D, 0x00000006, 0x00000522, 0x00000521, 0x0003003E, 0x00000520, 
-0x00000522, 0x00060039, 0x00000006, 0x00000523, 0x0000003D, 0x0000051E, 0x00000520, 0x00050085, 
-0x00000006, 0x00000524, 0x0000051D, 0x00000523, 0x0005008E, 0x0000000C, 0x00000525, 0x0000051A, 
-0x00000524, 0x0004003D, 0x0000000C, 0x00000526, 0x00000425, 0x00050081, 0x0000000C, 0x00000527, 
-0x00000526, 0x00000525, 0x0003003E, 0x00000425, 0x00000527, 0x000200F9, 0x0000042B, 0x000200F8, 
-0x0000042B, 0x0004003D, 0x00000083, 0x00000528, 0x00000427, 0x00050080, 0x00000083, 0x00000529, 
-0x00000528, 0x00000205, 0x0003003E, 0x00000427, 0x00000529, 0x000200F9, 0x00000428, 0x000200F8, 
-0x0000042A, 0x0004003D, 0x0000000C, 0x0000052A, 0x00000425, 0x000200FE, 0x0000052A, 0x00010038, 
-0x00050036, 0x0000000C, 0x000000DB, 0x00000000, 0x000000D2, 0x00030037, 0x0000000D, 0x000000D8, 
-0x00030037, 0x0000000D, 0x000000D9, 0x00030037, 0x000000D1, 0x000000DA, 0x000200F8, 0x000000DC, 
-0x0004003B, 0x0000000D, 0x0000052D, 0x00000007, 0x0004003B, 0x0000000D, 0x00000537, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000538, 0x00000007, 0x0004003B, 0x00000007, 0x0000053A, 0x00000007, 
-0x0004003B, 0x00000007, 0x0000053D, 0x00000007, 0x0004003B, 0x0000000D, 0x00000541, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000549, 0x00000007, 0x0004003B, 0x00000084, 0x0000054F, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000553, 0x00000007, 0x0004003B, 0x0000000D, 0x0000055E, 0x00000007, 
-0x0004003D, 0x0000052F, 0x00000532, 0x00000531, 0x00050041, 0x0000000D, 0x00000533, 0x000000DA, 
-0x00000210, 0x0004003D, 0x0000000C, 0x00000534, 0x00000533, 0x00050057, 0x00000012, 0x00000535, 
-0x00000532, 0x00000534, 0x0008004F, 0x0000000C, 0x00000536, 0x00000535, 0x00000535, 0x00000000, 
-0x00000001, 0x00000002, 0x0003003E, 0x0000052D, 0x00000536, 0x0004003D, 0x0000000C, 0x00000539, 
-0x000000D8, 0x0003003E, 0x00000538, 0x00000539, 0x00050041, 0x00000007, 0x0000053B, 0x000000DA, 
-0x00000260, 0x0004003D, 0x00000006, 0x0000053C, 0x0000053B, 0x0003003E, 0x0000053A, 0x0000053C, 
-0x00050041, 0x00000007, 0x0000053E, 0x000000DA, 0x00000216, 0x0004003D, 0x00000006, 0x0000053F, 
-0x0000053E, 0x0003003E, 0x0000053D, 0x0000053F, 0x00070039, 0x0000000C, 0x00000540, 0x0000006D, 
-0x00000538, 0x0000053A, 0x0000053D, 0x0003003E, 0x00000537, 0x00000540, 0x0004003D, 0x0000000C, 
-0x00000542, 0x00000537, 0x00060050, 0x0000000C, 0x00000543, 0x000000DF, 0x000000DF, 0x000000DF, 
-0x00050083, 0x0000000C, 0x00000544, 0x00000543, 0x00000542, 0x00050041, 0x00000007, 0x00000545, 
-0x000000DA, 0x00000205, 0x0004003D, 0x00000006, 0x00000546, 0x00000545, 0x00050083, 0x00000006, 
-0x00000547, 0x000000DF, 0x00000546, 0x0005008E, 0x0000000C, 0x00000548, 0x00000544, 0x00000547, 
-0x0003003E, 0x00000541, 0x00000548, 0x00050041, 0x00000013, 0x0000054A, 0x000000DA, 0x000001F3, 
-0x0004003D, 0x00000012, 0x0000054B, 0x0000054A, 0x0008004F, 0x0000000C, 0x0000054C, 0x0000054B, 
-0x0000054B, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x0000054D, 0x0000052D, 
-0x00050085, 0x0000000C, 0x0000054E, 0x0000054C, 0x0000054D, 0x0003003E, 0x00000549, 0x0000054E, 
-0x00050041, 0x00000351, 0x00000551, 0x000002CB, 0x00000550, 0x0004003D, 0x00000083, 0x00000552, 
-0x00000551, 0x0003003E, 0x0000054F, 0x00000552, 0x0004003D, 0x0000052F, 0x00000555, 0x00000554, 
-0x0004003D, 0x0000000C, 0x00000556, 0x000000D9, 0x00050041, 0x00000007, 0x00000557, 0x000000DA, 
-0x0000043F, 0x0004003D, 0x00000006, 0x00000558, 0x00000557, 0x0004003D, 0x00000083, 0x00000559, 
-0x0000054F, 0x0004006F, 0x00000006, 0x0000055A, 0x00000559, 0x00050085, 0x00000006, 0x0000055B, 
-0x00000558, 0x0000055A, 0x00070058, 0x00000012, 0x0000055C, 0x00000555, 0x00000556, 0x00000002, 
-0x0000055B, 0x0008004F, 0x0000000C, 0x0000055D, 0x0000055C, 0x0000055C, 0x00000000, 0x00000001, 
-0x00000002, 0x0003003E, 0x00000553, 0x0000055D, 0x0004003D, 0x0000000C, 0x0000055F, 0x00000553, 
-0x0004003D, 0x0000000C, 0x00000560, 0x00000537, 0x00060041, 0x00000007, 0x00000561, 0x000000DA, 
-0x00000350, 0x00000244, 0x0004003D, 0x00000006, 0x00000562, 0x00000561, 0x0005008E, 0x0000000C, 
-0x00000563, 0x00000560, 0x00000562, 0x00060041, 0x00000007, 0x00000565, 0x000000DA, 0x00000350, 
-0x00000564, 0x0004003D, 0x00000006, 0x00000566, 0x00000565, 0x00060050, 0x0000000C, 0x00000567, 
-0x00000566, 0x00000566, 0x00000566, 0x00050081, 0x0000000C, 0x00000568, 0x00000563, 0x00000567, 
-0x00050085, 0x0000000C, 0x00000569, 0x0000055F, 0x00000568, 0x0003003E, 0x0000055E, 0x00000569, 
-0x0004003D, 0x0000000C, 0x0000056A, 0x00000541, 0x0004003D, 0x0000000C, 0x0000056B, 0x00000549, 
-0x00050085, 0x0000000C, 0x0000056C, 0x0000056A, 0x0000056B, 0x0004003D, 0x0000000C, 0x0000056D, 
-0x0000055E, 0x00050081, 0x0000000C, 0x0000056E, 0x0000056C, 0x0000056D, 0x000200FE, 0x0000056E, 
-0x00010038, 
+0x00050036, 0x000000F7, 0x00000836, 0x00000000, 0x0000082A, 0x00030037, 0x0000000D, 0x00000837, 
+0x000200F8, 0x00000838, 0x0004003D, 0x0000000C, 0x00000839, 0x00000837, 0x00050041, 0x00000340, 
+0x0000083A, 0x000002CB, 0x00000205, 0x0004003D, 0x000002C5, 0x0000083B, 0x0000083A, 0x00050050, 
+0x00000012, 0x0000083C, 0x00000839, 0x000000DF, 0x00050091, 0x00000012, 0x0000083D, 0x0000083B, 
+0x0000083C, 0x00050041, 0x00000340, 0x0000083E, 0x000002CB, 0x00000266, 0x0004003D, 0x000002C5, 
+0x0000083F, 0x0000083E, 0x00050091, 0x00000012, 0x00000840, 0x0000083F, 0x0000083D, 0x0007004F, 
+0x0000007D, 0x00000841, 0x00000840, 0x00000840, 0x00000000, 0x00000001, 0x00050051, 0x00000006, 
+0x00000842, 0x00000840, 0x00000003, 0x00050050, 0x0000007D, 0x00000843, 0x00000842, 0x00000842, 
+0x00050088, 0x0000007D, 0x00000844, 0x00000841, 0x00000843, 0x0005008E, 0x0000007D, 0x00000845, 
+0x00000844, 0x00000139, 0x00050081, 0x0000007D, 0x00000846, 0x00000845, 0x0000082F, 0x00050085, 
+0x0000007D, 0x00000847, 0x00000846, 0x00000831, 0x0008000C, 0x0000007D, 0x00000848, 0x00000001, 
+0x0000002B, 0x00000847, 0x00000832, 0x00000835, 0x0004006D, 0x0000081D, 0x00000849, 0x00000848, 
+0x00050051, 0x00000006, 0x0000084A, 0x0000083D, 0x00000002, 0x00060041, 0x000001EB, 0x0000084B, 
+0x000002CB, 0x0000022E, 0x00000244, 0x0004003D, 0x00000006, 0x0000084C, 0x0000084B, 0x00050085, 
+0x00000006, 0x0000084D, 0x0000084A, 0x0000084C, 0x0007000C, 0x00000006, 0x0000084E, 0x00000001, 
+0x00000028, 0x0000084D, 0x00000657, 0x00060041, 0x000001EB, 0x0000084F, 0x000002CB, 0x0000022E, 
+0x00000564, 0x0004003D, 0x00000006, 0x00000850, 0x0000084F, 0x0006000C, 0x00000006, 0x00000851, 
+0x00000001, 0x0000001C, 0x0000084E, 0x00050085, 0x00000006, 0x00000852, 0x00000851, 0x00000850, 
+0x00060041, 0x000001EB, 0x00000853, 0x000002CB, 0x0000022E, 0x000002E0, 0x0004003D, 0x00000006, 
+0x00000854, 0x00000853, 0x00050083, 0x00000006, 0x00000855, 0x00000852, 0x00000854, 0x0008000C, 
+0x00000006, 0x00000856, 0x00000001, 0x0000002B, 0x00000855, 0x00000102, 0x0000082E, 0x0004006D, 
+0x000000F7, 0x00000857, 0x00000856, 0x00050051, 0x000000F7, 0x00000858, 0x00000849, 0x00000000, 
+0x00050051, 0x000000F7, 0x00000859, 0x00000849, 0x00000001, 0x00050084, 0x000000F7, 0x0000085A, 
+0x0000082C, 0x00000857, 0x00050080, 0x000000F7, 0x0000085B, 0x00000859, 0x0000085A, 0x00050084, 
+0x000000F7, 0x0000085C, 0x00000721, 0x0000085B, 0x00050080, 0x000000F7, 0x0000085D, 0x00000858, 
+0x0000085C, 0x000200FE, 0x0000085D, 0x00010038, 0x00050036, 0x0000000C, 0x000000D6, 0x00000000, 
+0x000000D2, 0x00030037, 0x0000000D, 0x000000D3, 0x00030037, 0x0000000D, 0x000000D4, 0x00030037, 
+0x000000D1, 0x000000D5, 0x000200F8, 0x000000D7, 0x0004003B, 0x0000000D, 0x00000425, 0x00000007, 
+0x0004003B, 0x00000084, 0x00000427, 0x00000007, 0x0004003B, 0x00000432, 0x00000433, 0x00000007, 
+0x0004003B, 0x00000007, 0x00000447, 0x00000007, 0x0004003B, 0x0000000D, 0x0000044D, 0x00000007, 
+0x0004003B, 0x00000007, 0x00000453, 0x00000007, 0x0004003B, 0x00000007, 0x00000458, 0x00000007, 
+0x0004003B, 0x00000007, 0x0000045F, 0x00000007, 0x0004003B, 0x0000000D, 0x00000478, 0x00000007, 
+0x0004003B, 0x00000007, 0x0000047E, 0x00000007, 0x0004003B, 0x00000007, 0x00000482, 0x00000007, 
+0x0004003B, 0x00000007, 0x00000487, 0x00000007, 0x0004003B, 0x00000007, 0x0000048D, 0x00000007, 
+0x0004003B, 0x00000007, 0x00000493, 0x00000007, 0x0004003B, 0x00000007, 0x000004A4, 0x00000007, 
+0x0004003B, 0x00000084, 0x000004B4, 0x00000007, 0x0004003B, 0x0000000D, 0x000004B5, 0x00000007, 
+0x0004003B, 0x0000000D, 0x000004B8, 0x00000007, 0x0004003B, 0x00000084, 0x000004BA, 0x00000007, 
+0x0004003B, 0x0000000D, 0x000004BC, 0x00000007, 0x0004003B, 0x0000000D, 0x000004C0, 0x00000007, 
+0x0004003B, 0x0000000D, 0x000004C5, 0x00000007, 0x0004003B, 0x0000000D, 0x000004C9, 0x00000007, 
+0x0004003B, 0x0000000D, 0x000004D0, 0x00000007, 0x0004003B, 0x00000007, 0x000004D6, 0x00000007, 
+0x0004003B, 0x00000007, 0x000004DB, 0x00000007, 0x0004003B, 0x0000000D, 0x000004DD, 0x00000007, 
+0x0004003B, 0x00000007, 0x000004E3, 0x00000007, 0x0004003B, 0x00000007, 0x000004E9, 0x00000007, 
+0x0004003B, 0x00000007, 0x000004EB, 0x00000007, 0x0004003B, 0x00000007, 0x000004ED, 0x00000007, 
+0x0004003B, 0x00000007, 0x000004EE, 0x00000007, 0x0004003B, 0x00000007, 0x000004F1, 0x00000007, 
+0x0004003B, 0x00000007, 0x000004F6, 0x00000007, 0x0004003B, 0x00000007, 0x000004F8, 0x00000007, 
+0x0004003B, 0x00000007, 0x000004FC, 0x00000007, 0x0004003B, 0x0000000D, 0x000004FE, 0x00000007, 
+0x0004003B, 0x00000007, 0x00000500, 0x00000007, 0x0004003B, 0x00000007, 0x00000502, 0x00000007, 
+0x0004003B, 0x00000007, 0x00000504, 0x00000007, 0x0004003B, 0x0000000D, 0x00000507, 0x00000007, 
+0x0004003B, 0x00000007, 0x0000050B, 0x00000007, 0x0004003B, 0x00000007, 0x0000050D, 0x00000007, 
+0x0004003B, 0x00000007, 0x0000050F, 0x00000007, 0x0004003B, 0x00000007, 0x00000511, 0x00000007, 
+0x0004003B, 0x0000000D, 0x00000514, 0x00000007, 0x0004003B, 0x00000007, 0x0000051E, 0x00000007, 
+0x0004003B, 0x00000007, 0x00000520, 0x00000007, 0x0004003B, 0x0000000D, 0x0000085E, 0x00000007, 
+0x0003003E, 0x00000425, 0x00000426, 0x0004003D, 0x0000000C, 0x0000085F, 0x000000D4, 0x0003003E, 
+0x0000085E, 0x0000085F, 0x00050039, 0x000000F7, 0x00000860, 0x00000836, 0x0000085E, 0x00060041, 
+0x00000829, 0x00000861, 0x00000822, 0x000001F3, 0x00000860, 0x0004003D, 0x0000081D, 0x00000862, 
+0x00000861, 0x00050041, 0x00000351, 0x00000863, 0x000002CB, 0x0000082B, 0x0004003D, 0x00000083, 
+0x00000864, 0x00000863, 0x00050051, 0x000000F7, 0x00000865, 0x00000862, 0x00000001, 0x0004007C, 
+0x00000083, 0x00000866, 0x00000865, 0x00050080, 0x00000083, 0x00000867, 0x00000864, 0x00000866, 
+0x00050051, 0x000000F7, 0x00000868, 0x00000862, 0x00000000, 0x0003003E, 0x00000427, 0x000001F3, 
+0x000200F9, 0x00000428, 0x000200F8, 0x00000428, 0x000400F6, 0x0000042A, 0x0000042B, 0x00000000, 
+0x000200F9, 0x0000042C, 0x000200F8, 0x0000042C, 0x0004003D, 0x00000083, 0x0000042D, 0x00000427, 
+0x000500B1, 0x000001EF, 0x00000431, 0x0000042D, 0x00000867, 0x000400FA, 0x00000431, 0x00000429, 
+0x0000042A, 0x000200F8, 0x00000429, 0x0004003D, 0x00000083, 0x00000869, 0x00000427, 0x00050082, 
+0x00000083, 0x0000086A, 0x00000869, 0x00000864, 0x0004007C, 0x000000F7, 0x0000086B, 0x0000086A, 
+0x00050080, 0x000000F7, 0x0000086C, 0x00000868, 0x0000086B, 0x0007000C, 0x000000F7, 0x0000086D, 
+0x00000001, 0x00000026, 0x0000086C, 0x0000082D, 0x00060041, 0x00000828, 0x0000086E, 0x00000827, 
+0x000001F3, 0x0000086D, 0x0004003D, 0x000000F7, 0x0000086F, 0x0000086E, 0x000500B1, 0x000001EF, 
+0x00000870, 0x00000869, 0x00000864, 0x0004007C, 0x00000083, 0x00000871, 0x0000086F, 0x000600A9, 
+0x00000083, 0x00000872, 0x00000870, 0x00000869, 0x00000871, 0x00060041, 0x00000435, 0x00000436, 
+0x0000081C, 0x000001F3, 0x00000872, 0x0004003D, 0x000002C2, 0x00000437, 0x00000436, 0x00050051, 
+0x00000012, 0x00000438, 0x00000437, 0x00000000, 0x00050041, 0x00000013, 0x00000439, 0x00000433, 
+0x000001F3, 0x0003003E, 0x00000439, 0x00000438, 0x00050051, 0x00000012, 0x0000043A, 0x00000437, 
+0x00000001, 0x00050041, 0x00000013, 0x0000043B, 0x00000433, 0x00000205, 0x0003003E, 0x0000043B, 
+0x0000043A, 0x00050051, 0x00000012, 0x0000043C, 0x00000437, 0x00000002, 0x00050041, 0x00000013, 
+0x0000043D, 0x00000433, 0x00000216, 0x0003003E, 0x0000043D, 0x0000043C, 0x00050051, 0x00000006, 
+0x0000043E, 0x00000437, 0x00000003, 0x00050041, 0x00000007, 0x00000440, 0x00000433, 0x0000043F, 
+0x0003003E, 0x00000440, 0x0000043E, 0x00050051, 0x00000006, 0x00000441, 0x00000437, 0x00000004, 
+0x00050041, 0x00000007, 0x00000442, 0x00000433, 0x00000266, 0x0003003E, 0x00000442, 0x00000441, 
+0x00050051, 0x00000006, 0x00000443, 0x00000437, 0x00000005, 0x00050041, 0x00000007, 0x00000444, 
+0x00000433, 0x000001EA, 0x0003003E, 0x00000444, 0x00000443, 0x00050051, 0x00000006, 0x00000445, 
+0x00000437, 0x00000006, 0x00050041, 0x00000007, 0x00000446, 0x00000433, 0x00000210, 0x0003003E, 
+0x00000446, 0x00000445, 0x0003003E, 0x00000447, 0x00000102, 0x00050041, 0x00000007, 0x00000448, 
+0x00000433, 0x000001EA, 0x0004003D, 0x00000006, 0x00000449, 0x00000448, 0x000500B4, 0x000001EF, 
+0x0000044A, 0x00000449, 0x0000013A, 0x000300F7, 0x0000044C, 0x00000000, 0x000400FA, 0x0000044A, 
+0x0000044B, 0x00000472, 0x000200F8, 0x0000044B, 0x00050041, 0x00000013, 0x0000044E, 0x00000433, 
+0x00000205, 0x0004003D, 0x00000012, 0x0000044F, 0x0000044E, 0x0008004F, 0x0000000C, 0x00000450, 
+0x0000044F, 0x0000044F, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x00000451, 
+0x000000D4, 0x00050083, 0x0000000C, 0x00000452, 0x00000450, 0x00000451, 0x0003003E, 0x0000044D, 
+0x00000452, 0x0004003D, 0x0000000C, 0x00000454, 0x0000044D, 0x0006000C, 0x00000006, 0x00000455, 
+0x00000001, 0x00000042, 0x00000454, 0x0003003E, 0x00000453, 0x00000455, 0x0004003D, 0x0000000C, 
+0x00000456, 0x0000044D, 0x0006000C, 0x0000000C, 0x00000457, 0x00000001, 0x00000045, 0x00000456, 
+0x0003003E, 0x0000044D, 0x00000457, 0x00050041, 0x00000007, 0x00000459, 0x00000433, 0x00000266, 
+0x0004003D, 0x00000006, 0x0000045A, 0x00000459, 0x0004003D, 0x00000006, 0x0000045B, 0x00000453, 
+0x0007000C, 0x00000006, 0x0000045C, 0x00000001, 0x0000001A, 0x0000045B, 0x0000013A, 0x00050081, 
+0x00000006, 0x0000045D, 0x0000045C, 0x000000DF, 0x00050088, 0x00000006, 0x0000045E, 0x0000045A, 
+0x0000045D, 0x0003003E, 0x00000458, 0x0000045E, 0x0004003D, 0x00000006, 0x00000460, 0x00000453, 
+0x0004003D, 0x00000006, 0x00000461, 0x00000453, 0x00050085, 0x00000006, 0x00000462, 0x00000460, 
+0x00000461, 0x00050041, 0x00000007, 0x00000463, 0x00000433, 0x00000266, 0x0004003D, 0x00000006, 
+0x00000464, 0x00000463, 0x00050041, 0x00000007, 0x00000465, 0x00000433, 0x00000266, 0x0004003D, 
+0x00000006, 0x00000466, 0x00000465, 0x00050085, 0x00000006, 0x00000467, 0x00000464, 0x00000466, 
+0x00050088, 0x00000006, 0x00000468, 0x00000462, 0x00000467, 0x00050083, 0x00000006, 0x00000469, 
+0x000000DF, 0x00000468, 0x0008000C, 0x00000006, 0x0000046A, 0x00000001, 0x0000002B, 0x00000469, 
+0x00000102, 0x000000DF, 0x0003003E, 0x0000045F, 0x0000046A, 0x0004003D, 0x00000006, 0x0000046B, 
+0x0000045F, 0x0003003E, 0x00000447, 0x0000046B, 0x0004003D, 0x0000000C, 0x0000046C, 0x0000044D, 
+0x00050051, 0x00000006, 0x0000046D, 0x0000046C, 0x00000000, 0x00050051, 0x00000006, 0x0000046E, 
+0x0000046C, 0x00000001, 0x00050051, 0x00000006, 0x0000046F, 0x0000046C, 0x00000002, 0x00070050, 
+0x00000012, 0x00000470, 0x0000046D, 0x0000046E, 0x0000046F, 0x000000DF, 0x00050041, 0x00000013, 
+0x00000471, 0x00000433, 0x00000216, 0x0003003E, 0x00000471, 0x00000470, 0x000200F9, 0x0000044C, 
+0x000200F8, 0x00000472, 0x00050041, 0x00000007, 0x00000473, 0x00000433, 0x000001EA, 0x0004003D, 
+0x00000006, 0x00000474, 0x00000473, 0x000500B4, 0x000001EF, 0x00000475, 0x00000474, 0x000000DF, 
+0x000300F7, 0x00000477, 0x00000000, 0x000400FA, 0x00000475, 0x00000476, 0x000004A3, 0x000200F8, 
+0x00000476, 0x00050041, 0x00000013, 0x00000479, 0x00000433, 0x00000205, 0x0004003D, 0x00000012, 
+0x0000047A, 0x00000479, 0x0008004F, 0x0000000C, 0x0000047B, 0x0000047A, 0x0000047A, 0x00000000, 
+0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x0000047C, 0x000000D4, 0x00050083, 0x0000000C, 
+0x0000047D, 0x0000047B, 0x0000047C, 0x0003003E, 0x00000478, 0x0000047D, 0x00050041, 0x00000007, 
+0x0000047F, 0x00000433, 0x00000210, 0x0004003D, 0x00000006, 0x00000480, 0x0000047F, 0x00050083, 
+0x00000006, 0x00000481, 0x000000DF, 0x00000480, 0x0003003E, 0x0000047E, 0x00000481, 0x0004003D, 
+0x0000000C, 0x00000483, 0x00000478, 0x0006000C, 0x00000006, 0x00000484, 0x00000001, 0x00000042, 
+0x00000483, 0x0003003E, 0x00000482, 0x00000484, 0x0004003D, 0x0000000C, 0x00000485, 0x00000478, 
+0x0006000C, 0x0000000C, 0x00000486, 0x00000001, 0x00000045, 0x00000485, 0x0003003E, 0x00000478, 
+0x00000486, 0x0004003D, 0x0000000C, 0x00000488, 0x00000478, 0x00050041, 0x00000013, 0x00000489, 
+0x00000433, 0x00000216, 0x0004003D, 0x00000012, 0x0000048A, 0x00000489, 0x0008004F, 0x0000000C, 
+0x0000048B, 0x0000048A, 0x0000048A, 0x00000000, 0x00000001, 0x00000002, 0x00050094, 0x00000006, 
+0x0000048C, 0x00000488, 0x0000048B, 0x0003003E, 0x00000487, 0x0000048C, 0x0004003D, 0x00000006, 
+0x0000048E, 0x0000047E, 0x0004003D, 0x00000006, 0x0000048F, 0x0000047E, 0x00050085, 0x00000006, 
+0x00000491, 0x0000048F, 0x00000490, 0x00050083, 0x00000006, 0x00000492, 0x0000048E, 0x00000491, 
+0x0003003E, 0x0000048D, 0x00000492, 0x0004003D, 0x00000006, 0x00000494, 0x00000487, 0x0004003D, 
+0x00000006, 0x00000495, 0x0000047E, 0x00050083, 0x00000006, 0x00000496, 0x00000494, 0x00000495, 
+0x0004003D, 0x00000006, 0x00000497, 0x0000048D, 0x00050088, 0x00000006, 0x00000498, 0x00000496, 
+0x00000497, 0x0003003E, 0x00000493, 0x00000498, 0x00050041, 0x00000007, 0x00000499, 0x00000433, 
+0x00000266, 0x0004003D, 0x00000006, 0x0000049A, 0x00000499, 0x0004003D, 0x00000006, 0x0000049B, 
+0x00000482, 0x0007000C, 0x00000006, 0x0000049C, 0x00000001, 0x0000001A, 0x0000049B, 0x0000013A, 
+0x00050081, 0x00000006, 0x0000049D, 0x0000049C, 0x000000DF, 0x00050088, 0x00000006, 0x0000049E, 
+0x0000049A, 0x0000049D, 0x0004003D, 0x00000006, 0x0000049F, 0x00000493, 0x00050085, 0x00000006, 
+0x000004A0, 0x0000049F, 0x0000049E, 0x0003003E, 0x00000493, 0x000004A0, 0x0004003D, 0x00000006, 
+0x00000873, 0x00000482, 0x0004003D, 0x00000006, 0x00000874, 0x00000482, 0x00050085, 0x00000006, 
+0x00000875, 0x00000873, 0x00000874, 0x00050041, 0x00000007, 0x00000876, 0x00000433, 0x00000266, 
+0x0004003D, 0x00000006, 0x00000877, 0x00000876, 0x00050041, 0x00000007, 0x00000878, 0x00000433, 
+0x00000266, 0x0004003D, 0x00000006, 0x00000879, 0x00000878, 0x00050085, 0x00000006, 0x0000087A, 
+0x00000877, 0x00000879, 0x00050088, 0x00000006, 0x0000087B, 0x00000875, 0x0000087A, 0x00050083, 
+0x00000006, 0x0000087C, 0x000000DF, 0x0000087B, 0x0008000C, 0x00000006, 0x0000087D, 0x00000001, 
+0x0000002B, 0x0000087C, 0x00000102, 0x000000DF, 0x0004003D, 0x00000006, 0x0000087E, 0x00000493, 
+0x00050085, 0x00000006, 0x0000087F, 0x0000087E, 0x0000087D, 0x0003003E, 0x00000493, 0x0000087F, 
+0x0004003D, 0x00000006, 0x000004A1, 0x00000493, 0x0008000C, 0x00000006, 0x000004A2, 0x00000001, 
+0x0000002B, 0x000004A1, 0x00000102, 0x000000DF, 0x0003003E, 0x00000447, 0x000004A2, 0x000200F9, 
+0x00000477, 0x000200F8, 0x000004A3, 0x00050041, 0x0000000D, 0x000004A5, 0x000000D5, 0x00000210, 
+0x0004003D, 0x0000000C, 0x000004A6, 0x000004A5, 0x00050041, 0x00000013, 0x000004A7, 0x00000433, 
+0x00000216, 0x0004003D, 0x00000012, 0x000004A8, 0x000004A7, 0x0008004F, 0x0000000C, 0x000004A9, 
+0x000004A8, 0x000004A8, 0x00000000, 0x00000001, 0x00000002, 0x00050094, 0x00000006, 0x000004AA, 
+0x000004A6, 0x000004A9, 0x0003003E, 0x000004A4, 0x000004AA, 0x00050041, 0x00000351, 0x000004AC, 
+0x000002CB, 0x00000817, 0x0004003D, 0x00000083, 0x000004AD, 0x000004AC, 0x000500AD, 0x000001EF, 
+0x000004AE, 0x000004AD, 0x000001F3, 0x0004003D, 0x00000006, 0x000004AF, 0x000004A4, 0x000500BA, 
+0x000001EF, 0x000004B0, 0x000004AF, 0x00000102, 0x000500A7, 0x000001EF, 0x000004B1, 0x000004AE, 
+0x000004B0, 0x000300F7, 0x000004B3, 0x00000000, 0x000400FA, 0x000004B1, 0x000004B2, 0x000004C4, 
+0x000200F8, 0x000004B2, 0x0004003D, 0x0000000C, 0x000004B6, 0x000000D4, 0x0003003E, 0x000004B5, 
+0x000004B6, 0x00050039, 0x00000083, 0x000004B7, 0x000000AC, 0x000004B5, 0x0003003E, 0x000004B4, 
+0x000004B7, 0x0004003D, 0x0000000C, 0x000004B9, 0x000000D4, 0x0003003E, 0x000004B8, 0x000004B9, 
+0x0004003D, 0x00000083, 0x000004BB, 0x000004B4, 0x0003003E, 0x000004BA, 0x000004BB, 0x00050041, 
+0x00000013, 0x000004BD, 0x00000433, 0x00000216, 0x0004003D, 0x00000012, 0x000004BE, 0x000004BD, 
+0x0008004F, 0x0000000C, 0x000004BF, 0x000004BE, 0x000004BE, 0x00000000, 0x00000001, 0x00000002, 
+0x0003003E, 0x000004BC, 0x000004BF, 0x00050041, 0x0000000D, 0x000004C1, 0x000000D5, 0x00000210, 
+0x0004003D, 0x0000000C, 0x000004C2, 0x000004C1, 0x0003003E, 0x000004C0, 0x000004C2, 0x00080039, 
+0x00000006, 0x000004C3, 0x000000B3, 0x000004B8, 0x000004BA, 0x000004BC, 0x000004C0, 0x0003003E, 
+0x00000447, 0x000004C3, 0x000200F9, 0x000004B3, 0x000200F8, 0x000004C4, 0x0003003E, 0x00000447, 
+0x000000DF, 0x000200F9, 0x000004B3, 0x000200F8, 0x000004B3, 0x000200F9, 0x00000477, 0x000200F8, 
+0x00000477, 0x000200F9, 0x0000044C, 0x000200F8, 0x0000044C, 0x00050041, 0x00000013, 0x000004C6, 
+0x00000433, 0x00000216, 0x0004003D, 0x00000012, 0x000004C7, 0x000004C6, 0x0008004F, 0x0000000C, 
+0x000004C8, 0x000004C7, 0x000004C7, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000004C5, 
+0x000004C8, 0x00050041, 0x00000013, 0x000004CA, 0x00000433, 0x000001F3, 0x0004003D, 0x00000012, 
+0x000004CB, 0x000004CA, 0x0008004F, 0x0000000C, 0x000004CC, 0x000004CB, 0x000004CB, 0x00000000, 
+0x00000001, 0x00000002, 0x00050041, 0x00000007, 0x000004CD, 0x00000433, 0x0000043F, 0x0004003D, 
+0x00000006, 0x000004CE, 0x000004CD, 0x0005008E, 0x0000000C, 0x000004CF, 0x000004CC, 0x000004CE, 
+0x0003003E, 0x000004C9, 0x000004CF, 0x0004003D, 0x0000000C, 0x000004D1, 0x000004C5, 0x00050041, 
+0x0000000D, 0x000004D2, 0x000000D5, 0x00000366, 0x0004003D, 0x0000000C, 0x000004D3, 0x000004D2, 
+0x00050081, 0x0000000C, 0x000004D4, 0x000004D1, 0x000004D3, 0x0006000C, 0x0000000C, 0x000004D5, 
+0x00000001, 0x00000045, 0x000004D4, 0x0003003E, 0x000004D0, 0x000004D5, 0x00050041, 0x0000000D, 
+0x000004D7, 0x000000D5, 0x00000210, 0x0004003D, 0x0000000C, 0x000004D8, 0x000004D7, 0x0004003D, 
+0x0000000C, 0x000004D9, 0x000004C5, 0x00050094, 0x00000006, 0x000004DA, 0x000004D8, 0x000004D9, 
+0x0003003E, 0x000004DB, 0x000004DA, 0x00050039, 0x00000006, 0x000004DC, 0x00000019, 0x000004DB, 
+0x0003003E, 0x000004D6, 0x000004DC, 0x00050041, 0x0000000D, 0x000004DE, 0x000000D5, 0x00000366, 
+0x0004003D, 0x0000000C, 0x000004DF, 0x000004DE, 0x0004003D, 0x0000000C, 0x000004E0, 0x000004C5, 
+0x00050081, 0x0000000C, 0x000004E1, 0x000004DF, 0x000004E0, 0x0006000C, 0x0000000C, 0x000004E2, 
+0x00000001, 0x00000045, 0x000004E1, 0x0003003E, 0x000004DD, 0x000004E2, 0x00050041, 0x0000000D, 
+0x000004E4, 0x000000D5, 0x00000210, 0x0004003D, 0x0000000C, 0x000004E5, 0x000004E4, 0x00050041, 
+0x0000000D, 0x000004E6, 0x000000D5, 0x00000366, 0x0004003D, 0x0000000C, 0x000004E7, 0x000004E6, 
+0x00050094, 0x00000006, 0x000004E8, 0x000004E5, 0x000004E7, 0x0003003E, 0x000004E9, 0x000004E8, 
+0x00050039, 0x00000006, 0x000004EA, 0x00000046, 0x000004E9, 0x0003003E, 0x000004E3, 0x000004EA, 
+0x0004003D, 0x00000006, 0x000004EC, 0x000004E3, 0x0003003E, 0x000004EB, 0x000004EC, 0x0004003D, 
+0x00000006, 0x000004EF, 0x000004D6, 0x0003003E, 0x000004EE, 0x000004EF, 0x00050039, 0x00000006, 
+0x000004F0, 0x00000019, 0x000004EE, 0x0003003E, 0x000004ED, 0x000004F0, 0x00050041, 0x0000000D, 
+0x000004F2, 0x000000D5, 0x00000210, 0x0004003D, 0x0000000C, 0x000004F3, 0x000004F2, 0x0004003D, 
+0x0000000C, 0x000004F4, 0x000004DD, 0x00050094, 0x00000006, 0x000004F5, 0x000004F3, 0x000004F4, 
+0x0003003E, 0x000004F6, 0x000004F5, 0x00050039, 0x00000006, 0x000004F7, 0x00000019, 0x000004F6, 
+0x0003003E, 0x000004F1, 0x000004F7, 0x0004003D, 0x0000000C, 0x000004F9, 0x000004C5, 0x0004003D, 
+0x0000000C, 0x000004FA, 0x000004DD, 0x00050094, 0x00000006, 0x000004FB, 0x000004F9, 0x000004FA, 
+0x0003003E, 0x000004FC, 0x000004FB, 0x00050039, 0x00000006, 0x000004FD, 0x00000019, 0x000004FC, 
+0x0003003E, 0x000004F8, 0x000004FD, 0x0004003D, 0x000000B5, 0x000004FF, 0x000000D5, 0x0004003D, 
+0x00000006, 0x00000501, 0x000004EB, 0x0003003E, 0x00000500, 0x00000501, 0x0004003D, 0x00000006, 
+0x00000503, 0x000004ED, 0x0003003E, 0x00000502, 0x00000503, 0x0004003D, 0x00000006, 0x00000505, 
+0x000004F8, 0x0003003E, 0x00000504, 0x00000505, 0x00080039, 0x0000000C, 0x00000506, 0x000000C6, 
+0x000004FF, 0x00000500, 0x00000502, 0x00000504, 0x0003003E, 0x000004FE, 0x00000506, 0x0004003D, 
+0x000000B5, 0x00000508, 0x000000D5, 0x0004003D, 0x000000B6, 0x00000509, 0x00000433, 0x0004003D, 
+0x0000000C, 0x0000050A, 0x000004DD, 0x0004003D, 0x00000006, 0x0000050C, 0x000004EB, 0x0003003E, 
+0x0000050B, 0x0000050C, 0x0004003D, 0x00000006, 0x0000050E, 0x000004ED, 0x0003003E, 0x0000050D, 
+0x0000050E, 0x0004003D, 0x00000006, 0x00000510, 0x000004F1, 0x0003003E, 0x0000050F, 0x00000510, 
+0x0004003D, 0x00000006, 0x00000512, 0x000004F8, 0x0003003E, 0x00000511, 0x00000512, 0x000B0039, 
+0x0000000C, 0x00000513, 0x000000CF, 0x00000508, 0x00000509, 0x0000050A, 0x0000050B, 0x0000050D, 
+0x0000050F, 0x00000511, 0x0003003E, 0x00000507, 0x00000513, 0x0004003D, 0x0000000C, 0x00000515, 
+0x000004FE, 0x0004003D, 0x0000000C, 0x00000516, 0x00000507, 0x00050081, 0x0000000C, 0x00000517, 
+0x00000515, 0x00000516, 0x0003003E, 0x00000514, 0x00000517, 0x0004003D, 0x0000000C, 0x00000518, 
+0x00000514, 0x0004003D, 0x0000000C, 0x00000519, 0x000004C9, 0x00050085, 0x0000000C, 0x0000051A, 
+0x00000518, 0x00000519, 0x0004003D, 0x00000006, 0x0000051B, 0x00000447, 0x0004003D, 0x00000006, 
+0x0000051C, 0x000004ED, 0x00050085, 0x00000006, 0x0000051D, 0x0000051B, 0x0000051C, 0x0004003D, 
+0x00000006, 0x0000051F, 0x000004ED, 0x0003003E, 0x0000051E, 0x0000051F, 0x00050041, 0x00000007, 
+0x00000521, 0x000000D5, 0x0000022E, 0x0004003D, 0x00000006, 0x00000522, 0x00000521, 0x0003003E, 
+0x00000520, 0x00000522, 0x00060039, 0x00000006, 0x00000523, 0x0000003D, 0x0000051E, 0x00000520, 
+0x00050085, 0x00000006, 0x00000524, 0x0000051D, 0x00000523, 0x0005008E, 0x0000000C, 0x00000525, 
+0x0000051A, 0x00000524, 0x0004003D, 0x0000000C, 0x00000526, 0x00000425, 0x00050081, 0x0000000C, 
+0x00000527, 0x00000526, 0x00000525, 0x0003003E, 0x00000425, 0x00000527, 0x000200F9, 0x0000042B, 
+0x000200F8, 0x0000042B, 0x0004003D, 0x00000083, 0x00000528, 0x00000427, 0x00050080, 0x00000083, 
+0x00000529, 0x00000528, 0x00000205, 0x0003003E, 0x00000427, 0x00000529, 0x000200F9, 0x00000428, 
+0x000200F8, 0x0000042A, 0x0004003D, 0x0000000C, 0x0000052A, 0x00000425, 0x000200FE, 0x0000052A, 
+0x00010038, 0x00050036, 0x0000000C, 0x000000DB, 0x00000000, 0x000000D2, 0x00030037, 0x0000000D, 
+0x000000D8, 0x00030037, 0x0000000D, 0x000000D9, 0x00030037, 0x000000D1, 0x000000DA, 0x000200F8, 
+0x000000DC, 0x0004003B, 0x0000000D, 0x0000052D, 0x00000007, 0x0004003B, 0x0000000D, 0x00000537, 
+0x00000007, 0x0004003B, 0x0000000D, 0x00000538, 0x00000007, 0x0004003B, 0x00000007, 0x0000053A, 
+0x00000007, 0x0004003B, 0x00000007, 0x0000053D, 0x00000007, 0x0004003B, 0x0000000D, 0x00000541, 
+0x00000007, 0x0004003B, 0x0000000D, 0x00000549, 0x00000007, 0x0004003B, 0x00000084, 0x0000054F, 
+0x00000007, 0x0004003B, 0x0000000D, 0x00000553, 0x00000007, 0x0004003B, 0x0000000D, 0x0000055E, 
+0x00000007, 0x0004003D, 0x0000052F, 0x00000532, 0x00000531, 0x00050041, 0x0000000D, 0x00000533, 
+0x000000DA, 0x00000210, 0x0004003D, 0x0000000C, 0x00000534, 0x00000533, 0x00050057, 0x00000012, 
+0x00000535, 0x00000532, 0x00000534, 0x0008004F, 0x0000000C, 0x00000536, 0x00000535, 0x00000535, 
+0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x0000052D, 0x00000536, 0x0004003D, 0x0000000C, 
+0x00000539, 0x000000D8, 0x0003003E, 0x00000538, 0x00000539, 0x00050041, 0x00000007, 0x0000053B, 
+0x000000DA, 0x00000260, 0x0004003D, 0x00000006, 0x0000053C, 0x0000053B, 0x0003003E, 0x0000053A, 
+0x0000053C, 0x00050041, 0x00000007, 0x0000053E, 0x000000DA, 0x00000216, 0x0004003D, 0x00000006, 
+0x0000053F, 0x0000053E, 0x0003003E, 0x0000053D, 0x0000053F, 0x00070039, 0x0000000C, 0x00000540, 
+0x0000006D, 0x00000538, 0x0000053A, 0x0000053D, 0x0003003E, 0x00000537, 0x00000540, 0x0004003D, 
+0x0000000C, 0x00000542, 0x00000537, 0x00060050, 0x0000000C, 0x00000543, 0x000000DF, 0x000000DF, 
+0x000000DF, 0x00050083, 0x0000000C, 0x00000544, 0x00000543, 0x00000542, 0x00050041, 0x00000007, 
+0x00000545, 0x000000DA, 0x00000205, 0x0004003D, 0x00000006, 0x00000546, 0x00000545, 0x00050083, 
+0x00000006, 0x00000547, 0x000000DF, 0x00000546, 0x0005008E, 0x0000000C, 0x00000548, 0x00000544, 
+0x00000547, 0x0003003E, 0x00000541, 0x00000548, 0x00050041, 0x00000013, 0x0000054A, 0x000000DA, 
+0x000001F3, 0x0004003D, 0x00000012, 0x0000054B, 0x0000054A, 0x0008004F, 0x0000000C, 0x0000054C, 
+0x0000054B, 0x0000054B, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x0000054D, 
+0x0000052D, 0x00050085, 0x0000000C, 0x0000054E, 0x0000054C, 0x0000054D, 0x0003003E, 0x00000549, 
+0x0000054E, 0x00050041, 0x00000351, 0x00000551, 0x000002CB, 0x000002CC, 0x0004003D, 0x00000083, 
+0x00000552, 0x00000551, 0x0003003E, 0x0000054F, 0x00000552, 0x0004003D, 0x0000052F, 0x00000555, 
+0x00000554, 0x0004003D, 0x0000000C, 0x00000556, 0x000000D9, 0x00050041, 0x00000007, 0x00000557, 
+0x000000DA, 0x0000043F, 0x0004003D, 0x00000006, 0x00000558, 0x00000557, 0x0004003D, 0x00000083, 
+0x00000559, 0x0000054F, 0x0004006F, 0x00000006, 0x0000055A, 0x00000559, 0x00050085, 0x00000006, 
+0x0000055B, 0x00000558, 0x0000055A, 0x00070058, 0x00000012, 0x0000055C, 0x00000555, 0x00000556, 
+0x00000002, 0x0000055B, 0x0008004F, 0x0000000C, 0x0000055D, 0x0000055C, 0x0000055C, 0x00000000, 
+0x00000001, 0x00000002, 0x0003003E, 0x00000553, 0x0000055D, 0x0004003D, 0x0000000C, 0x0000055F, 
+0x00000553, 0x0004003D, 0x0000000C, 0x00000560, 0x00000537, 0x00060041, 0x00000007, 0x00000561, 
+0x000000DA, 0x00000350, 0x00000244, 0x0004003D, 0x00000006, 0x00000562, 0x00000561, 0x0005008E, 
+0x0000000C, 0x00000563, 0x00000560, 0x00000562, 0x00060041, 0x00000007, 0x00000565, 0x000000DA, 
+0x00000350, 0x00000564, 0x0004003D, 0x00000006, 0x00000566, 0x00000565, 0x00060050, 0x0000000C, 
+0x00000567, 0x00000566, 0x00000566, 0x00000566, 0x00050081, 0x0000000C, 0x00000568, 0x00000563, 
+0x00000567, 0x00050085, 0x0000000C, 0x00000569, 0x0000055F, 0x00000568, 0x0003003E, 0x0000055E, 
+0x00000569, 0x0004003D, 0x0000000C, 0x0000056A, 0x00000541, 0x0004003D, 0x0000000C, 0x0000056B, 
+0x00000549, 0x00050085, 0x0000000C, 0x0000056C, 0x0000056A, 0x0000056B, 0x0004003D, 0x0000000C, 
+0x0000056D, 0x0000055E, 0x00050081, 0x0000000C, 0x0000056E, 0x0000056C, 0x0000056D, 0x000200FE, 
+0x0000056E, 0x00010038, 
     };
\ No newline at end of file
@@ -319,13 +319,33 @@ vec3 SpecularLobe(const Material material, const Light light, const vec3 h, floa
 
 #define NEW_LIGHTING 1
 
+uint GetLightCluster(vec3 wsPos)
+{
+	vec4 viewPos = u_SceneData.ViewMatrix * vec4(wsPos, 1.0);
+	vec4 clipPos = u_SceneData.ProjectionMatrix * viewPos;
+	vec2 tile = (clipPos.xy / clipPos.w * 0.5 + 0.5) * vec2(LIGHT_CLUSTER_X, LIGHT_CLUSTER_Y);
+	uvec2 tileIndex = uvec2(clamp(tile, vec2(0.0), vec2(LIGHT_CLUSTER_X - 1, LIGHT_CLUSTER_Y - 1)));
+
+	float depth = max(viewPos.z * u_SceneData.ClusterParams.x, 0.0001);
+	float slice = log(depth) * u_SceneData.ClusterParams.y - u_SceneData.ClusterParams.z;
+	uint sliceIndex = uint(clamp(slice, 0.0, float(LIGHT_CLUSTER_Z - 1)));
+
+	return tileIndex.x + LIGHT_CLUSTER_X * (tileIndex.y + LIGHT_CLUSTER_Y * sliceIndex);
+}
+
 vec3 Lighting(vec3 F0, vec3 wsPos, Material material)
 {
 	vec3 result = vec3(0.0);
 
-	for(int i = 0; i < u_SceneData.LightCount; i++)
+	// Directional lights are first in the light list, followed by the lights binned into this fragment's cluster
+	uvec2 cluster = u_LightClusters.Clusters[GetLightCluster(wsPos)];
+	int directionalLightCount = u_SceneData.DirectionalLightCount;
+	int lightCount = directionalLightCount + int(cluster.y);
+
+	for(int i = 0; i < lightCount; i++)
 	{
-		Light light = u_SceneData.lights[i];
+		uint clusterLight = u_LightIndices.Indices[min(cluster.x + uint(i - directionalLightCount), uint(MAX_CLUSTER_LIGHT_INDICES - 1))];
+		Light light = u_LightData.lights[i < directionalLightCount ? i : int(clusterLight)];
 		float value = 0.0;
 
 		if(light.type == 2.0)
@@ -356,6 +376,7 @@ vec3 Lighting(vec3 F0, vec3 wsPos, Material material)
 			float epsilon       = cutoffAngle - cutoffAngle * 0.9f;
 			float attenuation 	= ((theta - cutoffAngle) / epsilon); // atteunate when approaching the outer cone
 			attenuation         *= light.radius / (pow(dist, 2.0) + 1.0);//saturate(1.0f - dist / light.range);
+			attenuation         *= clamp(1.0 - (dist * dist) / (light.radius * light.radius), 0.0, 1.0); // reach zero at the radius, clusters cull at it
 			//float intensity 	= attenuation * attenuation;
 
 			// Erase light if there is no need to compute it
@@ -1,6 +1,7 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
 #extension GL_ARB_shading_language_420pack : enable
+#define INSTANCED
 #include "Buffers.glslh"
 
 layout(push_constant) uniform PushConsts
@@ -33,13 +34,14 @@ out gl_PerVertex
 
 void main()
 {
-	VertexOutput.Position = pushConsts.transform * vec4(inPosition, 1.0);
+	mat4 transform = pushConsts.transform * u_InstanceTransforms.Transforms[gl_InstanceIndex];
+	VertexOutput.Position = transform * vec4(inPosition, 1.0);
     gl_Position = u_CameraData.projView * VertexOutput.Position;
 
 	VertexOutput.Colour = inColor.xyz;
 	VertexOutput.TexCoord = inTexCoord;
-	//VertexOutput.Normal = mat3(pushConsts.transform) * inNormal;
-	mat3 transposeInv = transpose(inverse(mat3(pushConsts.transform)));
+	//VertexOutput.Normal = mat3(transform) * inNormal;
+	mat3 transposeInv = transpose(inverse(mat3(transform)));
     VertexOutput.Normal = transposeInv * inNormal;
 
     VertexOutput.WorldNormal = transposeInv * mat3(inTangent, inBitangent, inNormal);
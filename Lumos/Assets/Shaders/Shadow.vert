@@ -1,6 +1,7 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
 #extension GL_ARB_shading_language_420pack : enable
+#define INSTANCED
 #include "Buffers.glslh"
 
 layout(push_constant) uniform PushConsts
@@ -28,7 +29,7 @@ layout(location = 0) out vec2 uv;
 
 void main()
 {
-    mat4 transform = pushConsts.transform;
+    mat4 transform = pushConsts.transform * u_InstanceTransforms.Transforms[gl_InstanceIndex];
     mat4 proj;
     switch(pushConsts.cascadeIndex)
     {
@@ -1,6 +1,7 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
 #extension GL_ARB_shading_language_420pack : enable
+#define ANIMATED
 #include "Buffers.glslh"
 
 layout(push_constant) uniform PushConsts
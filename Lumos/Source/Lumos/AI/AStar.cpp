@@ -7,23 +7,22 @@ namespace Lumos
 
     AStar::AStar(const TDArray<PathNode*>& nodes)
     {
-        HashMapInit(&m_NodeData);
+        m_NodeData.Reserve((uint32_t)nodes.Size());
 
         // Create node data
         for(auto it = nodes.begin(); it != nodes.end(); ++it)
         {
             QueueablePathNode* pathNode = new QueueablePathNode(*it);
-            HashMapInsert(&m_NodeData, *it, pathNode);
+            m_NodeData.Insert(*it, pathNode);
         }
     }
 
     AStar::~AStar()
     {
 
-        ForHashMapEach(PathNode*, QueueablePathNode*, &m_NodeData, it)
+        for(auto& nodeData : m_NodeData)
         {
-            QueueablePathNode* value = *it.value;
-            delete value;
+            delete nodeData.Value;
         }
     }
 
@@ -35,9 +34,9 @@ namespace Lumos
         m_Path.Clear();
 
         // Reset node data
-        ForHashMapEach(PathNode*, QueueablePathNode*, &m_NodeData, it)
+        for(auto& nodeData : m_NodeData)
         {
-            QueueablePathNode* value = *it.value;
+            QueueablePathNode* value = nodeData.Value;
             value->Parent            = nullptr;
             value->fScore            = std::numeric_limits<float>::max();
             value->gScore            = std::numeric_limits<float>::max();
@@ -50,7 +49,7 @@ namespace Lumos
         Reset();
 
         QueueablePathNode* startNode = nullptr;
-        if(HashMapFind(&m_NodeData, start, &startNode))
+        if(m_NodeData.Find(start, startNode))
         {
             // Add start node to open list
             startNode->gScore = 0.0f;
@@ -86,7 +85,7 @@ namespace Lumos
                 QueueablePathNode* q         = nullptr;
                 QueueablePathNode* otherNode = nullptr;
                 auto otherNodePtr            = pq->OtherNode(p->node);
-                HashMapFind(&m_NodeData, otherNodePtr, &q);
+                m_NodeData.Find(otherNodePtr, q);
 
                 // Calculate new scores
                 float gScore = p->gScore + pq->Cost();
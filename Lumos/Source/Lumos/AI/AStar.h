@@ -37,7 +37,7 @@ namespace Lumos
         }
 
     private:
-        HashMap(PathNode*, QueueablePathNode*) m_NodeData;
+        FlatHashMap<PathNode*, QueueablePathNode*> m_NodeData;
         PathNodePriorityQueue m_OpenList;
         TDArray<QueueablePathNode*> m_ClosedList;
         TDArray<PathNode*> m_Path;
@@ -0,0 +1,353 @@
+#include "Precompiled.h"
+#include "AudioStream.h"
+#include "Sound.h"
+#include "Core/OS/FileSystem.h"
+#include "Core/Thread.h"
+#include "Utilities/StringUtilities.h"
+#include "Maths/MathsUtilities.h"
+
+#define STB_VORBIS_HEADER_ONLY
+#include <stb/stb_vorbis.c>
+
+namespace Lumos
+{
+    AudioStream::AudioStream(const std::string& filePath, uint32_t chunkSize)
+        : m_ChunkSize(chunkSize)
+    {
+        std::string physicalPath;
+        if(!FileSystem::Get().ResolvePhysicalPath(filePath, physicalPath))
+            physicalPath = filePath;
+
+        std::string extension = StringUtilities::GetFilePathExtension(filePath);
+        if(extension == "ogg")
+            m_Valid = OpenOgg(physicalPath);
+        else if(extension == "wav")
+            m_Valid = OpenWav(physicalPath);
+
+        if(!m_Valid)
+        {
+            LERROR("Failed to open audio stream %s", physicalPath.c_str());
+            return;
+        }
+
+        if(m_ChunkSize == 0)
+            return;
+
+        // Whole sample frames only, so chunks never split a frame
+        uint32_t frameSize = m_Format.Channels * (m_Format.BitRate / 8);
+        m_ChunkSize        = Maths::Max(frameSize, m_ChunkSize - m_ChunkSize % frameSize);
+
+        for(auto& chunk : m_Chunks)
+            chunk.Data.Resize(m_ChunkSize);
+
+        if(m_Vorbis)
+            m_DecodeScratch.Resize(m_ChunkSize * m_SourceChannels);
+    }
+
+    AudioStream::~AudioStream()
+    {
+        if(m_Vorbis)
+            stb_vorbis_close(m_Vorbis);
+        if(m_File)
+            fclose(m_File);
+    }
+
+    bool AudioStream::ReadFormat(const std::string& filePath, AudioData& outFormat)
+    {
+        AudioStream stream(filePath, 0);
+        outFormat = stream.GetFormat();
+        return stream.IsValid();
+    }
+
+    bool AudioStream::OpenOgg(const std::string& physicalPath)
+    {
+        int error = 0;
+        m_Vorbis  = stb_vorbis_open_filename(physicalPath.c_str(), &error, nullptr);
+        if(!m_Vorbis)
+            return false;
+
+        const stb_vorbis_info info = stb_vorbis_get_info(m_Vorbis);
+        m_SourceChannels           = info.channels;
+        m_Format.Channels          = 1;
+        m_Format.BitRate           = 16;
+        m_Format.FreqRate          = static_cast<float>(info.sample_rate);
+        m_Format.Size              = stb_vorbis_stream_length_in_samples(m_Vorbis) * sizeof(int16_t);
+        m_Format.Length            = stb_vorbis_stream_length_in_seconds(m_Vorbis) * 1000.0f; // Milliseconds
+        return m_SourceChannels > 0;
+    }
+
+    bool AudioStream::OpenWav(const std::string& physicalPath)
+    {
+        m_File = fopen(physicalPath.c_str(), "rb");
+        if(!m_File)
+            return false;
+
+        char chunkName[4];
+        uint32_t chunkSize = 0;
+        bool foundFormat   = false;
+
+        while(fread(chunkName, 1, 4, m_File) == 4 && fread(&chunkSize, 4, 1, m_File) == 1)
+        {
+            if(memcmp(chunkName, "RIFF", 4) == 0)
+            {
+                fseek(m_File, 4, SEEK_CUR);
+            }
+            else if(memcmp(chunkName, "fmt ", 4) == 0)
+            {
+                // Read field by field, the layout of FMTCHUNK depends on the size of long
+                uint16_t format, channels, blockAlign, bitsPerSample;
+                uint32_t sampleRate, byteRate;
+                fread(&format, 2, 1, m_File);
+                fread(&channels, 2, 1, m_File);
+                fread(&sampleRate, 4, 1, m_File);
+                fread(&byteRate, 4, 1, m_File);
+                fread(&blockAlign, 2, 1, m_File);
+                fread(&bitsPerSample, 2, 1, m_File);
+                fseek(m_File, chunkSize - 16, SEEK_CUR);
+
+                m_Format.Channels = channels;
+                m_Format.FreqRate = static_cast<float>(sampleRate);
+                m_Format.BitRate  = bitsPerSample;
+                foundFormat       = true;
+            }
+            else if(memcmp(chunkName, "data", 4) == 0)
+            {
+                m_DataOffset  = (uint32_t)ftell(m_File);
+                m_Format.Size = chunkSize;
+                break;
+            }
+            else
+            {
+                fseek(m_File, chunkSize, SEEK_CUR);
+            }
+        }
+
+        if(!foundFormat || m_DataOffset == 0 || m_Format.Channels == 0 || m_Format.BitRate == 0)
+            return false;
+
+        m_Format.Length = static_cast<float>(m_Format.Size) / (m_Format.Channels * m_Format.FreqRate * (m_Format.BitRate / 8.0f)) * 1000.0f;
+        return true;
+    }
+
+    uint32_t AudioStream::GetMemoryUsage() const
+    {
+        return m_ChunkSize * AUDIO_STREAM_CHUNK_COUNT + (uint32_t)m_DecodeScratch.Size();
+    }
+
+    uint32_t AudioStream::ReadPCM(uint8_t* dst, uint32_t maxBytes)
+    {
+        if(m_Vorbis)
+        {
+            int16_t* scratch = reinterpret_cast<int16_t*>(m_DecodeScratch.Data());
+            int samples      = stb_vorbis_get_samples_short_interleaved(m_Vorbis, m_SourceChannels, scratch, (maxBytes / sizeof(int16_t)) * m_SourceChannels);
+            uint32_t bytes   = samples * m_SourceChannels * sizeof(int16_t);
+
+            Sound::ConvertToMono(m_DecodeScratch.Data(), bytes, dst, m_SourceChannels, 16);
+            return samples * sizeof(int16_t);
+        }
+
+        uint32_t remaining = m_Format.Size - m_DataRead;
+        uint32_t bytes     = (uint32_t)fread(dst, 1, Maths::Min(maxBytes, remaining), m_File);
+        m_DataRead += bytes;
+        return bytes;
+    }
+
+    void AudioStream::SeekDecoder(double seconds)
+    {
+        seconds = Maths::Clamp(seconds, 0.0, m_Format.Length / 1000.0);
+
+        if(m_Vorbis)
+        {
+            stb_vorbis_seek(m_Vorbis, (unsigned int)(seconds * m_Format.FreqRate));
+        }
+        else
+        {
+            uint32_t frameSize = m_Format.Channels * (m_Format.BitRate / 8);
+            uint32_t frame     = (uint32_t)(seconds * m_Format.FreqRate);
+            m_DataRead         = Maths::Min(frame * frameSize, m_Format.Size);
+            fseek(m_File, m_DataOffset + m_DataRead, SEEK_SET);
+        }
+
+        m_DecodeTime = seconds;
+    }
+
+    bool AudioStream::DecodeChunk()
+    {
+        if(!m_Valid || m_EndOfStream.load(std::memory_order_relaxed))
+            return false;
+
+        std::lock_guard<std::mutex> lock(m_DecodeMutex);
+
+        uint32_t write = m_WriteIndex.load(std::memory_order_relaxed);
+        if(write - m_ReadIndex.load(std::memory_order_acquire) >= AUDIO_STREAM_CHUNK_COUNT)
+            return false;
+
+        LUMOS_PROFILE_FUNCTION();
+        AudioStreamChunk& chunk = m_Chunks[write % AUDIO_STREAM_CHUNK_COUNT];
+        chunk.StartTime         = m_DecodeTime;
+
+        uint32_t filled    = 0;
+        uint32_t wrapStart = 0; // Bytes before a loop wrap were timed from before it, SeekDecoder resets the time
+        bool rewound       = false;
+        while(filled < m_ChunkSize)
+        {
+            uint32_t bytes = ReadPCM(chunk.Data.Data() + filled, m_ChunkSize - filled);
+            if(bytes == 0)
+            {
+                // Wrap looping sounds inside the chunk so there is no gap at the loop point
+                if(m_Looping.load(std::memory_order_relaxed) && !rewound)
+                {
+                    SeekDecoder(0.0);
+                    wrapStart = filled;
+                    rewound   = true;
+                    continue;
+                }
+
+                m_EndOfStream.store(true, std::memory_order_relaxed);
+                break;
+            }
+
+            filled += bytes;
+            rewound = false;
+        }
+
+        if(filled == 0)
+            return true;
+
+        uint32_t bytesPerSecond = (uint32_t)(m_Format.FreqRate * m_Format.Channels * (m_Format.BitRate / 8));
+        m_DecodeTime += (double)(filled - wrapStart) / bytesPerSecond;
+        chunk.Size = filled;
+        m_WriteIndex.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    const AudioStreamChunk* AudioStream::PeekChunk() const
+    {
+        uint32_t read = m_ReadIndex.load(std::memory_order_relaxed);
+        if(read == m_WriteIndex.load(std::memory_order_acquire))
+            return nullptr;
+
+        return &m_Chunks[read % AUDIO_STREAM_CHUNK_COUNT];
+    }
+
+    void AudioStream::PopChunk()
+    {
+        m_ReadIndex.store(m_ReadIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    void AudioStream::Seek(double seconds)
+    {
+        if(!m_Valid)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_DecodeMutex);
+        SeekDecoder(seconds);
+        m_ReadIndex.store(m_WriteIndex.load(std::memory_order_relaxed), std::memory_order_release);
+        m_EndOfStream.store(false, std::memory_order_relaxed);
+    }
+
+    bool AudioStream::IsFinished() const
+    {
+        return m_EndOfStream.load(std::memory_order_relaxed) && PeekChunk() == nullptr;
+    }
+
+    AudioStreamer* AudioStreamer::s_Instance = nullptr;
+
+    AudioStreamer::AudioStreamer(uint64_t memoryBudget)
+        : m_MemoryBudget(memoryBudget)
+    {
+        ASSERT(!s_Instance, "Only one AudioStreamer can exist");
+        s_Instance = this;
+        m_Running  = true;
+        m_Thread   = std::thread([this]
+                                { Run(); });
+    }
+
+    AudioStreamer::~AudioStreamer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_WakeMutex);
+            m_Running = false;
+        }
+        m_WakeCondition.notify_one();
+        m_Thread.join();
+
+        if(!m_Streams.Empty())
+            LWARN("AudioStreamer destroyed with %u streams still registered", (uint32_t)m_Streams.Size());
+
+        s_Instance = nullptr;
+    }
+
+    bool AudioStreamer::AddStream(AudioStream* stream)
+    {
+        if(!stream || !stream->IsValid())
+            return false;
+
+        std::lock_guard<std::mutex> lock(m_StreamsMutex);
+        uint64_t usage = stream->GetMemoryUsage();
+        if(m_MemoryUsage + usage > m_MemoryBudget)
+        {
+            LWARN("Audio stream memory budget of %llu bytes exceeded, not streaming", (unsigned long long)m_MemoryBudget);
+            return false;
+        }
+
+        m_MemoryUsage += usage;
+        m_Streams.PushBack(stream);
+        Wake();
+        return true;
+    }
+
+    void AudioStreamer::RemoveStream(AudioStream* stream)
+    {
+        // Held while the worker decodes, so the stream is idle once this returns
+        std::lock_guard<std::mutex> lock(m_StreamsMutex);
+        for(size_t i = 0; i < m_Streams.Size(); i++)
+        {
+            if(m_Streams[i] == stream)
+            {
+                m_Streams[i] = m_Streams.Back();
+                m_Streams.PopBack();
+                m_MemoryUsage -= stream->GetMemoryUsage();
+                return;
+            }
+        }
+    }
+
+    void AudioStreamer::Wake()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_WakeMutex);
+            m_WakeRequested = true;
+        }
+        m_WakeCondition.notify_one();
+    }
+
+    void AudioStreamer::Run()
+    {
+        ThreadContext& threadContext = *GetThreadContext();
+        threadContext                = ThreadContextAlloc();
+        LUMOS_PROFILE_SETTHREADNAME("AudioStreamer");
+        SetThreadName(Str8Lit("AudioStreamer"));
+
+        while(m_Running.load())
+        {
+            bool decoded = false;
+            {
+                std::lock_guard<std::mutex> lock(m_StreamsMutex);
+                for(auto stream : m_Streams)
+                    decoded |= stream->DecodeChunk();
+            }
+
+            // Keep going while there is work, otherwise sleep until a chunk is consumed
+            if(decoded)
+                continue;
+
+            std::unique_lock<std::mutex> lock(m_WakeMutex);
+            m_WakeCondition.wait_for(lock, std::chrono::milliseconds(10), [this]
+                                     { return m_WakeRequested || !m_Running.load(); });
+            m_WakeRequested = false;
+        }
+
+        ThreadContextRelease(&threadContext);
+    }
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "AudioData.h"
+#include "Core/Core.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct stb_vorbis;
+
+namespace Lumos
+{
+    static const uint32_t AUDIO_STREAM_CHUNK_COUNT = 4;
+    static const uint32_t AUDIO_STREAM_CHUNK_SIZE  = Kilobytes(64);
+
+    struct AudioStreamChunk
+    {
+        TDArray<uint8_t> Data;
+        uint32_t Size    = 0;
+        double StartTime = 0.0; // Seconds into the sound of the first sample
+    };
+
+    // Incremental ogg/wav decoder feeding a small ring of pcm chunks.
+    // DecodeChunk runs on the AudioStreamer thread, the chunk/seek functions on the audio thread.
+    // Ogg data is mixed down to mono to match LoadOgg.
+    class LUMOS_EXPORT AudioStream
+    {
+    public:
+        AudioStream(const std::string& filePath, uint32_t chunkSize = AUDIO_STREAM_CHUNK_SIZE);
+        ~AudioStream();
+
+        NONCOPYABLE(AudioStream);
+
+        // Reads the format and decoded size of a file without decoding it
+        static bool ReadFormat(const std::string& filePath, AudioData& outFormat);
+
+        bool IsValid() const { return m_Valid; }
+
+        // Format of the decoded pcm. Data is empty, Size is the decoded size of the whole stream
+        const AudioData& GetFormat() const { return m_Format; }
+        uint32_t GetMemoryUsage() const;
+
+        // Decodes into the next free chunk. Returns false if there was nothing to do
+        bool DecodeChunk();
+
+        // Oldest decoded chunk, or nullptr if the decoder hasn't caught up
+        const AudioStreamChunk* PeekChunk() const;
+        void PopChunk();
+
+        // Drops any decoded chunks and restarts decoding from seconds
+        void Seek(double seconds);
+        void SetLooping(bool looping) { m_Looping.store(looping, std::memory_order_relaxed); }
+
+        // End of the stream was decoded and every chunk consumed
+        bool IsFinished() const;
+
+    private:
+        bool OpenOgg(const std::string& physicalPath);
+        bool OpenWav(const std::string& physicalPath);
+        uint32_t ReadPCM(uint8_t* dst, uint32_t maxBytes);
+        void SeekDecoder(double seconds);
+
+        AudioData m_Format;
+        bool m_Valid         = false;
+        uint32_t m_ChunkSize = 0;
+
+        stb_vorbis* m_Vorbis      = nullptr;
+        uint32_t m_SourceChannels = 0;
+        TDArray<uint8_t> m_DecodeScratch;
+
+        FILE* m_File          = nullptr;
+        uint32_t m_DataOffset = 0;
+        uint32_t m_DataRead   = 0;
+
+        AudioStreamChunk m_Chunks[AUDIO_STREAM_CHUNK_COUNT];
+        std::atomic<uint32_t> m_ReadIndex  = 0;
+        std::atomic<uint32_t> m_WriteIndex = 0;
+        std::atomic<bool> m_EndOfStream    = false;
+        std::atomic<bool> m_Looping        = false;
+        double m_DecodeTime                = 0.0;
+        std::mutex m_DecodeMutex;
+    };
+
+    // Worker thread decoding every registered AudioStream ahead of playback.
+    // Stream memory is limited by a budget, streams that would exceed it are refused.
+    class LUMOS_EXPORT AudioStreamer
+    {
+    public:
+        AudioStreamer(uint64_t memoryBudget = Megabytes(8));
+        ~AudioStreamer();
+
+        NONCOPYABLE(AudioStreamer);
+
+        static AudioStreamer* Get() { return s_Instance; }
+
+        bool AddStream(AudioStream* stream);
+        void RemoveStream(AudioStream* stream);
+
+        // Call after consuming chunks so the worker refills them without waiting for its timeout
+        void Wake();
+
+        void SetMemoryBudget(uint64_t budget) { m_MemoryBudget = budget; }
+        uint64_t GetMemoryBudget() const { return m_MemoryBudget; }
+        uint64_t GetMemoryUsage() const { return m_MemoryUsage; }
+        uint32_t GetStreamCount() const { return (uint32_t)m_Streams.Size(); }
+
+    private:
+        void Run();
+
+        static AudioStreamer* s_Instance;
+
+        TDArray<AudioStream*> m_Streams;
+        uint64_t m_MemoryBudget = 0;
+        uint64_t m_MemoryUsage  = 0;
+
+        std::thread m_Thread;
+        std::mutex m_StreamsMutex;
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCondition;
+        std::atomic<bool> m_Running = false;
+        bool m_WakeRequested        = false;
+    };
+}
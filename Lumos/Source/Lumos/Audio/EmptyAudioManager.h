@@ -7,7 +7,7 @@ namespace Lumos
         class EmptyAudioManager : public AudioManager
         {
         public:
-            EmptyAudioManager(int numChannels = 8) { }
+            EmptyAudioManager(int numChannels = 8) { m_Access.Exclusive = false; }
             ~EmptyAudioManager() = default;
 
             bool OnInit() override { return true; };
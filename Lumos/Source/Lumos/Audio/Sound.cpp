@@ -8,6 +8,8 @@
 
 namespace Lumos
 {
+    uint32_t Sound::s_StreamingThreshold = Megabytes(2);
+
     Sound::Sound()
         : m_Streaming(false)
         , m_Data {}
@@ -45,6 +45,10 @@ namespace Lumos
 
         const std::string& GetFilePath() const { return m_FilePath; }
 
+        // Sounds that decode to more than this many bytes are streamed instead of loaded whole
+        static void SetStreamingThreshold(uint32_t bytes) { s_StreamingThreshold = bytes; }
+        static uint32_t GetStreamingThreshold() { return s_StreamingThreshold; }
+
         static void ConvertToMono(const uint8_t* inputData, int dataSize, uint8_t* monoData, int channels, int bitsPerSample);
 
     protected:
@@ -53,5 +57,7 @@ namespace Lumos
         std::string m_FilePath;
 
         AudioData m_Data;
+
+        static uint32_t s_StreamingThreshold;
     };
 }
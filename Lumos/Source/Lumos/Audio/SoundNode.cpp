@@ -43,6 +43,9 @@ namespace Lumos
         m_ReferenceDistance = 1.0f;
         m_RollOffFactor     = 1.0f;
         m_Velocity          = Vec3(0.0f);
+        m_Priority          = 128;
+        m_Audibility        = 0.0f;
+        m_Virtual           = true;
     }
 
     SoundNode::~SoundNode()
@@ -67,4 +70,33 @@ namespace Lumos
     {
         m_Radius = Maths::Max(0.0f, value);
     }
+
+    void SoundNode::SetPriority(int value)
+    {
+        m_Priority = Maths::Clamp(value, 0, 255);
+    }
+
+    float SoundNode::ComputeAudibility(const Vec3& listenerPosition)
+    {
+        if(!m_Sound || m_Paused)
+        {
+            m_Audibility = 0.0f;
+            return m_Audibility;
+        }
+
+        if(m_IsGlobal)
+        {
+            m_Audibility = m_Volume;
+            return m_Audibility;
+        }
+
+        // Same attenuation as AL_LINEAR_DISTANCE_CLAMPED
+        float distance    = Maths::Distance(m_Position, listenerPosition);
+        float range       = Maths::Max(m_Radius - m_ReferenceDistance, 0.0001f);
+        distance          = Maths::Clamp(distance, m_ReferenceDistance, m_Radius);
+        float attenuation = 1.0f - m_RollOffFactor * (distance - m_ReferenceDistance) / range;
+
+        m_Audibility = m_Volume * Maths::Clamp(attenuation, 0.0f, 1.0f);
+        return m_Audibility;
+    }
 }
@@ -57,10 +57,23 @@ namespace Lumos
 
         double GetTimeLeft() const { return m_TimeLeft; }
 
+        // Higher priority voices keep a hardware source over quieter ones
+        int GetPriority() const { return m_Priority; }
+        void SetPriority(int value);
+
+        // Virtual voices have no source, their playback is only tracked in time
+        bool IsVirtual() const { return m_Virtual; }
+        float GetAudibility() const { return m_Audibility; }
+        float ComputeAudibility(const Vec3& listenerPosition);
+
+        // Playback position in seconds
+        virtual double GetPlaybackPosition() const { return m_StreamPos; }
+
         virtual void OnUpdate(float msec) = 0;
         virtual void Pause()              = 0;
         virtual void Resume()             = 0;
         virtual void Stop()               = 0;
+        virtual void Seek(double seconds) = 0;
         virtual void SetSound(SharedPtr<Sound> s);
 
     protected:
@@ -77,7 +90,10 @@ namespace Lumos
         float m_ReferenceDistance;
         float m_RollOffFactor;
         bool m_Stationary;
-        double m_StreamPos;
+        double m_StreamPos; // Seconds, only tracked for streaming and virtual voices
+        int m_Priority;
+        float m_Audibility;
+        bool m_Virtual;
     };
 
 }
@@ -21,6 +21,7 @@
 #include "Core/OS/Input.h"
 #include "Core/OS/Window.h"
 #include "Core/Profiler.h"
+#include "Core/Telemetry.h"
 #include "Core/OS/FileSystem.h"
 #include "Core/JobSystem.h"
 #include "Core/CoreSystem.h"
@@ -231,12 +232,47 @@ namespace Lumos
         GetUIState()->DPIScale = Application::Get().GetWindow()->GetDPIScale();
         
         LINFO("Initalised UI");
-        Maths::TestMaths();
+    }
+
+    void Application::InitHeadless()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_Headless   = true;
+        m_FrameArena = ArenaAlloc(Megabytes(1));
+        m_Arena      = ArenaAlloc(Kilobytes(64));
+
+        m_SceneManager  = CreateUniquePtr<SceneManager>();
+        m_AssetManager  = CreateSharedPtr<AssetManager>();
+        m_SystemManager = CreateUniquePtr<SystemManager>();
+        m_Timer         = CreateUniquePtr<Timer>();
+
+        Engine::Get();
+        LuaManager::Get().OnInit();
+
+        m_SystemManager->RegisterSystem<LumosPhysicsEngine>();
+        m_SystemManager->RegisterSystem<B2PhysicsEngine>();
+
+        m_EditorState  = EditorState::Play;
+        m_CurrentState = AppState::Running;
+        LINFO("Initialised headless Application");
     }
 
     void Application::OnQuit()
     {
         LUMOS_PROFILE_FUNCTION();
+        if(m_Headless)
+        {
+            ArenaRelease(m_FrameArena);
+            ArenaRelease(m_Arena);
+
+            Engine::Release();
+            m_AssetManager.reset();
+            m_SceneManager.reset();
+            LuaManager::Release();
+            m_SystemManager.reset();
+            return;
+        }
+
         Serialise();
 
         ArenaRelease(m_FrameArena);
@@ -383,6 +419,10 @@ namespace Lumos
         LUMOS_PROFILE_FUNCTION();
         LUMOS_PROFILE_FRAMEMARKER();
 
+        // Collects the previous frame, so this frame's scope below is counted in full
+        LUMOS_TELEMETRY_FRAME();
+        LUMOS_TELEMETRY_SCOPE("Application::Frame");
+
         ArenaClear(m_FrameArena);
 
         if(m_SceneManager->GetSwitchingScene())
@@ -479,6 +519,7 @@ namespace Lumos
 
         {
             LUMOS_PROFILE_SCOPE("Application::Update");
+            LUMOS_TELEMETRY_SCOPE("Application::Update");
             OnUpdate(ts);
 
             System::JobSystem::Execute(context, [](JobDispatchArgs args)
@@ -507,6 +548,7 @@ namespace Lumos
         if(!m_Minimized)
         {
             LUMOS_PROFILE_SCOPE("Application::Render");
+            LUMOS_TELEMETRY_SCOPE("Application::Render");
             Engine::Get().ResetStats();
 
             OnRender();
@@ -565,6 +607,10 @@ namespace Lumos
         if(!m_Minimized)
             Graphics::Renderer::GetRenderer()->Present();
 
+        LUMOS_TELEMETRY_COUNTER_SET("DrawCalls", stats.NumDrawCalls);
+        LUMOS_TELEMETRY_COUNTER_SET("Triangles", stats.TriangleCount);
+        LUMOS_TELEMETRY_COUNTER_SET("RenderedObjects", stats.NumRenderedObjects);
+
         return m_CurrentState != AppState::Closing;
     }
 
@@ -652,6 +698,8 @@ namespace Lumos
             LuaManager::Get().OnUpdate(m_SceneManager->GetCurrentScene());
             m_SceneManager->GetCurrentScene()->OnUpdate(dt);
         }
+        else
+            LuaManager::Get().StepGarbageCollector();
         m_ImGuiManager->OnUpdate(dt, m_SceneManager->GetCurrentScene());
     }
 
@@ -691,7 +739,8 @@ namespace Lumos
     void Application::OnNewScene(Scene* scene)
     {
         LUMOS_PROFILE_FUNCTION();
-        m_SceneRenderer->OnNewScene(scene);
+        if(m_SceneRenderer)
+            m_SceneRenderer->OnNewScene(scene);
     }
 
     SharedPtr<AssetManager>& Application::GetAssetManager()
@@ -773,6 +822,7 @@ namespace Lumos
     void Application::UpdateSystems()
     {
         LUMOS_PROFILE_FUNCTION();
+        LUMOS_TELEMETRY_SCOPE("Application::UpdateSystems");
         if(Application::Get().GetEditorState() != EditorState::Paused
            && Application::Get().GetEditorState() != EditorState::Preview)
         {
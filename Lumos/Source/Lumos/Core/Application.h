@@ -70,6 +70,10 @@ namespace Lumos
         virtual void Init();
         virtual void OnQuit();
 
+        // Scene, systems and scripting only. No window, renderer, audio or ImGui
+        void InitHeadless();
+        bool IsHeadless() const { return m_Headless; }
+
         void Run();
         bool OnFrame();
 
@@ -212,6 +216,7 @@ namespace Lumos
         bool m_Minimized                = false;
         bool m_SceneActive              = true;
         bool m_DisableMainSceneRenderer = false;
+        bool m_Headless                 = false;
 
         uint32_t m_SceneViewWidth  = 0;
         uint32_t m_SceneViewHeight = 0;
@@ -7,6 +7,7 @@
 #include "Core/CommandLine.h"
 #include "Core/Thread.h"
 #include "Core/OS/MemoryManager.h"
+#include "Core/Telemetry.h"
 
 namespace Lumos
 {
@@ -55,10 +56,17 @@ namespace Lumos
         void CoreSystem::Shutdown()
         {
             LINFO("Shutting down System");
+
+            // --telemetry=<path> writes the frame telemetry gathered this run
+            String8 telemetryPath = s_CommandLine.OptionString(Str8Lit("telemetry"));
+            if(telemetryPath.size)
+                Telemetry::Dump(ToStdString(telemetryPath));
+
             FileSystem::Release();
 
             Debug::Log::OnRelease();
             System::JobSystem::Release();
+            Telemetry::Release();
 
             ArenaClear(s_Arena);
 
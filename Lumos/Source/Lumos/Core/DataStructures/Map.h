@@ -2,6 +2,19 @@
 #include "Core/OS/Memory.h"
 #include "Utilities/Hash.h"
 #include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LUMOS_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace Lumos
 {
@@ -132,7 +145,7 @@ namespace Lumos
         map->length = 0;
     }
 
-    static inline void HashMapDeinitRaw(HashMapRaw* map)
+    static inline void HashMapDeinitRaw(HashMapRaw* map, int elem_size)
     {
         if(!map->arena && map->data)
         {
@@ -143,4 +156,523 @@ namespace Lumos
         *map             = empty;
     }
 
+    // Typed open addressing map, Swiss table style.
+    // Keys and values live in one slot array, with a separate array of one byte control
+    // values (empty, deleted, or the top 7 bits of the hash) that is probed 16 slots at a time.
+    // Only slots whose control byte matches are compared, so most misses never touch an entry.
+    //
+    //   FlatHashMap<u64, UI_Widget*> map;
+    //   map.SetArena(arena); // Optional, otherwise the heap is used
+    //   map.Insert(key, widget);
+    //   if(UI_Widget** found = map.Find(key)) { }
+    //   for(auto& entry : map) { entry.Key; entry.Value; }
+    //
+    // A zero initialised FlatHashMap is a valid empty map.
+    // Pointers to values are invalidated when the map grows.
+
+    inline uint64_t MapHashMix(uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    template <typename T>
+    struct MapHash
+    {
+        uint64_t operator()(const T& value) const
+        {
+            return MapHashMix((uint64_t)std::hash<T>()(value));
+        }
+    };
+
+    // Transparent, so lookups can use string_view or const char* without building a std::string
+    template <>
+    struct MapHash<std::string>
+    {
+        uint64_t operator()(std::string_view value) const
+        {
+            return MapHashMix((uint64_t)std::hash<std::string_view>()(value));
+        }
+    };
+
+    struct MapKeyEqual
+    {
+        template <typename A, typename B>
+        bool operator()(const A& a, const B& b) const
+        {
+            return a == b;
+        }
+    };
+
+    namespace MapDetail
+    {
+        static constexpr int8_t CtrlEmpty      = -128;
+        static constexpr int8_t CtrlDeleted    = -2;
+        static constexpr uint32_t GroupWidth   = 16;
+        static constexpr uint32_t InvalidIndex = ~0u;
+        static constexpr uint32_t MinCapacity  = 16;
+
+        inline uint32_t TrailingZeros(uint32_t mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return (uint32_t)index;
+#else
+            return (uint32_t)__builtin_ctz(mask);
+#endif
+        }
+
+        // Leading zeros of a 16 bit group mask
+        inline uint32_t LeadingZeros16(uint32_t mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanReverse(&index, mask);
+            return 15 - (uint32_t)index;
+#else
+            return (uint32_t)__builtin_clz(mask) - 16;
+#endif
+        }
+
+        // One bit per slot of a 16 byte control group
+        struct Group
+        {
+#ifdef LUMOS_MAP_SSE2
+            __m128i Ctrl;
+
+            explicit Group(const int8_t* ctrl)
+                : Ctrl(_mm_loadu_si128((const __m128i*)ctrl))
+            {
+            }
+
+            uint32_t Match(int8_t h2) const
+            {
+                return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), Ctrl));
+            }
+
+            // Empty and deleted are the only control values with the sign bit set
+            uint32_t MatchEmptyOrDeleted() const
+            {
+                return (uint32_t)_mm_movemask_epi8(Ctrl);
+            }
+#else
+            const int8_t* Ctrl;
+
+            explicit Group(const int8_t* ctrl)
+                : Ctrl(ctrl)
+            {
+            }
+
+            uint32_t Match(int8_t h2) const
+            {
+                uint32_t mask = 0;
+                for(uint32_t i = 0; i < GroupWidth; i++)
+                    mask |= (uint32_t)(Ctrl[i] == h2) << i;
+                return mask;
+            }
+
+            uint32_t MatchEmptyOrDeleted() const
+            {
+                uint32_t mask = 0;
+                for(uint32_t i = 0; i < GroupWidth; i++)
+                    mask |= (uint32_t)(Ctrl[i] < 0) << i;
+                return mask;
+            }
+#endif
+            uint32_t MatchEmpty() const
+            {
+                return Match(CtrlEmpty);
+            }
+        };
+    }
+
+    template <typename K, typename V, typename Hash = MapHash<K>, typename KeyEqual = MapKeyEqual>
+    class FlatHashMap
+    {
+    public:
+        struct Entry
+        {
+            K Key;
+            V Value;
+        };
+
+        template <typename MapType, typename EntryType>
+        class IteratorBase
+        {
+        public:
+            IteratorBase(MapType* map, uint32_t index)
+                : m_Map(map)
+                , m_Index(index)
+            {
+                SkipEmpty();
+            }
+
+            EntryType& operator*() const { return m_Map->m_Entries[m_Index]; }
+            EntryType* operator->() const { return &m_Map->m_Entries[m_Index]; }
+
+            IteratorBase& operator++()
+            {
+                m_Index++;
+                SkipEmpty();
+                return *this;
+            }
+
+            bool operator==(const IteratorBase& other) const { return m_Index == other.m_Index; }
+            bool operator!=(const IteratorBase& other) const { return m_Index != other.m_Index; }
+
+        private:
+            friend class FlatHashMap;
+
+            void SkipEmpty()
+            {
+                while(m_Index < m_Map->m_Capacity && m_Map->m_Ctrl[m_Index] < 0)
+                    m_Index++;
+            }
+
+            MapType* m_Map;
+            uint32_t m_Index;
+        };
+
+        using Iterator      = IteratorBase<FlatHashMap, Entry>;
+        using ConstIterator = IteratorBase<const FlatHashMap, const Entry>;
+
+        FlatHashMap() = default;
+        explicit FlatHashMap(Arena* arena)
+            : m_Arena(arena)
+        {
+        }
+
+        ~FlatHashMap()
+        {
+            Destroy();
+        }
+
+        FlatHashMap(FlatHashMap&& other) noexcept
+        {
+            Swap(other);
+        }
+
+        FlatHashMap& operator=(FlatHashMap&& other) noexcept
+        {
+            if(this != &other)
+            {
+                Destroy();
+                Swap(other);
+            }
+            return *this;
+        }
+
+        NONCOPYABLE(FlatHashMap);
+
+        // Must be set before the first insert
+        void SetArena(Arena* arena)
+        {
+            ASSERT(m_Capacity == 0, "Arena must be set on an empty map");
+            m_Arena = arena;
+        }
+
+        template <typename Q>
+        V* Find(const Q& key)
+        {
+            uint32_t index = FindIndex(key, Hash()(key));
+            return index == MapDetail::InvalidIndex ? nullptr : &m_Entries[index].Value;
+        }
+
+        template <typename Q>
+        const V* Find(const Q& key) const
+        {
+            uint32_t index = FindIndex(key, Hash()(key));
+            return index == MapDetail::InvalidIndex ? nullptr : &m_Entries[index].Value;
+        }
+
+        template <typename Q>
+        bool Find(const Q& key, V& outValue) const
+        {
+            const V* value = Find(key);
+            if(!value)
+                return false;
+            outValue = *value;
+            return true;
+        }
+
+        template <typename Q>
+        bool Contains(const Q& key) const
+        {
+            return FindIndex(key, Hash()(key)) != MapDetail::InvalidIndex;
+        }
+
+        // Returns true if the key was added, false if an existing value was overwritten
+        template <typename Q, typename T>
+        bool Insert(const Q& key, T&& value)
+        {
+            auto result = FindOrPrepareInsert(key);
+            if(result.second)
+                new(&m_Entries[result.first]) Entry { K(key), V(std::forward<T>(value)) };
+            else
+                m_Entries[result.first].Value = std::forward<T>(value);
+            return result.second;
+        }
+
+        // Returns the value for key, default constructing it if missing. outAdded is set when it was created
+        template <typename Q>
+        V& GetOrAdd(const Q& key, bool* outAdded = nullptr)
+        {
+            auto result = FindOrPrepareInsert(key);
+            if(result.second)
+                new(&m_Entries[result.first]) Entry { K(key), V() };
+            if(outAdded)
+                *outAdded = result.second;
+            return m_Entries[result.first].Value;
+        }
+
+        template <typename Q>
+        V& operator[](const Q& key)
+        {
+            return GetOrAdd(key);
+        }
+
+        template <typename Q>
+        bool Remove(const Q& key)
+        {
+            uint32_t index = FindIndex(key, Hash()(key));
+            if(index == MapDetail::InvalidIndex)
+                return false;
+
+            EraseIndex(index);
+            return true;
+        }
+
+        Iterator Remove(Iterator it)
+        {
+            EraseIndex(it.m_Index);
+            return Iterator(this, it.m_Index + 1);
+        }
+
+        // Destroys all entries but keeps the allocation
+        void Clear()
+        {
+            if(m_Capacity == 0)
+                return;
+
+            DestroyEntries();
+            memset(m_Ctrl, MapDetail::CtrlEmpty, m_Capacity + MapDetail::GroupWidth);
+            m_Size       = 0;
+            m_GrowthLeft = MaxLoad(m_Capacity);
+        }
+
+        void Reserve(uint32_t count)
+        {
+            if(count <= MaxLoad(m_Capacity))
+                return;
+
+            uint32_t capacity = m_Capacity > MapDetail::MinCapacity ? m_Capacity : MapDetail::MinCapacity;
+            while(MaxLoad(capacity) < count)
+                capacity *= 2;
+            Resize(capacity);
+        }
+
+        uint32_t Size() const { return m_Size; }
+        uint32_t Capacity() const { return m_Capacity; }
+        bool Empty() const { return m_Size == 0; }
+
+        Iterator begin() { return Iterator(this, 0); }
+        Iterator end() { return Iterator(this, m_Capacity); }
+        ConstIterator begin() const { return ConstIterator(this, 0); }
+        ConstIterator end() const { return ConstIterator(this, m_Capacity); }
+
+    private:
+        static uint32_t MaxLoad(uint32_t capacity) { return capacity - capacity / 8; }
+        static uint32_t H1(uint64_t hash) { return (uint32_t)(hash >> 7); }
+        static int8_t H2(uint64_t hash) { return (int8_t)(hash & 0x7f); }
+
+        // The first group is mirrored past the end so a group load never needs to wrap
+        void SetCtrl(uint32_t index, int8_t value)
+        {
+            m_Ctrl[index] = value;
+            if(index < MapDetail::GroupWidth)
+                m_Ctrl[m_Capacity + index] = value;
+        }
+
+        template <typename Q>
+        uint32_t FindIndex(const Q& key, uint64_t hash) const
+        {
+            if(m_Size == 0)
+                return MapDetail::InvalidIndex;
+
+            const int8_t h2 = H2(hash);
+            uint32_t mask   = m_Capacity - 1;
+            uint32_t pos    = H1(hash) & mask;
+
+            // Triangular probing over groups visits every group once for power of two capacities
+            for(uint32_t step = MapDetail::GroupWidth; step <= m_Capacity + MapDetail::GroupWidth; step += MapDetail::GroupWidth)
+            {
+                MapDetail::Group group(m_Ctrl + pos);
+                for(uint32_t match = group.Match(h2); match; match &= match - 1)
+                {
+                    uint32_t index = (pos + MapDetail::TrailingZeros(match)) & mask;
+                    if(KeyEqual()(m_Entries[index].Key, key))
+                        return index;
+                }
+
+                if(group.MatchEmpty())
+                    return MapDetail::InvalidIndex;
+
+                pos = (pos + step) & mask;
+            }
+
+            return MapDetail::InvalidIndex;
+        }
+
+        uint32_t FindFirstNonFull(uint64_t hash) const
+        {
+            uint32_t mask = m_Capacity - 1;
+            uint32_t pos  = H1(hash) & mask;
+
+            for(uint32_t step = MapDetail::GroupWidth;; step += MapDetail::GroupWidth)
+            {
+                uint32_t match = MapDetail::Group(m_Ctrl + pos).MatchEmptyOrDeleted();
+                if(match)
+                    return (pos + MapDetail::TrailingZeros(match)) & mask;
+
+                pos = (pos + step) & mask;
+            }
+        }
+
+        // Returns the slot index and whether it still needs its entry constructing
+        template <typename Q>
+        std::pair<uint32_t, bool> FindOrPrepareInsert(const Q& key)
+        {
+            uint64_t hash  = Hash()(key);
+            uint32_t index = FindIndex(key, hash);
+            if(index != MapDetail::InvalidIndex)
+                return { index, false };
+
+            if(m_GrowthLeft == 0)
+            {
+                // Lots of tombstones, rehash in place rather than doubling
+                if(m_Capacity > 0 && m_Size < MaxLoad(m_Capacity) / 2)
+                    Resize(m_Capacity);
+                else
+                    Resize(m_Capacity == 0 ? MapDetail::MinCapacity : m_Capacity * 2);
+            }
+
+            index = FindFirstNonFull(hash);
+            if(m_Ctrl[index] == MapDetail::CtrlEmpty)
+                m_GrowthLeft--;
+
+            SetCtrl(index, H2(hash));
+            m_Size++;
+            return { index, true };
+        }
+
+        void EraseIndex(uint32_t index)
+        {
+            m_Entries[index].~Entry();
+            m_Size--;
+
+            // If no probe sequence could have passed over this slot while it was full, mark it empty
+            // instead of leaving a tombstone. That holds when the empty slots either side of it are
+            // less than a group apart, since any group covering the slot would have stopped at one.
+            uint32_t indexBefore = (index - MapDetail::GroupWidth) & (m_Capacity - 1);
+            uint32_t emptyAfter  = MapDetail::Group(m_Ctrl + index).MatchEmpty();
+            uint32_t emptyBefore = MapDetail::Group(m_Ctrl + indexBefore).MatchEmpty();
+            bool wasNeverFull    = emptyBefore && emptyAfter && MapDetail::TrailingZeros(emptyAfter) + MapDetail::LeadingZeros16(emptyBefore) < MapDetail::GroupWidth;
+
+            SetCtrl(index, wasNeverFull ? MapDetail::CtrlEmpty : MapDetail::CtrlDeleted);
+            if(wasNeverFull)
+                m_GrowthLeft++;
+        }
+
+        void Resize(uint32_t newCapacity)
+        {
+            int8_t* oldCtrl      = m_Ctrl;
+            Entry* oldEntries    = m_Entries;
+            uint32_t oldCapacity = m_Capacity;
+
+            size_t ctrlSize  = ((size_t)newCapacity + MapDetail::GroupWidth + alignof(Entry) - 1) & ~(alignof(Entry) - 1);
+            size_t allocSize = ctrlSize + sizeof(Entry) * newCapacity;
+            size_t alignment = alignof(Entry) > 16 ? alignof(Entry) : 16;
+
+            uint8_t* data;
+            if(m_Arena)
+            {
+                ArenaPushAligner(m_Arena, alignment);
+                data = (uint8_t*)ArenaPushNoZero(m_Arena, allocSize);
+            }
+            else
+                data = (uint8_t*)Memory::AlignedAlloc(allocSize, alignment);
+
+            m_Ctrl       = (int8_t*)data;
+            m_Entries    = (Entry*)(data + ctrlSize);
+            m_Capacity   = newCapacity;
+            m_GrowthLeft = MaxLoad(newCapacity) - m_Size;
+            memset(m_Ctrl, MapDetail::CtrlEmpty, newCapacity + MapDetail::GroupWidth);
+
+            for(uint32_t i = 0; i < oldCapacity; i++)
+            {
+                if(oldCtrl[i] < 0)
+                    continue;
+
+                Entry& oldEntry = oldEntries[i];
+                uint64_t hash   = Hash()(oldEntry.Key);
+                uint32_t index  = FindFirstNonFull(hash);
+                SetCtrl(index, H2(hash));
+                new(&m_Entries[index]) Entry { std::move(oldEntry.Key), std::move(oldEntry.Value) };
+                oldEntry.~Entry();
+            }
+
+            if(oldCtrl && !m_Arena)
+                Memory::AlignedFree(oldCtrl);
+        }
+
+        void DestroyEntries()
+        {
+            if(std::is_trivially_destructible<Entry>::value)
+                return;
+
+            for(uint32_t i = 0; i < m_Capacity; i++)
+            {
+                if(m_Ctrl[i] >= 0)
+                    m_Entries[i].~Entry();
+            }
+        }
+
+        void Destroy()
+        {
+            if(m_Capacity == 0)
+                return;
+
+            DestroyEntries();
+            if(!m_Arena)
+                Memory::AlignedFree(m_Ctrl);
+
+            m_Ctrl       = nullptr;
+            m_Entries    = nullptr;
+            m_Capacity   = 0;
+            m_Size       = 0;
+            m_GrowthLeft = 0;
+        }
+
+        void Swap(FlatHashMap& other)
+        {
+            std::swap(m_Ctrl, other.m_Ctrl);
+            std::swap(m_Entries, other.m_Entries);
+            std::swap(m_Capacity, other.m_Capacity);
+            std::swap(m_Size, other.m_Size);
+            std::swap(m_GrowthLeft, other.m_GrowthLeft);
+            std::swap(m_Arena, other.m_Arena);
+        }
+
+        int8_t* m_Ctrl        = nullptr;
+        Entry* m_Entries      = nullptr;
+        uint32_t m_Capacity   = 0;
+        uint32_t m_Size       = 0;
+        uint32_t m_GrowthLeft = 0;
+        Arena* m_Arena        = nullptr;
+    };
 }
@@ -0,0 +1,113 @@
+#include "Precompiled.h"
+#include "MapBenchmark.h"
+#include "Map.h"
+#include "TDArray.h"
+#include "Utilities/Timer.h"
+#include <unordered_map>
+
+namespace Lumos
+{
+    void BenchmarkHashMaps(uint32_t count)
+    {
+        LINFO("Running HashMap Benchmark, %u keys", count);
+
+        // Scattered keys, with a second set that is never inserted to measure misses
+        TDArray<uint64_t> keys;
+        TDArray<uint64_t> missingKeys;
+        keys.Reserve(count);
+        missingKeys.Reserve(count);
+        for(uint32_t i = 0; i < count; i++)
+        {
+            keys.PushBack(MapHashMix((uint64_t)i * 2 + 1));
+            missingKeys.PushBack(MapHashMix((uint64_t)i * 2 + 2));
+        }
+
+        uint64_t checksum[3] = { 0, 0, 0 };
+        double results[3][4] = {};
+
+        {
+            FlatHashMap<uint64_t, uint64_t> map;
+            Timer timer;
+            for(uint32_t i = 0; i < count; i++)
+                map.Insert(keys[i], (uint64_t)i);
+            results[0][0] = timer.GetElapsedMSD();
+
+            timer = Timer();
+            for(uint32_t i = 0; i < count; i++)
+                checksum[0] += *map.Find(keys[i]);
+            results[0][1] = timer.GetElapsedMSD();
+
+            timer = Timer();
+            for(uint32_t i = 0; i < count; i++)
+                checksum[0] += map.Contains(missingKeys[i]) ? 1 : 0;
+            results[0][2] = timer.GetElapsedMSD();
+
+            timer = Timer();
+            for(uint32_t i = 0; i < count; i++)
+                map.Remove(keys[i]);
+            results[0][3] = timer.GetElapsedMSD();
+            ASSERT(map.Empty());
+        }
+
+        {
+            HashMap(uint64_t, uint64_t) map = {};
+            Timer timer;
+            for(uint32_t i = 0; i < count; i++)
+            {
+                uint64_t value = i;
+                HashMapInsert(&map, keys[i], value);
+            }
+            results[1][0] = timer.GetElapsedMSD();
+
+            timer = Timer();
+            for(uint32_t i = 0; i < count; i++)
+            {
+                uint64_t value = 0;
+                HashMapFind(&map, keys[i], &value);
+                checksum[1] += value;
+            }
+            results[1][1] = timer.GetElapsedMSD();
+
+            timer = Timer();
+            for(uint32_t i = 0; i < count; i++)
+                checksum[1] += HashMapFindPtr(&map, missingKeys[i]) ? 1 : 0;
+            results[1][2] = timer.GetElapsedMSD();
+
+            timer = Timer();
+            for(uint32_t i = 0; i < count; i++)
+                HashMapRemove(&map, keys[i]);
+            results[1][3] = timer.GetElapsedMSD();
+            HashMapDeinit(&map);
+        }
+
+        {
+            std::unordered_map<uint64_t, uint64_t> map;
+            Timer timer;
+            for(uint32_t i = 0; i < count; i++)
+                map[keys[i]] = i;
+            results[2][0] = timer.GetElapsedMSD();
+
+            timer = Timer();
+            for(uint32_t i = 0; i < count; i++)
+                checksum[2] += map.find(keys[i])->second;
+            results[2][1] = timer.GetElapsedMSD();
+
+            timer = Timer();
+            for(uint32_t i = 0; i < count; i++)
+                checksum[2] += map.count(missingKeys[i]);
+            results[2][2] = timer.GetElapsedMSD();
+
+            timer = Timer();
+            for(uint32_t i = 0; i < count; i++)
+                map.erase(keys[i]);
+            results[2][3] = timer.GetElapsedMSD();
+        }
+
+        const char* names[3] = { "FlatHashMap", "HashMap", "std::unordered_map" };
+        for(uint32_t i = 0; i < 3; i++)
+            LINFO("%-20s insert %.3fms, find %.3fms, miss %.3fms, remove %.3fms", names[i], results[i][0], results[i][1], results[i][2], results[i][3]);
+
+        if(checksum[0] != checksum[2] || checksum[1] != checksum[2])
+            LERROR("HashMap Benchmark checksum mismatch");
+    }
+}
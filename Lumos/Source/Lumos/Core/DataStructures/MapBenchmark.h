@@ -0,0 +1,9 @@
+#pragma once
+#include "Core/Core.h"
+
+namespace Lumos
+{
+    // Compares FlatHashMap, the HashMap macros and std::unordered_map, results are logged.
+    // Not run by the engine, call it from a test or tool
+    void BenchmarkHashMaps(uint32_t count = 100000);
+}
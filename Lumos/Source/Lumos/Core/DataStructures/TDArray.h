@@ -1,9 +1,21 @@
 #pragma once
 #include "Core/OS/Memory.h"
+#include <cstring>
 #include <initializer_list>
+#include <new>
+#include <type_traits>
 
 namespace Lumos
 {
+    // Types that can be moved to a new address with memcpy, skipping move construction and destruction.
+    // Specialise for types that are not trivially copyable but own no self references.
+    template <class T>
+    struct IsTriviallyRelocatable
+    {
+        static constexpr bool value = std::is_trivially_copyable<T>::value;
+    };
+
+    // Storage is uninitialised, elements are only constructed in [0, Size()).
     template <class T>
     class TDArray
     {
@@ -115,14 +127,29 @@ namespace Lumos
         // Helper function for deleting allocated memory
         void Destroy() noexcept;
 
+    protected:
+        // Used by TDSmallArray to point the array at its inline buffer
+        void SetInlineStorage(T* data, size_t capacity);
+        bool IsInline() const { return m_Data && m_Data == m_InlineData; }
+
     private:
-        T* m_Data         = nullptr;
-        size_t m_Size     = 0;
-        size_t m_Capacity = 0;
-        Arena* m_Arena    = nullptr;
+        T* m_Data               = nullptr;
+        size_t m_Size           = 0;
+        size_t m_Capacity       = 0;
+        Arena* m_Arena          = nullptr;
+        T* m_InlineData         = nullptr;
+        size_t m_InlineCapacity = 0;
 
         // Helper function for copying elements
         void CopyElements(const TDArray<T>& other);
+
+        T* Allocate(size_t capacity);
+        void Deallocate(T* data);
+        void Grow(size_t minCapacity);
+        void Truncate(size_t size);
+
+        static void Relocate(T* dst, T* src, size_t count);
+        static void DestroyElements(T* data, size_t count);
     };
 
     // Constructor implementations
@@ -134,23 +161,33 @@ namespace Lumos
 
     template <class T>
     TDArray<T>::TDArray(const TDArray<T>& other)
-        : m_Arena(other.m_Arena)
-        , m_Size(0)
+        : m_Size(0)
         , m_Capacity(0)
+        , m_Arena(other.m_Arena)
     {
         CopyElements(other);
     }
 
     template <class T>
     TDArray<T>::TDArray(TDArray<T>&& other) noexcept
-        : m_Data(other.m_Data)
-        , m_Size(other.m_Size)
-        , m_Capacity(other.m_Capacity)
-        , m_Arena(other.m_Arena)
+        : m_Arena(other.m_Arena)
     {
-        other.m_Data     = nullptr;
+        if(other.IsInline())
+        {
+            // Inline storage can't be stolen, relocate the elements instead
+            Reserve(other.m_Size);
+            Relocate(m_Data, other.m_Data, other.m_Size);
+            m_Size       = other.m_Size;
+            other.m_Size = 0;
+            return;
+        }
+
+        m_Data           = other.m_Data;
+        m_Size           = other.m_Size;
+        m_Capacity       = other.m_Capacity;
+        other.m_Data     = other.m_InlineData;
         other.m_Size     = 0;
-        other.m_Capacity = 0;
+        other.m_Capacity = other.m_InlineCapacity;
     }
 
     template <class T>
@@ -161,21 +198,20 @@ namespace Lumos
     {
         Reserve(size);
         for(size_t i = 0; i < size; ++i)
-            m_Data[i] = initial;
+            new(m_Data + i) T(initial);
 
         m_Size = size;
     }
 
     template <class T>
     TDArray<T>::TDArray(std::initializer_list<T> values, Arena* arena)
-        : m_Size(values.size())
+        : m_Size(0)
         , m_Capacity(0)
         , m_Arena(arena)
     {
-        Reserve(m_Size);
-        size_t index = 0;
+        Reserve(values.size());
         for(auto& value : values)
-            m_Data[index++] = value;
+            new(m_Data + m_Size++) T(value);
     }
 
     // Destructor implementation
@@ -189,11 +225,11 @@ namespace Lumos
     template <class T>
     TDArray<T>& TDArray<T>::operator=(const TDArray<T>& other)
     {
+        // Existing storage and arena are kept, only the elements are replaced
         if(this != &other)
         {
-            Destroy();
+            Clear();
             CopyElements(other);
-            m_Arena = other.m_Arena;
         }
         return *this;
     }
@@ -202,15 +238,28 @@ namespace Lumos
     template <class T>
     TDArray<T>& TDArray<T>::operator=(TDArray<T>&& other) noexcept
     {
-        Swap(m_Data, other.m_Data);
-        Swap(m_Arena, other.m_Arena);
-        Swap(m_Size, other.m_Size);
-        Swap(m_Capacity, other.m_Capacity);
+        if(this == &other)
+            return *this;
+
+        if(other.IsInline())
+        {
+            Clear();
+            Reserve(other.m_Size);
+            Relocate(m_Data, other.m_Data, other.m_Size);
+            m_Size       = other.m_Size;
+            other.m_Size = 0;
+            return *this;
+        }
 
-        other.m_Capacity = 0;
-        other.m_Data     = nullptr;
-        other.m_Arena    = nullptr;
+        Destroy();
+        m_Data     = other.m_Data;
+        m_Size     = other.m_Size;
+        m_Capacity = other.m_Capacity;
+        m_Arena    = other.m_Arena;
+
+        other.m_Data     = other.m_InlineData;
         other.m_Size     = 0;
+        other.m_Capacity = other.m_InlineCapacity;
         return *this;
     }
 
@@ -278,19 +327,12 @@ namespace Lumos
         if(capacity <= m_Capacity)
             return;
 
-        T* newData = nullptr;
-        if(m_Arena)
-            newData = PushArrayNoZero(m_Arena, T, capacity);
-        else
-            newData = new T[capacity];
+        T* newData = Allocate(capacity);
 
         if(m_Data)
         {
-            for(size_t i = 0; i < m_Size; ++i)
-                newData[i] = Move(m_Data[i]);
-
-            if(!m_Arena)
-                delete[] m_Data;
+            Relocate(newData, m_Data, m_Size);
+            Deallocate(m_Data);
         }
 
         m_Data     = newData;
@@ -300,9 +342,15 @@ namespace Lumos
     template <class T>
     void TDArray<T>::Resize(size_t size, const T& value)
     {
+        if(size <= m_Size)
+        {
+            Truncate(size);
+            return;
+        }
+
         Reserve(size);
         for(size_t i = m_Size; i < size; ++i)
-            m_Data[i] = value;
+            new(m_Data + i) T(value);
         m_Size = size;
     }
 
@@ -310,13 +358,7 @@ namespace Lumos
     template <class T>
     void TDArray<T>::Clear() noexcept
     {
-        for(size_t i = 0; i < m_Size; ++i)
-        {
-            m_Data[i].~T();
-        }
-
-        if(m_Data)
-            MemorySet(m_Data, 0, m_Size * sizeof(T));
+        DestroyElements(m_Data, m_Size);
         m_Size = 0;
     }
 
@@ -324,16 +366,29 @@ namespace Lumos
     void TDArray<T>::PushBack(const T& value)
     {
         if(m_Size == m_Capacity)
-            Reserve(m_Capacity == 0 ? 1 : m_Capacity * 2);
-        m_Data[m_Size++] = value;
+        {
+            // value may live in this array, copy it before the storage moves
+            T temp(value);
+            Grow(m_Size + 1);
+            new(m_Data + m_Size++) T(Move(temp));
+            return;
+        }
+
+        new(m_Data + m_Size++) T(value);
     }
 
     template <class T>
     void TDArray<T>::PushBack(T&& value)
     {
         if(m_Size == m_Capacity)
-            Reserve(m_Capacity == 0 ? 1 : m_Capacity * 2);
-        m_Data[m_Size++] = value;
+        {
+            T temp(Move(value));
+            Grow(m_Size + 1);
+            new(m_Data + m_Size++) T(Move(temp));
+            return;
+        }
+
+        new(m_Data + m_Size++) T(Move(value));
     }
 
     template <class T>
@@ -341,10 +396,11 @@ namespace Lumos
     T& TDArray<T>::EmplaceBack(Args&&... args)
     {
         if(m_Size == m_Capacity)
-            Reserve(m_Capacity == 0 ? 1 : m_Capacity * 2);
+            Grow(m_Size + 1);
 
-        m_Data[m_Size] = T(Forward<Args>(args)...);
-        return m_Data[m_Size++];
+        T* element = new(m_Data + m_Size) T(Forward<Args>(args)...);
+        m_Size++;
+        return *element;
     }
 
     template <class T>
@@ -361,9 +417,17 @@ namespace Lumos
     template <class T>
     void TDArray<T>::CopyElements(const TDArray<T>& other)
     {
-        Reserve(other.m_Capacity);
-        for(size_t i = 0; i < other.m_Size; ++i)
-            m_Data[i] = other.m_Data[i];
+        Reserve(other.m_Size);
+        if(std::is_trivially_copyable<T>::value)
+        {
+            if(other.m_Size)
+                MemoryCopy((void*)m_Data, (const void*)other.m_Data, other.m_Size * sizeof(T));
+        }
+        else
+        {
+            for(size_t i = 0; i < other.m_Size; ++i)
+                new(m_Data + i) T(other.m_Data[i]);
+        }
         m_Size = other.m_Size;
     }
 
@@ -372,22 +436,88 @@ namespace Lumos
     {
         if(m_Data)
         {
-            if(m_Arena)
-            {
-                for(size_t i = 0; i < m_Size; ++i)
-                {
-                    m_Data[i].~T();
-                }
-            }
-            else
-            {
-                delete[] m_Data;
-            }
+            DestroyElements(m_Data, m_Size);
+            Deallocate(m_Data);
         }
 
-        m_Data     = nullptr;
+        m_Data     = m_InlineData;
         m_Size     = 0;
-        m_Capacity = 0;
+        m_Capacity = m_InlineCapacity;
+    }
+
+    template <class T>
+    void TDArray<T>::SetInlineStorage(T* data, size_t capacity)
+    {
+        ASSERT(m_Data == nullptr, "Inline storage must be set on an empty array");
+        m_Data           = data;
+        m_Capacity       = capacity;
+        m_InlineData     = data;
+        m_InlineCapacity = capacity;
+    }
+
+    template <class T>
+    T* TDArray<T>::Allocate(size_t capacity)
+    {
+        if(m_Arena)
+        {
+            ArenaPushAligner(m_Arena, alignof(T));
+            return PushArrayNoZero(m_Arena, T, capacity);
+        }
+
+        return (T*)Memory::AlignedAlloc(capacity * sizeof(T), alignof(T) > sizeof(void*) ? alignof(T) : sizeof(void*));
+    }
+
+    template <class T>
+    void TDArray<T>::Deallocate(T* data)
+    {
+        // Arena memory is released with the arena
+        if(!m_Arena && data != m_InlineData)
+            Memory::AlignedFree(data);
+    }
+
+    template <class T>
+    void TDArray<T>::Grow(size_t minCapacity)
+    {
+        // Start at a cache line worth of elements rather than one, then double
+        size_t capacity = m_Capacity ? m_Capacity * 2 : (sizeof(T) < 16 ? 64 / sizeof(T) : 4);
+        Reserve(capacity > minCapacity ? capacity : minCapacity);
+    }
+
+    template <class T>
+    void TDArray<T>::Truncate(size_t size)
+    {
+        if(size >= m_Size)
+            return;
+
+        DestroyElements(m_Data + size, m_Size - size);
+        m_Size = size;
+    }
+
+    template <class T>
+    void TDArray<T>::Relocate(T* dst, T* src, size_t count)
+    {
+        if(IsTriviallyRelocatable<T>::value)
+        {
+            if(count)
+                MemoryCopy((void*)dst, (const void*)src, count * sizeof(T));
+            return;
+        }
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            new(dst + i) T(Move(src[i]));
+            src[i].~T();
+        }
+    }
+
+    template <class T>
+    void TDArray<T>::DestroyElements(T* data, size_t count)
+    {
+        if(std::is_trivially_destructible<T>::value)
+            return;
+
+        for(size_t i = 0; i < count; ++i)
+            data[i].~T();
     }
 
     template <class T>
@@ -406,7 +536,7 @@ namespace Lumos
                 ++writeIndex;
             }
         }
-        Resize(writeIndex);
+        Truncate(writeIndex);
     }
 
     template <class T>
@@ -427,6 +557,72 @@ namespace Lumos
             }
         }
 
-        Resize(writeIndex); // Resize the array to the new size
+        Truncate(writeIndex); // Shrink the array to the new size
     }
+
+    // TDArray with room for N elements inline, only touching the heap or arena once it grows past that.
+    // For short lived arrays that are usually small.
+    template <class T, size_t N>
+    class TDSmallArray : public TDArray<T>
+    {
+    public:
+        TDSmallArray(Arena* arena = nullptr)
+            : TDArray<T>(arena)
+        {
+            this->SetInlineStorage((T*)m_InlineBuffer, N);
+        }
+
+        TDSmallArray(std::initializer_list<T> values, Arena* arena = nullptr)
+            : TDSmallArray(arena)
+        {
+            this->Reserve(values.size());
+            for(auto& value : values)
+                this->PushBack(value);
+        }
+
+        TDSmallArray(const TDArray<T>& other)
+            : TDSmallArray()
+        {
+            TDArray<T>::operator=(other);
+        }
+
+        TDSmallArray(const TDSmallArray& other)
+            : TDSmallArray()
+        {
+            TDArray<T>::operator=(other);
+        }
+
+        TDSmallArray(TDSmallArray&& other) noexcept
+            : TDSmallArray()
+        {
+            TDArray<T>::operator=(Move(other));
+        }
+
+        ~TDSmallArray()
+        {
+            // Elements may live in m_InlineBuffer, so they go before it does
+            this->Destroy();
+        }
+
+        TDSmallArray& operator=(const TDArray<T>& other)
+        {
+            TDArray<T>::operator=(other);
+            return *this;
+        }
+
+        TDSmallArray& operator=(const TDSmallArray& other)
+        {
+            TDArray<T>::operator=(other);
+            return *this;
+        }
+
+        TDSmallArray& operator=(TDSmallArray&& other) noexcept
+        {
+            TDArray<T>::operator=(Move(other));
+            return *this;
+        }
+
+    private:
+        alignas(T) uint8_t m_InlineBuffer[N * sizeof(T)];
+    };
 }
@@ -41,6 +41,7 @@ namespace Lumos
         static int64_t GetFileSize(const std::string& path);
 
         static uint8_t* ReadFile(const std::string& path);
+        // Reads size bytes, or the whole file if negative, into buffer. The caller owns buffer and sizes it
         static bool ReadFile(const std::string& path, void* buffer, int64_t size = -1);
         static std::string ReadTextFile(const std::string& path);
 
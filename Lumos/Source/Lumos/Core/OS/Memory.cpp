@@ -1,5 +1,6 @@
 #include "Precompiled.h"
 #include "Memory.h"
+#include "Core/Telemetry.h"
 
 namespace Lumos
 {
@@ -62,6 +63,8 @@ namespace Lumos
 #if defined(LUMOS_PROFILE) && defined(TRACY_ENABLE) && LUMOS_TRACK_MEMORY
         TracyAlloc(memory, size);
 #endif
+        // Added to this thread's ring totals, no shared atomic on the allocation path
+        LUMOS_TELEMETRY_COUNTER_ADD("Allocations", 1);
 
         return memory;
     }
@@ -0,0 +1,344 @@
+#include "Precompiled.h"
+#include "Telemetry.h"
+#include "Maths/MathsUtilities.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace Lumos
+{
+    namespace Telemetry
+    {
+        struct Sample
+        {
+            uint16_t Scope;
+            uint64_t Duration;
+        };
+
+        // Single producer (the owning thread), single consumer (EndFrame)
+        struct ThreadRing
+        {
+            Sample Samples[TELEMETRY_RING_SIZE];
+            std::atomic<uint32_t> Write;
+            std::atomic<uint32_t> Read;
+            std::atomic<uint32_t> Dropped;
+
+            // Running totals written only by the owner, so adding needs no locked instruction.
+            // EndFrame takes the difference from the totals it saw last frame
+            std::atomic<int64_t> CounterTotals[TELEMETRY_MAX_COUNTERS];
+            int64_t CounterSampled[TELEMETRY_MAX_COUNTERS];
+        };
+
+        struct History
+        {
+            char Name[TELEMETRY_MAX_NAME];
+            double Frames[TELEMETRY_HISTORY_FRAMES];
+            double Current;
+            uint32_t CurrentCalls;
+            uint32_t LastCalls;
+        };
+
+        static std::mutex s_RegisterMutex;
+
+        static History s_Scopes[TELEMETRY_MAX_SCOPES];
+        static std::atomic<uint32_t> s_ScopeCount;
+
+        static History s_Counters[TELEMETRY_MAX_COUNTERS];
+        static std::atomic<int64_t> s_CounterValues[TELEMETRY_MAX_COUNTERS];
+        static std::atomic<uint32_t> s_CounterCount;
+
+        static std::atomic<ThreadRing*> s_Rings[TELEMETRY_MAX_THREADS];
+        static std::atomic<uint32_t> s_RingCount;
+        static std::atomic<uint32_t> s_RingEpoch; // Bumped by Release so threads drop their freed ring
+        static thread_local ThreadRing* t_Ring   = nullptr;
+        static thread_local uint32_t t_RingEpoch = 0;
+
+        static uint64_t s_FrameIndex    = 0;
+        static uint32_t s_DroppedWarned = 0;
+
+        static uint16_t Register(History* histories, std::atomic<uint32_t>& count, uint32_t maxCount, const char* name)
+        {
+            std::lock_guard<std::mutex> lock(s_RegisterMutex);
+            uint32_t existing = count.load(std::memory_order_relaxed);
+            for(uint32_t i = 0; i < existing; i++)
+            {
+                if(strncmp(histories[i].Name, name, TELEMETRY_MAX_NAME - 1) == 0)
+                    return (uint16_t)i;
+            }
+
+            if(existing == maxCount)
+            {
+                LWARN("Telemetry limit of %u reached, %s will not be recorded", maxCount, name);
+                return TELEMETRY_INVALID_ID;
+            }
+
+            strncpy(histories[existing].Name, name, TELEMETRY_MAX_NAME - 1);
+            count.store(existing + 1, std::memory_order_release);
+            return (uint16_t)existing;
+        }
+
+        uint16_t RegisterScope(const char* name)
+        {
+            return Register(s_Scopes, s_ScopeCount, TELEMETRY_MAX_SCOPES, name);
+        }
+
+        uint16_t RegisterCounter(const char* name)
+        {
+            return Register(s_Counters, s_CounterCount, TELEMETRY_MAX_COUNTERS, name);
+        }
+
+        static ThreadRing* GetThreadRing()
+        {
+            uint32_t epoch = s_RingEpoch.load(std::memory_order_relaxed);
+            if(t_Ring && t_RingEpoch == epoch)
+                return t_Ring;
+
+            uint32_t index = s_RingCount.load(std::memory_order_relaxed);
+            do
+            {
+                if(index >= TELEMETRY_MAX_THREADS)
+                    return nullptr;
+            } while(!s_RingCount.compare_exchange_weak(index, index + 1));
+
+            // malloc so the allocation counter in operator new isn't re-entered
+            ThreadRing* ring = (ThreadRing*)malloc(sizeof(ThreadRing));
+            new(&ring->Write) std::atomic<uint32_t>(0);
+            new(&ring->Read) std::atomic<uint32_t>(0);
+            new(&ring->Dropped) std::atomic<uint32_t>(0);
+            for(uint32_t i = 0; i < TELEMETRY_MAX_COUNTERS; i++)
+            {
+                new(&ring->CounterTotals[i]) std::atomic<int64_t>(0);
+                ring->CounterSampled[i] = 0;
+            }
+
+            t_Ring      = ring;
+            t_RingEpoch = epoch;
+            s_Rings[index].store(ring, std::memory_order_release);
+            return ring;
+        }
+
+        void RecordScope(uint16_t scope, uint64_t durationNanoseconds)
+        {
+            if(scope >= TELEMETRY_MAX_SCOPES)
+                return;
+
+            ThreadRing* ring = GetThreadRing();
+            if(!ring)
+                return;
+
+            uint32_t write = ring->Write.load(std::memory_order_relaxed);
+            if(write - ring->Read.load(std::memory_order_acquire) >= TELEMETRY_RING_SIZE)
+            {
+                ring->Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            ring->Samples[write % TELEMETRY_RING_SIZE] = { scope, durationNanoseconds };
+            ring->Write.store(write + 1, std::memory_order_release);
+        }
+
+        void AddCounter(uint16_t counter, int64_t value)
+        {
+            if(counter >= TELEMETRY_MAX_COUNTERS)
+                return;
+
+            ThreadRing* ring = GetThreadRing();
+            if(!ring)
+            {
+                s_CounterValues[counter].fetch_add(value, std::memory_order_relaxed);
+                return;
+            }
+
+            std::atomic<int64_t>& total = ring->CounterTotals[counter];
+            total.store(total.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        void SetCounter(uint16_t counter, int64_t value)
+        {
+            if(counter >= TELEMETRY_MAX_COUNTERS)
+                return;
+
+            s_CounterValues[counter].store(value, std::memory_order_relaxed);
+        }
+
+        void EndFrame()
+        {
+            uint32_t frame          = (uint32_t)(s_FrameIndex % TELEMETRY_HISTORY_FRAMES);
+            uint32_t ringCount      = Maths::Min(s_RingCount.load(std::memory_order_acquire), TELEMETRY_MAX_THREADS);
+            uint32_t scopeCount     = s_ScopeCount.load(std::memory_order_acquire);
+            uint32_t counterCount   = s_CounterCount.load(std::memory_order_acquire);
+            uint32_t droppedSamples = 0;
+            int64_t counterAdds[TELEMETRY_MAX_COUNTERS] = {};
+
+            for(uint32_t i = 0; i < ringCount; i++)
+            {
+                ThreadRing* ring = s_Rings[i].load(std::memory_order_acquire);
+                if(!ring) // Claimed but not published yet
+                    continue;
+
+                uint32_t read  = ring->Read.load(std::memory_order_relaxed);
+                uint32_t write = ring->Write.load(std::memory_order_acquire);
+                for(; read != write; read++)
+                {
+                    const Sample& sample = ring->Samples[read % TELEMETRY_RING_SIZE];
+                    History& scope       = s_Scopes[sample.Scope];
+                    scope.Current += sample.Duration * 0.000001;
+                    scope.CurrentCalls++;
+                }
+
+                ring->Read.store(read, std::memory_order_release);
+                droppedSamples += ring->Dropped.exchange(0, std::memory_order_relaxed);
+
+                for(uint32_t c = 0; c < counterCount; c++)
+                {
+                    int64_t total = ring->CounterTotals[c].load(std::memory_order_relaxed);
+                    counterAdds[c] += total - ring->CounterSampled[c];
+                    ring->CounterSampled[c] = total;
+                }
+            }
+
+            if(droppedSamples > 0 && s_DroppedWarned++ < 8)
+                LWARN("Telemetry dropped %u samples, a thread recorded more than %u scopes in a frame", droppedSamples, TELEMETRY_RING_SIZE);
+
+            for(uint32_t i = 0; i < scopeCount; i++)
+            {
+                History& scope      = s_Scopes[i];
+                scope.Frames[frame] = scope.Current;
+                scope.LastCalls     = scope.CurrentCalls;
+                scope.Current       = 0.0;
+                scope.CurrentCalls  = 0;
+            }
+
+            for(uint32_t i = 0; i < counterCount; i++)
+                s_Counters[i].Frames[frame] = (double)(s_CounterValues[i].exchange(0, std::memory_order_relaxed) + counterAdds[i]);
+
+            s_FrameIndex++;
+        }
+
+        void Release()
+        {
+            uint32_t ringCount = Maths::Min(s_RingCount.load(std::memory_order_acquire), TELEMETRY_MAX_THREADS);
+            for(uint32_t i = 0; i < ringCount; i++)
+                free(s_Rings[i].exchange(nullptr));
+
+            s_RingCount.store(0);
+            s_RingEpoch.fetch_add(1);
+            t_Ring = nullptr;
+        }
+
+        uint64_t GetFrameIndex()
+        {
+            return s_FrameIndex;
+        }
+
+        static void CalculateStats(const History& history, bool isCounter, TelemetryStats& outStats)
+        {
+            uint32_t frameCount = (uint32_t)Maths::Min(s_FrameIndex, (uint64_t)TELEMETRY_HISTORY_FRAMES);
+
+            outStats           = {};
+            outStats.Name      = history.Name;
+            outStats.IsCounter = isCounter;
+            outStats.Calls     = isCounter ? 0 : history.LastCalls;
+            if(frameCount == 0)
+                return;
+
+            double sorted[TELEMETRY_HISTORY_FRAMES];
+            double total = 0.0;
+            for(uint32_t i = 0; i < frameCount; i++)
+            {
+                sorted[i] = history.Frames[i];
+                total += sorted[i];
+            }
+            std::sort(sorted, sorted + frameCount);
+
+            outStats.Last    = history.Frames[(s_FrameIndex - 1) % TELEMETRY_HISTORY_FRAMES];
+            outStats.Average = total / frameCount;
+            outStats.P95     = sorted[Maths::Min(frameCount - 1, (uint32_t)(frameCount * 0.95f))];
+            outStats.Max     = sorted[frameCount - 1];
+        }
+
+        bool GetStats(const char* name, TelemetryStats& outStats)
+        {
+            uint32_t scopeCount = s_ScopeCount.load(std::memory_order_acquire);
+            for(uint32_t i = 0; i < scopeCount; i++)
+            {
+                if(strcmp(s_Scopes[i].Name, name) == 0)
+                {
+                    CalculateStats(s_Scopes[i], false, outStats);
+                    return true;
+                }
+            }
+
+            uint32_t counterCount = s_CounterCount.load(std::memory_order_acquire);
+            for(uint32_t i = 0; i < counterCount; i++)
+            {
+                if(strcmp(s_Counters[i].Name, name) == 0)
+                {
+                    CalculateStats(s_Counters[i], true, outStats);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void GetAllStats(TDArray<TelemetryStats>& outStats)
+        {
+            uint32_t scopeCount   = s_ScopeCount.load(std::memory_order_acquire);
+            uint32_t counterCount = s_CounterCount.load(std::memory_order_acquire);
+            outStats.Resize(scopeCount + counterCount);
+
+            for(uint32_t i = 0; i < scopeCount; i++)
+                CalculateStats(s_Scopes[i], false, outStats[i]);
+            for(uint32_t i = 0; i < counterCount; i++)
+                CalculateStats(s_Counters[i], true, outStats[scopeCount + i]);
+        }
+
+        static void DumpHistories(FILE* file, const char* label, const History* histories, uint32_t count, bool isCounter)
+        {
+            uint32_t frameCount = (uint32_t)Maths::Min(s_FrameIndex, (uint64_t)TELEMETRY_HISTORY_FRAMES);
+
+            fprintf(file, "    \"%s\": [\n", label);
+            for(uint32_t i = 0; i < count; i++)
+            {
+                TelemetryStats stats;
+                CalculateStats(histories[i], isCounter, stats);
+
+                fprintf(file, "        { \"name\": \"%s\", \"average\": %.4f, \"p95\": %.4f, \"max\": %.4f, \"last\": %.4f, \"frames\": [",
+                        stats.Name, stats.Average, stats.P95, stats.Max, stats.Last);
+
+                // Oldest frame first
+                for(uint32_t f = 0; f < frameCount; f++)
+                {
+                    uint32_t index = (uint32_t)((s_FrameIndex - frameCount + f) % TELEMETRY_HISTORY_FRAMES);
+                    fprintf(file, f == 0 ? "%.4f" : ", %.4f", histories[i].Frames[index]);
+                }
+
+                fprintf(file, "] }%s\n", i + 1 < count ? "," : "");
+            }
+            fprintf(file, "    ]");
+        }
+
+        bool Dump(const std::string& filePath)
+        {
+            FILE* file = fopen(filePath.c_str(), "w");
+            if(!file)
+            {
+                LERROR("Failed to write telemetry to %s", filePath.c_str());
+                return false;
+            }
+
+            fprintf(file, "{\n");
+            fprintf(file, "    \"frame\": %llu,\n", (unsigned long long)s_FrameIndex);
+            DumpHistories(file, "scopes", s_Scopes, s_ScopeCount.load(std::memory_order_acquire), false);
+            fprintf(file, ",\n");
+            DumpHistories(file, "counters", s_Counters, s_CounterCount.load(std::memory_order_acquire), true);
+            fprintf(file, "\n}\n");
+            fclose(file);
+
+            LINFO("Telemetry written to %s", filePath.c_str());
+            return true;
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "Core/Core.h"
+#include "Core/DataStructures/TDArray.h"
+
+#include <chrono>
+
+// Built into every configuration, including production. Define as 0 to compile the macros out
+#ifndef LUMOS_TELEMETRY
+#define LUMOS_TELEMETRY 1
+#endif
+
+namespace Lumos
+{
+    static const uint32_t TELEMETRY_MAX_SCOPES     = 256;
+    static const uint32_t TELEMETRY_MAX_COUNTERS   = 64;
+    static const uint32_t TELEMETRY_MAX_THREADS    = 64;
+    static const uint32_t TELEMETRY_MAX_NAME       = 64;
+    static const uint32_t TELEMETRY_RING_SIZE      = 4096; // Samples a thread can record between EndFrame calls
+    static const uint32_t TELEMETRY_HISTORY_FRAMES = 128;
+    static const uint16_t TELEMETRY_INVALID_ID     = UINT16_MAX; // Returned once a limit is reached, recording it is a no-op
+
+    struct TelemetryStats
+    {
+        const char* Name = nullptr;
+        bool IsCounter   = false;
+        uint32_t Calls   = 0;   // Scopes only, calls in the last frame
+        double Last      = 0.0; // Milliseconds for scopes, value for counters
+        double Average   = 0.0;
+        double P95       = 0.0;
+        double Max       = 0.0;
+    };
+
+    // Lightweight frame timings and counters that don't depend on Tracy.
+    // Scoped timers write into a ring buffer owned by the recording thread and counter adds into that thread's totals.
+    // EndFrame drains every ring on the main thread and keeps the per frame total of each scope and counter for
+    // the last TELEMETRY_HISTORY_FRAMES frames.
+    // Register and record from any thread, query from the main thread.
+    namespace Telemetry
+    {
+        // Names are copied. Registering an existing name returns its id
+        uint16_t RegisterScope(const char* name);
+        uint16_t RegisterCounter(const char* name);
+
+        void RecordScope(uint16_t scope, uint64_t durationNanoseconds);
+        void AddCounter(uint16_t counter, int64_t value);
+        void SetCounter(uint16_t counter, int64_t value);
+
+        void EndFrame();
+
+        // Frees the thread rings. Only call once every other recording thread has stopped,
+        // threads that record again afterwards are given a new ring
+        void Release();
+
+        uint64_t GetFrameIndex();
+        bool GetStats(const char* name, TelemetryStats& outStats);
+        void GetAllStats(TDArray<TelemetryStats>& outStats);
+
+        // Writes every scope and counter, with its history, as json
+        bool Dump(const std::string& filePath);
+
+        inline uint64_t Now()
+        {
+            return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    }
+
+    class TelemetryScope
+    {
+    public:
+        TelemetryScope(uint16_t scope)
+            : m_Scope(scope)
+            , m_Start(Telemetry::Now())
+        {
+        }
+
+        ~TelemetryScope()
+        {
+            Telemetry::RecordScope(m_Scope, Telemetry::Now() - m_Start);
+        }
+
+    private:
+        uint16_t m_Scope;
+        uint64_t m_Start;
+    };
+}
+
+#if LUMOS_TELEMETRY
+#define LUMOS_TELEMETRY_CONCAT_IMPL(a, b) a##b
+#define LUMOS_TELEMETRY_CONCAT(a, b) LUMOS_TELEMETRY_CONCAT_IMPL(a, b)
+#define LUMOS_TELEMETRY_SCOPE(name)                                                                                   \
+    static const uint16_t LUMOS_TELEMETRY_CONCAT(telemetryScopeID, __LINE__) = Lumos::Telemetry::RegisterScope(name); \
+    Lumos::TelemetryScope LUMOS_TELEMETRY_CONCAT(telemetryScope, __LINE__)(LUMOS_TELEMETRY_CONCAT(telemetryScopeID, __LINE__))
+#define LUMOS_TELEMETRY_COUNTER_ADD(name, value)                                                \
+    {                                                                                           \
+        static const uint16_t telemetryCounterID = Lumos::Telemetry::RegisterCounter(name);     \
+        Lumos::Telemetry::AddCounter(telemetryCounterID, (int64_t)(value));                     \
+    }
+#define LUMOS_TELEMETRY_COUNTER_SET(name, value)                                                \
+    {                                                                                           \
+        static const uint16_t telemetryCounterID = Lumos::Telemetry::RegisterCounter(name);     \
+        Lumos::Telemetry::SetCounter(telemetryCounterID, (int64_t)(value));                     \
+    }
+#define LUMOS_TELEMETRY_FRAME() Lumos::Telemetry::EndFrame()
+#else
+#define LUMOS_TELEMETRY_SCOPE(name)
+#define LUMOS_TELEMETRY_COUNTER_ADD(name, value)
+#define LUMOS_TELEMETRY_COUNTER_SET(name, value)
+#define LUMOS_TELEMETRY_FRAME()
+#endif
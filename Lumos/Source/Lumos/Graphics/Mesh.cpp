@@ -7,14 +7,24 @@
 #include "Core/OS/FileSystem.h"
 #include "Maths/MathsUtilities.h"
 #include "Maths/Vector3.h"
+#include "Maths/TriangleBVH.h"
 
 #include <cereal/archives/json.hpp>
+#include <mutex>
 #include <ModelLoaders/meshoptimizer/src/meshoptimizer.h>
 
 namespace Lumos
 {
     namespace Graphics
     {
+        struct Mesh::TriangleData
+        {
+            std::once_flag Built;
+            TDArray<Vec3> Positions;
+            TDArray<uint32_t> Indices;
+            SharedPtr<Maths::TriangleBVH> TriangleBVH;
+        };
+
         Mesh::Mesh()
             : m_VertexBuffer(nullptr)
             , m_IndexBuffer(nullptr)
@@ -26,6 +36,7 @@ namespace Lumos
             : m_VertexBuffer(mesh.m_VertexBuffer)
             , m_IndexBuffer(mesh.m_IndexBuffer)
             , m_BoundingBox(mesh.m_BoundingBox)
+            , m_Triangles(mesh.m_Triangles)
             , m_Name(mesh.m_Name)
             , m_Material(mesh.m_Material)
         {
@@ -43,6 +54,15 @@ namespace Lumos
             m_IndexBuffer  = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create((uint32_t*)indices.Data(), (uint32_t)indices.Size()));
             m_VertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create((uint32_t)(sizeof(Graphics::Vertex) * vertices.Size()), vertices.Data(), BufferUsage::STATIC));
 
+            if(!vertices.Empty())
+            {
+                m_Triangles = CreateSharedPtr<TriangleData>();
+                m_Triangles->Positions.Reserve(vertices.Size());
+                for(auto& vertex : vertices)
+                    m_Triangles->Positions.PushBack(vertex.Position);
+                m_Triangles->Indices = indices;
+            }
+
 #ifndef LUMOS_PRODUCTION
             m_Stats.VertexCount   = (uint32_t)vertices.Size();
             m_Stats.TriangleCount = m_Stats.VertexCount / 3;
@@ -73,6 +93,26 @@ namespace Lumos
         {
         }
 
+        const SharedPtr<Maths::TriangleBVH>& Mesh::GetTriangleBVH() const
+        {
+            static const SharedPtr<Maths::TriangleBVH> s_NoTriangleBVH;
+            if(!m_Triangles)
+                return s_NoTriangleBVH;
+
+            TriangleData& triangles = *m_Triangles;
+            std::call_once(triangles.Built, [&triangles]()
+                           {
+                               LUMOS_PROFILE_SCOPE("Build Triangle BVH");
+                               triangles.TriangleBVH = CreateSharedPtr<Maths::TriangleBVH>();
+                               triangles.TriangleBVH->Build(triangles.Positions.Data(), sizeof(Vec3), (uint32_t)triangles.Positions.Size(), triangles.Indices.Data(), (uint32_t)triangles.Indices.Size());
+
+                               // The BVH keeps its own copy
+                               triangles.Positions = TDArray<Vec3>();
+                               triangles.Indices   = TDArray<uint32_t>(); });
+
+            return triangles.TriangleBVH;
+        }
+
         void Mesh::GenerateNormals(Vertex* vertices, uint32_t vertexCount, uint32_t* indices, uint32_t indexCount)
         {
             Vec3* normals = new Vec3[vertexCount];
@@ -10,6 +10,7 @@ namespace Lumos
     namespace Maths
     {
         class BoundingBox;
+        class TriangleBVH;
     }
     namespace Graphics
     {
@@ -151,6 +152,10 @@ namespace Lumos
             const SharedPtr<Material>& GetMaterial() const { return m_Material; }
             const Maths::BoundingBox& GetBoundingBox() const { return m_BoundingBox; }
 
+            // Local space triangle BVH for exact ray hits and mesh colliders, null for skinned meshes.
+            // Built from the positions kept at load the first time it is asked for, safe to call from any thread
+            const SharedPtr<Maths::TriangleBVH>& GetTriangleBVH() const;
+
             void SetMaterial(const SharedPtr<Material>& material);
             void SetAndLoadMaterial(const std::string& filePath);
 
@@ -184,6 +189,10 @@ namespace Lumos
             SharedPtr<Material> m_Material;
             Maths::BoundingBox m_BoundingBox;
 
+            // Positions and indices of a static mesh until its triangle BVH is built, shared between copies
+            struct TriangleData;
+            SharedPtr<TriangleData> m_Triangles;
+
             std::string m_Name;
 
 #ifndef LUMOS_PRODUCTION
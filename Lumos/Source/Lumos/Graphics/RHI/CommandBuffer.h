@@ -29,6 +29,12 @@ namespace Lumos
             virtual void UnBindPipeline()                                 = 0;
             virtual void EndCurrentRenderPass()                           = 0;
 
+            // Parallel recording. BeginSecondaryRenderPass starts the pipeline's render pass on a primary buffer with its
+            // contents supplied by secondary buffers, which continue it after BeginRecordingInRenderPass.
+            // Returns false when the backend can't, the draws should then be recorded inline
+            virtual bool BeginSecondaryRenderPass(Pipeline* pipeline, uint32_t layer = 0) { return false; }
+            virtual void BeginRecordingInRenderPass(CommandBuffer* primaryCmdBuffer) { }
+
         protected:
             static CommandBuffer* (*CreateFunc)();
         };
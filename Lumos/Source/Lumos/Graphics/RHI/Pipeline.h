@@ -56,6 +56,7 @@ namespace Lumos
 
             virtual void ClearRenderTargets(CommandBuffer* commandBuffer) { }
             virtual Shader* GetShader() const = 0;
+            virtual RenderPass* GetRenderPass() const { return nullptr; }
 
             uint32_t GetWidth();
             uint32_t GetHeight();
@@ -133,7 +133,8 @@ namespace Lumos
             UNIFORM_BUFFER,
             UNIFORM_BUFFER_DYNAMIC,
             IMAGE_SAMPLER,
-            IMAGE_STORAGE
+            IMAGE_STORAGE,
+            STORAGE_BUFFER
         };
 
         enum class ShaderDataType : uint8_t
@@ -188,7 +188,7 @@ namespace Lumos
             return Application::Get().GetWindow()->GetSwapChain();
         }
 
-        void Renderer::DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh)
+        void Renderer::DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, uint32_t instanceCount)
         {
             if(mesh->GetAnimVertexBuffer())
                 mesh->GetAnimVertexBuffer()->Bind(commandBuffer, pipeline);
@@ -196,7 +196,7 @@ namespace Lumos
                 mesh->GetVertexBuffer()->Bind(commandBuffer, pipeline);
             mesh->GetIndexBuffer()->Bind(commandBuffer);
 
-            Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, mesh->GetIndexBuffer()->GetCount());
+            Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, mesh->GetIndexBuffer()->GetCount(), 0, instanceCount);
             // mesh->GetVertexBuffer()->Unbind();
             // mesh->GetIndexBuffer()->Unbind();
         }
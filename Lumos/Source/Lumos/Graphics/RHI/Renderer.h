@@ -48,8 +48,8 @@ namespace Lumos
             virtual void BindDescriptorSetsInternal(Graphics::Pipeline* pipeline, Graphics::CommandBuffer* commandBuffer, uint32_t dynamicOffset, Graphics::DescriptorSet** descriptorSets, uint32_t descriptorCount) = 0;
 
             virtual const char* GetTitleInternal() const                                                                                    = 0;
-            virtual void DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start) const             = 0;
-            virtual void DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const = 0;
+            virtual void DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start, uint32_t instanceCount) const = 0;
+            virtual void DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const             = 0;
             virtual void Dispatch(CommandBuffer* commandBuffer, uint32_t workGroupSizeX, uint32_t workGroupSizeY, uint32_t workGroupSizeZ) { }
             virtual void DrawSplashScreen(Texture* texture) { }
             virtual uint32_t GetGPUCount() const { return 1; }
@@ -73,9 +73,9 @@ namespace Lumos
             {
                 s_Instance->DrawInternal(commandBuffer, type, count, datayType, indices);
             }
-            inline static void DrawIndexed(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start = 0)
+            inline static void DrawIndexed(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start = 0, uint32_t instanceCount = 1)
             {
-                s_Instance->DrawIndexedInternal(commandBuffer, type, count, start);
+                s_Instance->DrawIndexedInternal(commandBuffer, type, count, start, instanceCount);
             }
             inline static const char* GetTitle()
             {
@@ -90,7 +90,7 @@ namespace Lumos
 
             static GraphicsContext* GetGraphicsContext();
             static SwapChain* GetMainSwapChain();
-            static void DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh);
+            static void DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, uint32_t instanceCount = 1);
 
         protected:
             static Renderer* (*CreateFunc)();
@@ -32,6 +32,9 @@ namespace Lumos
             virtual TDArray<PushConstant>& GetPushConstants() = 0;
             virtual PushConstant* GetPushConstant(uint32_t index) { return nullptr; }
             virtual void BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline) = 0;
+
+            // Pushes data for one push constant without writing the shader's copy, safe to call while recording in parallel
+            virtual void BindPushConstantData(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const void* data) = 0;
             virtual DescriptorSetInfo GetDescriptorInfo(uint32_t index) { return DescriptorSetInfo(); }
             virtual uint64_t GetHash() const { return 0; };
 
@@ -2,6 +2,7 @@
 
 #define MAX_FRAMES_FLIGHT 3
 #define MAX_ELEMENTS_PER_SET 32
+#define MAX_RECORDING_SLOTS 16
 namespace Lumos
 {
     class Window;
@@ -28,6 +29,10 @@ namespace Lumos
             virtual CommandBuffer* GetCurrentCommandBuffer() = 0;
             virtual void SetVSync(bool vsync)                = 0;
 
+            // Secondary command buffers for parallel recording, slot < MAX_RECORDING_SLOTS. Every slot has its own pool
+            // per frame in flight, so different slots can record at the same time. Buffers are recycled with the frame
+            virtual CommandBuffer* GetSecondaryCommandBuffer(uint32_t slot) { return nullptr; }
+
         protected:
             static SwapChain* (*CreateFunc)(uint32_t, uint32_t);
         };
@@ -28,6 +28,7 @@ namespace Lumos
         class Material;
 
         typedef TDArray<RenderCommand> CommandQueue;
+        typedef TDArray<InstancedDraw> InstancedDrawQueue;
 
         class LUMOS_EXPORT IRenderer
         {
@@ -0,0 +1,381 @@
+#include "Precompiled.h"
+#include "LightClusterGrid.h"
+#include "Graphics/Light.h"
+#include "Core/JobSystem.h"
+#include "Maths/MathsUtilities.h"
+
+#ifdef LUMOS_SSE
+#include <smmintrin.h>
+#endif
+
+namespace Lumos::Graphics
+{
+    static const uint32_t LightsPerJob    = 32;
+    static const uint32_t MaxLightBinJobs = (MAX_LIGHTS + LightsPerJob - 1) / LightsPerJob;
+
+    static_assert(LIGHT_CLUSTER_X % 4 == 0, "Cluster rows are tested four at a time");
+    static_assert(LIGHT_CLUSTER_COUNT <= 0xFFFF && MAX_LIGHTS <= 0xFFFF, "Binned cluster and light indices are packed into 16 bits");
+    static_assert(sizeof(Light) == 64, "Light must match the std430 layout in Buffers.glslh");
+
+    static bool SphereIntersectsBounds(const Vec3& centre, float radius, const Vec3& min, const Vec3& max)
+    {
+        float dx = Maths::Max(0.0f, Maths::Max(min.x - centre.x, centre.x - max.x));
+        float dy = Maths::Max(0.0f, Maths::Max(min.y - centre.y, centre.y - max.y));
+        float dz = Maths::Max(0.0f, Maths::Max(min.z - centre.z, centre.z - max.z));
+        return dx * dx + dy * dy + dz * dz <= radius * radius;
+    }
+
+    static Vec3 MinPerAxis(const Vec3& a, const Vec3& b)
+    {
+        return Vec3(Maths::Min(a.x, b.x), Maths::Min(a.y, b.y), Maths::Min(a.z, b.z));
+    }
+
+    static Vec3 MaxPerAxis(const Vec3& a, const Vec3& b)
+    {
+        return Vec3(Maths::Max(a.x, b.x), Maths::Max(a.y, b.y), Maths::Max(a.z, b.z));
+    }
+
+    LightClusterGrid::LightClusterGrid()
+    {
+        m_MinX.Resize(LIGHT_CLUSTER_COUNT);
+        m_MinY.Resize(LIGHT_CLUSTER_COUNT);
+        m_MinZ.Resize(LIGHT_CLUSTER_COUNT);
+        m_MaxX.Resize(LIGHT_CLUSTER_COUNT);
+        m_MaxY.Resize(LIGHT_CLUSTER_COUNT);
+        m_MaxZ.Resize(LIGHT_CLUSTER_COUNT);
+        m_SliceBounds.Resize(LIGHT_CLUSTER_Z);
+        m_RowBounds.Resize(LIGHT_CLUSTER_Z * LIGHT_CLUSTER_Y);
+
+        m_LightBounds.Reserve(MAX_LIGHTS);
+        m_JobClusterLights.Resize(MaxLightBinJobs);
+        m_ClusterData.Resize(LIGHT_CLUSTER_COUNT * 2, 0);
+        m_ClusterCursor.Resize(LIGHT_CLUSTER_COUNT, 0);
+        m_LightIndices.Resize(MAX_CLUSTER_LIGHT_INDICES, 0);
+    }
+
+    void LightClusterGrid::SetProjection(const Mat4& projection, float nearPlane, float farPlane)
+    {
+        if(m_BoundsValid && m_Projection == projection && m_Near == nearPlane && m_Far == farPlane)
+            return;
+
+        m_Projection  = projection;
+        m_Near        = Maths::Max(nearPlane, 0.001f);
+        m_Far         = Maths::Max(farPlane, m_Near + 0.001f);
+        m_BoundsValid = true;
+
+        BuildClusterBounds();
+    }
+
+    void LightClusterGrid::BuildClusterBounds()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const Mat4 invProjection = m_Projection.Inverse();
+
+        auto Unproject = [&invProjection](float x, float y, float z)
+        {
+            Vec4 p = invProjection * Vec4(x, y, z, 1.0f);
+            return Vec3(p) / p.w;
+        };
+
+        // Works out which way the camera looks down view z, for both handedness conventions
+        Vec3 centreNear       = Unproject(0.0f, 0.0f, 0.25f);
+        const float depthSign = centreNear.z > 0.0f ? 1.0f : -1.0f;
+
+        const float logDepthRange = log(m_Far / m_Near);
+        m_ClusterParams.x         = depthSign;
+        m_ClusterParams.y         = float(LIGHT_CLUSTER_Z) / logDepthRange;
+        m_ClusterParams.z         = float(LIGHT_CLUSTER_Z) * log(m_Near) / logDepthRange;
+        m_ClusterParams.w         = 0.0f;
+
+        // One view space line per tile corner, cluster corners are points along it at each slice depth.
+        // Lines rather than rays so orthographic projections are handled the same way.
+        const uint32_t cornerCountX = LIGHT_CLUSTER_X + 1;
+        const uint32_t cornerCountY = LIGHT_CLUSTER_Y + 1;
+        Vec3 lineStart[cornerCountX * cornerCountY];
+        Vec3 lineDelta[cornerCountX * cornerCountY];
+
+        for(uint32_t y = 0; y < cornerCountY; y++)
+        {
+            for(uint32_t x = 0; x < cornerCountX; x++)
+            {
+                float ndcX = -1.0f + 2.0f * float(x) / float(LIGHT_CLUSTER_X);
+                float ndcY = -1.0f + 2.0f * float(y) / float(LIGHT_CLUSTER_Y);
+                Vec3 a     = Unproject(ndcX, ndcY, 0.25f);
+                Vec3 b     = Unproject(ndcX, ndcY, 0.75f);
+
+                uint32_t index   = x + y * cornerCountX;
+                lineStart[index] = a;
+                lineDelta[index] = b - a;
+            }
+        }
+
+        auto PointAtDepth = [&](uint32_t corner, float depth)
+        {
+            float startDepth = depthSign * lineStart[corner].z;
+            float deltaDepth = depthSign * lineDelta[corner].z;
+            float t          = Maths::Abs(deltaDepth) > Maths::M_EPSILON ? (depth - startDepth) / deltaDepth : 0.0f;
+            return lineStart[corner] + lineDelta[corner] * t;
+        };
+
+        for(uint32_t z = 0; z < LIGHT_CLUSTER_Z; z++)
+        {
+            float sliceNear = m_Near * pow(m_Far / m_Near, float(z) / float(LIGHT_CLUSTER_Z));
+            float sliceFar  = m_Near * pow(m_Far / m_Near, float(z + 1) / float(LIGHT_CLUSTER_Z));
+
+            ClusterBounds& sliceBounds = m_SliceBounds[z];
+            sliceBounds.Min            = Vec3(Maths::M_INFINITY);
+            sliceBounds.Max            = Vec3(-Maths::M_INFINITY);
+
+            for(uint32_t y = 0; y < LIGHT_CLUSTER_Y; y++)
+            {
+                ClusterBounds& rowBounds = m_RowBounds[y + z * LIGHT_CLUSTER_Y];
+                rowBounds.Min            = Vec3(Maths::M_INFINITY);
+                rowBounds.Max            = Vec3(-Maths::M_INFINITY);
+
+                for(uint32_t x = 0; x < LIGHT_CLUSTER_X; x++)
+                {
+                    const uint32_t corners[4] = { x + y * cornerCountX, x + 1 + y * cornerCountX, x + (y + 1) * cornerCountX, x + 1 + (y + 1) * cornerCountX };
+
+                    Vec3 min = Vec3(Maths::M_INFINITY);
+                    Vec3 max = Vec3(-Maths::M_INFINITY);
+                    for(uint32_t corner : corners)
+                    {
+                        Vec3 p0 = PointAtDepth(corner, sliceNear);
+                        Vec3 p1 = PointAtDepth(corner, sliceFar);
+                        min     = MinPerAxis(min, MinPerAxis(p0, p1));
+                        max     = MaxPerAxis(max, MaxPerAxis(p0, p1));
+                    }
+
+                    uint32_t cluster = x + LIGHT_CLUSTER_X * (y + LIGHT_CLUSTER_Y * z);
+                    m_MinX[cluster]  = min.x;
+                    m_MinY[cluster]  = min.y;
+                    m_MinZ[cluster]  = min.z;
+                    m_MaxX[cluster]  = max.x;
+                    m_MaxY[cluster]  = max.y;
+                    m_MaxZ[cluster]  = max.z;
+
+                    rowBounds.Min = MinPerAxis(rowBounds.Min, min);
+                    rowBounds.Max = MaxPerAxis(rowBounds.Max, max);
+                }
+
+                sliceBounds.Min = MinPerAxis(sliceBounds.Min, rowBounds.Min);
+                sliceBounds.Max = MaxPerAxis(sliceBounds.Max, rowBounds.Max);
+            }
+        }
+    }
+
+    uint32_t LightClusterGrid::DepthToSlice(float depth) const
+    {
+        float slice = log(Maths::Max(depth, m_Near)) * m_ClusterParams.y - m_ClusterParams.z;
+        return uint32_t(Maths::Clamp(slice, 0.0f, float(LIGHT_CLUSTER_Z - 1)));
+    }
+
+    void LightClusterGrid::Build(const Mat4& view, const Light* lights, uint32_t lightCount, uint32_t firstLightIndex)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_LightIndexCount = 0;
+        MemorySet(m_ClusterData.Data(), 0, sizeof(uint32_t) * LIGHT_CLUSTER_COUNT * 2);
+
+        if(firstLightIndex >= MAX_LIGHTS)
+            return;
+
+        lightCount = Maths::Min(lightCount, MAX_LIGHTS - firstLightIndex);
+        m_LightBounds.Clear();
+
+        for(uint32_t i = 0; i < lightCount; i++)
+        {
+            const Light& light = lights[i];
+
+            LightBounds bounds;
+            bounds.Index  = firstLightIndex + i;
+            bounds.Spot   = light.Type == float(LightType::SpotLight);
+            bounds.Apex   = Vec3(view * Vec4(Vec3(light.Position), 1.0f));
+            bounds.Centre = bounds.Apex;
+            bounds.Radius = light.Radius;
+
+            if(bounds.Spot)
+            {
+                // Shading lights fragments where dot(toLight, Direction) > 1 - Angle, so the cone opens along -Direction
+                Vec3 axis       = -Vec3(view * Vec4(Vec3(light.Direction), 0.0f));
+                bounds.Axis     = axis.Normalised();
+                bounds.Range    = light.Radius;
+                bounds.CosAngle = Maths::Clamp(1.0f - light.Angle, -1.0f, 1.0f);
+                bounds.SinAngle = Maths::Sqrt(1.0f - bounds.CosAngle * bounds.CosAngle);
+
+                // Wide cones are treated as spheres
+                if(bounds.CosAngle <= 0.0f)
+                    bounds.Spot = false;
+                else if(bounds.CosAngle < 0.7071f)
+                {
+                    // Past 45 degrees the cap is the widest part
+                    bounds.Centre = bounds.Apex + bounds.Axis * bounds.Range;
+                    bounds.Radius = bounds.Range * bounds.SinAngle / bounds.CosAngle;
+                }
+                else
+                {
+                    // Bounding sphere of the cone passes through the apex and the cap rim
+                    float radius  = bounds.Range * 0.5f / (bounds.CosAngle * bounds.CosAngle);
+                    bounds.Centre = bounds.Apex + bounds.Axis * radius;
+                    bounds.Radius = radius;
+                }
+
+                if(!bounds.Spot)
+                    bounds.Radius = bounds.Range;
+            }
+
+            m_LightBounds.PushBack(bounds);
+        }
+
+        if(lightCount == 0)
+            return;
+
+        const uint32_t jobCount = (lightCount + LightsPerJob - 1) / LightsPerJob;
+        if(jobCount == 1)
+            BinLights(0);
+        else
+        {
+            System::JobSystem::Context ctx;
+            System::JobSystem::Dispatch(ctx, jobCount, 1, [this](JobDispatchArgs args)
+                                        { BinLights(args.jobIndex); });
+            System::JobSystem::Wait(ctx);
+        }
+
+        // Count, prefix sum then scatter so each cluster's lights end up contiguous
+        uint32_t* counts = m_ClusterCursor.Data();
+        MemorySet(counts, 0, sizeof(uint32_t) * LIGHT_CLUSTER_COUNT);
+
+        for(uint32_t job = 0; job < jobCount; job++)
+        {
+            for(uint32_t pair : m_JobClusterLights[job])
+                counts[pair >> 16]++;
+        }
+
+        uint32_t offset  = 0;
+        bool overflowed = false;
+        for(uint32_t cluster = 0; cluster < LIGHT_CLUSTER_COUNT; cluster++)
+        {
+            uint32_t count = Maths::Min(counts[cluster], MAX_CLUSTER_LIGHT_INDICES - offset);
+            overflowed |= count != counts[cluster];
+
+            m_ClusterData[cluster * 2]     = offset;
+            m_ClusterData[cluster * 2 + 1] = count;
+            counts[cluster]                = offset;
+            offset += count;
+        }
+
+        if(overflowed)
+            LWARN("Light cluster index list full, some lights were dropped");
+
+        for(uint32_t job = 0; job < jobCount; job++)
+        {
+            for(uint32_t pair : m_JobClusterLights[job])
+            {
+                uint32_t cluster = pair >> 16;
+                uint32_t end     = m_ClusterData[cluster * 2] + m_ClusterData[cluster * 2 + 1];
+                if(counts[cluster] < end)
+                    m_LightIndices[counts[cluster]++] = pair & 0xFFFF;
+            }
+        }
+
+        m_LightIndexCount = offset;
+    }
+
+    void LightClusterGrid::BinLights(uint32_t jobIndex)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        TDArray<uint32_t>& clusterLights = m_JobClusterLights[jobIndex];
+        clusterLights.Clear();
+
+        const uint32_t first = jobIndex * LightsPerJob;
+        const uint32_t last  = Maths::Min(first + LightsPerJob, (uint32_t)m_LightBounds.Size());
+
+        for(uint32_t i = first; i < last; i++)
+        {
+            const LightBounds& light = m_LightBounds[i];
+
+            float depth = m_ClusterParams.x * light.Centre.z;
+            if(depth + light.Radius < m_Near || depth - light.Radius > m_Far)
+                continue;
+
+            uint32_t firstSlice = DepthToSlice(depth - light.Radius);
+            uint32_t lastSlice  = DepthToSlice(depth + light.Radius);
+
+            for(uint32_t z = firstSlice; z <= lastSlice; z++)
+            {
+                if(!SphereIntersectsBounds(light.Centre, light.Radius, m_SliceBounds[z].Min, m_SliceBounds[z].Max))
+                    continue;
+
+                for(uint32_t y = 0; y < LIGHT_CLUSTER_Y; y++)
+                {
+                    const ClusterBounds& row = m_RowBounds[y + z * LIGHT_CLUSTER_Y];
+                    if(!SphereIntersectsBounds(light.Centre, light.Radius, row.Min, row.Max))
+                        continue;
+
+                    const uint32_t rowStart = LIGHT_CLUSTER_X * (y + LIGHT_CLUSTER_Y * z);
+                    for(uint32_t x = 0; x < LIGHT_CLUSTER_X; x += 4)
+                    {
+                        uint32_t mask = TestClusterRow(light, rowStart + x);
+                        for(uint32_t bit = 0; mask && bit < 4; bit++)
+                        {
+                            if(!(mask & (1u << bit)))
+                                continue;
+
+                            uint32_t cluster = rowStart + x + bit;
+                            if(!light.Spot || TestCone(light, cluster))
+                                clusterLights.PushBack((cluster << 16) | light.Index);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Sphere against four consecutive clusters, returns a bit per intersecting cluster
+    uint32_t LightClusterGrid::TestClusterRow(const LightBounds& light, uint32_t firstCluster) const
+    {
+#ifdef LUMOS_SSE
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 cx   = _mm_set1_ps(light.Centre.x);
+        const __m128 cy   = _mm_set1_ps(light.Centre.y);
+        const __m128 cz   = _mm_set1_ps(light.Centre.z);
+
+        __m128 dx = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_MinX[firstCluster]), cx), _mm_sub_ps(cx, _mm_loadu_ps(&m_MaxX[firstCluster])));
+        __m128 dy = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_MinY[firstCluster]), cy), _mm_sub_ps(cy, _mm_loadu_ps(&m_MaxY[firstCluster])));
+        __m128 dz = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_MinZ[firstCluster]), cz), _mm_sub_ps(cz, _mm_loadu_ps(&m_MaxZ[firstCluster])));
+        dx        = _mm_max_ps(dx, zero);
+        dy        = _mm_max_ps(dy, zero);
+        dz        = _mm_max_ps(dz, zero);
+
+        __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        return (uint32_t)_mm_movemask_ps(_mm_cmple_ps(distSq, _mm_set1_ps(light.Radius * light.Radius)));
+#else
+        uint32_t mask = 0;
+        for(uint32_t i = 0; i < 4; i++)
+        {
+            uint32_t cluster = firstCluster + i;
+            Vec3 min         = Vec3(m_MinX[cluster], m_MinY[cluster], m_MinZ[cluster]);
+            Vec3 max         = Vec3(m_MaxX[cluster], m_MaxY[cluster], m_MaxZ[cluster]);
+            if(SphereIntersectsBounds(light.Centre, light.Radius, min, max))
+                mask |= 1u << i;
+        }
+        return mask;
+#endif
+    }
+
+    // Cone against the cluster's bounding sphere
+    bool LightClusterGrid::TestCone(const LightBounds& light, uint32_t cluster) const
+    {
+        Vec3 min          = Vec3(m_MinX[cluster], m_MinY[cluster], m_MinZ[cluster]);
+        Vec3 max          = Vec3(m_MaxX[cluster], m_MaxY[cluster], m_MaxZ[cluster]);
+        Vec3 centre       = (min + max) * 0.5f;
+        float radius      = (max - min).Length() * 0.5f;
+        Vec3 toCentre     = centre - light.Apex;
+        float lengthSq    = Vec3::Dot(toCentre, toCentre);
+        float alongAxis   = Vec3::Dot(toCentre, light.Axis);
+        float distToCone  = light.CosAngle * Maths::Sqrt(Maths::Max(lengthSq - alongAxis * alongAxis, 0.0f)) - alongAxis * light.SinAngle;
+        bool outsideAngle = distToCone > radius;
+        bool outsideFront = alongAxis > radius + light.Range;
+        bool outsideBack  = alongAxis < -radius;
+        return !(outsideAngle || outsideFront || outsideBack);
+    }
+}
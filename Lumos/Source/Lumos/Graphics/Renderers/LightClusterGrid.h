@@ -0,0 +1,91 @@
+#pragma once
+#include "Core/DataStructures/TDArray.h"
+#include "Maths/Matrix4.h"
+#include "Maths/Vector4.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        struct Light;
+
+        // Must match the defines in Buffers.glslh
+        static const uint32_t LIGHT_CLUSTER_X           = 16;
+        static const uint32_t LIGHT_CLUSTER_Y           = 9;
+        static const uint32_t LIGHT_CLUSTER_Z           = 24;
+        static const uint32_t LIGHT_CLUSTER_COUNT       = LIGHT_CLUSTER_X * LIGHT_CLUSTER_Y * LIGHT_CLUSTER_Z;
+        // Light, cluster and index lists are read only storage buffers
+        static const uint32_t MAX_LIGHTS                = 4096;
+        static const uint32_t MAX_CLUSTER_LIGHT_INDICES = 131072;
+
+        // View space light grid for clustered forward shading.
+        // Screen is split into LIGHT_CLUSTER_X * LIGHT_CLUSTER_Y tiles and LIGHT_CLUSTER_Z exponential depth slices.
+        // Each frame point and spot lights are binned into the clusters they touch on the JobSystem,
+        // then compacted into one index list. Per cluster data is the offset into that list then the light count.
+        class LUMOS_EXPORT LightClusterGrid
+        {
+        public:
+            LightClusterGrid();
+            ~LightClusterGrid() = default;
+
+            // Cluster bounds are only rebuilt when the projection or depth range changes
+            void SetProjection(const Mat4& projection, float nearPlane, float farPlane);
+
+            // lights are world space point/spot lights, stored in the GPU light array starting at firstLightIndex
+            void Build(const Mat4& view, const Light* lights, uint32_t lightCount, uint32_t firstLightIndex);
+
+            const uint32_t* GetClusterData() const { return m_ClusterData.Data(); }
+            const uint32_t* GetLightIndices() const { return m_LightIndices.Data(); }
+            uint32_t GetLightIndexCount() const { return m_LightIndexCount; }
+
+            // x = view depth sign, y = slice scale, z = slice bias
+            const Vec4& GetClusterParams() const { return m_ClusterParams; }
+
+        private:
+            struct LightBounds
+            {
+                Vec3 Centre;
+                float Radius;
+                Vec3 Apex;
+                float Range;
+                Vec3 Axis;
+                float CosAngle;
+                float SinAngle;
+                uint32_t Index;
+                bool Spot;
+            };
+
+            struct ClusterBounds
+            {
+                Vec3 Min;
+                Vec3 Max;
+            };
+
+            void BuildClusterBounds();
+            void BinLights(uint32_t jobIndex);
+            uint32_t DepthToSlice(float depth) const;
+            uint32_t TestClusterRow(const LightBounds& light, uint32_t firstCluster) const;
+            bool TestCone(const LightBounds& light, uint32_t cluster) const;
+
+            Mat4 m_Projection;
+            float m_Near        = 0.0f;
+            float m_Far         = 0.0f;
+            bool m_BoundsValid  = false;
+            Vec4 m_ClusterParams;
+
+            // Cluster bounds as structure of arrays so four clusters along x are tested at once
+            TDArray<float> m_MinX, m_MinY, m_MinZ;
+            TDArray<float> m_MaxX, m_MaxY, m_MaxZ;
+            TDArray<ClusterBounds> m_SliceBounds;
+            TDArray<ClusterBounds> m_RowBounds;
+
+            TDArray<LightBounds> m_LightBounds;
+            TDArray<TDArray<uint32_t>> m_JobClusterLights;
+
+            TDArray<uint32_t> m_ClusterData; // Two per cluster, matches uvec2 in the shader
+            TDArray<uint32_t> m_ClusterCursor;
+            TDArray<uint32_t> m_LightIndices;
+            uint32_t m_LightIndexCount = 0;
+        };
+    }
+}
@@ -20,5 +20,14 @@ namespace Lumos
             bool animated                        = false;
             DescriptorSet* AnimatedDescriptorSet = nullptr;
         };
+
+        // One draw after batching. Commands sharing a mesh, material and pipeline are drawn
+        // as a single instanced draw with their transforms in InstanceSet
+        struct LUMOS_EXPORT InstancedDraw
+        {
+            uint32_t CommandIndex      = 0; // First command of the batch, provides the mesh, material and pipeline
+            uint32_t InstanceCount     = 1;
+            DescriptorSet* InstanceSet = nullptr; // Null when drawn alone with the command's transform
+        };
     }
 }
@@ -6,6 +6,7 @@
 #include "Graphics/Animation/Skeleton.h"
 #include "Graphics/Renderers/IRenderer.h"
 #include "Graphics/Renderers/DebugRenderer.h"
+#include "Core/Telemetry.h"
 #include "Graphics/Light.h"
 #include "Graphics/Camera/Camera.h"
 #include "Graphics/Environment.h"
@@ -23,6 +24,8 @@
 #include "Core/JobSystem.h"
 #include "Core/OS/Window.h"
 #include "Core/Algorithms/Sort.h"
+#include "Core/DataStructures/Map.h"
+#include "Utilities/CombineHash.h"
 #include "Maths/BoundingSphere.h"
 #include "Maths/BoundingBox.h"
 #include "Maths/Rect.h"
@@ -55,7 +58,6 @@ static const uint32_t MaxLineIndices            = MaxLines * 2;
 static const uint32_t MAX_LINE_BATCH_DRAW_CALLS = 100;
 static const uint32_t RENDERER_LINE_SIZE        = sizeof(Lumos::Graphics::LineVertexData) * 4;
 static const uint32_t RENDERER_LINE_BUFFER_SIZE = RENDERER_LINE_SIZE * MaxLineVertices;
-static const uint32_t MAX_LIGHTS                = 32;
 static const uint32_t MAX_SHADOWMAPS            = 4;
 
 namespace Lumos::Graphics
@@ -233,6 +235,12 @@ namespace Lumos::Graphics
         m_ForwardData.m_DescriptorSet[3]->SetUniformBufferData(0, boneTransforms);
         m_ForwardData.m_DescriptorSet[3]->Update();
 
+        descriptorDesc.shader              = m_ForwardData.m_Shader.get();
+        m_ForwardData.m_DefaultInstanceSet = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+        Mat4 instanceTransform             = Mat4(1.0f);
+        m_ForwardData.m_DefaultInstanceSet->SetUniformBufferData(0, &instanceTransform, float(sizeof(Mat4)));
+        m_ForwardData.m_DefaultInstanceSet->Update();
+
         m_ForwardData.m_DefaultMaterial  = new Material(m_ForwardData.m_Shader);
         uint32_t blackCubeTextureData[6] = { 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000 };
         m_DefaultTextureCube             = Graphics::TextureCube::Create(1, blackCubeTextureData);
@@ -701,13 +709,17 @@ namespace Lumos::Graphics
     void SceneRenderer::BeginScene(Scene* scene)
     {
         LUMOS_PROFILE_FUNCTION();
-        auto& registry             = scene->GetRegistry();
-        m_CurrentScene             = scene;
-        m_Stats.FramesPerSecond    = 0;
-        m_Stats.NumDrawCalls       = 0;
-        m_Stats.NumRenderedObjects = 0;
-        m_Stats.NumShadowObjects   = 0;
-        m_Stats.UpdatesPerSecond   = 0;
+        auto& registry              = scene->GetRegistry();
+        m_CurrentScene              = scene;
+        m_Stats.FramesPerSecond     = 0;
+        m_Stats.NumDrawCalls        = 0;
+        m_Stats.NumInstancedObjects = 0;
+        m_Stats.NumRenderedObjects  = 0;
+        m_Stats.NumShadowObjects    = 0;
+        m_Stats.UpdatesPerSecond    = 0;
+        m_Stats.NumLights           = 0;
+        m_Stats.NumClusterLightRefs = 0;
+        m_Stats.UIWidgetsRebuilt    = 0;
 
         m_Renderer2DData.m_BatchDrawCallIndex        = 0;
         m_TextRendererData.m_BatchDrawCallIndex      = 0;
@@ -839,8 +851,11 @@ namespace Lumos::Graphics
         }
 
         Light* directionaLight = nullptr;
+        // Directional lights first, then the clustered point/spot lights
         static Light lights[MAX_LIGHTS];
-        uint32_t numLights = 0;
+        static Light localLights[MAX_LIGHTS];
+        uint32_t numDirectionalLights = 0;
+        uint32_t numLocalLights       = 0;
 
         m_ForwardData.m_Frustum = m_Camera->GetFrustum(view);
 
@@ -852,16 +867,19 @@ namespace Lumos::Graphics
         }
 
         m_ForwardData.m_CommandQueue.Clear();
+        m_ForwardData.m_DrawQueue.Clear();
+        m_InstanceDescriptorSetsUsed = 0;
 
         struct UniformSceneData
         {
-            Light lights[MAX_LIGHTS];
             Mat4 ShadowTransform[MAX_SHADOWMAPS];
             Mat4 ViewMatrix;
             Mat4 LightView;
             Mat4 BiasMatrix;
+            Mat4 ProjectionMatrix;
             Vec4 cameraPosition;
             Vec4 SplitDepths[MAX_SHADOWMAPS];
+            Vec4 ClusterParams;
             float LightSize;
             float MaxShadowDist;
             float ShadowFade;
@@ -874,6 +892,8 @@ namespace Lumos::Graphics
             float Width;
             float Height;
             int shadowEnabled;
+            int DirectionalLightCount;
+            int Padding[3];
         };
 
         if(renderSettings.Renderer3DEnabled)
@@ -887,9 +907,6 @@ namespace Lumos::Graphics
                     if(!Entity(lightEntity, scene).Active())
                         continue;
 
-                    if(numLights >= MAX_LIGHTS)
-                        break;
-
                     const auto& [light, trans] = group.get<Graphics::Light, Maths::Transform>(lightEntity);
                     light.Position             = Vec4(trans.GetWorldPosition(), 1.0f);
                     Vec3 forward               = Vec3(0.0f, 0.0f, 1.0f);
@@ -900,25 +917,48 @@ namespace Lumos::Graphics
                     if(light.Type == (float)Graphics::LightType::DirectionalLight)
                         directionaLight = &light;
 
-                    if(light.Type != float(LightType::DirectionalLight))
+                    if(light.Type == float(LightType::DirectionalLight))
                     {
-                        auto inside = m_ForwardData.m_Frustum.IsInside(Maths::BoundingSphere(Vec3(light.Position), light.Radius * 100));
-
-                        if(inside == Maths::Intersection::OUTSIDE)
-                            continue;
+                        if(numDirectionalLights < MAX_LIGHTS)
+                        {
+                            lights[numDirectionalLights] = light;
+                            lights[numDirectionalLights].Intensity *= m_Exposure;
+                            numDirectionalLights++;
+                        }
+                        continue;
                     }
 
-                    lights[numLights] = light;
-                    lights[numLights].Intensity *= m_Exposure;
-                    numLights++;
+                    // Point and spot attenuation both reach zero at the radius
+                    auto inside = m_ForwardData.m_Frustum.IsInside(Maths::BoundingSphere(Vec3(light.Position), light.Radius));
+
+                    if(inside == Maths::Intersection::OUTSIDE || numLocalLights >= MAX_LIGHTS)
+                        continue;
+
+                    localLights[numLocalLights] = light;
+                    localLights[numLocalLights].Intensity *= m_Exposure;
+                    numLocalLights++;
                 }
+
+                numLocalLights = Maths::Min(numLocalLights, MAX_LIGHTS - numDirectionalLights);
+                MemoryCopy(lights + numDirectionalLights, localLights, sizeof(Light) * numLocalLights);
             }
 
+            {
+                LUMOS_PROFILE_SCOPE("Light Clusters");
+                auto& lightGrid = m_ForwardData.m_LightClusterGrid;
+                lightGrid.SetProjection(proj, m_Camera->GetNear(), m_Camera->GetFar());
+                lightGrid.Build(view, lights + numDirectionalLights, numLocalLights, numDirectionalLights);
+                m_Stats.NumClusterLightRefs = lightGrid.GetLightIndexCount();
+            }
+
+            m_Stats.NumLights = numDirectionalLights + numLocalLights;
+
             if(renderSettings.ShadowsEnabled)
             {
                 for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
                 {
                     m_ShadowData.m_CascadeCommandQueue[i].Clear();
+                    m_ShadowData.m_CascadeDrawQueue[i].Clear();
                 }
 
                 if(directionaLight)
@@ -952,11 +992,19 @@ namespace Lumos::Graphics
             uniformSceneData.Mode           = m_ForwardData.m_RenderMode;
             uniformSceneData.cameraPosition = Vec4(m_CameraTransform->GetWorldPosition(), 1.0f);
 
-            MemoryCopy(uniformSceneData.lights, lights, sizeof(Graphics::Light) * numLights);
-            uniformSceneData.LightCount = numLights;
+            uniformSceneData.ProjectionMatrix      = proj;
+            uniformSceneData.ClusterParams         = m_ForwardData.m_LightClusterGrid.GetClusterParams();
+            uniformSceneData.DirectionalLightCount = numDirectionalLights;
+            uniformSceneData.LightCount            = numDirectionalLights + numLocalLights;
 
             m_ForwardData.m_DescriptorSet[2]->SetUniformBufferData(5, &uniformSceneData);
 
+            // Only the used part of the light and index buffers is copied
+            const uint32_t lightIndexCount = Maths::Max(m_ForwardData.m_LightClusterGrid.GetLightIndexCount(), 1u);
+            m_ForwardData.m_DescriptorSet[2]->SetUniformBufferData(6, lights, float(sizeof(Graphics::Light) * Maths::Max(uniformSceneData.LightCount, 1)));
+            m_ForwardData.m_DescriptorSet[2]->SetUniformBufferData(7, (void*)m_ForwardData.m_LightClusterGrid.GetClusterData());
+            m_ForwardData.m_DescriptorSet[2]->SetUniformBufferData(8, (void*)m_ForwardData.m_LightClusterGrid.GetLightIndices(), float(sizeof(uint32_t) * lightIndexCount));
+
             m_ForwardData.m_DescriptorSet[2]->SetTexture(0, reinterpret_cast<Texture*>(shadowData.m_ShadowTex), 0, TextureType::DEPTHARRAY);
             m_ForwardData.m_DescriptorSet[2]->SetTexture(3, m_ForwardData.m_BRDFLUT.get());
             m_ForwardData.m_DescriptorSet[2]->SetTexture(4, Application::Get().GetCurrentScene()->GetSettings().RenderSettings.SSAOEnabled ? m_SSAOTexture : Material::GetDefaultTexture().get());
@@ -971,6 +1019,8 @@ namespace Lumos::Graphics
             }
             m_ForwardData.m_DescriptorSet[3]->SetUniformBufferData(0, boneTransforms);
             m_ForwardData.m_DescriptorSet[3]->Update();
+            if(m_ForwardData.m_DefaultInstanceSet)
+                m_ForwardData.m_DefaultInstanceSet->Update();
 
             auto group = registry.group<ModelComponent>(entt::get<Maths::Transform>);
 
@@ -1178,6 +1228,122 @@ namespace Lumos::Graphics
                                            });
             }
         }
+
+        if(renderSettings.Renderer3DEnabled)
+        {
+            LUMOS_PROFILE_SCOPE("Build Instanced Draws");
+            BuildInstancedDraws(m_ForwardData.m_CommandQueue, m_ForwardData.m_DrawQueue, true);
+
+            if(renderSettings.ShadowsEnabled)
+            {
+                for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+                    BuildInstancedDraws(m_ShadowData.m_CascadeCommandQueue[i], m_ShadowData.m_CascadeDrawQueue[i], false);
+            }
+        }
+    }
+
+    void SceneRenderer::BuildInstancedDraws(const CommandQueue& commands, InstancedDrawQueue& outDraws, bool keepBlendedOrder)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        outDraws.Clear();
+
+        if(commands.Empty())
+            return;
+
+        struct BatchKey
+        {
+            Mesh* mesh;
+            Material* material;
+            Pipeline* pipeline;
+
+            bool operator==(const BatchKey& other) const
+            {
+                return mesh == other.mesh && material == other.material && pipeline == other.pipeline;
+            }
+        };
+
+        struct BatchKeyHash
+        {
+            uint64_t operator()(const BatchKey& key) const
+            {
+                uint64_t hash = 0;
+                HashCombine(hash, key.mesh, key.material, key.pipeline);
+                return MapHashMix(hash);
+            }
+        };
+
+        static const uint32_t EndOfBatch = ~0u;
+
+        Arena* frameArena = Application::Get().GetFrameArena();
+        uint32_t count    = (uint32_t)commands.Size();
+        uint32_t* next    = PushArrayNoZero(frameArena, uint32_t, count); // Next command in the same batch
+        uint32_t* tail    = PushArrayNoZero(frameArena, uint32_t, count); // Last command of each draw
+
+        FlatHashMap<BatchKey, uint32_t, BatchKeyHash> batches(frameArena);
+        batches.Reserve(count);
+
+        for(uint32_t i = 0; i < count; i++)
+        {
+            const RenderCommand& command = commands[i];
+            Material* material           = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
+            next[i]                      = EndOfBatch;
+
+            // Skinned meshes use set 3 for bones. Blended and non depth tested draws depend on the sorted order
+            bool canBatch = !command.animated;
+            if(keepBlendedOrder && (material->GetFlag(Material::RenderFlags::ALPHABLEND) || !material->GetFlag(Material::RenderFlags::DEPTHTEST)))
+                canBatch = false;
+
+            if(canBatch)
+            {
+                BatchKey key   = { command.mesh, material, command.pipeline };
+                bool added     = false;
+                uint32_t& draw = batches.GetOrAdd(key, &added);
+
+                if(!added && outDraws[draw].InstanceCount < MAX_INSTANCES)
+                {
+                    next[tail[draw]] = i;
+                    tail[draw]       = i;
+                    outDraws[draw].InstanceCount++;
+                    continue;
+                }
+
+                draw = (uint32_t)outDraws.Size();
+            }
+
+            tail[outDraws.Size()]  = i;
+            InstancedDraw& newDraw = outDraws.EmplaceBack();
+            newDraw.CommandIndex   = i;
+            newDraw.InstanceCount  = 1;
+            newDraw.InstanceSet    = nullptr;
+        }
+
+        Mat4* transforms = PushArrayNoZero(frameArena, Mat4, MAX_INSTANCES);
+        for(auto& draw : outDraws)
+        {
+            if(draw.InstanceCount == 1)
+                continue;
+
+            uint32_t instance = 0;
+            for(uint32_t i = draw.CommandIndex; i != EndOfBatch; i = next[i])
+                transforms[instance++] = commands[i].transform;
+
+            draw.InstanceSet = GetInstanceDescriptorSet();
+            draw.InstanceSet->SetUniformBufferData(0, transforms, float(sizeof(Mat4) * draw.InstanceCount));
+            draw.InstanceSet->Update();
+        }
+    }
+
+    Graphics::DescriptorSet* SceneRenderer::GetInstanceDescriptorSet()
+    {
+        if(m_InstanceDescriptorSetsUsed == m_InstanceDescriptorSets.Size())
+        {
+            Graphics::DescriptorDesc descriptorDesc {};
+            descriptorDesc.layoutIndex = 3;
+            descriptorDesc.shader      = m_ForwardData.m_Shader.get();
+            m_InstanceDescriptorSets.PushBack(SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc)));
+        }
+
+        return m_InstanceDescriptorSets[m_InstanceDescriptorSetsUsed++].get();
     }
 
     void SceneRenderer::SetRenderTarget(Graphics::Texture* texture, bool onlyIfTargetsScreen, bool rebuildFramebuffer)
@@ -1189,6 +1355,7 @@ namespace Lumos::Graphics
     void SceneRenderer::OnRender()
     {
         LUMOS_PROFILE_FUNCTION();
+        LUMOS_TELEMETRY_SCOPE("SceneRenderer::OnRender");
         LUMOS_PROFILE_GPU("Render Passes");
 
         auto& sceneRenderSettings       = Application::Get().GetCurrentScene()->GetSettings().RenderSettings;
@@ -1413,6 +1580,10 @@ namespace Lumos::Graphics
 
     void SceneRenderer::OnNewScene(Scene* scene)
     {
+        m_TextDrawCache.Clear();
+        m_UIDrawCache.Clear();
+        m_TextLayoutCache.Clear();
+
         m_ForwardData.m_EnvironmentMap = m_DefaultTextureCube;
         m_ForwardData.m_IrradianceMap  = m_DefaultTextureCube;
 
@@ -1593,6 +1764,14 @@ namespace Lumos::Graphics
         commandBuffer->UnBindPipeline();
     }
 
+    // Matches PushConsts in Shadow.vert and ShadowAnim.vert
+    struct ShadowPushConstants
+    {
+        Mat4 Transform;
+        uint32_t CascadeIndex;
+        float Padding[3];
+    };
+
     void SceneRenderer::ShadowPass()
     {
         LUMOS_PROFILE_FUNCTION();
@@ -1618,8 +1797,7 @@ namespace Lumos::Graphics
         m_ShadowData.m_DescriptorSet[1]->SetUniformBufferData(1, m_ShadowData.m_ShadowProjView);
         m_ShadowData.m_DescriptorSet[1]->Update();
 
-        Arena* frameArena                  = Application::Get().GetFrameArena();
-        DescriptorSet** currentDescriptors = PushArrayNoZero(frameArena, DescriptorSet*, 4);
+        Arena* frameArena = Application::Get().GetFrameArena();
 
         for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
         {
@@ -1627,35 +1805,59 @@ namespace Lumos::Graphics
 
             m_ShadowData.m_Layer = i;
 
-            for(auto& command : m_ShadowData.m_CascadeCommandQueue[m_ShadowData.m_Layer])
+            const CommandQueue& commands    = m_ShadowData.m_CascadeCommandQueue[m_ShadowData.m_Layer];
+            const InstancedDrawQueue& draws = m_ShadowData.m_CascadeDrawQueue[m_ShadowData.m_Layer];
+            if(draws.Empty())
+                continue;
+
+            uint32_t drawCount             = (uint32_t)draws.Size();
+            Graphics::Pipeline** pipelines = PushArrayNoZero(frameArena, Graphics::Pipeline*, drawCount);
+            for(uint32_t d = 0; d < drawCount; d++)
             {
-                Material* material    = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-                currentDescriptors[1] = material->GetDescriptorSet();
-                bool alphaBlend       = material->GetFlag(Material::RenderFlags::ALPHABLEND);
+                pipelines[d] = commands[draws[d].CommandIndex].pipeline;
+                m_Stats.NumShadowObjects += draws[d].InstanceCount;
+                m_Stats.NumDrawCalls++;
+            }
 
-                uint32_t layer      = static_cast<uint32_t>(m_ShadowData.m_Layer);
-                auto& pushConstants = command.pipeline->GetShader()->GetPushConstants();
-                memcpy(pushConstants[0].data + sizeof(Mat4), &layer, sizeof(uint32_t));
-                currentDescriptors[0] = alphaBlend ? m_ShadowData.m_DescriptorSet[1].get() : m_ShadowData.m_DescriptorSet[0].get();
+            auto recordDraws = [&](Graphics::CommandBuffer* cmd, uint32_t begin, uint32_t end)
+            {
+                DescriptorSet* currentDescriptors[4];
                 currentDescriptors[2] = m_ForwardData.m_DescriptorSet[2];
 
-                if(command.animated)
+                ShadowPushConstants pushConstants = {};
+                pushConstants.CascadeIndex        = static_cast<uint32_t>(m_ShadowData.m_Layer);
+
+                for(uint32_t d = begin; d < end; d++)
                 {
-                    currentDescriptors[3] = command.AnimatedDescriptorSet;
-                }
+                    const InstancedDraw& draw    = draws[d];
+                    const RenderCommand& command = commands[draw.CommandIndex];
+                    Material* material           = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
+                    currentDescriptors[1]        = material->GetDescriptorSet();
+                    bool alphaBlend              = material->GetFlag(Material::RenderFlags::ALPHABLEND);
 
-                auto pipeline = command.pipeline;
-                commandBuffer->BindPipeline(pipeline, m_ShadowData.m_Layer);
+                    currentDescriptors[0] = alphaBlend ? m_ShadowData.m_DescriptorSet[1].get() : m_ShadowData.m_DescriptorSet[0].get();
 
-                Mesh* mesh     = command.mesh;
-                auto transform = m_ShadowData.m_ShadowProjView[m_ShadowData.m_Layer] * command.transform;
-                memcpy(pushConstants[0].data, &transform, sizeof(Mat4));
+                    if(command.animated)
+                        currentDescriptors[3] = command.AnimatedDescriptorSet;
+                    else
+                        currentDescriptors[3] = draw.InstanceSet ? draw.InstanceSet : m_ForwardData.m_DefaultInstanceSet.get();
+
+                    auto pipeline = pipelines[d];
+                    cmd->BindPipeline(pipeline, m_ShadowData.m_Layer);
+
+                    // Batched draws take the world transform from the instance set
+                    Mesh* mesh              = command.mesh;
+                    pushConstants.Transform = draw.InstanceSet ? m_ShadowData.m_ShadowProjView[m_ShadowData.m_Layer] : m_ShadowData.m_ShadowProjView[m_ShadowData.m_Layer] * command.transform;
+
+                    pipeline->GetShader()->BindPushConstantData(cmd, pipeline, 0, &pushConstants);
+                    Renderer::BindDescriptorSets(pipeline, cmd, 0, currentDescriptors, 4);
+                    Renderer::DrawMesh(cmd, pipeline, mesh, draw.InstanceCount);
+                }
+            };
+
+            if(!RecordDrawsParallel(pipelines, drawCount, m_ShadowData.m_Layer, recordDraws))
+                recordDraws(commandBuffer, 0, drawCount);
 
-                command.pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline);
-                Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, command.animated ? 4 : 3);
-                Renderer::DrawMesh(commandBuffer, pipeline, mesh);
-                m_Stats.NumShadowObjects++;
-            }
             commandBuffer->UnBindPipeline();
             commandBuffer->EndCurrentRenderPass();
         }
@@ -1678,40 +1880,65 @@ namespace Lumos::Graphics
         pipelineDesc.DebugName        = "Depth Prepass";
         pipelineDesc.samples          = m_MainTextureSamples;
 
-        DescriptorSet* sets[4];
-        sets[0] = m_ForwardData.m_DescriptorSet[0].get();
-        sets[2] = m_ForwardData.m_DescriptorSet[2].get();
+        // Pipelines are looked up on the main thread, the pipeline cache isn't thread safe
+        Arena* frameArena              = Application::Get().GetFrameArena();
+        const InstancedDraw** draws    = PushArrayNoZero(frameArena, const InstancedDraw*, m_ForwardData.m_DrawQueue.Size());
+        Graphics::Pipeline** pipelines = PushArrayNoZero(frameArena, Graphics::Pipeline*, m_ForwardData.m_DrawQueue.Size());
+        uint32_t drawCount             = 0;
 
-        for(auto& command : m_ForwardData.m_CommandQueue)
+        for(auto& draw : m_ForwardData.m_DrawQueue)
         {
-            Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-            sets[1]            = material->GetDescriptorSet();
+            const RenderCommand& command = m_ForwardData.m_CommandQueue[draw.CommandIndex];
+            Material* material           = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
             if(!material->GetFlag(Material::RenderFlags::DEPTHTEST)) // || command.material->GetFlag(Material::RenderFlags::ALPHABLEND))
                 continue;
 
             bool alphaBlend = material->GetFlag(Material::RenderFlags::ALPHABLEND);
 
-            if(command.animated)
-            {
-                sets[3] = command.AnimatedDescriptorSet;
-            }
-
             pipelineDesc.transparencyEnabled = alphaBlend;
             pipelineDesc.shader              = command.animated ? (alphaBlend ? m_DepthPrePassAlphaAnimShader : m_DepthPrePassAnimShader) : (alphaBlend ? m_DepthPrePassAlphaShader : m_DepthPrePassShader);
 
-            auto pipeline = Graphics::Pipeline::Get(pipelineDesc);
-            commandBuffer->BindPipeline(pipeline);
+            draws[drawCount]     = &draw;
+            pipelines[drawCount] = Graphics::Pipeline::Get(pipelineDesc).get();
+            drawCount++;
+            m_Stats.NumDrawCalls++;
+        }
+
+        if(drawCount == 0)
+            return;
 
-            Mesh* mesh           = command.mesh;
-            auto& worldTransform = command.transform;
+        auto recordDraws = [&](Graphics::CommandBuffer* cmd, uint32_t begin, uint32_t end)
+        {
+            DescriptorSet* sets[4];
+            sets[0] = m_ForwardData.m_DescriptorSet[0].get();
+            sets[2] = m_ForwardData.m_DescriptorSet[2].get();
 
-            auto& pushConstants = m_DepthPrePassShader->GetPushConstants()[0];
-            pushConstants.SetData((void*)&worldTransform);
+            for(uint32_t d = begin; d < end; d++)
+            {
+                const InstancedDraw& draw    = *draws[d];
+                const RenderCommand& command = m_ForwardData.m_CommandQueue[draw.CommandIndex];
+                Material* material           = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
+                sets[1]                      = material->GetDescriptorSet();
 
-            m_DepthPrePassShader->BindPushConstants(commandBuffer, pipeline);
-            Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, sets, command.animated ? 4 : 3);
-            Renderer::DrawMesh(commandBuffer, pipeline, mesh);
-        }
+                if(command.animated)
+                    sets[3] = command.AnimatedDescriptorSet;
+                else
+                    sets[3] = draw.InstanceSet ? draw.InstanceSet : m_ForwardData.m_DefaultInstanceSet.get();
+
+                auto pipeline = pipelines[d];
+                cmd->BindPipeline(pipeline);
+
+                Mesh* mesh          = command.mesh;
+                Mat4 worldTransform = draw.InstanceSet ? Mat4(1.0f) : command.transform;
+
+                m_DepthPrePassShader->BindPushConstantData(cmd, pipeline, 0, &worldTransform);
+                Renderer::BindDescriptorSets(pipeline, cmd, 0, sets, 4);
+                Renderer::DrawMesh(cmd, pipeline, mesh, draw.InstanceCount);
+            }
+        };
+
+        if(!RecordDrawsParallel(pipelines, drawCount, 0, recordDraws))
+            recordDraws(commandBuffer, 0, drawCount);
     }
 
     void SceneRenderer::SSAOPass()
@@ -1876,33 +2103,100 @@ namespace Lumos::Graphics
         Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
         m_ForwardData.m_DescriptorSet[2]->TransitionImages(commandBuffer);
 
-        Arena* frameArena                  = Application::Get().GetFrameArena();
-        DescriptorSet** currentDescriptors = PushArrayNoZero(frameArena, DescriptorSet*, 4);
+        const InstancedDrawQueue& draws = m_ForwardData.m_DrawQueue;
+        uint32_t drawCount              = (uint32_t)draws.Size();
 
-        for(auto& command : m_ForwardData.m_CommandQueue)
+        Arena* frameArena              = Application::Get().GetFrameArena();
+        Graphics::Pipeline** pipelines = PushArrayNoZero(frameArena, Graphics::Pipeline*, drawCount);
+        for(uint32_t d = 0; d < drawCount; d++)
         {
-            m_Stats.NumRenderedObjects++;
-
-            Mesh* mesh           = command.mesh;
-            auto& worldTransform = command.transform;
-            Material* material   = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-            auto pipeline        = command.pipeline;
-            commandBuffer->BindPipeline(pipeline);
+            pipelines[d] = m_ForwardData.m_CommandQueue[draws[d].CommandIndex].pipeline;
+            m_Stats.NumRenderedObjects += draws[d].InstanceCount;
+            m_Stats.NumDrawCalls++;
+            if(draws[d].InstanceCount > 1)
+                m_Stats.NumInstancedObjects += draws[d].InstanceCount;
+        }
 
+        auto recordDraws = [&](Graphics::CommandBuffer* cmd, uint32_t begin, uint32_t end)
+        {
+            DescriptorSet* currentDescriptors[4];
             currentDescriptors[0] = m_ForwardData.m_DescriptorSet[0].get();
-            currentDescriptors[1] = material->GetDescriptorSet();
             currentDescriptors[2] = m_ForwardData.m_DescriptorSet[2].get();
 
-            if(command.animated)
-                currentDescriptors[3] = command.AnimatedDescriptorSet ? command.AnimatedDescriptorSet : m_ForwardData.m_DescriptorSet[3].get();
+            for(uint32_t d = begin; d < end; d++)
+            {
+                const InstancedDraw& draw    = draws[d];
+                const RenderCommand& command = m_ForwardData.m_CommandQueue[draw.CommandIndex];
+
+                // Batched draws take the world transform from the instance set
+                Mesh* mesh          = command.mesh;
+                Mat4 worldTransform = draw.InstanceSet ? Mat4(1.0f) : command.transform;
+                Material* material  = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
+                auto pipeline       = pipelines[d];
+                cmd->BindPipeline(pipeline);
+
+                currentDescriptors[1] = material->GetDescriptorSet();
+
+                if(command.animated)
+                    currentDescriptors[3] = command.AnimatedDescriptorSet ? command.AnimatedDescriptorSet : m_ForwardData.m_DescriptorSet[3].get();
+                else
+                    currentDescriptors[3] = draw.InstanceSet ? draw.InstanceSet : m_ForwardData.m_DefaultInstanceSet.get();
+
+                m_ForwardData.m_Shader->BindPushConstantData(cmd, pipeline, 0, &worldTransform);
+                Renderer::BindDescriptorSets(pipeline, cmd, 0, currentDescriptors, 4);
+                Renderer::DrawMesh(cmd, pipeline, mesh, draw.InstanceCount);
+            }
+        };
 
-            auto& pushConstants = m_ForwardData.m_Shader->GetPushConstants()[0];
-            pushConstants.SetData((void*)&worldTransform);
+        if(!RecordDrawsParallel(pipelines, drawCount, 0, recordDraws))
+            recordDraws(commandBuffer, 0, drawCount);
+    }
 
-            m_ForwardData.m_Shader->BindPushConstants(commandBuffer, pipeline);
-            Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, command.animated ? 4 : 3);
-            Renderer::DrawMesh(commandBuffer, pipeline, mesh);
+    bool SceneRenderer::RecordDrawsParallel(Graphics::Pipeline** pipelines, uint32_t drawCount, uint32_t layer, const Function<void(Graphics::CommandBuffer*, uint32_t, uint32_t)>& recordDraws)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        uint32_t workerCount = Maths::Min(System::JobSystem::GetThreadCount(), (uint32_t)MAX_RECORDING_SLOTS);
+        uint32_t chunkCount  = Maths::Min(workerCount, drawCount / PARALLEL_RECORDING_MIN_DRAWS);
+        if(!m_ParallelRecording || chunkCount < 2)
+            return false;
+
+        // Secondary buffers continue a single render pass, every pipeline has to be compatible with it
+        Graphics::RenderPass* renderPass = pipelines[0]->GetRenderPass();
+        for(uint32_t i = 1; i < drawCount; i++)
+        {
+            if(pipelines[i]->GetRenderPass() != renderPass)
+                return false;
         }
+
+        Graphics::SwapChain* swapChain         = Renderer::GetMainSwapChain();
+        Graphics::CommandBuffer* commandBuffer = swapChain->GetCurrentCommandBuffer();
+        if(!commandBuffer->BeginSecondaryRenderPass(pipelines[0], layer))
+            return false;
+
+        Arena* frameArena                   = Application::Get().GetFrameArena();
+        Graphics::CommandBuffer** secondary = PushArrayNoZero(frameArena, Graphics::CommandBuffer*, chunkCount);
+        uint32_t drawsPerChunk              = (drawCount + chunkCount - 1) / chunkCount;
+
+        System::JobSystem::Context context;
+        System::JobSystem::Dispatch(context, chunkCount, 1, [&](JobDispatchArgs args)
+                                    {
+                uint32_t begin = args.jobIndex * drawsPerChunk;
+                uint32_t end   = Maths::Min(begin + drawsPerChunk, drawCount);
+
+                Graphics::CommandBuffer* cmd = swapChain->GetSecondaryCommandBuffer(args.jobIndex);
+                cmd->BeginRecordingInRenderPass(commandBuffer);
+                recordDraws(cmd, begin, end);
+                cmd->EndRecording();
+                secondary[args.jobIndex] = cmd; });
+        System::JobSystem::Wait(context);
+
+        // Executed in draw order, so the result matches recording inline
+        for(uint32_t i = 0; i < chunkCount; i++)
+            secondary[i]->ExecuteSecondary(commandBuffer);
+
+        // Nothing can be recorded inline into a pass begun for secondary buffers
+        commandBuffer->EndCurrentRenderPass();
+        return true;
     }
 
     void SceneRenderer::SkyboxPass()
@@ -2040,8 +2334,9 @@ namespace Lumos::Graphics
     static Vec2 debugUIOffset     = Vec2(0.0f, 0.0f);
     static Vec2 debugUISizeOffset = Vec2(0.0f, 0.0f);
 
-    void SceneRenderer::draw_ui(UI_Widget* widget)
+    void SceneRenderer::BuildUIDrawCache(UI_Widget* widget, UIDrawCache& drawCache)
     {
+        LUMOS_PROFILE_FUNCTION_LOW();
         Vec4 border_color     = widget->style_vars[StyleVar_BorderColor];
         Vec4 background_color = widget->style_vars[StyleVar_BackgroundColor];
         Vec4 text_color       = widget->style_vars[StyleVar_TextColor];
@@ -2059,105 +2354,134 @@ namespace Lumos::Graphics
             text_color       = text_color.Lerp(widget->style_vars[StyleVar_ActiveTextColor], widget->ActiveTransition);
         }
 
-        if(widget->flags & WidgetFlags_DrawBorder)
+        const float targetHeight = drawCache.TargetHeight;
+        const auto& uv           = Renderable2D::GetDefaultUVs();
+
+        // Texture slots depend on the batch, so quads are cached with slot 0 and patched when submitted
+        auto addQuad = [&](const Vec2& min, const Vec2& size, const Vec4& colour)
         {
-            Vec2 size = widget->size;
-            Vec2 p    = widget->position + /*size * 0.5f+*/ debugUIOffset;
-            // size *= 4.0f;
-            p.y = m_MainTexture->GetHeight() - p.y;
+            Vec2 max;
+            max.x = min.x + size.x;
+            max.y = min.y - size.y;
 
-            if(m_CurrentUIText)
-            {
-                if(m_TextRendererData.m_IndexCount >= 0)
-                {
-                    TextFlush(m_TextRendererData, TextVertexBufferBase, TextVertexBufferPtr);
-                    // BeginTextPass();
-                }
+            const Vec2 corners[4] = { min, { min.x, max.y }, max, { max.x, min.y } };
+            const int uvIndex[4]  = { 0, 3, 2, 1 };
 
-                Begin2DPass();
+            VertexData* vertex = &drawCache.Quads[drawCache.QuadCount * 4];
+            for(uint32_t corner = 0; corner < 4; corner++)
+            {
+                vertex->vertex = Vec3(corners[corner].x, corners[corner].y, 0.0f);
+                vertex->uv.x   = uv[uvIndex[corner]].x;
+                vertex->uv.y   = uv[uvIndex[corner]].y;
+                vertex->tid    = Vec2(0.0f, 0.0f);
+                vertex->colour = colour;
+                vertex++;
             }
 
-            m_CurrentUIText = false;
+            drawCache.QuadCount++;
+        };
 
-            {
-                m_Stats.NumRenderedObjects++;
+        drawCache.QuadCount = 0;
 
-                if(m_Renderer2DData.m_IndexCount >= m_Renderer2DData.m_Limits.IndiciesSize)
-                {
-                    Render2DFlush();
-                    Renderer2DBeginBatch();
-                }
+        if(widget->flags & WidgetFlags_DrawBorder)
+        {
+            Vec2 p = widget->position + debugUIOffset;
+            p.y    = targetHeight - p.y;
+            addQuad(p, widget->size, border_color);
+        }
 
-                const Vec2 min = p; // - size * 0.5f;
-                Vec2 max;
-                max.x = min.x + size.x;
-                max.y = min.y - size.y;
+        if(widget->flags & WidgetFlags_DrawBackground)
+        {
+            Vec2 border = widget->style_vars[StyleVar_Border].ToVector2();
+            Vec2 p      = widget->position + border + debugUIOffset;
+            p.y         = targetHeight - p.y;
+            addQuad(p, widget->size - 2.0f * border, background_color);
+        }
 
-                const Vec4 colour = border_color;
-                const auto& uv    = Renderable2D::GetDefaultUVs();
-                Texture* texture  = widget->texture;
+        drawCache.TextVertices.Clear();
+        drawCache.TextTextureIndex = 0;
 
-                float textureSlot = 0.0f;
-                if(texture)
-                    textureSlot = SubmitTexture(texture);
-
-                Vec3 vertex                       = Vec4(min.x, min.y, 0.0f, 1.0f);
-                m_Renderer2DData.m_Buffer->vertex = vertex;
-                m_Renderer2DData.m_Buffer->uv.x   = uv[0].x;
-                m_Renderer2DData.m_Buffer->uv.y   = uv[0].y;
-                m_Renderer2DData.m_Buffer->tid    = Vec2(textureSlot, 0.0f);
-                m_Renderer2DData.m_Buffer->colour = colour;
-                m_Renderer2DData.m_Buffer++;
-
-                vertex                            = Vec4(min.x, max.y, 0.0f, 1.0f);
-                m_Renderer2DData.m_Buffer->vertex = vertex;
-                m_Renderer2DData.m_Buffer->uv.x   = uv[3].x;
-                m_Renderer2DData.m_Buffer->uv.y   = uv[3].y;
-                m_Renderer2DData.m_Buffer->tid    = Vec2(textureSlot, 0.0f);
-                m_Renderer2DData.m_Buffer->colour = colour;
-                m_Renderer2DData.m_Buffer++;
-
-                vertex                            = Vec4(max.x, max.y, 0.0f, 1.0f);
-                m_Renderer2DData.m_Buffer->vertex = vertex;
-                m_Renderer2DData.m_Buffer->uv.x   = uv[2].x;
-                m_Renderer2DData.m_Buffer->uv.y   = uv[2].y;
-                m_Renderer2DData.m_Buffer->tid    = Vec2(textureSlot, 0.0f);
-                m_Renderer2DData.m_Buffer->colour = colour;
-                m_Renderer2DData.m_Buffer++;
-
-                vertex                            = Vec4(max.x, min.y, 0.0f, 1.0f);
-                m_Renderer2DData.m_Buffer->vertex = vertex;
-                m_Renderer2DData.m_Buffer->uv.x   = uv[1].x;
-                m_Renderer2DData.m_Buffer->uv.y   = uv[1].y;
-                m_Renderer2DData.m_Buffer->tid    = Vec2(textureSlot, 0.0f);
-                m_Renderer2DData.m_Buffer->colour = colour;
-                m_Renderer2DData.m_Buffer++;
+        if(!(widget->flags & WidgetFlags_DrawText) || widget->text.size == 0)
+            return;
 
-                m_Renderer2DData.m_IndexCount += 6;
+        Vec2 padding   = widget->style_vars[StyleVar_Padding].ToVector2();
+        float fontSize = widget->style_vars[StyleVar_FontSize].x;
+
+        Vec2 size = widget->size;
+        Vec2 p    = widget->position + debugUIOffset;
+        p.y       = targetHeight - p.y;
+        p.y -= size.y - padding.y * 0.5f;
+
+        if(widget->TextAlignment & UI_Text_Alignment_Center_X)
+            p.x += size.x * 0.5f + padding.x * 0.5f;
+        else
+            p.x += padding.x * 0.5f;
+
+        auto font = Font::GetDefaultFont();
+        if(!font->GetFontAtlas())
+            ASSERT(false);
+
+        const float maxWidth     = 100.0f; // widget->size.x;
+        const TextLayout* layout = m_TextLayoutCache.GetLayout(font.get(), std::string((const char*)widget->text.str, widget->text.size), maxWidth, 0.0f, 0.0f);
+        uint32_t quadCount       = Maths::Min((uint32_t)layout->Quads.Size(), m_TextRendererData.m_Limits.IndiciesSize / 6);
+
+        const Mat4 transform     = Mat4::Translation(Vec3(p.x, p.y, 0.0f)) * Mat4::Scale(Vec3(fontSize, fontSize, fontSize));
+        const Vec4 colour        = Vec4(1.0f);
+        const Vec4 outlineColour = Vec4(1.0f);
+        const float outlineWidth = 0.0f;
+
+        drawCache.TextVertices.Resize(quadCount * 4);
+        TextVertexData* vertex = drawCache.TextVertices.Data();
+        for(uint32_t i = 0; i < quadCount; i++)
+        {
+            const TextGlyphQuad& quad = layout->Quads[i];
+            const Vec2 corners[4]     = { quad.PlaneMin, { quad.PlaneMax.x, quad.PlaneMin.y }, quad.PlaneMax, { quad.PlaneMin.x, quad.PlaneMax.y } };
+            const Vec2 uvs[4]         = { quad.UVMin, { quad.UVMax.x, quad.UVMin.y }, quad.UVMax, { quad.UVMin.x, quad.UVMax.y } };
+
+            for(uint32_t corner = 0; corner < 4; corner++)
+            {
+                vertex->vertex        = transform * Vec4(corners[corner].x, corners[corner].y, 0.0f, 1.0f);
+                vertex->colour        = colour;
+                vertex->uv            = uvs[corner];
+                vertex->tid           = Vec2(0.0f, outlineWidth);
+                vertex->outlineColour = outlineColour;
+                vertex++;
             }
         }
+    }
 
-        if(widget->flags & WidgetFlags_DrawBackground)
+    void SceneRenderer::draw_ui(UI_Widget* widget)
+    {
+        // Geometry is only rebuilt when the widget's layout, style or animation state changed
+        const float targetHeight = (float)m_MainTexture->GetHeight();
+        const u64 renderHash     = UIGetWidgetRenderHash(widget);
+
+        UIDrawCache& drawCache  = m_UIDrawCache[widget->hash];
+        drawCache.LastUsedFrame = GetUIState()->FrameIndex;
+
+        if(drawCache.RenderHash != renderHash || drawCache.TargetHeight != targetHeight)
         {
-            Vec2 border = widget->style_vars[StyleVar_Border].ToVector2();
-            Vec2 size   = widget->size - 2.0f * border;
-            Vec2 p      = widget->position + border + debugUIOffset; /* + size * 0.5f */
-            ;
-            // size *= 4.0f;
-            p.y = m_MainTexture->GetHeight() - p.y; //- size.y;
+            drawCache.RenderHash   = renderHash;
+            drawCache.TargetHeight = targetHeight;
+            BuildUIDrawCache(widget, drawCache);
+            m_Stats.UIWidgetsRebuilt++;
+        }
 
+        if(drawCache.QuadCount > 0)
+        {
             if(m_CurrentUIText)
             {
                 if(m_TextRendererData.m_IndexCount >= 0)
                 {
                     TextFlush(m_TextRendererData, TextVertexBufferBase, TextVertexBufferPtr);
-                    // BeginTextPass();
                 }
 
                 Begin2DPass();
             }
 
             m_CurrentUIText = false;
+
+            for(uint32_t quad = 0; quad < drawCache.QuadCount; quad++)
             {
                 m_Stats.NumRenderedObjects++;
 
@@ -2167,76 +2491,25 @@ namespace Lumos::Graphics
                     Renderer2DBeginBatch();
                 }
 
-                const Vec2 min = p; // - size * 0.5f;
-                Vec2 max;
-                max.x = min.x + size.x;
-                max.y = min.y - size.y;
-
-                const Vec4 colour = background_color;
-                const auto& uv    = Renderable2D::GetDefaultUVs();
-                Texture* texture  = widget->texture;
-
                 float textureSlot = 0.0f;
-                if(texture)
-                    textureSlot = SubmitTexture(texture);
-
-                Vec3 vertex                       = Vec4(min.x, min.y, 0.0f, 1.0f);
-                m_Renderer2DData.m_Buffer->vertex = vertex;
-                m_Renderer2DData.m_Buffer->uv.x   = uv[0].x;
-                m_Renderer2DData.m_Buffer->uv.y   = uv[0].y;
-                m_Renderer2DData.m_Buffer->tid    = Vec2(textureSlot, 0.0f);
-                m_Renderer2DData.m_Buffer->colour = colour;
-                m_Renderer2DData.m_Buffer++;
-
-                vertex                            = Vec4(min.x, max.y, 0.0f, 1.0f);
-                m_Renderer2DData.m_Buffer->vertex = vertex;
-                m_Renderer2DData.m_Buffer->uv.x   = uv[3].x;
-                m_Renderer2DData.m_Buffer->uv.y   = uv[3].y;
-                m_Renderer2DData.m_Buffer->tid    = Vec2(textureSlot, 0.0f);
-                m_Renderer2DData.m_Buffer->colour = colour;
-                m_Renderer2DData.m_Buffer++;
-
-                vertex                            = Vec4(max.x, max.y, 0.0f, 1.0f);
-                m_Renderer2DData.m_Buffer->vertex = vertex;
-                m_Renderer2DData.m_Buffer->uv.x   = uv[2].x;
-                m_Renderer2DData.m_Buffer->uv.y   = uv[2].y;
-                m_Renderer2DData.m_Buffer->tid    = Vec2(textureSlot, 0.0f);
-                m_Renderer2DData.m_Buffer->colour = colour;
-                m_Renderer2DData.m_Buffer++;
-
-                vertex                            = Vec4(max.x, min.y, 0.0f, 1.0f);
-                m_Renderer2DData.m_Buffer->vertex = vertex;
-                m_Renderer2DData.m_Buffer->uv.x   = uv[1].x;
-                m_Renderer2DData.m_Buffer->uv.y   = uv[1].y;
-                m_Renderer2DData.m_Buffer->tid    = Vec2(textureSlot, 0.0f);
-                m_Renderer2DData.m_Buffer->colour = colour;
-                m_Renderer2DData.m_Buffer++;
+                if(widget->texture)
+                    textureSlot = SubmitTexture(widget->texture);
+
+                MemoryCopy(m_Renderer2DData.m_Buffer, &drawCache.Quads[quad * 4], sizeof(VertexData) * 4);
+                if(textureSlot != 0.0f)
+                {
+                    for(uint32_t corner = 0; corner < 4; corner++)
+                        m_Renderer2DData.m_Buffer[corner].tid.x = textureSlot;
+                }
 
+                m_Renderer2DData.m_Buffer += 4;
                 m_Renderer2DData.m_IndexCount += 6;
             }
         }
 
-        if(widget->flags & WidgetFlags_DrawText)
+        uint32_t textQuadCount = (uint32_t)drawCache.TextVertices.Size() / 4;
+        if(textQuadCount > 0)
         {
-            Vec2 padding   = widget->style_vars[StyleVar_Padding].ToVector2();
-            float fontSize = widget->style_vars[StyleVar_FontSize].x;
-
-            Vec2 size = widget->size;
-            Vec2 p    = widget->position /* - size * 0.5f*/ + debugUIOffset;
-            // size *= 4.0f;
-
-            if(widget->TextAlignment & UI_Text_Alignment_Center_X)
-            {
-                p.y = m_MainTexture->GetHeight() - p.y;
-                p.y -= size.y - padding.y * 0.5f;
-                p.x += size.x * 0.5f + padding.x * 0.5f;
-            }
-            else
-            {
-                p.y = m_MainTexture->GetHeight() - p.y;
-                p.y -= size.y - padding.y * 0.5f;
-                p.x += padding.x * 0.5f;
-            }
             if(!m_CurrentUIText)
             {
                 if(m_Renderer2DData.m_IndexCount >= 0)
@@ -2247,138 +2520,42 @@ namespace Lumos::Graphics
             }
 
             m_CurrentUIText = true;
+            m_Stats.NumRenderedObjects++;
 
-            Vec2 pos = p; // - size * 0.5f;
+            if(m_TextRendererData.m_IndexCount + textQuadCount * 6 > m_TextRendererData.m_Limits.IndiciesSize)
             {
-                Mat4 transform = Mat4::Translation(Vec3(pos.x, pos.y, 0.0f)) * Mat4::Scale(Vec3(fontSize, fontSize, fontSize));
-                m_Stats.NumRenderedObjects++;
-
-                if(m_TextRendererData.m_IndexCount >= m_TextRendererData.m_Limits.IndiciesSize)
-                {
-                    TextFlush(m_TextRendererData, TextVertexBufferBase, TextVertexBufferPtr);
-                    BeginTextPass();
-                }
-
-                int textureIndex       = -1;
-                auto& string           = widget->text;
-                auto font              = Font::GetDefaultFont();
-                float lineHeightOffset = 0.0f;
-                float kerningOffset    = 0.0f;
-
-                float maxWidth     = 100.0f; // widget->size.x;// textComp.MaxWidth;
-                auto colour        = Vec4(1.0f);
-                float lineSpacing  = 0.0f;
-                float kerning      = 0.0f;
-                auto outlineColour = Vec4(1.0f);
-                auto outlineWidth  = 0.0f;
-
-                SharedPtr<Texture2D> fontAtlas = font->GetFontAtlas();
-                if(!fontAtlas)
-                    ASSERT(false);
-
-                for(uint32_t i = 0; i < m_TextRendererData.m_TextureCount; i++)
-                {
-                    if(m_TextRendererData.m_Textures[i] == fontAtlas.get())
-                    {
-                        textureIndex = int(i + 1);
-                        break;
-                    }
-                }
+                TextFlush(m_TextRendererData, TextVertexBufferBase, TextVertexBufferPtr);
+                BeginTextPass();
+            }
 
-                if(textureIndex == -1)
+            Texture* fontAtlas = Font::GetDefaultFont()->GetFontAtlas().get();
+            int textureIndex   = -1;
+            for(uint32_t i = 0; i < m_TextRendererData.m_TextureCount; i++)
+            {
+                if(m_TextRendererData.m_Textures[i] == fontAtlas)
                 {
-                    textureIndex                                                     = (int)m_TextRendererData.m_TextureCount + 1;
-                    m_TextRendererData.m_Textures[m_TextRendererData.m_TextureCount] = fontAtlas.get();
-                    m_TextRendererData.m_TextureCount++;
+                    textureIndex = int(i + 1);
+                    break;
                 }
+            }
 
-                auto& fontGeometry  = font->GetMSDFData()->FontGeometry;
-                const auto& metrics = fontGeometry.getMetrics();
-
-                {
-                    double x       = 0.0;
-                    double fsScale = 1 / (metrics.ascenderY - metrics.descenderY);
-                    double y       = 0.0;
-                    for(int i = 0; i < string.size; i++)
-                    {
-                        char32_t character = string.str[i];
-
-                        if(character == '\r')
-                            continue;
-
-                        if(character == '\n')
-                        {
-                            x = 0;
-                            y -= fsScale * metrics.lineHeight + lineHeightOffset;
-                            continue;
-                        }
-
-                        if(character == '\t')
-                        {
-                            auto glyph     = fontGeometry.getGlyph('a');
-                            double advance = glyph->getAdvance();
-                            x += 4 * fsScale * advance + kerningOffset;
-                            continue;
-                        }
-
-                        auto glyph = fontGeometry.getGlyph(character);
-                        if(!glyph)
-                            glyph = fontGeometry.getGlyph('?');
-                        if(!glyph)
-                            continue;
-
-                        double l, b, r, t;
-                        glyph->getQuadAtlasBounds(l, b, r, t);
-
-                        double pl, pb, pr, pt;
-                        glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-
-                        pl *= fsScale, pb *= fsScale, pr *= fsScale, pt *= fsScale;
-                        pl += x, pb += y, pr += x, pt += y;
-
-                        double texelWidth  = 1. / fontAtlas->GetWidth();
-                        double texelHeight = 1. / fontAtlas->GetHeight();
-                        l *= texelWidth, b *= texelHeight, r *= texelWidth, t *= texelHeight;
-
-                        {
-                            LUMOS_PROFILE_SCOPE("Set text buffer data");
-                            TextVertexBufferPtr->vertex        = transform * Vec4((float)pl, (float)pb, 0.0f, 1.0f);
-                            TextVertexBufferPtr->colour        = colour;
-                            TextVertexBufferPtr->uv            = { (float)l, (float)b };
-                            TextVertexBufferPtr->tid           = Vec2((float)textureIndex, outlineWidth);
-                            TextVertexBufferPtr->outlineColour = outlineColour;
-                            TextVertexBufferPtr++;
-
-                            TextVertexBufferPtr->vertex        = transform * Vec4((float)pr, (float)pb, 0.0f, 1.0f);
-                            TextVertexBufferPtr->colour        = colour;
-                            TextVertexBufferPtr->uv            = { (float)r, (float)b };
-                            TextVertexBufferPtr->tid           = Vec2((float)textureIndex, outlineWidth);
-                            TextVertexBufferPtr->outlineColour = outlineColour;
-                            TextVertexBufferPtr++;
-
-                            TextVertexBufferPtr->vertex        = transform * Vec4((float)pr, (float)pt, 0.0f, 1.0f);
-                            TextVertexBufferPtr->colour        = colour;
-                            TextVertexBufferPtr->uv            = { (float)r, (float)t };
-                            TextVertexBufferPtr->tid           = Vec2((float)textureIndex, outlineWidth);
-                            TextVertexBufferPtr->outlineColour = outlineColour;
-                            TextVertexBufferPtr++;
-
-                            TextVertexBufferPtr->vertex        = transform * Vec4((float)pl, (float)pt, 0.0f, 1.0f);
-                            TextVertexBufferPtr->colour        = colour;
-                            TextVertexBufferPtr->uv            = { (float)l, (float)t };
-                            TextVertexBufferPtr->tid           = Vec2((float)textureIndex, outlineWidth);
-                            TextVertexBufferPtr->outlineColour = outlineColour;
-                            TextVertexBufferPtr++;
-                        }
-
-                        m_TextRendererData.m_IndexCount += 6;
+            if(textureIndex == -1)
+            {
+                textureIndex                                                     = (int)m_TextRendererData.m_TextureCount + 1;
+                m_TextRendererData.m_Textures[m_TextRendererData.m_TextureCount] = fontAtlas;
+                m_TextRendererData.m_TextureCount++;
+            }
 
-                        double advance = glyph->getAdvance();
-                        fontGeometry.getAdvance(advance, character, string.str[i + 1]);
-                        x += fsScale * advance + kerningOffset;
-                    }
-                }
+            if(drawCache.TextTextureIndex != textureIndex)
+            {
+                drawCache.TextTextureIndex = textureIndex;
+                for(auto& vertex : drawCache.TextVertices)
+                    vertex.tid.x = (float)textureIndex;
             }
+
+            MemoryCopy(TextVertexBufferPtr, drawCache.TextVertices.Data(), sizeof(TextVertexData) * textQuadCount * 4);
+            TextVertexBufferPtr += textQuadCount * 4;
+            m_TextRendererData.m_IndexCount += textQuadCount * 6;
         }
 
         for(UI_Widget* child = widget->first;
@@ -2420,9 +2597,20 @@ namespace Lumos::Graphics
 
         m_CurrentUIText = true;
 
-        for(UI_Widget* Widget = &GetUIState()->root_parent; Widget; Widget = UIWidgetRecurseDepthFirstPreOrder(Widget))
+        // draw_ui recurses into children, so only the root is submitted here
+        draw_ui(&GetUIState()->root_parent);
+
+        // Drop cached geometry for widgets that no longer exist
+        UI_State* uiState = GetUIState();
+        if(m_UIDrawCache.Size() > uiState->widgets.Size() + 1)
         {
-            draw_ui(Widget);
+            for(auto it = m_UIDrawCache.begin(); it != m_UIDrawCache.end();)
+            {
+                if(it->Value.LastUsedFrame != uiState->FrameIndex)
+                    it = m_UIDrawCache.Remove(it);
+                else
+                    ++it;
+            }
         }
 
         if(m_CurrentUIText && m_TextRendererData.m_IndexCount > 0)
@@ -3426,7 +3614,10 @@ namespace Lumos::Graphics
 
         auto textGroup = m_CurrentScene->GetRegistry().group<TextComponent>(entt::get<Maths::Transform>);
         if(textGroup.size() == 0)
+        {
+            m_TextDrawCache.Clear();
             return;
+        }
 
         Graphics::PipelineDesc pipelineDesc;
         pipelineDesc.shader              = m_TextRendererData.m_Shader;
@@ -3461,33 +3652,30 @@ namespace Lumos::Graphics
         m_TextRendererData.m_DescriptorSet[m_TextRendererData.m_BatchDrawCallIndex][0]->Update();
 
         m_TextRendererData.m_TextureCount = 0;
+        const uint32_t textFrame          = m_TextLayoutCache.GetCurrentFrame();
+
         for(auto entity : textGroup)
         {
             const auto& [textComp, trans] = textGroup.get<TextComponent, Maths::Transform>(entity);
 
-            Mat4 transform = trans.GetWorldMatrix();
+            const Mat4& transform = trans.GetWorldMatrix();
             m_Stats.NumRenderedObjects++;
 
-            if(m_TextRendererData.m_IndexCount >= m_TextRendererData.m_Limits.IndiciesSize)
-                TextFlush(m_TextRendererData, TextVertexBufferBase, TextVertexBufferPtr);
-
-            int textureIndex       = -1;
-            auto& string           = textComp.TextString;
-            auto font              = textComp.FontHandle ? textComp.FontHandle : Font::GetDefaultFont();
-            float lineHeightOffset = 0.0f;
-            float kerningOffset    = 0.0f;
-
-            float maxWidth     = textComp.MaxWidth;
-            auto colour        = textComp.Colour;
-            float lineSpacing  = textComp.LineSpacing;
-            float kerning      = textComp.Kerning;
-            auto outlineColour = textComp.OutlineColour;
-            auto outlineWidth  = textComp.OutlineWidth;
+            int textureIndex = -1;
+            auto font        = textComp.FontHandle ? textComp.FontHandle : Font::GetDefaultFont();
 
             SharedPtr<Texture2D> fontAtlas = font->GetFontAtlas();
             if(!fontAtlas)
                 continue;
 
+            const TextLayout* layout = m_TextLayoutCache.GetLayout(font.get(), textComp.TextString, textComp.MaxWidth, textComp.LineSpacing, textComp.Kerning);
+            uint32_t quadCount       = Maths::Min((uint32_t)layout->Quads.Size(), m_TextRendererData.m_Limits.IndiciesSize / 6);
+            if(quadCount == 0)
+                continue;
+
+            if(m_TextRendererData.m_IndexCount + quadCount * 6 > m_TextRendererData.m_Limits.IndiciesSize)
+                TextFlush(m_TextRendererData, TextVertexBufferBase, TextVertexBufferPtr);
+
             for(uint32_t i = 0; i < m_TextRendererData.m_TextureCount; i++)
             {
                 if(m_TextRendererData.m_Textures[i] == fontAtlas.get())
@@ -3504,94 +3692,62 @@ namespace Lumos::Graphics
                 m_TextRendererData.m_TextureCount++;
             }
 
-            auto& fontGeometry  = font->GetMSDFData()->FontGeometry;
-            const auto& metrics = fontGeometry.getMetrics();
+            TextDrawCache& drawCache = m_TextDrawCache[(uint32_t)entity];
+            drawCache.LastUsedFrame  = textFrame;
 
+            bool upToDate = drawCache.LayoutID == layout->ID && drawCache.TextureIndex == textureIndex && drawCache.OutlineWidth == textComp.OutlineWidth
+                && drawCache.Colour == textComp.Colour && drawCache.OutlineColour == textComp.OutlineColour && drawCache.Transform == transform;
+
+            if(!upToDate)
             {
-                double x       = 0.0;
-                double fsScale = 1 / (metrics.ascenderY - metrics.descenderY);
-                double y       = 0.0;
-                for(int i = 0; i < string.size(); i++)
+                LUMOS_PROFILE_SCOPE("Set text buffer data");
+                drawCache.LayoutID      = layout->ID;
+                drawCache.TextureIndex  = textureIndex;
+                drawCache.OutlineWidth  = textComp.OutlineWidth;
+                drawCache.Colour        = textComp.Colour;
+                drawCache.OutlineColour = textComp.OutlineColour;
+                drawCache.Transform     = transform;
+                drawCache.Vertices.Resize(quadCount * 4);
+
+                const Vec2 tid         = Vec2((float)textureIndex, textComp.OutlineWidth);
+                TextVertexData* vertex = drawCache.Vertices.Data();
+                for(uint32_t i = 0; i < quadCount; i++)
                 {
-                    char32_t character = string[i];
-
-                    if(character == '\r')
-                        continue;
-
-                    if(character == '\n')
-                    {
-                        x = 0;
-                        y -= fsScale * metrics.lineHeight + lineHeightOffset;
-                        continue;
-                    }
-
-                    if(character == '\t')
-                    {
-                        auto glyph     = fontGeometry.getGlyph('a');
-                        double advance = glyph->getAdvance();
-                        x += 4 * fsScale * advance + kerningOffset;
-                        continue;
-                    }
-
-                    auto glyph = fontGeometry.getGlyph(character);
-                    if(!glyph)
-                        glyph = fontGeometry.getGlyph('?');
-                    if(!glyph)
-                        continue;
-
-                    double l, b, r, t;
-                    glyph->getQuadAtlasBounds(l, b, r, t);
-
-                    double pl, pb, pr, pt;
-                    glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-
-                    pl *= fsScale, pb *= fsScale, pr *= fsScale, pt *= fsScale;
-                    pl += x, pb += y, pr += x, pt += y;
-
-                    double texelWidth  = 1. / fontAtlas->GetWidth();
-                    double texelHeight = 1. / fontAtlas->GetHeight();
-                    l *= texelWidth, b *= texelHeight, r *= texelWidth, t *= texelHeight;
+                    const TextGlyphQuad& quad = layout->Quads[i];
+                    const Vec2 corners[4]     = { quad.PlaneMin, { quad.PlaneMax.x, quad.PlaneMin.y }, quad.PlaneMax, { quad.PlaneMin.x, quad.PlaneMax.y } };
+                    const Vec2 uvs[4]         = { quad.UVMin, { quad.UVMax.x, quad.UVMin.y }, quad.UVMax, { quad.UVMin.x, quad.UVMax.y } };
 
+                    for(uint32_t corner = 0; corner < 4; corner++)
                     {
-                        LUMOS_PROFILE_SCOPE("Set text buffer data");
-                        TextVertexBufferPtr->vertex        = transform * Vec4((float)pl, (float)pb, 0.0f, 1.0f);
-                        TextVertexBufferPtr->colour        = colour;
-                        TextVertexBufferPtr->uv            = { (float)l, (float)b };
-                        TextVertexBufferPtr->tid           = Vec2((float)textureIndex, outlineWidth);
-                        TextVertexBufferPtr->outlineColour = outlineColour;
-                        TextVertexBufferPtr++;
-
-                        TextVertexBufferPtr->vertex        = transform * Vec4((float)pr, (float)pb, 0.0f, 1.0f);
-                        TextVertexBufferPtr->colour        = colour;
-                        TextVertexBufferPtr->uv            = { (float)r, (float)b };
-                        TextVertexBufferPtr->tid           = Vec2((float)textureIndex, outlineWidth);
-                        TextVertexBufferPtr->outlineColour = outlineColour;
-                        TextVertexBufferPtr++;
-
-                        TextVertexBufferPtr->vertex        = transform * Vec4((float)pr, (float)pt, 0.0f, 1.0f);
-                        TextVertexBufferPtr->colour        = colour;
-                        TextVertexBufferPtr->uv            = { (float)r, (float)t };
-                        TextVertexBufferPtr->tid           = Vec2((float)textureIndex, outlineWidth);
-                        TextVertexBufferPtr->outlineColour = outlineColour;
-                        TextVertexBufferPtr++;
-
-                        TextVertexBufferPtr->vertex        = transform * Vec4((float)pl, (float)pt, 0.0f, 1.0f);
-                        TextVertexBufferPtr->colour        = colour;
-                        TextVertexBufferPtr->uv            = { (float)l, (float)t };
-                        TextVertexBufferPtr->tid           = Vec2((float)textureIndex, outlineWidth);
-                        TextVertexBufferPtr->outlineColour = outlineColour;
-                        TextVertexBufferPtr++;
+                        vertex->vertex        = transform * Vec4(corners[corner].x, corners[corner].y, 0.0f, 1.0f);
+                        vertex->colour        = textComp.Colour;
+                        vertex->uv            = uvs[corner];
+                        vertex->tid           = tid;
+                        vertex->outlineColour = textComp.OutlineColour;
+                        vertex++;
                     }
+                }
+            }
 
-                    m_TextRendererData.m_IndexCount += 6;
+            MemoryCopy(TextVertexBufferPtr, drawCache.Vertices.Data(), sizeof(TextVertexData) * quadCount * 4);
+            TextVertexBufferPtr += quadCount * 4;
+            m_TextRendererData.m_IndexCount += quadCount * 6;
+        }
 
-                    double advance = glyph->getAdvance();
-                    fontGeometry.getAdvance(advance, character, string[i + 1]);
-                    x += fsScale * advance + kerningOffset;
-                }
+        // Drop cached vertices for text entities that were not drawn this frame
+        if(m_TextDrawCache.Size() > textGroup.size())
+        {
+            for(auto it = m_TextDrawCache.begin(); it != m_TextDrawCache.end();)
+            {
+                if(it->Value.LastUsedFrame != textFrame)
+                    it = m_TextDrawCache.Remove(it);
+                else
+                    ++it;
             }
         }
 
+        m_TextLayoutCache.EndFrame();
+
         if(m_TextRendererData.m_IndexCount == 0)
         {
             // m_TextRendererData.m_VertexBuffers[currentFrame][m_TextRendererData.m_BatchDrawCallIndex]->ReleasePointer();
@@ -1,8 +1,14 @@
 #pragma once
 #include "Graphics/Renderers/IRenderer.h"
 #include "Graphics/Renderable2D.h"
+#include "Graphics/Renderers/LightClusterGrid.h"
+#include "Graphics/TextLayoutCache.h"
+#include "Core/Function.h"
+#include "Core/DataStructures/Map.h"
 
 #define MAX_BOUND_TEXTURES 16
+#define MAX_INSTANCES 256 // Must match Buffers.glslh
+#define PARALLEL_RECORDING_MIN_DRAWS 64 // Below this many draws per worker, recording inline is cheaper
 
 namespace Lumos
 {
@@ -61,9 +67,13 @@ namespace Lumos
         {
             uint32_t UpdatesPerSecond;
             uint32_t FramesPerSecond;
-            uint32_t NumRenderedObjects = 0;
-            uint32_t NumShadowObjects   = 0;
-            uint32_t NumDrawCalls       = 0;
+            uint32_t NumRenderedObjects  = 0;
+            uint32_t NumShadowObjects    = 0;
+            uint32_t NumDrawCalls        = 0;
+            uint32_t NumInstancedObjects = 0; // Objects drawn as part of a batch of two or more
+            uint32_t NumLights           = 0;
+            uint32_t NumClusterLightRefs = 0;
+            uint32_t UIWidgetsRebuilt    = 0;
         };
 
         class SceneRenderer
@@ -172,6 +182,7 @@ namespace Lumos
                 float m_InitialBias;
                 float CascadeFarPlaneOffset = 50.0f, CascadeNearPlaneOffset = -50.0f;
                 CommandQueue m_CascadeCommandQueue[SHADOWMAP_MAX];
+                InstancedDrawQueue m_CascadeDrawQueue[SHADOWMAP_MAX];
 
                 TextureDepthArray* m_ShadowTex;
                 uint32_t m_ShadowMapNum;
@@ -203,8 +214,10 @@ namespace Lumos
                 Texture* m_IrradianceMap  = nullptr;
 
                 CommandQueue m_CommandQueue;
+                InstancedDrawQueue m_DrawQueue;
 
                 TDArray<SharedPtr<Graphics::DescriptorSet>> m_DescriptorSet;
+                SharedPtr<Graphics::DescriptorSet> m_DefaultInstanceSet; // Identity instance transform for unbatched draws
 
                 SharedPtr<Shader> m_Shader     = nullptr;
                 SharedPtr<Shader> m_AnimShader = nullptr;
@@ -212,6 +225,7 @@ namespace Lumos
                 TextureDepth* m_DepthTexture   = nullptr;
 
                 Maths::Frustum m_Frustum;
+                LightClusterGrid m_LightClusterGrid;
 
                 uint32_t m_RenderMode      = 0;
                 uint32_t m_CurrentBufferID = 0;
@@ -292,6 +306,19 @@ namespace Lumos
             void Init2DRenderData();
             bool m_2DRenderDataInitialised = false;
 
+            // Groups commands into instanced draws. Draws keep the order of their first command
+            void BuildInstancedDraws(const CommandQueue& commands, InstancedDrawQueue& outDraws, bool keepBlendedOrder);
+            Graphics::DescriptorSet* GetInstanceDescriptorSet();
+
+            // Records draws [0, drawCount) on JobSystem workers into secondary command buffers that continue the
+            // pipelines' render pass, then executes them in order. Returns false if the draws should be recorded inline
+            bool RecordDrawsParallel(Graphics::Pipeline** pipelines, uint32_t drawCount, uint32_t layer, const Function<void(Graphics::CommandBuffer*, uint32_t, uint32_t)>& recordDraws);
+            bool m_ParallelRecording = true;
+
+            // Instance transform sets, reused every frame
+            TDArray<SharedPtr<Graphics::DescriptorSet>> m_InstanceDescriptorSets;
+            uint32_t m_InstanceDescriptorSetsUsed = 0;
+
             Texture2D* m_MainTexture         = nullptr;
             Texture2D* m_ResolveTexture      = nullptr;
             Texture2D* m_LastRenderTarget    = nullptr;
@@ -314,6 +341,39 @@ namespace Lumos
 
             TextVertexData* TextVertexBufferPtr = nullptr;
 
+            // World space glyph vertices per text entity, reused while layout, transform and style are unchanged
+            struct TextDrawCache
+            {
+                TDArray<TextVertexData> Vertices;
+                Mat4 Transform;
+                Vec4 Colour;
+                Vec4 OutlineColour;
+                uint64_t LayoutID      = 0;
+                float OutlineWidth     = 0.0f;
+                int TextureIndex       = -1;
+                uint32_t LastUsedFrame = 0;
+            };
+
+            TextLayoutCache m_TextLayoutCache;
+            FlatHashMap<uint32_t, TextDrawCache> m_TextDrawCache;
+
+            // Screen space border, background and glyph vertices per UI widget, keyed by widget hash.
+            // Rebuilt when the widget's render hash or the target height changes
+            struct UIDrawCache
+            {
+                VertexData Quads[8];
+                TDArray<TextVertexData> TextVertices;
+                uint64_t RenderHash    = 0;
+                uint64_t LastUsedFrame = 0;
+                float TargetHeight     = 0.0f;
+                uint32_t QuadCount     = 0;
+                int TextTextureIndex   = 0;
+            };
+
+            void BuildUIDrawCache(UI_Widget* widget, UIDrawCache& drawCache);
+
+            FlatHashMap<uint64_t, UIDrawCache> m_UIDrawCache;
+
             // Vertex data per frame in flight, per batch
             TDArray<TDArray<VertexData*>> m_ParticleBufferBase;
             TDArray<TDArray<VertexData*>> m_2DBufferBase;
@@ -31,6 +31,12 @@ namespace Lumos
         uint32_t* indices    = new uint32_t[numIndices];
         m_BoundingBox        = {};
 
+        m_Width     = width;
+        m_Depth     = height;
+        m_CellWidth = xRand;
+        m_CellDepth = zRand;
+        m_Heights.Resize(numVertices);
+
         for(int x = 0; x < width; ++x)
         {
             for(int z = 0; z < height; ++z)
@@ -46,6 +52,8 @@ namespace Lumos
                     (static_cast<float>(z) + (static_cast<float>(zCoord) * float(width))) * zRand);
 
                 texCoords[offset] = Vec2(x * texRandX, z * texRandZ);
+
+                m_Heights[x * height + z] = vertices[offset].y;
             }
         }
 
@@ -7,5 +7,19 @@ namespace Lumos
     {
     public:
         Terrain(int width = 500, int height = 500, int lowside = 50, int lowscale = 10, float xRand = 1.0f, float yRand = 150.0f, float zRand = 1.0f, float texRandX = 1.0f / 16.0f, float texRandZ = 1.0f / 16.0f);
+
+        // Height of every vertex, indexed [x * depth + z], kept for HeightFieldCollisionShape
+        const TDArray<float>& GetHeights() const { return m_Heights; }
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetDepth() const { return m_Depth; }
+        float GetCellWidth() const { return m_CellWidth; }
+        float GetCellDepth() const { return m_CellDepth; }
+
+    private:
+        TDArray<float> m_Heights;
+        uint32_t m_Width  = 0;
+        uint32_t m_Depth  = 0;
+        float m_CellWidth = 1.0f;
+        float m_CellDepth = 1.0f;
     };
 }
@@ -0,0 +1,126 @@
+#include "Precompiled.h"
+#include "TextLayoutCache.h"
+#include "Font.h"
+#include "MSDFData.h"
+#include "RHI/Texture.h"
+#include "Utilities/CombineHash.h"
+
+namespace Lumos::Graphics
+{
+    const TextLayout* TextLayoutCache::GetLayout(Font* font, const std::string& text, float maxWidth, float lineSpacing, float kerning)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        uint64_t hash = 0;
+        HashCombine(hash, (void*)font, text, maxWidth, lineSpacing, kerning);
+
+        Entry& entry = m_Layouts[hash];
+        if(entry.Layout.ID == 0 || entry.FontHandle != font || entry.MaxWidth != maxWidth || entry.LineSpacing != lineSpacing || entry.Kerning != kerning || entry.Text != text)
+        {
+            // New entry, or a hash collision which just replaces the old layout
+            entry.FontHandle  = font;
+            entry.Text        = text;
+            entry.MaxWidth    = maxWidth;
+            entry.LineSpacing = lineSpacing;
+            entry.Kerning     = kerning;
+            BuildLayout(entry);
+        }
+
+        entry.LastUsedFrame = m_Frame;
+        return &entry.Layout;
+    }
+
+    void TextLayoutCache::BuildLayout(Entry& entry)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        entry.Layout.Quads.Clear();
+        entry.Layout.ID = m_NextLayoutID++;
+
+        SharedPtr<Texture2D> fontAtlas = entry.FontHandle->GetFontAtlas();
+        if(!fontAtlas)
+            return;
+
+        auto& fontGeometry     = entry.FontHandle->GetMSDFData()->FontGeometry;
+        const auto& metrics    = fontGeometry.getMetrics();
+        const auto& string     = entry.Text;
+        float lineHeightOffset = 0.0f;
+        float kerningOffset    = 0.0f;
+
+        double x           = 0.0;
+        double fsScale     = 1 / (metrics.ascenderY - metrics.descenderY);
+        double y           = 0.0;
+        double texelWidth  = 1. / fontAtlas->GetWidth();
+        double texelHeight = 1. / fontAtlas->GetHeight();
+
+        for(int i = 0; i < string.size(); i++)
+        {
+            char32_t character = string[i];
+
+            if(character == '\r')
+                continue;
+
+            if(character == '\n')
+            {
+                x = 0;
+                y -= fsScale * metrics.lineHeight + lineHeightOffset;
+                continue;
+            }
+
+            if(character == '\t')
+            {
+                auto glyph     = fontGeometry.getGlyph('a');
+                double advance = glyph->getAdvance();
+                x += 4 * fsScale * advance + kerningOffset;
+                continue;
+            }
+
+            auto glyph = fontGeometry.getGlyph(character);
+            if(!glyph)
+                glyph = fontGeometry.getGlyph('?');
+            if(!glyph)
+                continue;
+
+            double l, b, r, t;
+            glyph->getQuadAtlasBounds(l, b, r, t);
+
+            double pl, pb, pr, pt;
+            glyph->getQuadPlaneBounds(pl, pb, pr, pt);
+
+            pl *= fsScale, pb *= fsScale, pr *= fsScale, pt *= fsScale;
+            pl += x, pb += y, pr += x, pt += y;
+            l *= texelWidth, b *= texelHeight, r *= texelWidth, t *= texelHeight;
+
+            TextGlyphQuad& quad = entry.Layout.Quads.EmplaceBack();
+            quad.PlaneMin       = { (float)pl, (float)pb };
+            quad.PlaneMax       = { (float)pr, (float)pt };
+            quad.UVMin          = { (float)l, (float)b };
+            quad.UVMax          = { (float)r, (float)t };
+
+            double advance = glyph->getAdvance();
+            fontGeometry.getAdvance(advance, character, string[i + 1]);
+            x += fsScale * advance + kerningOffset;
+        }
+    }
+
+    void TextLayoutCache::EndFrame(uint32_t maxUnusedFrames)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        m_Frame++;
+
+        // Only sweep occasionally, most frames request the same set of layouts
+        if(m_Frame % maxUnusedFrames != 0)
+            return;
+
+        for(auto it = m_Layouts.begin(); it != m_Layouts.end();)
+        {
+            if(m_Frame - it->Value.LastUsedFrame > maxUnusedFrames)
+                it = m_Layouts.Remove(it);
+            else
+                ++it;
+        }
+    }
+
+    void TextLayoutCache::Clear()
+    {
+        m_Layouts.Clear();
+    }
+}
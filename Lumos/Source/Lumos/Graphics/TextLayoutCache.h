@@ -0,0 +1,63 @@
+#pragma once
+#include "Core/DataStructures/TDArray.h"
+#include "Maths/Vector2.h"
+#include "Core/DataStructures/Map.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        class Font;
+
+        // Glyph quad in text local space with its atlas uvs
+        struct TextGlyphQuad
+        {
+            Vec2 PlaneMin;
+            Vec2 PlaneMax;
+            Vec2 UVMin;
+            Vec2 UVMax;
+        };
+
+        struct TextLayout
+        {
+            TDArray<TextGlyphQuad> Quads;
+            uint64_t ID = 0; // Unique per built layout, lets users detect a rebuild
+        };
+
+        // Glyph layouts keyed by font, string and layout settings.
+        // Layouts are only rebuilt when one of those changes and are dropped after going unused for a while.
+        class LUMOS_EXPORT TextLayoutCache
+        {
+        public:
+            TextLayoutCache()  = default;
+            ~TextLayoutCache() = default;
+
+            // Valid until the next GetLayout call, which may add an entry and rehash
+            const TextLayout* GetLayout(Font* font, const std::string& text, float maxWidth, float lineSpacing, float kerning);
+
+            void EndFrame(uint32_t maxUnusedFrames = 120);
+            void Clear();
+
+            uint32_t GetCurrentFrame() const { return m_Frame; }
+            uint32_t GetLayoutCount() const { return m_Layouts.Size(); }
+
+        private:
+            struct Entry
+            {
+                TextLayout Layout;
+                std::string Text;
+                Font* FontHandle       = nullptr;
+                float MaxWidth         = 0.0f;
+                float LineSpacing      = 0.0f;
+                float Kerning          = 0.0f;
+                uint32_t LastUsedFrame = 0;
+            };
+
+            void BuildLayout(Entry& entry);
+
+            FlatHashMap<uint64_t, Entry> m_Layouts;
+            uint64_t m_NextLayoutID = 1;
+            uint32_t m_Frame        = 0;
+        };
+    }
+}
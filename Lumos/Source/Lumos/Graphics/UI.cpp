@@ -4,6 +4,7 @@
 #include "Font.h"
 #include "Maths/MathsUtilities.h"
 #include "Utilities/StringUtilities.h"
+#include "Utilities/Hash.h"
 #include "Graphics/RHI/Texture.h"
 #include "Core/Application.h"
 #include "Core/OS/Window.h"
@@ -25,6 +26,7 @@ namespace Lumos
         s_UIState->next_hot_widget = 0;
         s_UIState->FrameIndex      = 0;
         s_UIState->AnimationRate   = 10.0f;
+        s_UIState->LayoutAll       = true;
 
         s_UIState->UIArena      = arena;
         s_UIState->UIFrameArena = ArenaAlloc(Megabytes(1));
@@ -166,16 +168,19 @@ namespace Lumos
     {
         UI_Widget* parent = GetCurrentParent();
 
+        bool added        = false;
         UI_Widget* widget = nullptr;
-        HashMapFind(&s_UIState->widgets, hash, &widget);
-        if(!widget)
+        UI_Widget*& slot  = s_UIState->widgets.GetOrAdd(hash, &added);
+        if(added)
         {
             void* mem                = s_UIState->WidgetAllocator->Allocate();
             widget                   = new(mem) UI_Widget();
             widget->HotTransition    = 0.0f;
             widget->ActiveTransition = 0.0f;
-            HashMapInsert(&s_UIState->widgets, hash, widget);
+            slot                     = widget;
         }
+        else
+            widget = slot;
 
         widget->parent               = parent;
         widget->flags                = flags;
@@ -190,6 +195,10 @@ namespace Lumos
         widget->next  = NULL;
         widget->prev  = NULL;
 
+        widget->PrevChildHash = widget->ChildHash;
+        widget->ChildHash     = 0;
+        parent->ChildHash     = MurmurHash64A(&hash, sizeof(u64), parent->ChildHash);
+
         widget->semantic_size[UIAxis_X] = semantic_size_x;
         widget->semantic_size[UIAxis_Y] = semantic_size_y;
 
@@ -267,10 +276,47 @@ namespace Lumos
         root_parent->last                         = NULL;
         root_parent->next                         = NULL;
         root_parent->prev                         = NULL;
+        root_parent->PrevChildHash                = root_parent->ChildHash;
+        root_parent->ChildHash                    = 0;
+
+        if(frame_buffer_size != s_UIState->LastLayoutSize)
+            s_UIState->LayoutAll = true;
 
         PushParent(root_parent);
     }
 
+    static u64 HashWidgetLayout(UI_Widget* widget)
+    {
+        u64 hash = MurmurHash64A(widget->semantic_size, sizeof(widget->semantic_size), widget->flags);
+        hash     = MurmurHash64A(&widget->style_vars[StyleVar_Padding], sizeof(Vec4), hash);
+        hash     = MurmurHash64A(&widget->style_vars[StyleVar_Border], sizeof(Vec4), hash);
+        hash     = MurmurHash64A(&widget->style_vars[StyleVar_FontSize], sizeof(Vec4), hash);
+        hash     = MurmurHash64A(&widget->texture, sizeof(Graphics::Texture2D*), hash);
+        hash     = MurmurHash64A(&widget->TextAlignment, sizeof(UITextAlignment), hash);
+        if(widget->text.size)
+            hash = MurmurHash64A(widget->text.str, (int)widget->text.size, hash);
+
+        // Only floating widgets own their relative position, the layout writes it for the rest
+        if(widget->flags & WidgetFlags_Floating_X)
+            hash = MurmurHash64A(&widget->relative_position.x, sizeof(f32), hash);
+        if(widget->flags & WidgetFlags_Floating_Y)
+            hash = MurmurHash64A(&widget->relative_position.y, sizeof(f32), hash);
+
+        return hash;
+    }
+
+    static u64 HashWidgetStyle(UI_Widget* widget)
+    {
+        return MurmurHash64A(&widget->style_vars[StyleVar_BorderColor], sizeof(Vec4) * (StyleVar_ActiveTextColor - StyleVar_BorderColor + 1), 0);
+    }
+
+    static void MarkLayoutDirty(UI_Widget* widget)
+    {
+        // Ancestors are always marked along with a widget, so stop at the first one already dirty
+        for(UI_Widget* w = widget; w && !w->LayoutDirty; w = w->parent)
+            w->LayoutDirty = true;
+    }
+
     void UIEndFrame(Graphics::Font* font)
     {
         LUMOS_PROFILE_FUNCTION();
@@ -352,7 +398,7 @@ namespace Lumos
                     s_UIState->active_widget = s_UIState->hot_widget;
                     s_UIState->hot_widget    = 0;
 
-                    HashMapFind(&s_UIState->widgets, s_UIState->active_widget, &s_UIState->active_widget_state);
+                    s_UIState->widgets.Find(s_UIState->active_widget, s_UIState->active_widget_state);
 
                     if(s_UIState->active_widget_state)
                         s_UIState->active_widget_state->clicked = true;
@@ -360,11 +406,11 @@ namespace Lumos
             }
         }
 
-        TDArray<UI_Widget*> lWidgetsToDelete(s_UIState->UIFrameArena);
-        ForHashMapEach(u64, UI_Widget*, &s_UIState->widgets, it)
+        // Erasing never moves other entries, so stale widgets are removed while iterating
+        for(auto it = s_UIState->widgets.begin(); it != s_UIState->widgets.end();)
         {
-            u64 key          = *it.key;
-            UI_Widget* value = *it.value;
+            u64 key          = it->Key;
+            UI_Widget* value = it->Value;
 
             if(key == s_UIState->hot_widget || key == s_UIState->active_widget)
             {
@@ -384,15 +430,26 @@ namespace Lumos
 
             if(value->LastFrameIndexActive < s_UIState->FrameIndex)
             {
-                lWidgetsToDelete.PushBack(value);
+                s_UIState->WidgetAllocator->Deallocate(value);
+                it = s_UIState->widgets.Remove(it);
+            }
+            else
+            {
+                // Hashed here rather than in PushWidget as widgets are still modified after being pushed
+                u64 layoutHash   = HashWidgetLayout(value);
+                value->StyleHash = HashWidgetStyle(value);
+                if(layoutHash != value->LayoutHash || value->ChildHash != value->PrevChildHash)
+                {
+                    value->LayoutHash = layoutHash;
+                    MarkLayoutDirty(value);
+                }
+                ++it;
             }
         }
 
-        for(auto widget : lWidgetsToDelete)
-        {
-            HashMapRemove(&s_UIState->widgets, widget->hash);
-            s_UIState->WidgetAllocator->Deallocate(widget);
-        }
+        UI_Widget* root_parent = &s_UIState->root_parent;
+        if(root_parent->ChildHash != root_parent->PrevChildHash)
+            root_parent->LayoutDirty = true;
     }
 
     String8 HandleUIString(const char* str, u64* out_hash)
@@ -658,7 +715,7 @@ namespace Lumos
         return Graphics::Font::GetDefaultFont()->CalculateTextSize(text, size); // sizeVec;
     }
 
-    UI_Widget* UIWidgetRecurseDepthFirstPreOrder(UI_Widget* Node)
+    UI_Widget* UIWidgetRecurseDepthFirstPreOrder(UI_Widget* Node, UI_Widget* Root)
     {
         UI_Widget* Next = NULL;
 
@@ -668,7 +725,7 @@ namespace Lumos
         }
         else
         {
-            for(UI_Widget* Parent = Node; Parent != 0; Parent = Parent->parent)
+            for(UI_Widget* Parent = Node; Parent != 0 && Parent != Root; Parent = Parent->parent)
             {
                 if(Parent->next)
                 {
@@ -681,7 +738,7 @@ namespace Lumos
         return Next;
     }
 
-    UI_Widget* UIWidgetRecurseDepthFirstPostOrder(UI_Widget* Node)
+    UI_Widget* UIWidgetRecurseDepthFirstPostOrder(UI_Widget* Node, UI_Widget* Root)
     {
         UI_Widget* Next = 0;
 
@@ -691,7 +748,7 @@ namespace Lumos
         }
         else
         {
-            for(UI_Widget* P = Node; P != 0; P = P->parent)
+            for(UI_Widget* P = Node; P != 0 && P != Root; P = P->parent)
             {
                 if(P->prev != 0)
                 {
@@ -706,7 +763,7 @@ namespace Lumos
 
     void UILayoutSolveStandaloneSizes(UI_Widget* Root, UIAxis Axis)
     {
-        for(UI_Widget* Widget = Root; Widget; Widget = UIWidgetRecurseDepthFirstPreOrder(Widget))
+        for(UI_Widget* Widget = Root; Widget; Widget = UIWidgetRecurseDepthFirstPreOrder(Widget, Root))
         {
             UI_Size* Size  = &Widget->semantic_size[Axis];
             float fontSize = Widget->style_vars[StyleVar_FontSize].x;
@@ -747,7 +804,7 @@ namespace Lumos
 
     void UILayoutSolveUpwardsSizes(UI_Widget* Root, UIAxis Axis)
     {
-        for(UI_Widget* Widget = Root; Widget; Widget = UIWidgetRecurseDepthFirstPreOrder(Widget))
+        for(UI_Widget* Widget = Root; Widget; Widget = UIWidgetRecurseDepthFirstPreOrder(Widget, Root))
         {
             UI_Size* Size = &Widget->semantic_size[Axis];
 
@@ -764,7 +821,7 @@ namespace Lumos
 
     void UILayoutSolveDownwardsSizes(UI_Widget* Root, UIAxis Axis)
     {
-        for(UI_Widget* Widget = Root; Widget; Widget = UIWidgetRecurseDepthFirstPostOrder(Widget))
+        for(UI_Widget* Widget = Root; Widget; Widget = UIWidgetRecurseDepthFirstPostOrder(Widget, Root))
         {
             UI_Size* Size = &Widget->semantic_size[Axis];
 
@@ -819,65 +876,70 @@ namespace Lumos
         }
     }
 
-    void UILayoutFinalisePositions(UI_Widget* Root, UIAxis Axis)
+    static void UILayoutFinaliseChildPositions(UI_Widget* Parent, UIAxis Axis)
     {
-        for(UI_Widget* Parent = Root; Parent != 0; Parent = UIWidgetRecurseDepthFirstPreOrder(Parent))
+        f32 LayoutPosition = 0;
+        for(UI_Widget* Child = Parent->first; Child != 0; Child = Child->next)
         {
-            f32 LayoutPosition = 0;
-            for(UI_Widget* Child = Parent->first; Child != 0; Child = Child->next)
+            if(Axis == UIAxis_X && !(Child->flags & WidgetFlags_Floating_X))
             {
-                if(Axis == UIAxis_X && !(Child->flags & WidgetFlags_Floating_X))
+                float xOffset = 0;
+                if(Child->flags & WidgetFlags_CentreX)
                 {
-                    float xOffset = 0;
-                    if(Child->flags & WidgetFlags_CentreX)
-                    {
-                        xOffset = Parent->size[Axis] * 0.5f - Child->size[Axis] * 0.5f;
-                    }
+                    xOffset = Parent->size[Axis] * 0.5f - Child->size[Axis] * 0.5f;
+                }
 
-                    Child->relative_position[Axis] = LayoutPosition + xOffset;
+                Child->relative_position[Axis] = LayoutPosition + xOffset;
 
-                    LayoutPosition += (Parent->flags & WidgetFlags_StackHorizontally ? 1 : 0) * (Child->size[Axis] + xOffset);
-                }
-                if(Axis == UIAxis_Y && !(Child->flags & WidgetFlags_Floating_Y))
+                LayoutPosition += (Parent->flags & WidgetFlags_StackHorizontally ? 1 : 0) * (Child->size[Axis] + xOffset);
+            }
+            if(Axis == UIAxis_Y && !(Child->flags & WidgetFlags_Floating_Y))
+            {
+                float yOffset = 0;
+                if(Child->flags & WidgetFlags_CentreY)
                 {
-                    float yOffset = 0;
-                    if(Child->flags & WidgetFlags_CentreY)
-                    {
-                        yOffset = Parent->size[Axis] * 0.5f - Child->size[Axis] * 0.5f;
-                    }
-
-                    Child->relative_position[Axis] = LayoutPosition + yOffset;
-                    LayoutPosition += /*(Axis == Parent->LayoutingAxis)*/ (Parent->flags & WidgetFlags_StackVertically ? 1 : 0) * (Child->size[Axis] + yOffset);
+                    yOffset = Parent->size[Axis] * 0.5f - Child->size[Axis] * 0.5f;
                 }
 
-                Vec2 padding = Child->style_vars[StyleVar_Padding].ToVector2();
+                Child->relative_position[Axis] = LayoutPosition + yOffset;
+                LayoutPosition += /*(Axis == Parent->LayoutingAxis)*/ (Parent->flags & WidgetFlags_StackVertically ? 1 : 0) * (Child->size[Axis] + yOffset);
+            }
 
-                if(Axis == UIAxis_X)
-                {
-                    f32 X = 0.0f;
-                    // if (Parent->flags & UI_WidgetFlag_ViewScroll)
-                    // {
-                    //     X = Parent->ViewOffset[UIAxis_X];
-                    // }
-
-                    Child->position.x = Parent->position.x + Child->relative_position[Axis] - X + padding.x;
-                    // Child->position.Width = Child->size[Axis];
-                }
-                else if(Axis == UIAxis_Y)
-                {
-                    f32 Y = 0.0f;
-                    // if (Parent->flags & UI_WidgetFlag_ViewScroll)
-                    // {
-                    //     Y = Parent->ViewOffset[UIAxis_Y];
-                    // }
-
-                    Child->position.y = Parent->position.y + Child->relative_position[Axis] - Y + padding.y;
-                    // Child->position.Height = Child->size[Axis];
-                }
+            Vec2 padding = Child->style_vars[StyleVar_Padding].ToVector2();
+
+            if(Axis == UIAxis_X)
+            {
+                f32 X = 0.0f;
+                // if (Parent->flags & UI_WidgetFlag_ViewScroll)
+                // {
+                //     X = Parent->ViewOffset[UIAxis_X];
+                // }
+
+                Child->position.x = Parent->position.x + Child->relative_position[Axis] - X + padding.x;
+                // Child->position.Width = Child->size[Axis];
+            }
+            else if(Axis == UIAxis_Y)
+            {
+                f32 Y = 0.0f;
+                // if (Parent->flags & UI_WidgetFlag_ViewScroll)
+                // {
+                //     Y = Parent->ViewOffset[UIAxis_Y];
+                // }
+
+                Child->position.y = Parent->position.y + Child->relative_position[Axis] - Y + padding.y;
+                // Child->position.Height = Child->size[Axis];
             }
         }
     }
 
+    void UILayoutFinalisePositions(UI_Widget* Root, UIAxis Axis)
+    {
+        for(UI_Widget* Parent = Root; Parent != 0; Parent = UIWidgetRecurseDepthFirstPreOrder(Parent, Root))
+        {
+            UILayoutFinaliseChildPositions(Parent, Axis);
+        }
+    }
+
     void UIBeginBuild()
     {
     }
@@ -886,7 +948,7 @@ namespace Lumos
     {
     }
 
-    void UILayoutRoot(UI_Widget* Root)
+    static void UILayoutSolveSizes(UI_Widget* Root)
     {
         for(UIAxis Axis = (UIAxis)0; Axis < UIAxis_Count; Axis = (UIAxis)(Axis + 1))
         {
@@ -894,6 +956,24 @@ namespace Lumos
             UILayoutSolveDownwardsSizes(Root, Axis);
             UILayoutSolveUpwardsSizes(Root, Axis);
         }
+    }
+
+    // Clears the dirty flags of a laid out subtree, returning its widget count
+    static u32 UILayoutClearDirty(UI_Widget* Root)
+    {
+        u32 count = 0;
+        for(UI_Widget* Widget = Root; Widget; Widget = UIWidgetRecurseDepthFirstPreOrder(Widget, Root))
+        {
+            Widget->LayoutDirty = false;
+            count++;
+        }
+
+        return count;
+    }
+
+    void UILayoutRoot(UI_Widget* Root)
+    {
+        UILayoutSolveSizes(Root);
 
         for(UIAxis Axis = (UIAxis)0; Axis < UIAxis_Count; Axis = (UIAxis)(Axis + 1))
         {
@@ -905,7 +985,68 @@ namespace Lumos
     {
         LUMOS_PROFILE_FUNCTION();
         UI_Widget* Root = &s_UIState->root_parent;
-        UILayoutRoot(Root);
+
+        s_UIState->LaidOutWidgetCount = 0;
+        s_UIState->DirtyTopLevelCount = 0;
+
+        if(s_UIState->LayoutAll)
+        {
+            UILayoutRoot(Root);
+            s_UIState->LaidOutWidgetCount = UILayoutClearDirty(Root);
+            s_UIState->LastLayoutSize     = Root->size;
+            s_UIState->LayoutAll          = false;
+            return;
+        }
+
+        if(!Root->LayoutDirty)
+            return;
+
+        // Sizes only depend on the widget's own subtree and the root size, so top level
+        // subtrees that did not change keep last frame's layout
+        for(UI_Widget* Child = Root->first; Child; Child = Child->next)
+        {
+            if(Child->LayoutDirty)
+            {
+                UILayoutSolveSizes(Child);
+                s_UIState->DirtyTopLevelCount++;
+            }
+        }
+
+        u32 childCount = 0;
+        for(UI_Widget* Child = Root->first; Child; Child = Child->next)
+            childCount++;
+
+        Vec2* previousPositions = PushArrayNoZero(s_UIState->UIFrameArena, Vec2, childCount);
+        u32 childIndex          = 0;
+        for(UI_Widget* Child = Root->first; Child; Child = Child->next)
+            previousPositions[childIndex++] = Child->position;
+
+        for(UIAxis Axis = (UIAxis)0; Axis < UIAxis_Count; Axis = (UIAxis)(Axis + 1))
+            UILayoutFinaliseChildPositions(Root, Axis);
+
+        // Position the inside of every subtree that changed or was moved by a sibling
+        childIndex = 0;
+        for(UI_Widget* Child = Root->first; Child; Child = Child->next)
+        {
+            if(Child->LayoutDirty || Child->position != previousPositions[childIndex])
+            {
+                for(UIAxis Axis = (UIAxis)0; Axis < UIAxis_Count; Axis = (UIAxis)(Axis + 1))
+                    UILayoutFinalisePositions(Child, Axis);
+
+                s_UIState->LaidOutWidgetCount += UILayoutClearDirty(Child);
+            }
+            childIndex++;
+        }
+
+        Root->LayoutDirty = false;
+    }
+
+    u64 UIGetWidgetRenderHash(UI_Widget* widget)
+    {
+        f32 state[6] = { widget->position.x, widget->position.y, widget->size.x, widget->size.y, widget->HotTransition, widget->ActiveTransition };
+
+        u64 hash = MurmurHash64A(state, sizeof(state), widget->LayoutHash);
+        return MurmurHash64A(&widget->StyleHash, sizeof(u64), hash);
     }
 
     void UIAnimate()
@@ -914,15 +1055,13 @@ namespace Lumos
 
     void RefreshUI()
     {
-        ForHashMapEach(u64, UI_Widget*, &s_UIState->widgets, it)
+        for(auto& widget : s_UIState->widgets)
         {
-            u64 key          = *it.key;
-            UI_Widget* value = *it.value;
-
-            s_UIState->WidgetAllocator->Deallocate(value);
+            s_UIState->WidgetAllocator->Deallocate(widget.Value);
         }
 
-        HashMapClear(&s_UIState->widgets);
+        s_UIState->widgets.Clear();
+        s_UIState->LayoutAll = true;
 
         s_UIState->root_parent.first = NULL;
         s_UIState->root_parent.last  = NULL;
@@ -979,6 +1118,10 @@ namespace Lumos
 
         if(ImGui::Begin("UI Debug"))
         {
+            ImGui::Text("Widgets : %u", (u32)s_UIState->widgets.Size());
+            ImGui::Text("Laid out last frame : %u", s_UIState->LaidOutWidgetCount);
+            ImGui::Text("Dirty top level widgets : %u", s_UIState->DirtyTopLevelCount);
+
             drawHierarchy(&GetUIState()->root_parent);
 
             if(ImGui::TreeNode("Default Style"))
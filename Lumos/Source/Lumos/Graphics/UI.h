@@ -116,6 +116,13 @@ namespace Lumos
         f32 ActiveTransition;
 
         u64 LastFrameIndexActive;
+
+        // Retained between frames so unchanged subtrees skip layout and geometry rebuilds
+        u64 LayoutHash;    // Everything that affects the size of this widget and the layout of its children
+        u64 StyleHash;     // Colours, only affect drawing
+        u64 ChildHash;     // Children pushed this frame, in order
+        u64 PrevChildHash; // Children pushed last frame
+        bool LayoutDirty;  // This widget or a descendant changed since the last layout
     };
 
     struct UI_Interaction
@@ -152,7 +159,7 @@ namespace Lumos
 
         UI_Widget root_parent;
         TDArray<UI_Widget*> parents;
-        HashMap(u64, UI_Widget*) widgets;
+        FlatHashMap<u64, UI_Widget*> widgets;
 
         Style_Variable_List style_variable_lists[StyleVar_Count];
 
@@ -166,6 +173,11 @@ namespace Lumos
         u64 FrameIndex;
         f32 AnimationRate = 10.0f;
         f32 AnimationRateDT = 10.0f;
+
+        bool LayoutAll;             // Lay out every widget next frame, set on start up, refresh and resize
+        Vec2 LastLayoutSize;
+        u32 LaidOutWidgetCount;     // Widgets laid out by the last UILayout
+        u32 DirtyTopLevelCount;     // Top level subtrees that changed last frame
     };
 
     UI_State* GetUIState();
@@ -210,9 +222,13 @@ namespace Lumos
     void UILayout();
     void UIAnimate();
 
+    // Hash of everything that affects how a widget is drawn, valid after UILayout
+    u64 UIGetWidgetRenderHash(UI_Widget* widget);
+
     // Layout
-    UI_Widget* UIWidgetRecurseDepthFirstPreOrder(UI_Widget* Node);
-    UI_Widget* UIWidgetRecurseDepthFirstPostOrder(UI_Widget* Node);
+    // With a Root the traversal stays inside that subtree, otherwise it walks on to the rest of the tree
+    UI_Widget* UIWidgetRecurseDepthFirstPreOrder(UI_Widget* Node, UI_Widget* Root = nullptr);
+    UI_Widget* UIWidgetRecurseDepthFirstPostOrder(UI_Widget* Node, UI_Widget* Root = nullptr);
 
     void UILayoutSolveStandaloneSizes(UI_Widget* Root, UIAxis Axis);
     void UILayoutSolveUpwardsSizes(UI_Widget* Root, UIAxis Axis);
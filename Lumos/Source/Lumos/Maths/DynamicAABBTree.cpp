@@ -0,0 +1,296 @@
+#include "Precompiled.h"
+#include "DynamicAABBTree.h"
+#include "Maths/MathsUtilities.h"
+
+namespace Lumos
+{
+    namespace Maths
+    {
+        static float SurfaceArea(const BoundingBox& box)
+        {
+            Vec3 size = box.m_Max - box.m_Min;
+            return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
+        static BoundingBox Union(const BoundingBox& a, const BoundingBox& b)
+        {
+            return BoundingBox(Vec3(Maths::Min(a.m_Min.x, b.m_Min.x), Maths::Min(a.m_Min.y, b.m_Min.y), Maths::Min(a.m_Min.z, b.m_Min.z)),
+                               Vec3(Maths::Max(a.m_Max.x, b.m_Max.x), Maths::Max(a.m_Max.y, b.m_Max.y), Maths::Max(a.m_Max.z, b.m_Max.z)));
+        }
+
+        static bool Contains(const BoundingBox& outer, const BoundingBox& inner)
+        {
+            return outer.m_Min.x <= inner.m_Min.x && outer.m_Min.y <= inner.m_Min.y && outer.m_Min.z <= inner.m_Min.z && inner.m_Max.x <= outer.m_Max.x && inner.m_Max.y <= outer.m_Max.y && inner.m_Max.z <= outer.m_Max.z;
+        }
+
+        DynamicAABBTree::DynamicAABBTree(float margin)
+            : m_Margin(margin)
+        {
+        }
+
+        bool DynamicAABBTree::RayIntersectsBox(const Vec3& origin, const Vec3& inverseDirection, const BoundingBox& box, float maxDistance, float& outDistance)
+        {
+            float tMin = 0.0f;
+            float tMax = maxDistance;
+
+            for(int axis = 0; axis < 3; axis++)
+            {
+                float t1    = (box.m_Min[axis] - origin[axis]) * inverseDirection[axis];
+                float t2    = (box.m_Max[axis] - origin[axis]) * inverseDirection[axis];
+                float tNear = t1 < t2 ? t1 : t2;
+                float tFar  = t1 < t2 ? t2 : t1;
+
+                // Written so a NaN, from a zero direction with the origin on the slab plane, fails the comparison and is ignored
+                if(tNear > tMin)
+                    tMin = tNear;
+                if(tFar < tMax)
+                    tMax = tFar;
+            }
+
+            outDistance = tMin;
+            return tMin <= tMax;
+        }
+
+        int32_t DynamicAABBTree::AllocateNode()
+        {
+            if(m_FreeList == NullNode)
+            {
+                m_Nodes.EmplaceBack();
+                m_Nodes.Back().Parent = NullNode;
+                m_FreeList            = (int32_t)m_Nodes.Size() - 1;
+            }
+
+            int32_t index = m_FreeList;
+            Node& node    = m_Nodes[index];
+            m_FreeList    = node.Parent;
+            node.Parent   = NullNode;
+            node.Child1   = NullNode;
+            node.Child2   = NullNode;
+            node.Height   = 0;
+            node.UserData = 0;
+            return index;
+        }
+
+        void DynamicAABBTree::FreeNode(int32_t node)
+        {
+            m_Nodes[node].Parent = m_FreeList;
+            m_Nodes[node].Height = -1;
+            m_FreeList           = node;
+        }
+
+        int32_t DynamicAABBTree::CreateProxy(const BoundingBox& box, uint32_t userData)
+        {
+            int32_t proxy           = AllocateNode();
+            Vec3 margin             = Vec3(m_Margin);
+            m_Nodes[proxy].Box      = BoundingBox(box.m_Min - margin, box.m_Max + margin);
+            m_Nodes[proxy].UserData = userData;
+
+            InsertLeaf(proxy);
+            m_ProxyCount++;
+            return proxy;
+        }
+
+        void DynamicAABBTree::DestroyProxy(int32_t proxy)
+        {
+            ASSERT(m_Nodes[proxy].IsLeaf(), "Destroying a node that isn't a proxy");
+            RemoveLeaf(proxy);
+            FreeNode(proxy);
+            m_ProxyCount--;
+        }
+
+        bool DynamicAABBTree::MoveProxy(int32_t proxy, const BoundingBox& box)
+        {
+            if(Contains(m_Nodes[proxy].Box, box))
+                return false;
+
+            RemoveLeaf(proxy);
+
+            Vec3 margin        = Vec3(m_Margin);
+            m_Nodes[proxy].Box = BoundingBox(box.m_Min - margin, box.m_Max + margin);
+
+            InsertLeaf(proxy);
+            return true;
+        }
+
+        void DynamicAABBTree::Clear()
+        {
+            m_Nodes.Clear();
+            m_Root       = NullNode;
+            m_FreeList   = NullNode;
+            m_ProxyCount = 0;
+        }
+
+        void DynamicAABBTree::InsertLeaf(int32_t leaf)
+        {
+            if(m_Root == NullNode)
+            {
+                m_Root               = leaf;
+                m_Nodes[leaf].Parent = NullNode;
+                return;
+            }
+
+            // Walk down to the sibling that adds the least surface area
+            BoundingBox leafBox = m_Nodes[leaf].Box;
+            int32_t index       = m_Root;
+            while(!m_Nodes[index].IsLeaf())
+            {
+                const Node& node = m_Nodes[index];
+                float area       = SurfaceArea(node.Box);
+                float combined   = SurfaceArea(Union(node.Box, leafBox));
+
+                // Cost of making a new parent for this node and the leaf, and the minimum cost pushed down to the children
+                float cost            = 2.0f * combined;
+                float inheritanceCost = 2.0f * (combined - area);
+
+                auto childCost = [&](int32_t child)
+                {
+                    float unionArea = SurfaceArea(Union(m_Nodes[child].Box, leafBox));
+                    if(m_Nodes[child].IsLeaf())
+                        return unionArea + inheritanceCost;
+                    return unionArea - SurfaceArea(m_Nodes[child].Box) + inheritanceCost;
+                };
+
+                float cost1 = childCost(node.Child1);
+                float cost2 = childCost(node.Child2);
+
+                if(cost < cost1 && cost < cost2)
+                    break;
+
+                index = cost1 < cost2 ? node.Child1 : node.Child2;
+            }
+
+            int32_t sibling   = index;
+            int32_t oldParent = m_Nodes[sibling].Parent;
+            int32_t newParent = AllocateNode();
+
+            Node& parent  = m_Nodes[newParent];
+            parent.Parent = oldParent;
+            parent.Box    = Union(leafBox, m_Nodes[sibling].Box);
+            parent.Height = m_Nodes[sibling].Height + 1;
+            parent.Child1 = sibling;
+            parent.Child2 = leaf;
+
+            if(oldParent != NullNode)
+            {
+                if(m_Nodes[oldParent].Child1 == sibling)
+                    m_Nodes[oldParent].Child1 = newParent;
+                else
+                    m_Nodes[oldParent].Child2 = newParent;
+            }
+            else
+                m_Root = newParent;
+
+            m_Nodes[sibling].Parent = newParent;
+            m_Nodes[leaf].Parent    = newParent;
+
+            // Refit and rebalance the ancestors
+            index = m_Nodes[leaf].Parent;
+            while(index != NullNode)
+            {
+                index = Balance(index);
+
+                Node& node  = m_Nodes[index];
+                node.Height = 1 + Maths::Max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+                node.Box    = Union(m_Nodes[node.Child1].Box, m_Nodes[node.Child2].Box);
+
+                index = node.Parent;
+            }
+        }
+
+        void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+        {
+            if(leaf == m_Root)
+            {
+                m_Root = NullNode;
+                return;
+            }
+
+            int32_t parent      = m_Nodes[leaf].Parent;
+            int32_t grandParent = m_Nodes[parent].Parent;
+            int32_t sibling     = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+            if(grandParent == NullNode)
+            {
+                m_Root                  = sibling;
+                m_Nodes[sibling].Parent = NullNode;
+                FreeNode(parent);
+                return;
+            }
+
+            // Replace the parent with the sibling
+            if(m_Nodes[grandParent].Child1 == parent)
+                m_Nodes[grandParent].Child1 = sibling;
+            else
+                m_Nodes[grandParent].Child2 = sibling;
+            m_Nodes[sibling].Parent = grandParent;
+            FreeNode(parent);
+
+            int32_t index = grandParent;
+            while(index != NullNode)
+            {
+                index = Balance(index);
+
+                Node& node  = m_Nodes[index];
+                node.Height = 1 + Maths::Max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+                node.Box    = Union(m_Nodes[node.Child1].Box, m_Nodes[node.Child2].Box);
+
+                index = node.Parent;
+            }
+        }
+
+        // Rotates the taller child up if the subtree at a is out of balance. Returns the new root of the subtree
+        int32_t DynamicAABBTree::Balance(int32_t a)
+        {
+            Node& nodeA = m_Nodes[a];
+            if(nodeA.IsLeaf() || nodeA.Height < 2)
+                return a;
+
+            int32_t b     = nodeA.Child1;
+            int32_t c     = nodeA.Child2;
+            int32_t delta = m_Nodes[c].Height - m_Nodes[b].Height;
+
+            if(delta >= -1 && delta <= 1)
+                return a;
+
+            // The taller child is promoted, its taller child stays with it and the shorter one moves under a
+            int32_t up   = delta > 1 ? c : b;
+            int32_t down = delta > 1 ? b : c;
+
+            Node& nodeUp = m_Nodes[up];
+            int32_t f    = nodeUp.Child1;
+            int32_t g    = nodeUp.Child2;
+
+            nodeUp.Child1 = a;
+            nodeUp.Parent = nodeA.Parent;
+            nodeA.Parent  = up;
+
+            if(nodeUp.Parent != NullNode)
+            {
+                if(m_Nodes[nodeUp.Parent].Child1 == a)
+                    m_Nodes[nodeUp.Parent].Child1 = up;
+                else
+                    m_Nodes[nodeUp.Parent].Child2 = up;
+            }
+            else
+                m_Root = up;
+
+            int32_t keep  = m_Nodes[f].Height > m_Nodes[g].Height ? f : g;
+            int32_t moved = keep == f ? g : f;
+
+            nodeUp.Child2         = keep;
+            m_Nodes[moved].Parent = a;
+
+            if(delta > 1)
+                nodeA.Child2 = moved;
+            else
+                nodeA.Child1 = moved;
+
+            nodeA.Box     = Union(m_Nodes[down].Box, m_Nodes[moved].Box);
+            nodeA.Height  = 1 + Maths::Max(m_Nodes[down].Height, m_Nodes[moved].Height);
+            nodeUp.Box    = Union(nodeA.Box, m_Nodes[keep].Box);
+            nodeUp.Height = 1 + Maths::Max(nodeA.Height, m_Nodes[keep].Height);
+
+            return up;
+        }
+    }
+}
@@ -0,0 +1,216 @@
+#pragma once
+#include "Maths/BoundingBox.h"
+#include "Maths/Ray.h"
+#include "Core/DataStructures/TDArray.h"
+
+namespace Lumos
+{
+    namespace Maths
+    {
+        // Bounding volume hierarchy that is updated in place as proxies are added, moved and removed.
+        // Leaves keep a box fattened by a margin, so a proxy that moves inside it doesn't change the tree.
+        // Inserts pick the sibling with the lowest surface area cost and the tree is rebalanced on the way up.
+        class LUMOS_EXPORT DynamicAABBTree
+        {
+        public:
+            static const int32_t NullNode  = -1;
+            static const int32_t StackSize = 256;
+
+            explicit DynamicAABBTree(float margin = 0.1f);
+            ~DynamicAABBTree() = default;
+
+            int32_t CreateProxy(const BoundingBox& box, uint32_t userData);
+            void DestroyProxy(int32_t proxy);
+
+            // Returns true if the box left the fattened box and the proxy was reinserted
+            bool MoveProxy(int32_t proxy, const BoundingBox& box);
+            void Clear();
+
+            uint32_t GetUserData(int32_t proxy) const { return m_Nodes[proxy].UserData; }
+            void SetUserData(int32_t proxy, uint32_t userData) { m_Nodes[proxy].UserData = userData; }
+            const BoundingBox& GetFatBox(int32_t proxy) const { return m_Nodes[proxy].Box; }
+
+            uint32_t GetProxyCount() const { return m_ProxyCount; }
+            int32_t GetHeight() const { return m_Root == NullNode ? 0 : m_Nodes[m_Root].Height; }
+
+            // callback(userData) returns false to stop the query
+            template <typename Callback>
+            void QueryBox(const BoundingBox& box, Callback&& callback) const;
+
+            template <typename Callback>
+            void QuerySphere(const Vec3& centre, float radius, Callback&& callback) const;
+
+            // callback(userData, maxDistance) is called for every leaf the ray enters before maxDistance and returns
+            // the distance to clip the rest of the query to. Return the closest hit so far to find the nearest proxy,
+            // the distance passed in to visit every proxy, or a negative value to stop
+            template <typename Callback>
+            void QueryRay(const Ray& ray, float maxDistance, Callback&& callback) const;
+
+            // Entry distance of the ray in the box, false if it misses or enters after maxDistance
+            static bool RayIntersectsBox(const Vec3& origin, const Vec3& inverseDirection, const BoundingBox& box, float maxDistance, float& outDistance);
+
+        private:
+            struct Node
+            {
+                BoundingBox Box;
+                int32_t Parent; // Next free node when unused
+                int32_t Child1;
+                int32_t Child2;
+                int32_t Height; // -1 when unused
+                uint32_t UserData;
+
+                bool IsLeaf() const { return Child1 == NullNode; }
+            };
+
+            int32_t AllocateNode();
+            void FreeNode(int32_t node);
+            void InsertLeaf(int32_t leaf);
+            void RemoveLeaf(int32_t leaf);
+            int32_t Balance(int32_t node);
+
+            TDArray<Node> m_Nodes;
+            int32_t m_Root        = NullNode;
+            int32_t m_FreeList    = NullNode;
+            uint32_t m_ProxyCount = 0;
+            float m_Margin;
+        };
+
+        template <typename Callback>
+        void DynamicAABBTree::QueryBox(const BoundingBox& box, Callback&& callback) const
+        {
+            if(m_Root == NullNode)
+                return;
+
+            int32_t stack[StackSize];
+            int32_t count  = 0;
+            stack[count++] = m_Root;
+
+            while(count > 0)
+            {
+                const Node& node = m_Nodes[stack[--count]];
+                if(!node.Box.IsInsideFast(box))
+                    continue;
+
+                if(node.IsLeaf())
+                {
+                    if(!callback(node.UserData))
+                        return;
+                }
+                else
+                {
+                    ASSERT(count + 2 <= StackSize, "DynamicAABBTree stack overflow");
+                    stack[count++] = node.Child1;
+                    stack[count++] = node.Child2;
+                }
+            }
+        }
+
+        template <typename Callback>
+        void DynamicAABBTree::QuerySphere(const Vec3& centre, float radius, Callback&& callback) const
+        {
+            if(m_Root == NullNode)
+                return;
+
+            float radiusSquared = radius * radius;
+            int32_t stack[StackSize];
+            int32_t count  = 0;
+            stack[count++] = m_Root;
+
+            while(count > 0)
+            {
+                const Node& node = m_Nodes[stack[--count]];
+
+                // Squared distance from the centre to the closest point of the box
+                float distanceSquared = 0.0f;
+                for(int axis = 0; axis < 3; axis++)
+                {
+                    float value = centre[axis];
+                    if(value < node.Box.m_Min[axis])
+                        distanceSquared += (node.Box.m_Min[axis] - value) * (node.Box.m_Min[axis] - value);
+                    else if(value > node.Box.m_Max[axis])
+                        distanceSquared += (value - node.Box.m_Max[axis]) * (value - node.Box.m_Max[axis]);
+                }
+
+                if(distanceSquared > radiusSquared)
+                    continue;
+
+                if(node.IsLeaf())
+                {
+                    if(!callback(node.UserData))
+                        return;
+                }
+                else
+                {
+                    ASSERT(count + 2 <= StackSize, "DynamicAABBTree stack overflow");
+                    stack[count++] = node.Child1;
+                    stack[count++] = node.Child2;
+                }
+            }
+        }
+
+        template <typename Callback>
+        void DynamicAABBTree::QueryRay(const Ray& ray, float maxDistance, Callback&& callback) const
+        {
+            if(m_Root == NullNode)
+                return;
+
+            Vec3 inverseDirection(1.0f / ray.Direction.x, 1.0f / ray.Direction.y, 1.0f / ray.Direction.z);
+
+            struct Entry
+            {
+                int32_t Index;
+                float Distance;
+            };
+
+            Entry stack[StackSize];
+            int32_t count = 0;
+            float entry;
+            if(!RayIntersectsBox(ray.Origin, inverseDirection, m_Nodes[m_Root].Box, maxDistance, entry))
+                return;
+            stack[count++] = { m_Root, entry };
+
+            while(count > 0)
+            {
+                Entry current = stack[--count];
+
+                // Pushed before maxDistance was clipped by a closer hit
+                if(current.Distance > maxDistance)
+                    continue;
+
+                const Node& node = m_Nodes[current.Index];
+                if(node.IsLeaf())
+                {
+                    maxDistance = callback(node.UserData, maxDistance);
+                    if(maxDistance < 0.0f)
+                        return;
+                    continue;
+                }
+
+                float distance1, distance2;
+                bool hit1 = RayIntersectsBox(ray.Origin, inverseDirection, m_Nodes[node.Child1].Box, maxDistance, distance1);
+                bool hit2 = RayIntersectsBox(ray.Origin, inverseDirection, m_Nodes[node.Child2].Box, maxDistance, distance2);
+
+                ASSERT(count + 2 <= StackSize, "DynamicAABBTree stack overflow");
+
+                // Push the far child first so the near one is visited first and clips the far one
+                if(hit1 && hit2)
+                {
+                    if(distance1 <= distance2)
+                    {
+                        stack[count++] = { node.Child2, distance2 };
+                        stack[count++] = { node.Child1, distance1 };
+                    }
+                    else
+                    {
+                        stack[count++] = { node.Child1, distance1 };
+                        stack[count++] = { node.Child2, distance2 };
+                    }
+                }
+                else if(hit1)
+                    stack[count++] = { node.Child1, distance1 };
+                else if(hit2)
+                    stack[count++] = { node.Child2, distance2 };
+            }
+        }
+    }
+}
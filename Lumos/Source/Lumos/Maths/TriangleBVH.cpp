@@ -0,0 +1,255 @@
+#include "Precompiled.h"
+#include "TriangleBVH.h"
+#include "Maths/DynamicAABBTree.h"
+#include "Maths/Ray.h"
+#include "Maths/MathsUtilities.h"
+
+#include <algorithm>
+
+namespace Lumos
+{
+    namespace Maths
+    {
+        static bool RayIntersectsTriangle(const Ray& ray, const Vec3& a, const Vec3& b, const Vec3& c, float& t)
+        {
+            const float epsilon = 1e-8f;
+
+            Vec3 edge1 = b - a;
+            Vec3 edge2 = c - a;
+            Vec3 p     = Maths::Cross(ray.Direction, edge2);
+            float det  = Maths::Dot(edge1, p);
+
+            if(det > -epsilon && det < epsilon)
+                return false;
+
+            float invDet = 1.0f / det;
+            Vec3 s       = ray.Origin - a;
+            float u      = Maths::Dot(s, p) * invDet;
+            if(u < 0.0f || u > 1.0f)
+                return false;
+
+            Vec3 q  = Maths::Cross(s, edge1);
+            float v = Maths::Dot(ray.Direction, q) * invDet;
+            if(v < 0.0f || u + v > 1.0f)
+                return false;
+
+            t = Maths::Dot(edge2, q) * invDet;
+            return t >= 0.0f;
+        }
+
+        void TriangleBVH::Build(const void* positions, uint32_t stride, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            Clear();
+
+            uint32_t triangleCount = indexCount / 3;
+            if(triangleCount == 0 || vertexCount == 0)
+                return;
+
+            m_Positions.Resize(vertexCount);
+            for(uint32_t i = 0; i < vertexCount; i++)
+                m_Positions[i] = *(const Vec3*)((const uint8_t*)positions + (size_t)i * stride);
+
+            m_Indices.Resize(triangleCount * 3);
+            memcpy(m_Indices.Data(), indices, sizeof(uint32_t) * triangleCount * 3);
+
+            TDArray<uint32_t> triangles(triangleCount);
+            TDArray<Vec3> centroids(triangleCount);
+            for(uint32_t i = 0; i < triangleCount; i++)
+            {
+                triangles[i] = i;
+                centroids[i] = (m_Positions[indices[i * 3]] + m_Positions[indices[i * 3 + 1]] + m_Positions[indices[i * 3 + 2]]) / 3.0f;
+            }
+
+            // Median splits leave at least two triangles in a leaf, so there are fewer nodes than triangles
+            m_Nodes.Reserve(triangleCount);
+            m_Nodes.EmplaceBack();
+            BuildNode(0, triangles.Data(), centroids.Data(), 0, triangleCount);
+
+            // Store the triangles in leaf order so each leaf reads a contiguous range
+            TDArray<uint32_t> sorted(triangleCount * 3);
+            for(uint32_t i = 0; i < triangleCount; i++)
+            {
+                sorted[i * 3]     = m_Indices[triangles[i] * 3];
+                sorted[i * 3 + 1] = m_Indices[triangles[i] * 3 + 1];
+                sorted[i * 3 + 2] = m_Indices[triangles[i] * 3 + 2];
+            }
+            m_Indices = std::move(sorted);
+        }
+
+        void TriangleBVH::BuildNode(uint32_t nodeIndex, uint32_t* triangles, const Vec3* centroids, uint32_t start, uint32_t count)
+        {
+            BoundingBox box;
+            BoundingBox centroidBox;
+
+            for(uint32_t i = start; i < start + count; i++)
+            {
+                uint32_t triangle = triangles[i];
+                centroidBox.Merge(centroids[triangle]);
+                box.Merge(m_Positions[m_Indices[triangle * 3]]);
+                box.Merge(m_Positions[m_Indices[triangle * 3 + 1]]);
+                box.Merge(m_Positions[m_Indices[triangle * 3 + 2]]);
+            }
+
+            m_Nodes[nodeIndex].Box = box;
+
+            if(count <= MaxLeafTriangles)
+            {
+                m_Nodes[nodeIndex].Start = start;
+                m_Nodes[nodeIndex].Count = count;
+                return;
+            }
+
+            // Median split on the longest axis of the centroids
+            Vec3 extents = centroidBox.m_Max - centroidBox.m_Min;
+            int axis     = 0;
+            if(extents.y > extents[axis])
+                axis = 1;
+            if(extents.z > extents[axis])
+                axis = 2;
+
+            uint32_t half = count / 2;
+            std::nth_element(triangles + start, triangles + start + half, triangles + start + count, [centroids, axis](uint32_t a, uint32_t b)
+                             { return centroids[a][axis] < centroids[b][axis]; });
+
+            uint32_t left = (uint32_t)m_Nodes.Size();
+            m_Nodes.EmplaceBack();
+            BuildNode(left, triangles, centroids, start, half);
+
+            uint32_t right = (uint32_t)m_Nodes.Size();
+            m_Nodes.EmplaceBack();
+            BuildNode(right, triangles, centroids, start + half, count - half);
+
+            m_Nodes[nodeIndex].Start = right;
+            m_Nodes[nodeIndex].Count = 0;
+        }
+
+        bool TriangleBVH::Raycast(const Ray& ray, float maxDistance, float& outDistance, uint32_t* outTriangle) const
+        {
+            if(m_Nodes.Empty())
+                return false;
+
+            Vec3 inverseDirection(1.0f / ray.Direction.x, 1.0f / ray.Direction.y, 1.0f / ray.Direction.z);
+
+            struct Entry
+            {
+                uint32_t Index;
+                float Distance;
+            };
+
+            Entry stack[64];
+            int32_t count            = 0;
+            bool hit                 = false;
+            float closest            = maxDistance;
+            float entry              = 0.0f;
+            uint32_t closestTriangle = 0;
+
+            if(!DynamicAABBTree::RayIntersectsBox(ray.Origin, inverseDirection, m_Nodes[0].Box, closest, entry))
+                return false;
+            stack[count++] = { 0, entry };
+
+            while(count > 0)
+            {
+                Entry current = stack[--count];
+                if(current.Distance > closest)
+                    continue;
+
+                const Node& node = m_Nodes[current.Index];
+                if(node.Count > 0)
+                {
+                    for(uint32_t i = node.Start; i < node.Start + node.Count; i++)
+                    {
+                        float t;
+                        if(RayIntersectsTriangle(ray, m_Positions[m_Indices[i * 3]], m_Positions[m_Indices[i * 3 + 1]], m_Positions[m_Indices[i * 3 + 2]], t) && t < closest)
+                        {
+                            closest         = t;
+                            closestTriangle = i;
+                            hit             = true;
+                        }
+                    }
+                    continue;
+                }
+
+                uint32_t child1 = current.Index + 1;
+                uint32_t child2 = node.Start;
+                float distance1, distance2;
+                bool hit1 = DynamicAABBTree::RayIntersectsBox(ray.Origin, inverseDirection, m_Nodes[child1].Box, closest, distance1);
+                bool hit2 = DynamicAABBTree::RayIntersectsBox(ray.Origin, inverseDirection, m_Nodes[child2].Box, closest, distance2);
+
+                // Median splits keep the depth near log2 of the leaf count, well inside the stack
+                ASSERT(count + 2 <= 64, "TriangleBVH stack overflow");
+
+                if(hit1 && hit2)
+                {
+                    if(distance1 <= distance2)
+                    {
+                        stack[count++] = { child2, distance2 };
+                        stack[count++] = { child1, distance1 };
+                    }
+                    else
+                    {
+                        stack[count++] = { child1, distance1 };
+                        stack[count++] = { child2, distance2 };
+                    }
+                }
+                else if(hit1)
+                    stack[count++] = { child1, distance1 };
+                else if(hit2)
+                    stack[count++] = { child2, distance2 };
+            }
+
+            if(!hit)
+                return false;
+
+            outDistance = closest;
+            if(outTriangle)
+                *outTriangle = closestTriangle;
+            return true;
+        }
+
+        void TriangleBVH::QueryBox(const BoundingBox& box, TDArray<Vec3>& outTriangles) const
+        {
+            if(m_Nodes.Empty() || !m_Nodes[0].Box.IsInsideFast(box))
+                return;
+
+            uint32_t stack[64];
+            int32_t count  = 0;
+            stack[count++] = 0;
+
+            while(count > 0)
+            {
+                const uint32_t index = stack[--count];
+                const Node& node     = m_Nodes[index];
+                if(node.Count > 0)
+                {
+                    for(uint32_t i = node.Start; i < node.Start + node.Count; i++)
+                    {
+                        outTriangles.PushBack(m_Positions[m_Indices[i * 3]]);
+                        outTriangles.PushBack(m_Positions[m_Indices[i * 3 + 1]]);
+                        outTriangles.PushBack(m_Positions[m_Indices[i * 3 + 2]]);
+                    }
+                    continue;
+                }
+
+                ASSERT(count + 2 <= 64, "TriangleBVH stack overflow");
+
+                if(m_Nodes[index + 1].Box.IsInsideFast(box))
+                    stack[count++] = index + 1;
+                if(m_Nodes[node.Start].Box.IsInsideFast(box))
+                    stack[count++] = node.Start;
+            }
+        }
+
+        size_t TriangleBVH::GetMemoryUsage() const
+        {
+            return m_Positions.Size() * sizeof(Vec3) + m_Indices.Size() * sizeof(uint32_t) + m_Nodes.Size() * sizeof(Node);
+        }
+
+        void TriangleBVH::Clear()
+        {
+            m_Positions.Clear();
+            m_Indices.Clear();
+            m_Nodes.Clear();
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "Maths/BoundingBox.h"
+#include "Core/DataStructures/TDArray.h"
+
+namespace Lumos
+{
+    namespace Maths
+    {
+        class Ray;
+
+        // Static BVH over the triangles of a mesh, in the mesh's local space.
+        // Keeps its own copy of the positions so exact ray hits don't need the GPU buffers.
+        class LUMOS_EXPORT TriangleBVH
+        {
+        public:
+            static const uint32_t MaxLeafTriangles = 4;
+
+            // positions is read with a stride, so it can point at the Position of the first vertex of an interleaved array
+            void Build(const void* positions, uint32_t stride, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+            void Clear();
+
+            // Closest hit on either side of a triangle. The distance is in units of ray.Direction
+            bool Raycast(const Ray& ray, float maxDistance, float& outDistance, uint32_t* outTriangle = nullptr) const;
+
+            // Appends the three vertices of every triangle in a leaf whose bounds overlap box. Leaves are small,
+            // so this can include a few triangles just outside the box
+            void QueryBox(const BoundingBox& box, TDArray<Vec3>& outTriangles) const;
+
+            // Indices are in leaf order, building from them gives the same tree
+            const TDArray<Vec3>& GetPositions() const { return m_Positions; }
+            const TDArray<uint32_t>& GetIndices() const { return m_Indices; }
+
+            bool Empty() const { return m_Nodes.Empty(); }
+            uint32_t GetTriangleCount() const { return (uint32_t)m_Indices.Size() / 3; }
+            const BoundingBox& GetBoundingBox() const { return m_Nodes[0].Box; }
+            size_t GetMemoryUsage() const;
+
+        private:
+            struct Node
+            {
+                BoundingBox Box;
+                uint32_t Start; // First triangle for leaves, second child for internal nodes (the first is the next node)
+                uint32_t Count; // 0 for internal nodes
+            };
+
+            void BuildNode(uint32_t nodeIndex, uint32_t* triangles, const Vec3* centroids, uint32_t start, uint32_t count);
+
+            TDArray<Vec3> m_Positions;
+            TDArray<uint32_t> m_Indices;
+            TDArray<Node> m_Nodes;
+        };
+    }
+}
@@ -10,6 +10,8 @@
 #include "Maths/Transform.h"
 #include "Maths/MathsUtilities.h"
 #include "B2DebugDraw.h"
+#include "Core/JobSystem.h"
+#include "Scripting/Lua/LuaManager.h"
 
 #include <box2d/box2d.h>
 
@@ -18,16 +20,45 @@
 
 namespace Lumos
 {
+    // Tasks in flight during a step: one per solver worker plus a few others
+    static constexpr uint32_t MaxB2PhysicsTasks = 128;
+
+    struct B2PhysicsTask
+    {
+        System::JobSystem::Context Context;
+        b2TaskCallback* Callback = nullptr;
+        void* TaskContext        = nullptr;
+        int ItemCount            = 0;
+        int RangeSize            = 0;
+    };
+
     B2PhysicsEngine::B2PhysicsEngine()
         : m_UpdateTimestep(1.0f / 60.f)
         , m_Paused(false)
     {
         m_DebugName = "Box2D Physics Engine";
 
+        // Contact callbacks can call into lua
+        Writes<RigidBody2DComponent>();
+        WritesResource<LuaManager>();
+
+        // Job index is used as the Box2D worker index, so a task is never split into more jobs than workers
+        m_WorkerCount = Maths::Min(System::JobSystem::GetThreadCount(), 64u);
+        m_Tasks       = new B2PhysicsTask[MaxB2PhysicsTasks];
+
         b2Vec2 gravity      = { 0.0f, -9.81f };
         b2WorldDef worldDef = b2DefaultWorldDef();
         worldDef.gravity    = gravity;
-        m_B2DWorld          = b2CreateWorld(&worldDef);
+
+        if(m_WorkerCount > 1)
+        {
+            worldDef.workerCount     = (int)m_WorkerCount;
+            worldDef.enqueueTask     = &B2PhysicsEngine::EnqueueTask;
+            worldDef.finishTask      = &B2PhysicsEngine::FinishTask;
+            worldDef.userTaskContext = this;
+        }
+
+        m_B2DWorld = b2CreateWorld(&worldDef);
 
         b2AABB bounds = { { -FLT_MAX, -FLT_MAX }, { FLT_MAX, FLT_MAX } };
 
@@ -60,11 +91,63 @@ namespace Lumos
 
     B2PhysicsEngine::~B2PhysicsEngine()
     {
+        delete[] m_Tasks;
     }
 
     void B2PhysicsEngine::SetDefaults()
     {
         m_UpdateTimestep = 1.0f / 60.f;
+        m_SubStepCount   = 4;
+        m_UpdateAccum    = 0.0f;
+    }
+
+    void* B2PhysicsEngine::EnqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext)
+    {
+        B2PhysicsEngine* engine = (B2PhysicsEngine*)userContext;
+
+        const int workerCount = (int)engine->m_WorkerCount;
+        const int rangeSize   = Maths::Max(minRange, (itemCount + workerCount - 1) / workerCount);
+        const int jobCount    = (itemCount + rangeSize - 1) / rangeSize;
+
+        // Returning null tells Box2D the work was done serially.
+        // Single item tasks still go to a job, the solver enqueues one per worker and expects them to run side by side
+        if(engine->m_TaskCount >= MaxB2PhysicsTasks)
+        {
+            task(0, itemCount, 0, taskContext);
+            return nullptr;
+        }
+
+        B2PhysicsTask* physicsTask = &engine->m_Tasks[engine->m_TaskCount++];
+        physicsTask->Callback      = task;
+        physicsTask->TaskContext   = taskContext;
+        physicsTask->ItemCount     = itemCount;
+        physicsTask->RangeSize     = rangeSize;
+
+        System::JobSystem::Dispatch(physicsTask->Context, (uint32_t)jobCount, 1, [physicsTask](JobDispatchArgs args)
+                                    {
+                                        const int start = (int)args.jobIndex * physicsTask->RangeSize;
+                                        const int end   = Maths::Min(start + physicsTask->RangeSize, physicsTask->ItemCount);
+                                        physicsTask->Callback(start, end, args.jobIndex, physicsTask->TaskContext); });
+
+        return physicsTask;
+    }
+
+    void B2PhysicsEngine::FinishTask(void* userTask, void* userContext)
+    {
+        B2PhysicsTask* physicsTask = (B2PhysicsTask*)userTask;
+        System::JobSystem::Wait(physicsTask->Context);
+    }
+
+    void B2PhysicsEngine::StorePreviousState(Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        auto view = scene->GetRegistry().view<RigidBody2DComponent>();
+        for(auto entity : view)
+        {
+            RigidBody2D* body = view.get<RigidBody2DComponent>(entity).GetRigidBodyRaw();
+            if(!body->GetIsStatic())
+                body->StorePreviousState();
+        }
     }
 
     void B2PhysicsEngine::OnUpdate(const TimeStep& timeStep, Scene* scene)
@@ -73,7 +156,33 @@ namespace Lumos
 
         if(!m_Paused)
         {
-            b2World_Step(m_B2DWorld, (float)timeStep.GetSeconds(), 4);
+            {
+                LUMOS_PROFILE_SCOPE("Box2D::Step");
+
+                m_UpdateAccum += (float)timeStep.GetSeconds();
+
+                uint32_t stepCount = 0;
+                while(m_UpdateAccum + Maths::M_EPSILON >= m_UpdateTimestep && stepCount < m_MaxUpdatesPerFrame)
+                {
+                    m_UpdateAccum -= m_UpdateTimestep;
+                    stepCount++;
+                }
+
+                // Drop time that can't be caught up on instead of spiralling
+                if(m_UpdateAccum + Maths::M_EPSILON >= m_UpdateTimestep)
+                    m_UpdateAccum = Maths::Mod(m_UpdateAccum, m_UpdateTimestep);
+
+                for(uint32_t i = 0; i < stepCount; i++)
+                {
+                    if(m_Interpolate && scene && i == stepCount - 1)
+                        StorePreviousState(scene);
+
+                    b2World_Step(m_B2DWorld, m_UpdateTimestep, m_SubStepCount);
+                    m_TaskCount = 0;
+                }
+
+                m_InterpolationAlpha = m_Interpolate ? Maths::Clamp(m_UpdateAccum / m_UpdateTimestep, 0.0f, 1.0f) : 1.0f;
+            }
 
             b2ContactEvents contactEvents = b2World_GetContactEvents(m_B2DWorld);
             for(int i = 0; i < contactEvents.beginCount; ++i)
@@ -129,6 +238,30 @@ namespace Lumos
         ImGui::PopItemWidth();
         ImGui::NextColumn();
 
+        ImGui::AlignTextToFramePadding();
+        ImGui::TextUnformatted("Sub Steps");
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+        ImGui::DragInt("##SubSteps", &m_SubStepCount, 1.0f, 1, 16);
+        ImGui::PopItemWidth();
+        ImGui::NextColumn();
+
+        ImGui::AlignTextToFramePadding();
+        ImGui::TextUnformatted("Interpolate");
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+        ImGui::Checkbox("##Interpolate", &m_Interpolate);
+        ImGui::PopItemWidth();
+        ImGui::NextColumn();
+
+        ImGui::AlignTextToFramePadding();
+        ImGui::TextUnformatted("Worker Count");
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+        ImGui::Text("%u", m_WorkerCount);
+        ImGui::PopItemWidth();
+        ImGui::NextColumn();
+
         ImGui::AlignTextToFramePadding();
         ImGui::TextUnformatted("Gravity");
         ImGui::NextColumn();
@@ -189,6 +322,9 @@ namespace Lumos
 
         auto group = registry.group<RigidBody2DComponent>(entt::get<Maths::Transform>);
 
+        const float alpha      = m_InterpolationAlpha;
+        const bool interpolate = m_Interpolate && alpha < 1.0f;
+
         for(auto entity : group)
         {
             const auto& [phys, trans] = group.get<RigidBody2DComponent, Maths::Transform>(entity);
@@ -196,8 +332,25 @@ namespace Lumos
             // if (!phys.GetRigidBody()->GetB2Body()->IsAwake())
             //     break;
 
-            trans.SetLocalPosition(Vec3(phys.GetRigidBody()->GetPosition(), trans.GetLocalPosition().z));
-            trans.SetLocalOrientation(Quat(Vec3(0.0f, 0.0f, Maths::ToDegrees(phys.GetRigidBody()->GetAngle()))));
+            const RigidBody2D* body = phys.GetRigidBodyRaw();
+            Vec2 position           = body->GetPosition();
+            float angle             = body->GetAngle();
+
+            if(interpolate && !body->GetIsStatic())
+            {
+                // Blend from the state before the last step, taking the short way round for the angle
+                float angleDelta = angle - body->GetPreviousAngle();
+                if(angleDelta > Maths::M_PI)
+                    angleDelta -= Maths::M_2PI;
+                else if(angleDelta < -Maths::M_PI)
+                    angleDelta += Maths::M_2PI;
+
+                position = Maths::Lerp(body->GetPreviousPosition(), position, alpha);
+                angle    = body->GetPreviousAngle() + angleDelta * alpha;
+            }
+
+            trans.SetLocalPosition(Vec3(position, trans.GetLocalPosition().z));
+            trans.SetLocalOrientation(Quat(Vec3(0.0f, 0.0f, Maths::ToDegrees(angle))));
             // trans.SetWorldMatrix(Mat4(1.0f)); // TODO: temp
         };
     }
@@ -8,6 +8,7 @@
 namespace Lumos
 {
     class TimeStep;
+    struct B2PhysicsTask;
 
     enum PhysicsDebugFlags2D : uint32_t
     {
@@ -51,14 +52,37 @@ namespace Lumos
 
         void SyncTransforms(Scene* scene);
 
+        void SetUpdateTimestep(float timestep) { m_UpdateTimestep = timestep; }
+        float GetUpdateTimestep() const { return m_UpdateTimestep; }
+        void SetSubStepCount(int32_t count) { m_SubStepCount = count; }
+        int32_t GetSubStepCount() const { return m_SubStepCount; }
+        void SetInterpolation(bool interpolate) { m_Interpolate = interpolate; }
+        bool GetInterpolation() const { return m_Interpolate; }
+        uint32_t GetWorkerCount() const { return m_WorkerCount; }
+
     private:
+        // Box2D task callbacks, backed by the JobSystem
+        static void* EnqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext);
+        static void FinishTask(void* userTask, void* userContext);
+
+        void StorePreviousState(Scene* scene);
+
         b2WorldId m_B2DWorld;
         b2DebugDraw m_DebugDraw;
 
         u32 m_DebugDrawFlags = 0;
 
         float m_UpdateTimestep;
-        bool m_Paused = true;
+        float m_UpdateAccum           = 0.0f;
+        float m_InterpolationAlpha    = 1.0f;
+        uint32_t m_MaxUpdatesPerFrame = 5;
+        int32_t m_SubStepCount        = 4;
+        bool m_Interpolate            = true;
+        bool m_Paused                 = true;
+
+        B2PhysicsTask* m_Tasks = nullptr;
+        uint32_t m_TaskCount   = 0;
+        uint32_t m_WorkerCount = 1;
 
         int32_t m_VelocityIterations = 6;
         int32_t m_PositionIterations = 2;
@@ -131,6 +131,8 @@ namespace Lumos
         {
             LERROR("Shape Not Supported");
         }
+
+        StorePreviousState();
     }
 
     Vec2 RigidBody2D::GetPosition() const
@@ -144,6 +146,12 @@ namespace Lumos
         return b2Rot_GetAngle(b2Body_GetRotation(m_B2Body));
     }
 
+    void RigidBody2D::StorePreviousState()
+    {
+        m_PreviousPosition = GetPosition();
+        m_PreviousAngle    = GetAngle();
+    }
+
     const Vec2 RigidBody2D::GetLinearVelocity() const
     {
         b2Vec2 vel = b2Body_GetLinearVelocity(m_B2Body);
@@ -83,6 +83,11 @@ namespace Lumos
 
         UUID GetUUID() const { return m_UUID; }
 
+        // State before the last fixed step, used to interpolate the rendered transform
+        void StorePreviousState();
+        const Vec2& GetPreviousPosition() const { return m_PreviousPosition; }
+        float GetPreviousAngle() const { return m_PreviousAngle; }
+
         void RebuildShape();
 
         template <typename Archive>
@@ -106,6 +111,7 @@ namespace Lumos
             params.friction = m_Friction;
             Init(params);
             SetOrientation(angle);
+            StorePreviousState();
         }
 
     protected:
@@ -121,5 +127,8 @@ namespace Lumos
         float m_Friction;
         bool m_AtRest;
         UUID m_UUID;
+
+        Vec2 m_PreviousPosition = Vec2(0.0f);
+        float m_PreviousAngle   = 0.0f;
     };
 }
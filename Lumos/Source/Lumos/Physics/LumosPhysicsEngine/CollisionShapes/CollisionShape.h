@@ -38,7 +38,9 @@ namespace Lumos
         CollisionPyramid      = 4,
         CollisionCapsule      = 8,
         CollisionHull         = 16,
-        CollisionShapeTypeMax = 32
+        CollisionHeightField  = 32,
+        CollisionMesh         = 64,
+        CollisionShapeTypeMax = 128
     };
 
     class LUMOS_EXPORT CollisionShape
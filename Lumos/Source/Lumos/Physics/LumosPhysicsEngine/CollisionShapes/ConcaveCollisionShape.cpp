@@ -0,0 +1,51 @@
+#include "Precompiled.h"
+#include "ConcaveCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/RigidBody3D.h"
+#include "Graphics/Renderers/DebugRenderer.h"
+#include "Maths/MathsUtilities.h"
+
+namespace Lumos
+{
+    Mat3 ConcaveCollisionShape::BuildInverseInertia(float invMass) const
+    {
+        return Mat3(0.0f);
+    }
+
+    float ConcaveCollisionShape::GetSize() const
+    {
+        return Maths::Length(m_LocalBounds.Size());
+    }
+
+    void ConcaveCollisionShape::GetWorldTriangles(const RigidBody3D* currentObject, const Maths::BoundingBox& worldBox, TDArray<Vec3>& outTriangles) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const Mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
+
+        uint32_t first = (uint32_t)outTriangles.Size();
+        GetTriangles(worldBox.Transformed(Mat4::Inverse(transform)), outTriangles);
+
+        for(uint32_t i = first; i < outTriangles.Size(); i++)
+            outTriangles[i] = Vec3(transform * Vec4(outTriangles[i], 1.0f));
+    }
+
+    void ConcaveCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const Vec3& axis, Vec3* out_min, Vec3* out_max) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        Mat4 wsTransform      = currentObject ? currentObject->GetWorldSpaceTransform() * m_LocalTransform : m_LocalTransform;
+        const Vec3 local_axis = Maths::Transpose(Mat3(wsTransform)) * axis;
+
+        const Vec3& lower = m_LocalBounds.m_Min;
+        const Vec3& upper = m_LocalBounds.m_Max;
+
+        if(out_min)
+            *out_min = wsTransform * Vec4(local_axis.x >= 0.0f ? lower.x : upper.x, local_axis.y >= 0.0f ? lower.y : upper.y, local_axis.z >= 0.0f ? lower.z : upper.z, 1.0f);
+        if(out_max)
+            *out_max = wsTransform * Vec4(local_axis.x >= 0.0f ? upper.x : lower.x, local_axis.y >= 0.0f ? upper.y : lower.y, local_axis.z >= 0.0f ? upper.z : lower.z, 1.0f);
+    }
+
+    void ConcaveCollisionShape::DebugDraw(const RigidBody3D* currentObject) const
+    {
+        Mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
+        DebugRenderer::DebugDraw(m_LocalBounds.Transformed(transform), Vec4(0.2f, 0.8f, 0.2f, 1.0f), false, true);
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CollisionShape.h"
+#include "Maths/BoundingBox.h"
+#include "Maths/Matrix3.h"
+
+namespace Lumos
+{
+    // Base for static triangle shapes. They have no volume or useful support function, so the narrowphase and scene
+    // queries fetch the triangles near the other shape and test them one at a time.
+    // Bodies using them should be static with an inverse mass of zero.
+    class LUMOS_EXPORT ConcaveCollisionShape : public CollisionShape
+    {
+    public:
+        static bool IsConcave(CollisionShapeType type)
+        {
+            return (type & (CollisionHeightField | CollisionMesh)) != 0;
+        }
+
+        // Appends the three local space vertices of every triangle that may overlap localBox
+        virtual void GetTriangles(const Maths::BoundingBox& localBox, TDArray<Vec3>& outTriangles) const = 0;
+
+        // Same as GetTriangles with the box and triangles in world space
+        void GetWorldTriangles(const RigidBody3D* currentObject, const Maths::BoundingBox& worldBox, TDArray<Vec3>& outTriangles) const;
+
+        const Maths::BoundingBox& GetLocalBounds() const { return m_LocalBounds; }
+
+        virtual Mat3 BuildInverseInertia(float invMass) const override;
+        virtual float GetSize() const override;
+
+        // Contacts come from the individual triangles, these are empty
+        virtual TDArray<Vec3>& GetCollisionAxes(const RigidBody3D* currentObject) override { return m_Axes; }
+        virtual TDArray<CollisionEdge>& GetEdges(const RigidBody3D* currentObject) override { return m_Edges; }
+        virtual void GetIncidentReferencePolygon(const RigidBody3D* currentObject, const Vec3& axis, ReferencePolygon& refPolygon) const override { refPolygon.FaceCount = 0; }
+
+        // Corners of the local bounds, enough for the body's AABB
+        virtual void GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const Vec3& axis, Vec3* out_min, Vec3* out_max) const override;
+
+        // Draws the bounds rather than every triangle
+        virtual void DebugDraw(const RigidBody3D* currentObject) const override;
+
+    protected:
+        Maths::BoundingBox m_LocalBounds;
+    };
+}
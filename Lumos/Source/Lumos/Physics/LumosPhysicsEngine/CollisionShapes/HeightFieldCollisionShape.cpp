@@ -0,0 +1,99 @@
+#include "Precompiled.h"
+#include "HeightFieldCollisionShape.h"
+#include "Graphics/Terrain.h"
+#include "Maths/MathsUtilities.h"
+
+namespace Lumos
+{
+    HeightFieldCollisionShape::HeightFieldCollisionShape()
+    {
+        m_Type = CollisionShapeType::CollisionHeightField;
+        m_LocalBounds.Set(Vec3(0.0f), Vec3(0.0f));
+    }
+
+    HeightFieldCollisionShape::~HeightFieldCollisionShape()
+    {
+    }
+
+    void HeightFieldCollisionShape::Build(const float* heights, uint32_t width, uint32_t depth, float cellWidth, float cellDepth)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_Width     = width;
+        m_Depth     = depth;
+        m_CellWidth = cellWidth;
+        m_CellDepth = cellDepth;
+        m_Heights.Resize(width * depth);
+
+        if(width < 2 || depth < 2)
+        {
+            LWARN("Height field needs at least 2x2 samples, got %ux%u", width, depth);
+            m_Width = m_Depth = 0;
+            m_Heights.Clear();
+            m_LocalBounds.Set(Vec3(0.0f), Vec3(0.0f));
+            return;
+        }
+
+        float minHeight = FLT_MAX;
+        float maxHeight = -FLT_MAX;
+        for(uint32_t i = 0; i < width * depth; i++)
+        {
+            m_Heights[i] = heights[i];
+            minHeight    = Maths::Min(minHeight, heights[i]);
+            maxHeight    = Maths::Max(maxHeight, heights[i]);
+        }
+
+        m_LocalBounds.Set(Vec3(0.0f, minHeight, 0.0f), Vec3((width - 1) * cellWidth, maxHeight, (depth - 1) * cellDepth));
+    }
+
+    void HeightFieldCollisionShape::BuildFromTerrain(const Terrain* terrain)
+    {
+        const TDArray<float>& heights = terrain->GetHeights();
+        Build(heights.Data(), terrain->GetWidth(), terrain->GetDepth(), terrain->GetCellWidth(), terrain->GetCellDepth());
+    }
+
+    void HeightFieldCollisionShape::GetTriangles(const Maths::BoundingBox& localBox, TDArray<Vec3>& outTriangles) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(m_Heights.Empty() || !m_LocalBounds.IsInsideFast(localBox))
+            return;
+
+        // Range of cells under the box
+        int32_t lastCellX = (int32_t)m_Width - 2;
+        int32_t lastCellZ = (int32_t)m_Depth - 2;
+        int32_t minX      = Maths::Max(0, (int32_t)Maths::Floor(localBox.m_Min.x / m_CellWidth));
+        int32_t maxX      = Maths::Min(lastCellX, (int32_t)Maths::Floor(localBox.m_Max.x / m_CellWidth));
+        int32_t minZ      = Maths::Max(0, (int32_t)Maths::Floor(localBox.m_Min.z / m_CellDepth));
+        int32_t maxZ      = Maths::Min(lastCellZ, (int32_t)Maths::Floor(localBox.m_Max.z / m_CellDepth));
+
+        for(int32_t x = minX; x <= maxX; x++)
+        {
+            for(int32_t z = minZ; z <= maxZ; z++)
+            {
+                float heightA = GetHeight(x, z);
+                float heightB = GetHeight(x + 1, z);
+                float heightC = GetHeight(x + 1, z + 1);
+                float heightD = GetHeight(x, z + 1);
+
+                // Skip cells entirely above or below the box
+                float cellMin = Maths::Min(Maths::Min(heightA, heightB), Maths::Min(heightC, heightD));
+                float cellMax = Maths::Max(Maths::Max(heightA, heightB), Maths::Max(heightC, heightD));
+                if(cellMax < localBox.m_Min.y || cellMin > localBox.m_Max.y)
+                    continue;
+
+                Vec3 a(x * m_CellWidth, heightA, z * m_CellDepth);
+                Vec3 b((x + 1) * m_CellWidth, heightB, z * m_CellDepth);
+                Vec3 c((x + 1) * m_CellWidth, heightC, (z + 1) * m_CellDepth);
+                Vec3 d(x * m_CellWidth, heightD, (z + 1) * m_CellDepth);
+
+                // Same winding as Terrain
+                outTriangles.PushBack(c);
+                outTriangles.PushBack(b);
+                outTriangles.PushBack(a);
+
+                outTriangles.PushBack(a);
+                outTriangles.PushBack(d);
+                outTriangles.PushBack(c);
+            }
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "ConcaveCollisionShape.h"
+#include <cereal/types/vector.hpp>
+
+namespace Lumos
+{
+    class Terrain;
+
+    // Grid of heights in the XZ plane, sample (x, z) sits at (x * cellWidth, height, z * cellDepth) in local space.
+    // Each cell is split into two triangles along the same diagonal Terrain uses, so the collision surface matches
+    // the rendered terrain exactly. Only the cells under the other body's bounds are ever turned into triangles.
+    class LUMOS_EXPORT HeightFieldCollisionShape : public ConcaveCollisionShape
+    {
+    public:
+        HeightFieldCollisionShape();
+        ~HeightFieldCollisionShape();
+
+        // heights is width * depth samples, indexed [x * depth + z]
+        void Build(const float* heights, uint32_t width, uint32_t depth, float cellWidth, float cellDepth);
+        void BuildFromTerrain(const Terrain* terrain);
+
+        virtual void GetTriangles(const Maths::BoundingBox& localBox, TDArray<Vec3>& outTriangles) const override;
+
+        float GetHeight(uint32_t x, uint32_t z) const { return m_Heights[x * m_Depth + z]; }
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetDepth() const { return m_Depth; }
+        float GetCellWidth() const { return m_CellWidth; }
+        float GetCellDepth() const { return m_CellDepth; }
+
+        template <typename Archive>
+        void save(Archive& archive) const
+        {
+            std::vector<float> heights(m_Heights.Size());
+            for(uint32_t i = 0; i < m_Heights.Size(); i++)
+                heights[i] = m_Heights[i];
+
+            archive(m_Width, m_Depth, m_CellWidth, m_CellDepth, heights);
+        }
+
+        template <typename Archive>
+        void load(Archive& archive)
+        {
+            uint32_t width, depth;
+            float cellWidth, cellDepth;
+            std::vector<float> heights;
+            archive(width, depth, cellWidth, cellDepth, heights);
+
+            m_Type = CollisionShapeType::CollisionHeightField;
+            if(heights.size() == (size_t)width * depth)
+                Build(heights.data(), width, depth, cellWidth, cellDepth);
+        }
+
+    protected:
+        TDArray<float> m_Heights;
+        uint32_t m_Width  = 0;
+        uint32_t m_Depth  = 0;
+        float m_CellWidth = 1.0f;
+        float m_CellDepth = 1.0f;
+    };
+}
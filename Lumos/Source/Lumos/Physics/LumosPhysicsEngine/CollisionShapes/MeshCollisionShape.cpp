@@ -0,0 +1,102 @@
+#include "Precompiled.h"
+#include "MeshCollisionShape.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Model.h"
+#include "Maths/TriangleBVH.h"
+
+namespace Lumos
+{
+    MeshCollisionShape::MeshCollisionShape()
+    {
+        m_Type = CollisionShapeType::CollisionMesh;
+        m_LocalBounds.Set(Vec3(0.0f), Vec3(0.0f));
+    }
+
+    MeshCollisionShape::~MeshCollisionShape()
+    {
+    }
+
+    void MeshCollisionShape::Build(const Vec3* positions, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_TriangleBVH = CreateSharedPtr<Maths::TriangleBVH>();
+        m_TriangleBVH->Build(positions, sizeof(Vec3), vertexCount, indices, indexCount);
+        UpdateBounds();
+    }
+
+    bool MeshCollisionShape::BuildFromMesh(const Graphics::Mesh* mesh)
+    {
+        if(!mesh->GetTriangleBVH())
+        {
+            LWARN("Mesh %s has no triangle BVH to build a collision shape from", mesh->GetName().c_str());
+            return false;
+        }
+
+        m_TriangleBVH = mesh->GetTriangleBVH();
+        UpdateBounds();
+        return true;
+    }
+
+    bool MeshCollisionShape::BuildFromModel(const Graphics::Model* model)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const auto& meshes = model->GetMeshes();
+        if(meshes.Size() == 1)
+            return BuildFromMesh(meshes[0].get());
+
+        TDArray<Vec3> positions;
+        TDArray<uint32_t> indices;
+        for(const auto& mesh : meshes)
+        {
+            const SharedPtr<Maths::TriangleBVH>& triangleBVH = mesh->GetTriangleBVH();
+            if(!triangleBVH)
+            {
+                LWARN("Mesh %s has no triangle BVH to build a collision shape from", mesh->GetName().c_str());
+                continue;
+            }
+
+            uint32_t baseVertex = (uint32_t)positions.Size();
+            for(const Vec3& position : triangleBVH->GetPositions())
+                positions.PushBack(position);
+            for(uint32_t index : triangleBVH->GetIndices())
+                indices.PushBack(baseVertex + index);
+        }
+
+        if(indices.Empty())
+            return false;
+
+        Build(positions.Data(), (uint32_t)positions.Size(), indices.Data(), (uint32_t)indices.Size());
+        return true;
+    }
+
+    void MeshCollisionShape::GetTriangles(const Maths::BoundingBox& localBox, TDArray<Vec3>& outTriangles) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(m_TriangleBVH)
+            m_TriangleBVH->QueryBox(localBox, outTriangles);
+    }
+
+    uint32_t MeshCollisionShape::GetTriangleCount() const
+    {
+        return m_TriangleBVH ? m_TriangleBVH->GetTriangleCount() : 0;
+    }
+
+    void MeshCollisionShape::GetTriangleData(std::vector<Vec3>& outPositions, std::vector<uint32_t>& outIndices) const
+    {
+        if(!m_TriangleBVH)
+            return;
+
+        const TDArray<Vec3>& positions   = m_TriangleBVH->GetPositions();
+        const TDArray<uint32_t>& indices = m_TriangleBVH->GetIndices();
+        outPositions.assign(positions.Data(), positions.Data() + positions.Size());
+        outIndices.assign(indices.Data(), indices.Data() + indices.Size());
+    }
+
+    void MeshCollisionShape::UpdateBounds()
+    {
+        if(m_TriangleBVH && !m_TriangleBVH->Empty())
+            m_LocalBounds = m_TriangleBVH->GetBoundingBox();
+        else
+            m_LocalBounds.Set(Vec3(0.0f), Vec3(0.0f));
+    }
+}
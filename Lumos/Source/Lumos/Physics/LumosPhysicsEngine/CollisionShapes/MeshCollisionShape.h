@@ -0,0 +1,66 @@
+#pragma once
+
+#include "ConcaveCollisionShape.h"
+#include <cereal/types/vector.hpp>
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        class Mesh;
+        class Model;
+    }
+
+    namespace Maths
+    {
+        class TriangleBVH;
+    }
+
+    // Arbitrary static triangle mesh, e.g. level geometry. Triangles near the other body are found through a
+    // TriangleBVH, shared with the render mesh when built from one.
+    class LUMOS_EXPORT MeshCollisionShape : public ConcaveCollisionShape
+    {
+    public:
+        MeshCollisionShape();
+        ~MeshCollisionShape();
+
+        void Build(const Vec3* positions, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+
+        // Shares the mesh's triangle BVH, which is built on first use. False for skinned meshes, which have none
+        bool BuildFromMesh(const Graphics::Mesh* mesh);
+
+        // Merges every mesh of the model into one BVH, or shares the BVH of a single mesh model
+        bool BuildFromModel(const Graphics::Model* model);
+
+        virtual void GetTriangles(const Maths::BoundingBox& localBox, TDArray<Vec3>& outTriangles) const override;
+
+        uint32_t GetTriangleCount() const;
+        const SharedPtr<Maths::TriangleBVH>& GetTriangleBVH() const { return m_TriangleBVH; }
+
+        template <typename Archive>
+        void save(Archive& archive) const
+        {
+            std::vector<Vec3> positions;
+            std::vector<uint32_t> indices;
+            GetTriangleData(positions, indices);
+            archive(positions, indices);
+        }
+
+        template <typename Archive>
+        void load(Archive& archive)
+        {
+            std::vector<Vec3> positions;
+            std::vector<uint32_t> indices;
+            archive(positions, indices);
+
+            m_Type = CollisionShapeType::CollisionMesh;
+            Build(positions.data(), (uint32_t)positions.size(), indices.data(), (uint32_t)indices.size());
+        }
+
+    protected:
+        void GetTriangleData(std::vector<Vec3>& outPositions, std::vector<uint32_t>& outIndices) const;
+        void UpdateBounds();
+
+        SharedPtr<Maths::TriangleBVH> m_TriangleBVH;
+    };
+}
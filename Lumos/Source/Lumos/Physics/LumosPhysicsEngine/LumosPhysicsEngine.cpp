@@ -2,6 +2,7 @@
 #include "LumosPhysicsEngine.h"
 #include "RigidBody3D.h"
 #include "Narrowphase/CollisionDetection.h"
+#include "CollisionShapes/ConcaveCollisionShape.h"
 #include "Broadphase/BruteForceBroadphase.h"
 #include "Broadphase/OctreeBroadphase.h"
 #include "RigidBody3D.h"
@@ -11,12 +12,14 @@
 #include "Core/OS/Window.h"
 #include "Core/JobSystem.h"
 #include "Core/Application.h"
+#include "Core/Telemetry.h"
 #include "Scene/Component/RigidBody3DComponent.h"
 #include "Scene/Scene.h"
 #include "Scene/Entity.h"
 #include "Graphics/Renderers/DebugRenderer.h"
 #include "Maths/MathsUtilities.h"
 #include "Maths/Transform.h"
+#include "Maths/Ray.h"
 #include "ImGui/ImGuiUtilities.h"
 #include "Utilities/Colour.h"
 
@@ -40,6 +43,9 @@ namespace Lumos
         , m_BaumgarteSlop(config.BaumgarteSlop)
     {
         m_DebugName = "Lumos3DPhysicsEngine";
+
+        Reads<IDComponent>();
+        Writes<RigidBody3DComponent, SpringConstraintComponent, AxisConstraintComponent, DistanceConstraintComponent, WeldConstraintComponent>();
         m_BroadphaseCollisionPairs.Reserve(1000);
 
         m_Allocator = new PoolAllocator<RigidBody3D>();
@@ -66,6 +72,7 @@ namespace Lumos
     void LumosPhysicsEngine::OnUpdate(const TimeStep& timeStep, Scene* scene)
     {
         LUMOS_PROFILE_FUNCTION();
+        LUMOS_TELEMETRY_SCOPE("Physics3D::Update");
         if(!m_IsPaused)
         {
             auto& registry    = scene->GetRegistry();
@@ -149,6 +156,8 @@ namespace Lumos
                 }
             }
         }
+
+        UpdateQueryTree();
     }
 
     void LumosPhysicsEngine::UpdatePhysics()
@@ -162,11 +171,23 @@ namespace Lumos
 
         // Solve collision constraints
         SolveConstraints();
+
+        m_ContinuousBodies.Clear();
+        RigidBody3D* current = m_RootBody;
+        while(current)
+        {
+            if(current->m_Continuous && current->IsAwake() && !current->m_Static && !current->m_Trigger && current->m_CollisionShape)
+                m_ContinuousBodies.PushBack({ current, current->m_Position });
+            current = current->m_Next;
+        }
+
         // Update movement
         for(uint32_t i = 0; i < m_PositionIterations; i++)
             UpdateRigidBodys();
 
-        RigidBody3D* current = m_RootBody;
+        SolveContinuousCollisions();
+
+        current = m_RootBody;
         while(current)
         {
             current->RestTest();
@@ -213,6 +234,7 @@ namespace Lumos
         }
         m_RootBody = body;
 
+        m_QueryTreeDirty = true;
         return body;
     }
 
@@ -236,6 +258,8 @@ namespace Lumos
             m_RootBody = body->m_Next;
         }
 
+        RemoveQueryProxy(body);
+
         body->~RigidBody3D();
         m_Allocator->Deallocate(body);
     }
@@ -265,6 +289,310 @@ namespace Lumos
         };
     }
 
+    static const uint32_t QueryBatchGroupSize = 32;
+
+    static Maths::BoundingBox GetShapeBounds(const GJKShape& shape)
+    {
+        static const Vec3 axes[3] = { Vec3(1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f) };
+
+        // The six extreme points bound the core exactly
+        Maths::BoundingBox bounds;
+        for(uint32_t i = 0; i < 3; i++)
+        {
+            bounds.Merge(shape.Support(axes[i]));
+            bounds.Merge(shape.Support(-axes[i]));
+        }
+
+        Vec3 radius(shape.Radius);
+        return Maths::BoundingBox(bounds.m_Min - radius, bounds.m_Max + radius);
+    }
+
+    // Height fields and meshes only give their bounds as a GJK shape, so casts against them test each triangle
+    // inside the swept bounds of the query
+    static bool CastAgainstBody(const GJKShape& shape, const Vec3& direction, float maxDistance, const Maths::BoundingBox& swept, const RigidBody3D* body, float& outDistance, Vec3& outNormal, Vec3& outPoint)
+    {
+        const CollisionShape* collisionShape = body->GetCollisionShape().get();
+        if(!ConcaveCollisionShape::IsConcave(collisionShape->GetType()))
+            return GJK::ShapeCast(shape, direction, maxDistance, GJKShape::FromBody(body), outDistance, outNormal, outPoint);
+
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        TDArray<Vec3> triangles(scratch.arena);
+        ((const ConcaveCollisionShape*)collisionShape)->GetWorldTriangles(body, swept, triangles);
+
+        bool hit = false;
+        for(uint32_t i = 0; i + 2 < triangles.Size(); i += 3)
+        {
+            float distance;
+            Vec3 normal, point;
+            if(!GJK::ShapeCast(shape, direction, maxDistance, GJKShape::FromTriangle(triangles[i], triangles[i + 1], triangles[i + 2]), distance, normal, point))
+                continue;
+
+            hit         = true;
+            maxDistance = distance;
+            outDistance = distance;
+            outNormal   = normal;
+            outPoint    = point;
+        }
+
+        ScratchEnd(scratch);
+        return hit;
+    }
+
+    static bool OverlapsBody(const GJKShape& shape, const Maths::BoundingBox& bounds, const RigidBody3D* body)
+    {
+        const CollisionShape* collisionShape = body->GetCollisionShape().get();
+        if(!ConcaveCollisionShape::IsConcave(collisionShape->GetType()))
+            return GJK::Intersect(shape, GJKShape::FromBody(body));
+
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        TDArray<Vec3> triangles(scratch.arena);
+        ((const ConcaveCollisionShape*)collisionShape)->GetWorldTriangles(body, bounds, triangles);
+
+        bool hit = false;
+        for(uint32_t i = 0; i + 2 < triangles.Size() && !hit; i += 3)
+            hit = GJK::Intersect(shape, GJKShape::FromTriangle(triangles[i], triangles[i + 1], triangles[i + 2]));
+
+        ScratchEnd(scratch);
+        return hit;
+    }
+
+    void LumosPhysicsEngine::UpdateQueryTree()
+    {
+        LUMOS_PROFILE_FUNCTION();
+
+        RigidBody3D* current = m_RootBody;
+        while(current)
+        {
+            // Also warms the cached transform, so queries on worker threads only read it
+            const Maths::BoundingBox& bounds = current->GetWorldSpaceAABB();
+            current->GetWorldSpaceTransform();
+
+            if(!current->GetCollisionShape())
+            {
+                RemoveQueryProxy(current);
+            }
+            else if(current->m_QueryProxy == Maths::DynamicAABBTree::NullNode)
+            {
+                current->m_QueryIndex = (uint32_t)m_QueryBodies.Size();
+                current->m_QueryProxy = m_QueryTree.CreateProxy(bounds, current->m_QueryIndex);
+                m_QueryBodies.PushBack(current);
+            }
+            else
+            {
+                // Only reinserts bodies that left their fattened box
+                m_QueryTree.MoveProxy(current->m_QueryProxy, bounds);
+            }
+
+            current = current->m_Next;
+        }
+
+        m_QueryTreeDirty = false;
+    }
+
+    void LumosPhysicsEngine::RemoveQueryProxy(RigidBody3D* body)
+    {
+        if(body->m_QueryProxy == Maths::DynamicAABBTree::NullNode)
+            return;
+
+        m_QueryTree.DestroyProxy(body->m_QueryProxy);
+
+        uint32_t index = body->m_QueryIndex;
+        uint32_t last  = (uint32_t)m_QueryBodies.Size() - 1;
+        if(index != last)
+        {
+            RigidBody3D* moved   = m_QueryBodies[last];
+            moved->m_QueryIndex  = index;
+            m_QueryBodies[index] = moved;
+            m_QueryTree.SetUserData(moved->m_QueryProxy, index);
+        }
+
+        m_QueryBodies.PopBack();
+        body->m_QueryProxy = Maths::DynamicAABBTree::NullNode;
+    }
+
+    bool LumosPhysicsEngine::PassesFilter(const RigidBody3D* body, const PhysicsQueryFilter& filter) const
+    {
+        if(body == filter.IgnoreBody)
+            return false;
+
+        if(body->m_Trigger && !filter.IncludeTriggers)
+            return false;
+
+        // The mask only addresses layers 0-31, bodies on higher layers are only seen by unfiltered queries
+        if(body->m_CollisionLayer >= 32)
+            return filter.LayerMask == ~0u;
+
+        return (filter.LayerMask & (1u << body->m_CollisionLayer)) != 0;
+    }
+
+    bool LumosPhysicsEngine::CastRay(const Vec3& origin, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter) const
+    {
+        const GJKShape point = GJKShape::FromPoint(origin);
+        bool hit             = false;
+
+        m_QueryTree.QueryRay(Maths::Ray(origin, direction), maxDistance, [&](uint32_t index, float closest)
+                             {
+                                 RigidBody3D* body = m_QueryBodies[index];
+                                 if(!PassesFilter(body, filter))
+                                     return closest;
+
+                                 Maths::BoundingBox swept;
+                                 swept.Merge(origin);
+                                 swept.Merge(origin + direction * closest);
+
+                                 float distance;
+                                 Vec3 normal, contact;
+                                 if(!CastAgainstBody(point, direction, closest, swept, body, distance, normal, contact))
+                                     return closest;
+
+                                 hit             = true;
+                                 outHit.Body     = body;
+                                 outHit.Distance = distance;
+                                 outHit.Normal   = normal;
+                                 return distance; });
+
+        if(hit)
+            outHit.Point = origin + direction * outHit.Distance;
+        return hit;
+    }
+
+    bool LumosPhysicsEngine::CastShape(const GJKShape& shape, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter) const
+    {
+        Maths::BoundingBox start = GetShapeBounds(shape);
+        Vec3 travel              = direction * maxDistance;
+        Maths::BoundingBox swept = start;
+        swept.Merge(Maths::BoundingBox(start.m_Min + travel, start.m_Max + travel));
+
+        bool hit      = false;
+        float closest = maxDistance;
+
+        m_QueryTree.QueryBox(swept, [&](uint32_t index)
+                             {
+                                 RigidBody3D* body = m_QueryBodies[index];
+                                 if(!PassesFilter(body, filter))
+                                     return true;
+
+                                 float distance;
+                                 Vec3 normal, contact;
+                                 if(CastAgainstBody(shape, direction, closest, swept, body, distance, normal, contact))
+                                 {
+                                     hit             = true;
+                                     closest         = distance;
+                                     outHit.Body     = body;
+                                     outHit.Distance = distance;
+                                     outHit.Normal   = normal;
+                                     outHit.Point    = contact;
+                                 }
+                                 return true; });
+
+        return hit;
+    }
+
+    bool LumosPhysicsEngine::Raycast(const Vec3& origin, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(m_QueryTreeDirty)
+            UpdateQueryTree();
+
+        outHit = {};
+        return CastRay(origin, direction.Normalised(), maxDistance, outHit, filter);
+    }
+
+    bool LumosPhysicsEngine::ShapeCast(const GJKShape& shape, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(m_QueryTreeDirty)
+            UpdateQueryTree();
+
+        outHit = {};
+        return CastShape(shape, direction.Normalised(), maxDistance, outHit, filter);
+    }
+
+    bool LumosPhysicsEngine::SphereCast(const Vec3& origin, float radius, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter)
+    {
+        return ShapeCast(GJKShape::FromPoint(origin, radius), direction, maxDistance, outHit, filter);
+    }
+
+    bool LumosPhysicsEngine::CapsuleCast(const Vec3& pointA, const Vec3& pointB, float radius, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter)
+    {
+        return ShapeCast(GJKShape::FromSegment(pointA, pointB, radius), direction, maxDistance, outHit, filter);
+    }
+
+    bool LumosPhysicsEngine::BoxCast(const Vec3& centre, const Vec3& halfExtents, const Quat& orientation, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter)
+    {
+        return ShapeCast(GJKShape::FromBox(centre, orientation, halfExtents), direction, maxDistance, outHit, filter);
+    }
+
+    void LumosPhysicsEngine::OverlapShape(const GJKShape& shape, TDArray<RigidBody3D*>& outBodies, const PhysicsQueryFilter& filter)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(m_QueryTreeDirty)
+            UpdateQueryTree();
+
+        outBodies.Clear();
+
+        // The tree holds fattened boxes, so every candidate is tested against the real shape
+        const Maths::BoundingBox bounds = GetShapeBounds(shape);
+        m_QueryTree.QueryBox(bounds, [&](uint32_t index)
+                             {
+                                 RigidBody3D* body = m_QueryBodies[index];
+                                 if(PassesFilter(body, filter) && OverlapsBody(shape, bounds, body))
+                                     outBodies.PushBack(body);
+                                 return true; });
+    }
+
+    void LumosPhysicsEngine::OverlapSphere(const Vec3& centre, float radius, TDArray<RigidBody3D*>& outBodies, const PhysicsQueryFilter& filter)
+    {
+        OverlapShape(GJKShape::FromPoint(centre, radius), outBodies, filter);
+    }
+
+    void LumosPhysicsEngine::OverlapCapsule(const Vec3& pointA, const Vec3& pointB, float radius, TDArray<RigidBody3D*>& outBodies, const PhysicsQueryFilter& filter)
+    {
+        OverlapShape(GJKShape::FromSegment(pointA, pointB, radius), outBodies, filter);
+    }
+
+    void LumosPhysicsEngine::OverlapBox(const Vec3& centre, const Vec3& halfExtents, const Quat& orientation, TDArray<RigidBody3D*>& outBodies, const PhysicsQueryFilter& filter)
+    {
+        OverlapShape(GJKShape::FromBox(centre, orientation, halfExtents), outBodies, filter);
+    }
+
+    void LumosPhysicsEngine::RaycastBatch(const PhysicsRaycast* queries, uint32_t count, RaycastHit3D* outHits)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(count == 0)
+            return;
+
+        // Workers only read the tree and bodies, so bodies moved since the last step are refit and their
+        // cached transforms resolved here rather than lazily on several threads at once
+        UpdateQueryTree();
+
+        System::JobSystem::Context ctx;
+        System::JobSystem::Dispatch(ctx, count, QueryBatchGroupSize, [this, queries, outHits](JobDispatchArgs args)
+                                    {
+                                        const PhysicsRaycast& query = queries[args.jobIndex];
+                                        outHits[args.jobIndex]      = {};
+                                        CastRay(query.Origin, query.Direction.Normalised(), query.MaxDistance, outHits[args.jobIndex], query.Filter); });
+        System::JobSystem::Wait(ctx);
+    }
+
+    void LumosPhysicsEngine::ShapeCastBatch(const PhysicsShapeCast* queries, uint32_t count, RaycastHit3D* outHits)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(count == 0)
+            return;
+
+        // See RaycastBatch
+        UpdateQueryTree();
+
+        System::JobSystem::Context ctx;
+        System::JobSystem::Dispatch(ctx, count, QueryBatchGroupSize, [this, queries, outHits](JobDispatchArgs args)
+                                    {
+                                        const PhysicsShapeCast& query = queries[args.jobIndex];
+                                        outHits[args.jobIndex]        = {};
+                                        CastShape(query.Shape, query.Direction.Normalised(), query.MaxDistance, outHits[args.jobIndex], query.Filter); });
+        System::JobSystem::Wait(ctx);
+    }
+
     Quat QuatMulVec3(const Quat& quat, const Vec3& b)
     {
         Quat ans;
@@ -411,6 +739,90 @@ namespace Lumos
         s_UpdateTimestep *= m_PositionIterations;
     }
 
+    static const uint32_t MaxContinuousSubSteps = 4;
+
+    // Radius of the sphere swept for a continuous body, a quarter of its smallest extent. Anything moving less than this
+    // in a step still overlaps what it hit at the end of the step, so the discrete test will find it
+    static float GetContinuousRadius(const RigidBody3D* body)
+    {
+        const Maths::BoundingBox bounds = body->GetLocalBoundingBox();
+        Vec3 extents                    = (bounds.m_Max - bounds.m_Min) * 0.5f;
+        return Maths::Min(extents.x, Maths::Min(extents.y, extents.z)) * 0.5f;
+    }
+
+    void LumosPhysicsEngine::SolveContinuousCollisions()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_Stats.ContinuousCount = 0;
+        if(m_ContinuousBodies.Empty())
+            return;
+
+        // Sweeps are cast against where everything else ended this step
+        UpdateQueryTree();
+
+        for(const ContinuousBody& continuous : m_ContinuousBodies)
+        {
+            RigidBody3D* body = continuous.Body;
+            float radius      = GetContinuousRadius(body);
+            Vec3 motion       = body->m_Position - continuous.Start;
+            float distance    = Maths::Length(motion);
+            if(distance <= radius)
+                continue;
+
+            m_Stats.ContinuousCount++;
+
+            PhysicsQueryFilter filter;
+            filter.IgnoreBody = body;
+
+            Vec3 position       = continuous.Start;
+            Vec3 velocity       = body->m_LinearVelocity;
+            float remainingTime = s_UpdateTimestep;
+
+            for(uint32_t subStep = 0; subStep < MaxContinuousSubSteps && distance > Maths::M_EPSILON; subStep++)
+            {
+                Vec3 direction = motion / distance;
+                RaycastHit3D hit;
+                if(!CastShape(GJKShape::FromPoint(position, radius), direction, distance, hit, filter))
+                {
+                    position += motion;
+                    break;
+                }
+
+                // Already overlapping at the start of the sweep, the contact is in this step's manifolds
+                if(hit.Distance <= 0.0f)
+                {
+                    position += motion;
+                    break;
+                }
+
+                // Stop where the swept sphere touches, the rest of the body overlaps the surface by at least
+                // the same radius so the next step builds a contact for it
+                position += direction * hit.Distance;
+                remainingTime *= 1.0f - hit.Distance / distance;
+
+                float approachSpeed = Maths::Dot(velocity, hit.Normal);
+                if(approachSpeed < 0.0f)
+                {
+                    // Same restitution the contact solver uses
+                    float elasticity = Maths::Sqrt(body->m_Elasticity * hit.Body->m_Elasticity);
+                    velocity -= hit.Normal * approachSpeed * (1.0f + elasticity);
+                }
+
+                if(!hit.Body->m_Static)
+                    hit.Body->WakeUp();
+
+                // The last sub step drops whatever motion is left rather than risk passing through
+                motion   = velocity * remainingTime;
+                distance = subStep + 1 < MaxContinuousSubSteps ? Maths::Length(motion) : 0.0f;
+            }
+
+            body->m_Position               = position;
+            body->m_LinearVelocity         = velocity;
+            body->m_WSTransformInvalidated = true;
+            body->m_WSAabbInvalidated      = true;
+        }
+    }
+
     Quat AngularVelcityToQuaternion(const Vec3& angularVelocity)
     {
         Quat q;
@@ -428,6 +840,8 @@ namespace Lumos
         if(m_BroadphaseDetection)
             m_BroadphaseDetection->FindPotentialCollisionPairs(m_RootBody, m_BroadphaseCollisionPairs, m_RigidBodyCount);
 
+        LUMOS_TELEMETRY_COUNTER_ADD("PhysicsPairs", m_BroadphaseCollisionPairs.Size());
+
 #ifdef CHECK_COLLISION_PAIR_DUPLICATES
 
         uint32_t duplicatePairs = 0;
@@ -455,6 +869,12 @@ namespace Lumos
     void LumosPhysicsEngine::NarrowPhaseCollisions()
     {
         LUMOS_PROFILE_FUNCTION();
+
+        const FlatHashMap<uint64_t, GJKCache>& previousCaches = m_PairCaches[m_PairCacheIndex];
+        m_PairCacheIndex ^= 1;
+        FlatHashMap<uint64_t, GJKCache>& pairCaches = m_PairCaches[m_PairCacheIndex];
+        pairCaches.Clear();
+
         if(m_BroadphaseCollisionPairs.Empty())
             return;
 
@@ -469,6 +889,19 @@ namespace Lumos
 
             if(shapeA && shapeB)
             {
+                // The broadphase doesn't keep pair order between steps, so the key and direction are stored lower UUID first
+                uint64_t uuidA      = cp.pObjectA->GetUUID();
+                uint64_t uuidB      = cp.pObjectB->GetUUID();
+                bool flipped        = uuidB < uuidA;
+                uint64_t pairKey    = flipped ? (uuidB * 0x9E3779B97F4A7C15ull) ^ uuidA : (uuidA * 0x9E3779B97F4A7C15ull) ^ uuidB;
+                const GJKCache* old = previousCaches.Find(pairKey);
+
+                GJKCache cache;
+                if(old)
+                {
+                    cache           = *old;
+                    cache.Direction = flipped ? -cache.Direction : cache.Direction;
+                }
 
                 // Broadphase debug draw
                 if(m_DebugDrawFlags & PhysicsDebugFlags::BROADPHASE_PAIRS)
@@ -479,8 +912,16 @@ namespace Lumos
                     DebugRenderer::DrawPoint(cp.pObjectB->GetPosition(), 0.05f, false, colour);
                 }
 
-                // Detects if the objects are colliding - Seperating Axis Theorem
-                if(CollisionDetection::Get().CheckCollision(cp.pObjectA, cp.pObjectB, shapeA.get(), shapeB.get(), &colData))
+                // Detects if the objects are colliding - Seperating Axis Theorem for boxes, GJK/EPA for other convex pairs
+                bool colliding = CollisionDetection::Get().CheckCollision(cp.pObjectA, cp.pObjectB, shapeA.get(), shapeB.get(), &colData, &cache);
+
+                if(cache.Valid)
+                {
+                    cache.Direction = flipped ? -cache.Direction : cache.Direction;
+                    pairCaches.Insert(pairKey, cache);
+                }
+
+                if(colliding)
                 {
                     // Check to see if any of the objects have collision callbacks that dont
                     // want the objects to physically collide
@@ -633,6 +1074,7 @@ namespace Lumos
         ImGuiUtilities::Property("Rest Body Count", m_Stats.RestCount, ImGuiUtilities::PropertyFlag::ReadOnly);
         ImGuiUtilities::Property("Collision Count", m_Stats.CollisionCount, ImGuiUtilities::PropertyFlag::ReadOnly);
         ImGuiUtilities::Property("NarrowPhase Count", m_Stats.NarrowPhaseCount, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Continuous Count", m_Stats.ContinuousCount, ImGuiUtilities::PropertyFlag::ReadOnly);
         ImGuiUtilities::Property("Constraint Count", m_Stats.ConstraintCount, ImGuiUtilities::PropertyFlag::ReadOnly);
 
         ImGui::AlignTextToFramePadding();
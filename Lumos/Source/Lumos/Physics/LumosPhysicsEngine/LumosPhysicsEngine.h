@@ -2,9 +2,12 @@
 
 #include "Utilities/TSingleton.h"
 #include "Narrowphase/Manifold.h"
+#include "Narrowphase/GJK.h"
 #include "Broadphase/Broadphase.h"
 #include "Scene/ISystem.h"
 #include "Core/OS/Allocators/PoolAllocator.h"
+#include "Maths/DynamicAABBTree.h"
+#include "Core/DataStructures/Map.h"
 
 namespace Lumos
 {
@@ -51,6 +54,38 @@ namespace Lumos
         uint32_t StaticCount;
         uint32_t ConstraintCount;
         uint32_t NarrowPhaseCount;
+        uint32_t ContinuousCount; // Continuous bodies swept in the last step
+    };
+
+    struct PhysicsQueryFilter
+    {
+        uint32_t LayerMask            = ~0u; // Bit n accepts bodies on collision layer n (0-31), layers above 31 only pass a full mask
+        bool IncludeTriggers          = false;
+        const RigidBody3D* IgnoreBody = nullptr;
+    };
+
+    struct RaycastHit3D
+    {
+        RigidBody3D* Body = nullptr; // nullptr when nothing was hit
+        Vec3 Point;
+        Vec3 Normal;
+        float Distance = 0.0f;
+    };
+
+    struct PhysicsRaycast
+    {
+        Vec3 Origin;
+        Vec3 Direction;
+        float MaxDistance = FLT_MAX;
+        PhysicsQueryFilter Filter;
+    };
+
+    struct PhysicsShapeCast
+    {
+        GJKShape Shape;
+        Vec3 Direction;
+        float MaxDistance = FLT_MAX;
+        PhysicsQueryFilter Filter;
     };
 
     struct LumosPhysicsEngineConfig
@@ -124,6 +159,31 @@ namespace Lumos
 
         const PhysicsStats3D& GetStats() const { return m_Stats; }
 
+        // Scene queries. Directions are normalised by the queries and distances are in world units.
+        // A shape that starts inside a body hits it at distance zero with the normal facing back along the cast.
+        // Bodies moved outside of the physics step (SetPosition etc.) are picked up at the next UpdateQueryTree,
+        // which runs at the end of every OnUpdate
+        bool Raycast(const Vec3& origin, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter = {});
+        bool ShapeCast(const GJKShape& shape, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter = {});
+        bool SphereCast(const Vec3& origin, float radius, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter = {});
+        bool CapsuleCast(const Vec3& pointA, const Vec3& pointB, float radius, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter = {});
+        bool BoxCast(const Vec3& centre, const Vec3& halfExtents, const Quat& orientation, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter = {});
+
+        // Bodies overlapping the shape, outBodies is cleared first
+        void OverlapShape(const GJKShape& shape, TDArray<RigidBody3D*>& outBodies, const PhysicsQueryFilter& filter = {});
+        void OverlapSphere(const Vec3& centre, float radius, TDArray<RigidBody3D*>& outBodies, const PhysicsQueryFilter& filter = {});
+        void OverlapCapsule(const Vec3& pointA, const Vec3& pointB, float radius, TDArray<RigidBody3D*>& outBodies, const PhysicsQueryFilter& filter = {});
+        void OverlapBox(const Vec3& centre, const Vec3& halfExtents, const Quat& orientation, TDArray<RigidBody3D*>& outBodies, const PhysicsQueryFilter& filter = {});
+
+        // Runs the queries in parallel on the job system, outHits[i] is the result of queries[i].
+        // Refits the query tree first, so bodies moved since the last step are seen
+        void RaycastBatch(const PhysicsRaycast* queries, uint32_t count, RaycastHit3D* outHits);
+        void ShapeCastBatch(const PhysicsShapeCast* queries, uint32_t count, RaycastHit3D* outHits);
+
+        // Refits the query tree to the bodies' current world space bounds
+        void UpdateQueryTree();
+        const Maths::DynamicAABBTree& GetQueryTree() const { return m_QueryTree; }
+
     protected:
         // The actual time-independant update function
         void UpdatePhysics();
@@ -141,6 +201,15 @@ namespace Lumos
         // Solves all engine constraints (constraints and manifolds)
         void SolveConstraints();
 
+        // Sweeps continuous bodies from their position before UpdateRigidBodys to their new position, stopping them
+        // at the first hit. The remaining time is re-swept with the reflected velocity, up to MaxContinuousSubSteps
+        void SolveContinuousCollisions();
+
+        bool PassesFilter(const RigidBody3D* body, const PhysicsQueryFilter& filter) const;
+        bool CastShape(const GJKShape& shape, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter) const;
+        bool CastRay(const Vec3& origin, const Vec3& direction, float maxDistance, RaycastHit3D& outHit, const PhysicsQueryFilter& filter) const;
+        void RemoveQueryProxy(RigidBody3D* body);
+
     protected:
         bool m_IsPaused;
         float m_UpdateAccum;
@@ -176,6 +245,25 @@ namespace Lumos
 
         PhysicsStats3D m_Stats;
 
+        // Bounds of every body with a collision shape for scene queries. Kept apart from the broadphase,
+        // which rebuilds its octree in the frame arena each step
+        Maths::DynamicAABBTree m_QueryTree;
+        TDArray<RigidBody3D*> m_QueryBodies; // Indexed by proxy user data
+        bool m_QueryTreeDirty = true;
+
+        // Separating direction of each broadphase pair from the last step, keyed by the pair's body UUIDs.
+        // Pairs that drop out of the broadphase aren't carried over, so the map only holds recent pairs
+        FlatHashMap<uint64_t, GJKCache> m_PairCaches[2];
+        uint32_t m_PairCacheIndex = 0;
+
+        struct ContinuousBody
+        {
+            RigidBody3D* Body;
+            Vec3 Start;
+        };
+
+        TDArray<ContinuousBody> m_ContinuousBodies; // Awake continuous bodies this step
+
         static float s_UpdateTimestep;
 
         static constexpr int kRollingBufferSize    = 60;
@@ -5,47 +5,49 @@
 #include "Physics/LumosPhysicsEngine/CollisionShapes/PyramidCollisionShape.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/HullCollisionShape.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/CapsuleCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/ConcaveCollisionShape.h"
 #include "Maths/MathsUtilities.h"
 
+#include <algorithm>
+
 namespace Lumos
 {
     CollisionDetection::CollisionDetection()
     {
         m_MaxSize                 = CollisionShapeTypeMax | (CollisionShapeTypeMax >> 1);
         m_CollisionCheckFunctions = new CollisionCheckFunc[m_MaxSize];
+        // Pyramids, hulls and any pair with a polyhedron on one side go through GJK/EPA
         for(u32 i = 0; i < m_MaxSize; i++)
-            m_CollisionCheckFunctions[i] = &CollisionDetection::CheckPolyhedronCollision;
+            m_CollisionCheckFunctions[i] = &CollisionDetection::CheckConvexCollision;
 
         m_CollisionCheckFunctions[CollisionSphere]  = &CollisionDetection::CheckSphereCollision;
-        m_CollisionCheckFunctions[CollisionCuboid]  = &CollisionDetection::CheckPolyhedronCollision;
-        m_CollisionCheckFunctions[CollisionPyramid] = &CollisionDetection::CheckPolyhedronCollision;
-        m_CollisionCheckFunctions[CollisionHull]    = &CollisionDetection::CheckPolyhedronCollision;
+        m_CollisionCheckFunctions[CollisionCuboid]  = &CollisionDetection::CheckCuboidCollision;
         m_CollisionCheckFunctions[CollisionCapsule] = &CollisionDetection::CheckCapsuleCollision;
 
-        m_CollisionCheckFunctions[CollisionSphere | CollisionCuboid]  = &CollisionDetection::CheckPolyhedronSphereCollision;
-        m_CollisionCheckFunctions[CollisionSphere | CollisionPyramid] = &CollisionDetection::CheckPolyhedronSphereCollision;
-        m_CollisionCheckFunctions[CollisionSphere | CollisionHull]    = &CollisionDetection::CheckPolyhedronSphereCollision;
+        m_CollisionCheckFunctions[CollisionSphere | CollisionCapsule] = &CollisionDetection::CheckCapsuleSphereCheckCollision;
 
-        m_CollisionCheckFunctions[CollisionSphere | CollisionCapsule]  = &CollisionDetection::CheckCapsuleSphereCheckCollision;
-        m_CollisionCheckFunctions[CollisionCapsule | CollisionCuboid]  = &CollisionDetection::CheckPolyhedronCapsuleCheckCollision;
-        m_CollisionCheckFunctions[CollisionCapsule | CollisionPyramid] = &CollisionDetection::CheckPolyhedronCapsuleCheckCollision;
-        m_CollisionCheckFunctions[CollisionCapsule | CollisionHull]    = &CollisionDetection::CheckPolyhedronCapsuleCheckCollision;
+        // Height fields and meshes against anything are tested triangle by triangle
+        for(u32 i = 0; i < m_MaxSize; i++)
+        {
+            if(ConcaveCollisionShape::IsConcave((CollisionShapeType)i))
+                m_CollisionCheckFunctions[i] = &CollisionDetection::CheckConcaveCollision;
+        }
     }
 
-    bool CollisionDetection::CheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
+    bool CollisionDetection::CheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata, GJKCache* cache)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         ASSERT(((shape1->GetType() | shape2->GetType()) < m_MaxSize), "Invalid collision func %i, %i, %i, %i", (int)shape1->GetType(), (int)shape2->GetType(), (int)shape2->GetType() | (int)shape2->GetType(), m_MaxSize);
-        return CALL_MEMBER_FN(*this, m_CollisionCheckFunctions[shape1->GetType() | shape2->GetType()])(obj1, obj2, shape1, shape2, out_coldata);
+        return CALL_MEMBER_FN(*this, m_CollisionCheckFunctions[shape1->GetType() | shape2->GetType()])(obj1, obj2, shape1, shape2, out_coldata, cache);
     }
 
-    bool CollisionDetection::InvalidCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
+    bool CollisionDetection::InvalidCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata, GJKCache* cache)
     {
         LFATAL("Invalid Collision type specified");
         return false;
     }
 
-    bool CollisionDetection::CheckSphereCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
+    bool CollisionDetection::CheckSphereCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata, GJKCache* cache)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         ASSERT(shape1->GetType() == CollisionShapeType::CollisionSphere && shape2->GetType() == CollisionShapeType::CollisionSphere, "Both shapes are not spheres");
@@ -69,7 +71,7 @@ namespace Lumos
         return true;
     }
 
-    void AddPossibleCollisionAxis(Vec3& axis, Vec3* possibleCollisionAxes, uint32_t& possibleCollisionAxesCount)
+    void AddPossibleCollisionAxis(Vec3& axis, TDArray<Vec3>& possibleCollisionAxes)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         if(Maths::Length2(axis) < Maths::M_EPSILON)
@@ -79,116 +81,102 @@ namespace Lumos
 
         float value = (1.0f - Maths::M_EPSILON);
 
-        for(uint32_t i = 0; i < possibleCollisionAxesCount; i++)
+        for(const Vec3& p_axis : possibleCollisionAxes)
         {
-            const Vec3& p_axis = possibleCollisionAxes[i];
             if(Maths::Abs(Maths::Dot(axis, p_axis)) >= value)
                 return;
         }
 
-        possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
+        possibleCollisionAxes.PushBack(axis);
     }
 
-    bool CollisionDetection::CheckPolyhedronSphereCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
+    bool CollisionDetection::CheckCuboidCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata, GJKCache* cache)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
-        ASSERT(shape1->GetType() == CollisionShapeType::CollisionSphere || shape2->GetType() == CollisionShapeType::CollisionSphere, "No sphere collision shape");
-
-        CollisionShape* complexShape;
-        RigidBody3D* complexObj;
-        RigidBody3D* sphereObj;
 
-        if(obj1->GetCollisionShape()->GetType() == CollisionShapeType::CollisionSphere)
-        {
-            sphereObj    = obj1;
-            complexShape = shape2;
-            complexObj   = obj2;
-        }
-        else
-        {
-            sphereObj    = obj2;
-            complexShape = shape1;
-            complexObj   = obj1;
-        }
+        // Still apart along the axis that separated the pair last step
+        if(cache && cache->Valid && !CheckCollisionAxis(cache->Direction, obj1, obj2, shape1, shape2, nullptr))
+            return false;
 
         CollisionData cur_colData;
         CollisionData best_colData;
         best_colData.penetration = -FLT_MAX;
 
-        TDArray<Vec3>& shapeCollisionAxes           = complexShape->GetCollisionAxes(complexObj);
-        TDArray<CollisionEdge>& complex_shape_edges = complexShape->GetEdges(complexObj);
-
-        Vec3 p   = GetClosestPointOnEdges(sphereObj->GetPosition(), complex_shape_edges);
-        Vec3 p_t = sphereObj->GetPosition() - p;
-        p_t.Normalise();
-
-        static const int MAX_COLLISION_AXES = 100;
-        static Vec3 possibleCollisionAxes[MAX_COLLISION_AXES];
+        // Face normals of both boxes. Box edges run along the face normals, so the edge-edge axes are their cross products.
+        // Built here rather than read from the shapes so pairs can be tested on multiple threads
+        const Mat3 orientation1(obj1->GetOrientation());
+        const Mat3 orientation2(obj2->GetOrientation());
+        const Vec3 faceAxes[6] = { orientation1 * Vec3(1.0f, 0.0f, 0.0f), orientation1 * Vec3(0.0f, 1.0f, 0.0f), orientation1 * Vec3(0.0f, 0.0f, 1.0f),
+                                   orientation2 * Vec3(1.0f, 0.0f, 0.0f), orientation2 * Vec3(0.0f, 1.0f, 0.0f), orientation2 * Vec3(0.0f, 0.0f, 1.0f) };
 
-        uint32_t possibleCollisionAxesCount = 0;
-        for(const Vec3& axis : shapeCollisionAxes)
+        TDSmallArray<Vec3, 9> edgeAxes;
+        for(uint32_t i = 0; i < 3; i++)
         {
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
+            for(uint32_t j = 3; j < 6; j++)
+            {
+                Vec3 axis = Maths::Cross(faceAxes[i], faceAxes[j]);
+                AddPossibleCollisionAxis(axis, edgeAxes);
+            }
         }
 
-        AddPossibleCollisionAxis(p_t, possibleCollisionAxes, possibleCollisionAxesCount);
+        for(const Vec3& axis : faceAxes)
+        {
+            if(!CheckCollisionAxis(axis, obj1, obj2, shape1, shape2, &cur_colData))
+            {
+                if(cache)
+                {
+                    cache->Direction = axis;
+                    cache->Valid     = true;
+                }
+                return false;
+            }
 
-        for(uint32_t i = 0; i < possibleCollisionAxesCount; i++)
+            if(cur_colData.penetration >= best_colData.penetration)
+                best_colData = cur_colData;
+        }
+
+        // Edge contacts only win when clearly shallower, face contacts give a full manifold
+        const float edgeAxisBias = 0.001f;
+        for(const Vec3& axis : edgeAxes)
         {
-            const Vec3& axis = possibleCollisionAxes[i];
             if(!CheckCollisionAxis(axis, obj1, obj2, shape1, shape2, &cur_colData))
+            {
+                if(cache)
+                {
+                    cache->Direction = axis;
+                    cache->Valid     = true;
+                }
                 return false;
+            }
 
-            if(cur_colData.penetration > best_colData.penetration)
+            if(cur_colData.penetration > best_colData.penetration + edgeAxisBias)
                 best_colData = cur_colData;
         }
 
+        if(cache)
+            cache->Valid = false;
+
         if(out_coldata)
             *out_coldata = best_colData;
 
         return true;
     }
 
-    bool CollisionDetection::CheckPolyhedronCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
+    bool CollisionDetection::CheckConvexCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata, GJKCache* cache)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
-        CollisionData cur_colData;
-        CollisionData best_colData;
-        best_colData.penetration = -FLT_MAX;
-
-        TDArray<Vec3>& shape1CollisionAxes         = shape1->GetCollisionAxes(obj1);
-        TDArray<Vec3>& shape2PossibleCollisionAxes = shape2->GetCollisionAxes(obj2);
-
-        static const int MAX_COLLISION_AXES = 100;
-        static Vec3 possibleCollisionAxes[MAX_COLLISION_AXES];
-
-        uint32_t possibleCollisionAxesCount = 0;
-        for(const Vec3& axis : shape1CollisionAxes)
-        {
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
-        }
-
-        for(const Vec3& axis : shape2PossibleCollisionAxes)
-        {
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
-        }
-
-        TDArray<CollisionEdge>& shape1_edges = shape1->GetEdges(obj1);
-        TDArray<CollisionEdge>& shape2_edges = shape2->GetEdges(obj2);
+        GJKContact contact;
+        if(!GJK::Penetration(GJKShape::FromBody(obj1), GJKShape::FromBody(obj2), contact, cache))
+            return false;
 
-        for(uint32_t i = 0; i < possibleCollisionAxesCount; i++)
+        // Same convention as the SAT tests, the normal points from obj1 to obj2 and the penetration is negative
+        if(out_coldata)
         {
-            const Vec3& axis = possibleCollisionAxes[i];
-            if(!CheckCollisionAxis(axis, obj1, obj2, shape1, shape2, &cur_colData))
-                return false;
-
-            if(cur_colData.penetration >= best_colData.penetration)
-                best_colData = cur_colData;
+            out_coldata->normal       = contact.Normal;
+            out_coldata->penetration  = -contact.Depth;
+            out_coldata->pointOnPlane = contact.PointB;
         }
 
-        if(out_coldata)
-            *out_coldata = best_colData;
-
         return true;
     }
 
@@ -221,7 +209,7 @@ namespace Lumos
         return (Maths::Length(Maths::Cross((point - linePointA), (point - linePointB)))) / distAB;
     }
 
-    bool CollisionDetection::CheckCapsuleCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
+    bool CollisionDetection::CheckCapsuleCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata, GJKCache* cache)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         CapsuleCollisionShape* capsuleShape1 = static_cast<CapsuleCollisionShape*>(shape1);
@@ -464,7 +452,7 @@ namespace Lumos
         return false;
     }
 
-    bool CollisionDetection::CheckCapsuleSphereCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
+    bool CollisionDetection::CheckCapsuleSphereCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata, GJKCache* cache)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         ASSERT(shape1->GetType() == CollisionShapeType::CollisionSphere || shape2->GetType() == CollisionShapeType::CollisionSphere, "Both shapes are not spheres");
@@ -586,80 +574,6 @@ namespace Lumos
         return false;
     }
 
-    bool CollisionDetection::CheckPolyhedronCapsuleCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
-    {
-        LUMOS_PROFILE_FUNCTION_LOW();
-        CollisionShape* complexShape;
-        CapsuleCollisionShape* capsuleShape;
-        RigidBody3D* complexObj;
-        RigidBody3D* capsuleObj;
-
-        if(obj1->GetCollisionShape()->GetType() == CollisionShapeType::CollisionCapsule)
-        {
-            capsuleObj   = obj1;
-            complexShape = shape2;
-            complexObj   = obj2;
-            capsuleShape = (CapsuleCollisionShape*)shape1;
-        }
-        else
-        {
-            capsuleObj   = obj2;
-            complexShape = shape1;
-            complexObj   = obj1;
-            capsuleShape = (CapsuleCollisionShape*)shape2;
-        }
-
-        CollisionData cur_colData;
-        CollisionData best_colData;
-        best_colData.penetration = -FLT_MAX;
-
-        TDArray<Vec3>& shapeCollisionAxes           = complexShape->GetCollisionAxes(complexObj);
-        TDArray<CollisionEdge>& complex_shape_edges = complexShape->GetEdges(complexObj);
-
-        Vec3 p   = GetClosestPointOnEdges(capsuleObj->GetPosition(), complex_shape_edges);
-        Vec3 p_t = capsuleObj->GetPosition() - p;
-        p_t.Normalise();
-
-        static const int MAX_COLLISION_AXES = 100;
-        static Vec3 possibleCollisionAxes[MAX_COLLISION_AXES];
-
-        uint32_t possibleCollisionAxesCount = 0;
-        for(const Vec3& axis : shapeCollisionAxes)
-        {
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
-        }
-
-        AddPossibleCollisionAxis(p_t, possibleCollisionAxes, possibleCollisionAxesCount);
-
-        Vec3 capsulePos = capsuleObj->GetPosition();
-        Vec4 forward    = Vec4(0.0f, 0.0f, 1.0f, 0.0f);
-        Vec3 capsuleDir = capsuleObj->GetWorldSpaceTransform() * forward;
-
-        float capsuleRadius = capsuleShape->GetRadius();
-        float capsuleHeight = capsuleShape->GetHeight();
-
-        float capsuleTop    = capsulePos.y + capsuleHeight * 0.5f;
-        float capsuleBottom = capsulePos.y - capsuleHeight * 0.5f;
-
-        for(uint32_t i = 0; i < possibleCollisionAxesCount; i++)
-        {
-            const Vec3& axis = possibleCollisionAxes[i];
-            if(!CheckCollisionAxis(axis, obj1, obj2, shape1, shape2, &cur_colData))
-                return false;
-
-            if(cur_colData.penetration >= best_colData.penetration)
-                best_colData = cur_colData;
-        }
-
-        if(Maths::Dot(best_colData.normal, capsuleDir) < 0.0f)
-            best_colData.normal = -best_colData.normal;
-
-        if(out_coldata)
-            *out_coldata = best_colData;
-
-        return true;
-    }
-
     bool CollisionDetection::CheckCollisionAxis(const Vec3& axis, RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
@@ -699,12 +613,130 @@ namespace Lumos
         return false;
     }
 
+    // Contacts between the convex body and the triangles of the concave body near it. Each contact has the
+    // triangle as shape A, so normals point from the concave body towards the convex one
+    static void GetTriangleContacts(RigidBody3D* concaveBody, const ConcaveCollisionShape* concaveShape, RigidBody3D* convexBody, TDArray<Vec3>& triangles, TDArray<GJKContact>& outContacts)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        concaveShape->GetWorldTriangles(concaveBody, convexBody->GetWorldSpaceAABB(), triangles);
+        if(triangles.Empty())
+            return;
+
+        const GJKShape convex = GJKShape::FromBody(convexBody);
+        for(uint32_t i = 0; i + 2 < triangles.Size(); i += 3)
+        {
+            GJKContact contact;
+            if(GJK::Penetration(GJKShape::FromTriangle(triangles[i], triangles[i + 1], triangles[i + 2]), convex, contact))
+                outContacts.PushBack(contact);
+        }
+    }
+
+    // Adjacent triangles report the same part of the convex body, only the deepest contact near each point is kept
+    static uint32_t MergeTriangleContacts(TDArray<GJKContact>& contacts, GJKContact* outContacts, uint32_t maxContacts)
+    {
+        const float minDistSq = 0.2f * 0.2f; // Matches the spacing Manifold::AddContact keeps between points
+
+        std::sort(contacts.Data(), contacts.Data() + contacts.Size(), [](const GJKContact& a, const GJKContact& b)
+                  { return a.Depth > b.Depth; });
+
+        uint32_t count = 0;
+        for(const GJKContact& contact : contacts)
+        {
+            bool duplicate = false;
+            for(uint32_t i = 0; i < count; i++)
+            {
+                Vec3 offset = outContacts[i].PointB - contact.PointB;
+                if(Maths::Dot(offset, offset) < minDistSq)
+                {
+                    duplicate = true;
+                    break;
+                }
+            }
+
+            if(duplicate)
+                continue;
+
+            outContacts[count++] = contact;
+            if(count == maxContacts)
+                break;
+        }
+
+        return count;
+    }
+
+    bool CollisionDetection::CheckConcaveCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata, GJKCache* cache)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const bool concave1 = ConcaveCollisionShape::IsConcave(shape1->GetType());
+        const bool concave2 = ConcaveCollisionShape::IsConcave(shape2->GetType());
+
+        // Triangle soups have no inside to test against each other
+        if(concave1 == concave2)
+            return false;
+
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        TDArray<Vec3> triangles(scratch.arena);
+        TDArray<GJKContact> contacts(scratch.arena);
+
+        if(concave1)
+            GetTriangleContacts(obj1, (ConcaveCollisionShape*)shape1, obj2, triangles, contacts);
+        else
+            GetTriangleContacts(obj2, (ConcaveCollisionShape*)shape2, obj1, triangles, contacts);
+
+        GJKContact merged[MAX_CONTACT_POINTS];
+        uint32_t count = MergeTriangleContacts(contacts, merged, MAX_CONTACT_POINTS);
+        ScratchEnd(scratch);
+
+        if(out_coldata)
+        {
+            out_coldata->contactCount = count;
+            for(uint32_t i = 0; i < count; i++)
+            {
+                // Triangles are shape A of their contacts, flip them when the concave body is obj2
+                GJKContact& contact = out_coldata->contacts[i];
+                contact             = merged[i];
+                if(!concave1)
+                {
+                    contact.Normal = -merged[i].Normal;
+                    contact.PointA = merged[i].PointB;
+                    contact.PointB = merged[i].PointA;
+                }
+            }
+
+            if(count > 0)
+            {
+                const GJKContact& deepest = out_coldata->contacts[0];
+                out_coldata->normal       = deepest.Normal;
+                out_coldata->penetration  = -deepest.Depth;
+                out_coldata->pointOnPlane = deepest.PointB;
+            }
+        }
+
+        return count > 0;
+    }
+
+    bool CollisionDetection::BuildConcaveManifold(const CollisionData& coldata, Manifold* manifold)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        // Contacts were already found and merged by CheckConcaveCollision
+        for(uint32_t i = 0; i < coldata.contactCount; i++)
+        {
+            const GJKContact& contact = coldata.contacts[i];
+            manifold->AddContact(contact.PointA, contact.PointB, contact.Normal, -contact.Depth);
+        }
+
+        return coldata.contactCount > 0;
+    }
+
     bool CollisionDetection::BuildCollisionManifold(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData& coldata, Manifold* manifold)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         if(!manifold)
             return false;
 
+        if(ConcaveCollisionShape::IsConcave(shape1->GetType()) || ConcaveCollisionShape::IsConcave(shape2->GetType()))
+            return BuildConcaveManifold(coldata, manifold);
+
         ReferencePolygon poly1, poly2;
         shape1->GetIncidentReferencePolygon(obj1, coldata.normal, poly1);
         shape2->GetIncidentReferencePolygon(obj2, -coldata.normal, poly2);
@@ -804,43 +836,6 @@ namespace Lumos
         return true;
     }
 
-    Vec3 CollisionDetection::GetClosestPointOnEdges(const Vec3& target, const TDArray<CollisionEdge>& edges)
-    {
-        LUMOS_PROFILE_FUNCTION_LOW();
-        Vec3 closest_point      = Vec3(0.0f);
-        Vec3 temp_closest_point = Vec3(0.0f);
-        float closest_distsq    = FLT_MAX;
-
-        for(const CollisionEdge& edge : edges)
-        {
-            Vec3 a_t = target - edge.posA;
-            Vec3 a_b = edge.posB - edge.posA;
-
-            float magnitudeAB = Maths::Dot(a_b, a_b);      // Magnitude of AB vector (it's length squared)
-            float ABAPproduct = Maths::Dot(a_t, a_b);      // The DOT product of a_to_t and a_to_b
-            float distance    = ABAPproduct / magnitudeAB; // The Normalised "distance" from a to your closest point
-
-            if(distance < 0.0f) // Clamp returned point to be on the line, e.g if the closest point is beyond the AB return either A or B as closest points
-                temp_closest_point = edge.posA;
-
-            else if(distance > 1)
-                temp_closest_point = edge.posB;
-            else
-                temp_closest_point = edge.posA + a_b * distance;
-
-            Vec3 c_t          = target - temp_closest_point;
-            float temp_distsq = Maths::Dot(c_t, c_t);
-
-            if(temp_distsq < closest_distsq)
-            {
-                closest_distsq = temp_distsq;
-                closest_point  = temp_closest_point;
-            }
-        }
-
-        return closest_point;
-    }
-
     Vec3 CollisionDetection::PlaneEdgeIntersection(const Plane& plane, const Vec3& start, const Vec3& end) const
     {
         Vec3 ab = end - start;
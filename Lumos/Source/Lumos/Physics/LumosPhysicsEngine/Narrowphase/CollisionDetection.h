@@ -3,6 +3,7 @@
 #include "Physics/LumosPhysicsEngine/RigidBody3D.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/CollisionShape.h"
 #include "Manifold.h"
+#include "GJK.h"
 #include "Utilities/TSingleton.h"
 #include "Core/DataStructures/TDArray.h"
 
@@ -15,12 +16,17 @@ namespace Lumos
         float penetration;
         Vec3 normal;
         Vec3 pointOnPlane;
+
+        // Concave checks keep the contacts they found, merged and deepest first, so the manifold doesn't
+        // search the triangles again. Oriented with obj1 as shape A
+        uint32_t contactCount = 0;
+        GJKContact contacts[MAX_CONTACT_POINTS];
     };
 
     class LUMOS_EXPORT CollisionDetection : public ThreadSafeSingleton<CollisionDetection>
     {
         friend class TSingleton<CollisionDetection>;
-        typedef bool (CollisionDetection::*CollisionCheckFunc)(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata);
+        typedef bool (CollisionDetection::*CollisionCheckFunc)(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata, GJKCache* cache);
 
         CollisionCheckFunc* m_CollisionCheckFunctions;
 
@@ -32,7 +38,8 @@ namespace Lumos
                 delete[] m_CollisionCheckFunctions;
         }
 
-        bool CheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
+        // cache carries the separating axis or GJK direction between steps for one pair, it is only touched by this call
+        bool CheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr, GJKCache* cache = nullptr);
 
         bool BuildCollisionManifold(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData& coldata, Manifold* out_manifold);
 
@@ -43,17 +50,18 @@ namespace Lumos
         static bool CheckAABBInsideAABB(const Vec3& AABBInsideCenter, const Vec3& AABBInsideHalfVol, const Vec3& AABBCenter, const Vec3& AABBHalfVol);
 
     protected:
-        bool CheckPolyhedronCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
-        bool CheckPolyhedronSphereCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
-        bool CheckSphereCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
-        bool CheckCapsuleCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
-        bool CheckCapsuleSphereCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
-        bool CheckPolyhedronCapsuleCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
-        bool InvalidCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
+        bool CheckCuboidCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr, GJKCache* cache = nullptr);
+        bool CheckConvexCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr, GJKCache* cache = nullptr);
+        bool CheckSphereCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr, GJKCache* cache = nullptr);
+        bool CheckCapsuleCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr, GJKCache* cache = nullptr);
+        bool CheckCapsuleSphereCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr, GJKCache* cache = nullptr);
+        bool CheckConcaveCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr, GJKCache* cache = nullptr);
+        bool InvalidCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr, GJKCache* cache = nullptr);
+
+        bool BuildConcaveManifold(const CollisionData& coldata, Manifold* manifold);
 
         static bool CheckCollisionAxis(const Vec3& axis, RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata);
 
-        static Vec3 GetClosestPointOnEdges(const Vec3& target, const TDArray<CollisionEdge>& edges);
         Vec3 PlaneEdgeIntersection(const Plane& plane, const Vec3& start, const Vec3& end) const;
         void SutherlandHodgesonClipping(Arena* arena, const TDArray<Vec3>& input_polygon, int num_clip_planes, const Plane* clip_planes, TDArray<Vec3>* out_polygon, bool removePoints) const;
         uint32_t m_MaxSize = 0;
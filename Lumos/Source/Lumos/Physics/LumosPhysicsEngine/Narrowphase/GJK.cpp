@@ -0,0 +1,784 @@
+#include "Precompiled.h"
+#include "GJK.h"
+#include "Physics/LumosPhysicsEngine/RigidBody3D.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/SphereCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/CapsuleCollisionShape.h"
+#include "Maths/MathsUtilities.h"
+#include "Maths/Matrix4.h"
+#include "Maths/Vector4.h"
+
+namespace Lumos
+{
+    GJKShape GJKShape::FromPoint(const Vec3& point, float radius)
+    {
+        GJKShape shape;
+        shape.ShapeType = Type::Point;
+        shape.A         = point;
+        shape.Radius    = radius;
+        return shape;
+    }
+
+    GJKShape GJKShape::FromSegment(const Vec3& a, const Vec3& b, float radius)
+    {
+        GJKShape shape;
+        shape.ShapeType = Type::Segment;
+        shape.A         = a;
+        shape.B         = b;
+        shape.Radius    = radius;
+        return shape;
+    }
+
+    GJKShape GJKShape::FromTriangle(const Vec3& a, const Vec3& b, const Vec3& c)
+    {
+        GJKShape shape;
+        shape.ShapeType = Type::Triangle;
+        shape.A         = a;
+        shape.B         = b;
+        shape.C         = c;
+        return shape;
+    }
+
+    GJKShape GJKShape::FromBox(const Vec3& centre, const Quat& orientation, const Vec3& halfExtents)
+    {
+        GJKShape shape;
+        shape.ShapeType = Type::Box;
+        shape.A         = centre;
+        shape.B         = halfExtents;
+        shape.Rotation  = orientation.ToMatrix3();
+        return shape;
+    }
+
+    GJKShape GJKShape::FromBody(const RigidBody3D* body)
+    {
+        const CollisionShape* collisionShape = body->GetCollisionShape().get();
+        const Mat4& transform                = body->GetWorldSpaceTransform();
+
+        switch(collisionShape->GetType())
+        {
+        case CollisionShapeType::CollisionSphere:
+        {
+            GJKShape shape = FromPoint(transform.GetPositionVector(), static_cast<const SphereCollisionShape*>(collisionShape)->GetRadius());
+            shape.Body     = body;
+            shape.Shape    = collisionShape;
+            return shape;
+        }
+        case CollisionShapeType::CollisionCapsule:
+        {
+            const CapsuleCollisionShape* capsule = static_cast<const CapsuleCollisionShape*>(collisionShape);
+            Vec3 top                             = Vec3(transform * Vec4(0.0f, capsule->GetHeight() * 0.5f, 0.0f, 1.0f));
+            Vec3 bottom                          = Vec3(transform * Vec4(0.0f, -capsule->GetHeight() * 0.5f, 0.0f, 1.0f));
+
+            GJKShape shape = FromSegment(top, bottom, capsule->GetRadius());
+            shape.Body     = body;
+            shape.Shape    = collisionShape;
+            return shape;
+        }
+        default:
+        {
+            GJKShape shape;
+            shape.ShapeType = Type::Body;
+            shape.Body      = body;
+            shape.Shape     = collisionShape;
+            return shape;
+        }
+        }
+    }
+
+    Vec3 GJKShape::Support(const Vec3& direction) const
+    {
+        switch(ShapeType)
+        {
+        case Type::Point:
+            return A + Offset;
+        case Type::Segment:
+            return (Maths::Dot(A, direction) >= Maths::Dot(B, direction) ? A : B) + Offset;
+        case Type::Triangle:
+        {
+            float dotA = Maths::Dot(A, direction);
+            float dotB = Maths::Dot(B, direction);
+            float dotC = Maths::Dot(C, direction);
+            if(dotA >= dotB && dotA >= dotC)
+                return A + Offset;
+            return (dotB >= dotC ? B : C) + Offset;
+        }
+        case Type::Box:
+        {
+            Vec3 local = Mat3::Transpose(Rotation) * direction;
+            Vec3 corner(local.x >= 0.0f ? B.x : -B.x, local.y >= 0.0f ? B.y : -B.y, local.z >= 0.0f ? B.z : -B.z);
+            return A + Rotation * corner + Offset;
+        }
+        case Type::Body:
+        default:
+        {
+            Vec3 support;
+            Shape->GetMinMaxVertexOnAxis(Body, direction, nullptr, &support);
+            return support + Offset;
+        }
+        }
+    }
+
+    Vec3 GJKShape::GetCentre() const
+    {
+        switch(ShapeType)
+        {
+        case Type::Segment:
+            return (A + B) * 0.5f + Offset;
+        case Type::Triangle:
+            return (A + B + C) / 3.0f + Offset;
+        case Type::Body:
+            return Body->GetWorldSpaceTransform().GetPositionVector() + Offset;
+        default:
+            return A + Offset;
+        }
+    }
+
+    namespace
+    {
+        struct Simplex
+        {
+            Vec3 W[4]; // Points of the Minkowski difference A - B
+            Vec3 A[4]; // Support points on A and B that made them
+            Vec3 B[4];
+            float Weights[4];
+            uint32_t Count = 0;
+        };
+
+        // Barycentric weights of the point on triangle abc closest to the origin (Ericson, Real-Time Collision Detection 5.1.5)
+        void ClosestOnTriangle(const Vec3& a, const Vec3& b, const Vec3& c, float outWeights[3])
+        {
+            Vec3 ab  = b - a;
+            Vec3 ac  = c - a;
+            float d1 = -Maths::Dot(ab, a);
+            float d2 = -Maths::Dot(ac, a);
+            if(d1 <= 0.0f && d2 <= 0.0f)
+            {
+                outWeights[0] = 1.0f, outWeights[1] = 0.0f, outWeights[2] = 0.0f;
+                return;
+            }
+
+            float d3 = -Maths::Dot(ab, b);
+            float d4 = -Maths::Dot(ac, b);
+            if(d3 >= 0.0f && d4 <= d3)
+            {
+                outWeights[0] = 0.0f, outWeights[1] = 1.0f, outWeights[2] = 0.0f;
+                return;
+            }
+
+            float vc = d1 * d4 - d3 * d2;
+            if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+            {
+                float v       = d1 / (d1 - d3);
+                outWeights[0] = 1.0f - v, outWeights[1] = v, outWeights[2] = 0.0f;
+                return;
+            }
+
+            float d5 = -Maths::Dot(ab, c);
+            float d6 = -Maths::Dot(ac, c);
+            if(d6 >= 0.0f && d5 <= d6)
+            {
+                outWeights[0] = 0.0f, outWeights[1] = 0.0f, outWeights[2] = 1.0f;
+                return;
+            }
+
+            float vb = d5 * d2 - d1 * d6;
+            if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+            {
+                float w       = d2 / (d2 - d6);
+                outWeights[0] = 1.0f - w, outWeights[1] = 0.0f, outWeights[2] = w;
+                return;
+            }
+
+            float va = d3 * d6 - d5 * d4;
+            if(va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+            {
+                float w       = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                outWeights[0] = 0.0f, outWeights[1] = 1.0f - w, outWeights[2] = w;
+                return;
+            }
+
+            float denom   = 1.0f / (va + vb + vc);
+            float v       = vb * denom;
+            float w       = vc * denom;
+            outWeights[0] = 1.0f - v - w, outWeights[1] = v, outWeights[2] = w;
+        }
+
+        // Keeps the vertices in indices that have a non zero weight
+        void Reduce(Simplex& simplex, const uint32_t* indices, const float* weights, uint32_t count)
+        {
+            Simplex reduced;
+            for(uint32_t i = 0; i < count; i++)
+            {
+                if(weights[i] <= 0.0f)
+                    continue;
+
+                uint32_t source                = indices[i];
+                reduced.W[reduced.Count]       = simplex.W[source];
+                reduced.A[reduced.Count]       = simplex.A[source];
+                reduced.B[reduced.Count]       = simplex.B[source];
+                reduced.Weights[reduced.Count] = weights[i];
+                reduced.Count++;
+            }
+
+            simplex = reduced;
+        }
+
+        // Reduces the simplex to the smallest feature containing the point closest to the origin and returns that point.
+        // A tetrahedron that contains the origin is left whole
+        Vec3 Solve(Simplex& simplex)
+        {
+            switch(simplex.Count)
+            {
+            case 1:
+            {
+                simplex.Weights[0] = 1.0f;
+                break;
+            }
+            case 2:
+            {
+                Vec3 ab        = simplex.W[1] - simplex.W[0];
+                float lengthSq = Maths::Dot(ab, ab);
+                float t        = lengthSq > 0.0f ? -Maths::Dot(simplex.W[0], ab) / lengthSq : 0.0f;
+                t              = Maths::Clamp(t, 0.0f, 1.0f);
+
+                const uint32_t indices[2] = { 0, 1 };
+                const float weights[2]    = { 1.0f - t, t };
+                Reduce(simplex, indices, weights, 2);
+                break;
+            }
+            case 3:
+            {
+                float weights[3];
+                ClosestOnTriangle(simplex.W[0], simplex.W[1], simplex.W[2], weights);
+
+                const uint32_t indices[3] = { 0, 1, 2 };
+                Reduce(simplex, indices, weights, 3);
+                break;
+            }
+            case 4:
+            {
+                static const uint32_t faces[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+
+                float closestDistance       = FLT_MAX;
+                float closestWeights[3]     = { 0.0f, 0.0f, 0.0f };
+                const uint32_t* closestFace = nullptr;
+
+                for(uint32_t f = 0; f < 4; f++)
+                {
+                    const Vec3& a        = simplex.W[faces[f][0]];
+                    const Vec3& b        = simplex.W[faces[f][1]];
+                    const Vec3& c        = simplex.W[faces[f][2]];
+                    const Vec3& opposite = simplex.W[faces[f][3]];
+
+                    Vec3 normal      = Maths::Cross(b - a, c - a);
+                    float originSide = -Maths::Dot(normal, a);
+                    float otherSide  = Maths::Dot(normal, opposite - a);
+
+                    // Skip faces with the origin on the inside, a flat tetrahedron tests every face
+                    if(originSide * otherSide > 0.0f && Maths::Abs(otherSide) > 1e-12f)
+                        continue;
+
+                    float weights[3];
+                    ClosestOnTriangle(a, b, c, weights);
+                    Vec3 point       = a * weights[0] + b * weights[1] + c * weights[2];
+                    float distanceSq = Maths::Dot(point, point);
+                    if(distanceSq < closestDistance)
+                    {
+                        closestDistance   = distanceSq;
+                        closestWeights[0] = weights[0];
+                        closestWeights[1] = weights[1];
+                        closestWeights[2] = weights[2];
+                        closestFace       = faces[f];
+                    }
+                }
+
+                if(!closestFace)
+                    return Vec3(0.0f);
+
+                Reduce(simplex, closestFace, closestWeights, 3);
+                break;
+            }
+            default:
+                break;
+            }
+
+            Vec3 point(0.0f);
+            for(uint32_t i = 0; i < simplex.Count; i++)
+                point += simplex.W[i] * simplex.Weights[i];
+            return point;
+        }
+
+        // Runs GJK from the cached direction, or the centres when there is none. Returns true when the cores overlap,
+        // otherwise simplex holds the feature closest to the origin and outClosest the closest point of A - B
+        bool Evolve(const GJKShape& a, const GJKShape& b, const GJKCache* cache, Simplex& simplex, Vec3& outClosest, uint32_t& outIterations)
+        {
+            const float epsilon = 1e-10f;
+
+            Vec3 direction = cache && cache->Valid ? cache->Direction : a.GetCentre() - b.GetCentre();
+            if(Maths::Dot(direction, direction) < epsilon)
+                direction = Vec3(1.0f, 0.0f, 0.0f);
+
+            simplex.A[0]       = a.Support(-direction);
+            simplex.B[0]       = b.Support(direction);
+            simplex.W[0]       = simplex.A[0] - simplex.B[0];
+            simplex.Weights[0] = 1.0f;
+            simplex.Count      = 1;
+
+            Vec3 v        = simplex.W[0];
+            outIterations = 0;
+
+            for(uint32_t iteration = 0; iteration < GJK::MaxIterations; iteration++)
+            {
+                outIterations = iteration + 1;
+
+                float distanceSq = Maths::Dot(v, v);
+                if(distanceSq < epsilon)
+                {
+                    outClosest = v;
+                    return true;
+                }
+
+                Vec3 supportA = a.Support(-v);
+                Vec3 supportB = b.Support(v);
+                Vec3 w        = supportA - supportB;
+
+                // The new point gets no closer to the origin than v, so v is the closest point
+                if(distanceSq - Maths::Dot(v, w) <= 1e-6f * distanceSq)
+                    break;
+
+                bool duplicate = false;
+                for(uint32_t i = 0; i < simplex.Count; i++)
+                    duplicate |= Maths::Dot(simplex.W[i] - w, simplex.W[i] - w) < epsilon;
+                if(duplicate)
+                    break;
+
+                Simplex previous         = simplex;
+                simplex.A[simplex.Count] = supportA;
+                simplex.B[simplex.Count] = supportB;
+                simplex.W[simplex.Count] = w;
+                simplex.Count++;
+
+                Vec3 next = Solve(simplex);
+                if(simplex.Count == 4)
+                {
+                    outClosest = Vec3(0.0f);
+                    return true;
+                }
+
+                // Rounding can stop the distance shrinking near the end, keep the last good simplex
+                if(Maths::Dot(next, next) >= distanceSq)
+                {
+                    simplex = previous;
+                    break;
+                }
+
+                v = next;
+            }
+
+            outClosest = v;
+            return false;
+        }
+
+        // Adds the support point of A - B along direction, unless it is already in the simplex
+        bool AddSupport(const GJKShape& a, const GJKShape& b, const Vec3& direction, Simplex& simplex)
+        {
+            Vec3 supportA = a.Support(direction);
+            Vec3 supportB = b.Support(-direction);
+            Vec3 w        = supportA - supportB;
+
+            for(uint32_t i = 0; i < simplex.Count; i++)
+            {
+                if(Maths::Dot(simplex.W[i] - w, simplex.W[i] - w) < 1e-10f)
+                    return false;
+            }
+
+            simplex.A[simplex.Count] = supportA;
+            simplex.B[simplex.Count] = supportB;
+            simplex.W[simplex.Count] = w;
+            simplex.Count++;
+            return true;
+        }
+
+        // GJK can stop on a point, segment or triangle that touches the origin. EPA needs a tetrahedron, so grow
+        // the simplex with support points off the current feature. Fails for flat differences, e.g. two segments
+        bool CompleteTetrahedron(const GJKShape& a, const GJKShape& b, Simplex& simplex)
+        {
+            static const Vec3 axes[6] = { Vec3(1.0f, 0.0f, 0.0f), Vec3(-1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f),
+                                          Vec3(0.0f, -1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), Vec3(0.0f, 0.0f, -1.0f) };
+
+            if(simplex.Count == 1)
+            {
+                for(uint32_t i = 0; i < 6 && simplex.Count == 1; i++)
+                    AddSupport(a, b, axes[i], simplex);
+            }
+
+            if(simplex.Count == 2)
+            {
+                Vec3 line = simplex.W[1] - simplex.W[0];
+
+                // Search around the segment, starting from the axis it is least aligned with
+                Vec3 axis      = axes[0];
+                float smallest = Maths::Abs(line.x);
+                if(Maths::Abs(line.y) < smallest)
+                {
+                    axis     = axes[2];
+                    smallest = Maths::Abs(line.y);
+                }
+                if(Maths::Abs(line.z) < smallest)
+                    axis = axes[4];
+
+                Vec3 p                   = Maths::Cross(line, axis);
+                Vec3 q                   = Maths::Cross(line, p);
+                const Vec3 directions[4] = { p, -p, q, -q };
+
+                for(uint32_t i = 0; i < 4 && simplex.Count == 2; i++)
+                {
+                    if(!AddSupport(a, b, directions[i], simplex))
+                        continue;
+
+                    if(Maths::Length2(Maths::Cross(simplex.W[2] - simplex.W[0], line)) <= 1e-10f * Maths::Length2(line))
+                        simplex.Count--;
+                }
+            }
+
+            if(simplex.Count == 3)
+            {
+                Vec3 normal              = Maths::Cross(simplex.W[1] - simplex.W[0], simplex.W[2] - simplex.W[0]);
+                const Vec3 directions[2] = { normal, -normal };
+
+                for(uint32_t i = 0; i < 2 && simplex.Count == 3; i++)
+                {
+                    if(!AddSupport(a, b, directions[i], simplex))
+                        continue;
+
+                    if(Maths::Abs(Maths::Dot(simplex.W[3] - simplex.W[0], normal)) <= 1e-6f * Maths::Length(normal))
+                        simplex.Count--;
+                }
+            }
+
+            return simplex.Count == 4;
+        }
+
+        struct EPAFace
+        {
+            uint32_t Indices[3];
+            Vec3 Normal;
+            float Distance;
+        };
+
+        static const uint32_t MaxEPAVertices = 64;
+        static const uint32_t MaxEPAFaces    = 128;
+        static const uint32_t MaxEPAEdges    = 64;
+
+        // Expanding polytope algorithm on a tetrahedron of A - B containing the origin. Everything lives on the
+        // stack so it can run on any thread
+        bool ExpandPolytope(const GJKShape& a, const GJKShape& b, const Simplex& simplex, GJKContact& outContact)
+        {
+            Vec3 vertices[MaxEPAVertices];
+            Vec3 supportsA[MaxEPAVertices];
+            Vec3 supportsB[MaxEPAVertices];
+            EPAFace faces[MaxEPAFaces];
+            uint32_t edges[MaxEPAEdges][2];
+            uint32_t vertexCount = 4;
+            uint32_t faceCount   = 0;
+
+            for(uint32_t i = 0; i < 4; i++)
+            {
+                vertices[i]  = simplex.W[i];
+                supportsA[i] = simplex.A[i];
+                supportsB[i] = simplex.B[i];
+            }
+
+            // Wind the first face away from the fourth vertex, the others follow from it
+            if(Maths::Dot(Maths::Cross(vertices[1] - vertices[0], vertices[2] - vertices[0]), vertices[3] - vertices[0]) > 0.0f)
+            {
+                Swap(vertices[1], vertices[2]);
+                Swap(supportsA[1], supportsA[2]);
+                Swap(supportsB[1], supportsB[2]);
+            }
+
+            auto addFace = [&](uint32_t i0, uint32_t i1, uint32_t i2)
+            {
+                if(faceCount == MaxEPAFaces)
+                    return false;
+
+                EPAFace& face   = faces[faceCount++];
+                face.Indices[0] = i0;
+                face.Indices[1] = i1;
+                face.Indices[2] = i2;
+
+                Vec3 normal  = Maths::Cross(vertices[i1] - vertices[i0], vertices[i2] - vertices[i0]);
+                float length = Maths::Length(normal);
+
+                // A sliver face is never picked as the closest, its neighbours cover it
+                face.Normal   = length > 1e-12f ? normal / length : Vec3(0.0f);
+                face.Distance = length > 1e-12f ? Maths::Dot(face.Normal, vertices[i0]) : FLT_MAX;
+                return true;
+            };
+
+            addFace(0, 1, 2);
+            addFace(0, 3, 1);
+            addFace(0, 2, 3);
+            addFace(1, 3, 2);
+
+            uint32_t closest = 0;
+            for(uint32_t iteration = 0; iteration < GJK::MaxEPAIterations; iteration++)
+            {
+                closest = 0;
+                for(uint32_t i = 1; i < faceCount; i++)
+                {
+                    if(faces[i].Distance < faces[closest].Distance)
+                        closest = i;
+                }
+
+                const EPAFace face = faces[closest];
+                if(face.Distance == FLT_MAX)
+                    return false;
+
+                Vec3 supportA = a.Support(face.Normal);
+                Vec3 supportB = b.Support(-face.Normal);
+                Vec3 w        = supportA - supportB;
+
+                // The polytope can't grow past this face, it is on the boundary of A - B
+                if(Maths::Dot(w, face.Normal) - face.Distance < 1e-4f || vertexCount == MaxEPAVertices)
+                    break;
+
+                uint32_t newIndex   = vertexCount++;
+                vertices[newIndex]  = w;
+                supportsA[newIndex] = supportA;
+                supportsB[newIndex] = supportB;
+
+                // Remove every face the new point sees, keeping the edges on the horizon
+                uint32_t edgeCount = 0;
+                for(uint32_t f = 0; f < faceCount;)
+                {
+                    if(Maths::Dot(faces[f].Normal, w - vertices[faces[f].Indices[0]]) <= 0.0f)
+                    {
+                        f++;
+                        continue;
+                    }
+
+                    for(uint32_t e = 0; e < 3; e++)
+                    {
+                        uint32_t from = faces[f].Indices[e];
+                        uint32_t to   = faces[f].Indices[(e + 1) % 3];
+
+                        // An edge shared with another removed face is inside the hole
+                        bool shared = false;
+                        for(uint32_t i = 0; i < edgeCount; i++)
+                        {
+                            if(edges[i][0] == to && edges[i][1] == from)
+                            {
+                                edges[i][0] = edges[edgeCount - 1][0];
+                                edges[i][1] = edges[edgeCount - 1][1];
+                                edgeCount--;
+                                shared = true;
+                                break;
+                            }
+                        }
+
+                        if(!shared)
+                        {
+                            if(edgeCount == MaxEPAEdges)
+                                return false;
+
+                            edges[edgeCount][0] = from;
+                            edges[edgeCount][1] = to;
+                            edgeCount++;
+                        }
+                    }
+
+                    faces[f] = faces[--faceCount];
+                }
+
+                for(uint32_t i = 0; i < edgeCount; i++)
+                {
+                    if(!addFace(edges[i][0], edges[i][1], newIndex))
+                        return false;
+                }
+
+                if(faceCount == 0)
+                    return false;
+            }
+
+            closest = 0;
+            for(uint32_t i = 1; i < faceCount; i++)
+            {
+                if(faces[i].Distance < faces[closest].Distance)
+                    closest = i;
+            }
+
+            const EPAFace& face = faces[closest];
+            float weights[3];
+            ClosestOnTriangle(vertices[face.Indices[0]], vertices[face.Indices[1]], vertices[face.Indices[2]], weights);
+
+            outContact.Normal = face.Normal;
+            outContact.Depth  = Maths::Max(face.Distance, 0.0f);
+            outContact.PointA = supportsA[face.Indices[0]] * weights[0] + supportsA[face.Indices[1]] * weights[1] + supportsA[face.Indices[2]] * weights[2];
+            outContact.PointB = supportsB[face.Indices[0]] * weights[0] + supportsB[face.Indices[1]] * weights[1] + supportsB[face.Indices[2]] * weights[2];
+            return true;
+        }
+    }
+
+    void GJK::Distance(const GJKShape& a, const GJKShape& b, GJKResult& outResult, GJKCache* cache)
+    {
+        Simplex simplex;
+        Vec3 v;
+        outResult    = {};
+        bool overlap = Evolve(a, b, cache, simplex, v, outResult.Iterations);
+
+        if(cache)
+        {
+            cache->Direction = v;
+            cache->Valid     = !overlap;
+        }
+
+        if(overlap)
+        {
+            outResult.CoresOverlap = true;
+            outResult.Distance     = -(a.Radius + b.Radius);
+            return;
+        }
+
+        Vec3 pointA(0.0f), pointB(0.0f);
+        for(uint32_t i = 0; i < simplex.Count; i++)
+        {
+            pointA += simplex.A[i] * simplex.Weights[i];
+            pointB += simplex.B[i] * simplex.Weights[i];
+        }
+
+        float coreDistance = Maths::Length(v);
+        outResult.Normal   = -v / coreDistance;
+        outResult.PointA   = pointA + outResult.Normal * a.Radius;
+        outResult.PointB   = pointB - outResult.Normal * b.Radius;
+        outResult.Distance = coreDistance - a.Radius - b.Radius;
+    }
+
+    bool GJK::Penetration(const GJKShape& a, const GJKShape& b, GJKContact& outContact, GJKCache* cache)
+    {
+        const float radii = a.Radius + b.Radius;
+
+        // A - B still lies entirely past the last separating direction, so the pair hasn't closed the gap
+        if(cache && cache->Valid)
+        {
+            float length = Maths::Length(cache->Direction);
+            if(length > 0.0f)
+            {
+                Vec3 axis = cache->Direction / length;
+                if(Maths::Dot(a.Support(-axis) - b.Support(axis), axis) > radii)
+                    return false;
+            }
+        }
+
+        Simplex simplex;
+        Vec3 v;
+        uint32_t iterations;
+        bool overlap = Evolve(a, b, cache, simplex, v, iterations);
+
+        if(!overlap)
+        {
+            if(cache)
+            {
+                cache->Direction = v;
+                cache->Valid     = true;
+            }
+
+            float coreDistance = Maths::Length(v);
+            if(coreDistance >= radii)
+                return false;
+
+            // Only the radii overlap, the closest points of the cores give the contact
+            Vec3 pointA(0.0f), pointB(0.0f);
+            for(uint32_t i = 0; i < simplex.Count; i++)
+            {
+                pointA += simplex.A[i] * simplex.Weights[i];
+                pointB += simplex.B[i] * simplex.Weights[i];
+            }
+
+            outContact.Normal = -v / coreDistance;
+            outContact.Depth  = radii - coreDistance;
+            outContact.PointA = pointA + outContact.Normal * a.Radius;
+            outContact.PointB = pointB - outContact.Normal * b.Radius;
+            return true;
+        }
+
+        if(!CompleteTetrahedron(a, b, simplex) || !ExpandPolytope(a, b, simplex, outContact))
+        {
+            // Flat cores such as crossing segments, push apart along the line between the centres
+            Vec3 axis = b.GetCentre() - a.GetCentre();
+            if(Maths::Length2(axis) < 1e-10f)
+                axis = Vec3(0.0f, 1.0f, 0.0f);
+
+            outContact.Normal = axis.Normalised();
+            outContact.Depth  = radii;
+            outContact.PointA = a.GetCentre() + outContact.Normal * a.Radius;
+            outContact.PointB = b.GetCentre() - outContact.Normal * b.Radius;
+        }
+        else
+        {
+            outContact.Depth += radii;
+            outContact.PointA += outContact.Normal * a.Radius;
+            outContact.PointB -= outContact.Normal * b.Radius;
+        }
+
+        // Seeds the next step with the direction that separates the pair once it is resolved
+        if(cache)
+        {
+            cache->Direction = -outContact.Normal;
+            cache->Valid     = true;
+        }
+
+        return true;
+    }
+
+    bool GJK::Intersect(const GJKShape& a, const GJKShape& b)
+    {
+        GJKResult result;
+        Distance(a, b, result);
+        return result.CoresOverlap || result.Distance <= 0.0f;
+    }
+
+    bool GJK::ShapeCast(const GJKShape& a, const Vec3& direction, float maxDistance, const GJKShape& b, float& outDistance, Vec3& outNormal, Vec3& outPoint)
+    {
+        const float tolerance        = 1e-3f;
+        const uint32_t maxIterations = 32;
+
+        GJKShape moved = a;
+        GJKCache cache;
+        float travelled = 0.0f;
+
+        for(uint32_t iteration = 0; iteration < maxIterations; iteration++)
+        {
+            moved.Offset = a.Offset + direction * travelled;
+
+            GJKResult result;
+            Distance(moved, b, result, &cache);
+
+            if(result.CoresOverlap || result.Distance <= tolerance)
+            {
+                outDistance = travelled;
+                if(result.CoresOverlap || (iteration == 0 && result.Distance <= 0.0f))
+                {
+                    outNormal = -direction;
+                    outPoint  = moved.GetCentre();
+                }
+                else
+                {
+                    outNormal = -result.Normal;
+                    outPoint  = result.PointB;
+                }
+                return true;
+            }
+
+            // Advance by the distance that can't close the gap yet, a body moving away can never hit
+            float closingSpeed = Maths::Dot(direction, result.Normal);
+            if(closingSpeed <= 1e-6f)
+                return false;
+
+            travelled += result.Distance / closingSpeed;
+            if(travelled > maxDistance)
+                return false;
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "Maths/Vector3.h"
+#include "Maths/Matrix3.h"
+#include "Maths/Quaternion.h"
+
+namespace Lumos
+{
+    class RigidBody3D;
+    class CollisionShape;
+
+    // Convex shape described by the support point of a core shape, grown by Radius.
+    // Spheres and capsules are a point and a segment with a radius, which keeps them exact and
+    // lets GJK stop at the core instead of iterating towards a curved surface.
+    struct LUMOS_EXPORT GJKShape
+    {
+        enum class Type : uint8_t
+        {
+            Point,
+            Segment,
+            Triangle,
+            Box,
+            Body
+        };
+
+        static GJKShape FromPoint(const Vec3& point, float radius = 0.0f);
+        static GJKShape FromSegment(const Vec3& a, const Vec3& b, float radius);
+        static GJKShape FromTriangle(const Vec3& a, const Vec3& b, const Vec3& c);
+        static GJKShape FromBox(const Vec3& centre, const Quat& orientation, const Vec3& halfExtents);
+
+        // The body's world transform must be up to date, support points read the cached transform.
+        // Height field and mesh bodies only give their bounds here, test their triangles instead
+        static GJKShape FromBody(const RigidBody3D* body);
+
+        // Furthest point of the core shape along direction, direction doesn't need to be normalised
+        Vec3 Support(const Vec3& direction) const;
+
+        // Any point inside the core shape
+        Vec3 GetCentre() const;
+
+        Type ShapeType = Type::Point;
+        Vec3 A;        // Point, segment start, triangle corner or box centre
+        Vec3 B;        // Segment end, triangle corner or box half extents
+        Vec3 C;        // Triangle only
+        Mat3 Rotation; // Box only
+        Vec3 Offset;   // Added to every support point, used to move a shape along a cast
+        float Radius = 0.0f;
+        const RigidBody3D* Body     = nullptr;
+        const CollisionShape* Shape = nullptr;
+    };
+
+    // Search direction from the last query between two shapes. Reusing it for the same pair on the next step
+    // usually starts GJK on the final simplex's feature, so a separated pair finishes in one or two iterations
+    struct GJKCache
+    {
+        Vec3 Direction;
+        bool Valid = false;
+    };
+
+    struct GJKResult
+    {
+        float Distance = 0.0f; // Between the full shapes, negative if the cores are separated by less than the radii
+        Vec3 PointA;           // Closest points on the full shapes
+        Vec3 PointB;
+        Vec3 Normal;           // From A towards B
+        bool CoresOverlap   = false;
+        uint32_t Iterations = 0;
+    };
+
+    struct GJKContact
+    {
+        Vec3 Normal;        // From A towards B, moving B along it separates the shapes
+        float Depth = 0.0f; // Positive while the shapes overlap
+        Vec3 PointA;        // Deepest point of each shape inside the other
+        Vec3 PointB;
+    };
+
+    // Re-entrant convex queries over support functions. Shapes are only read, so queries can run on any thread
+    // as long as the bodies aren't being simulated at the same time.
+    class LUMOS_EXPORT GJK
+    {
+    public:
+        static const uint32_t MaxIterations    = 64;
+        static const uint32_t MaxEPAIterations = 32;
+
+        // Closest points between the two shapes. When the cores overlap only CoresOverlap is meaningful.
+        // cache, if given, seeds the search and is updated for the next call
+        static void Distance(const GJKShape& a, const GJKShape& b, GJKResult& outResult, GJKCache* cache = nullptr);
+
+        static bool Intersect(const GJKShape& a, const GJKShape& b);
+
+        // Contact between the full shapes, false if they don't touch. Overlapping cores are resolved with EPA and
+        // shapes that only overlap within their radii use the closest points of the cores.
+        // With a valid cache the pair is first tested along the cached direction, which skips GJK entirely for a
+        // pair that is still apart
+        static bool Penetration(const GJKShape& a, const GJKShape& b, GJKContact& outContact, GJKCache* cache = nullptr);
+
+        // Sweeps a along direction (normalised) by conservative advancement. On a hit outDistance is the distance
+        // travelled, outNormal the surface normal of b and outPoint the contact point on b.
+        // A shape that starts overlapping b hits at distance zero with the normal facing against direction
+        static bool ShapeCast(const GJKShape& a, const Vec3& direction, float maxDistance, const GJKShape& b, float& outDistance, Vec3& outNormal, Vec3& outPoint);
+    };
+}
@@ -8,6 +8,8 @@
 #include "Physics/LumosPhysicsEngine/CollisionShapes/PyramidCollisionShape.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/HullCollisionShape.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/CapsuleCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/HeightFieldCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/MeshCollisionShape.h"
 #include "Maths/MathsUtilities.h"
 
 namespace Lumos
@@ -40,6 +42,7 @@ namespace Lumos
         m_AtRest     = properties.AtRest;
         m_Elasticity = properties.Elasticity;
         m_Friction   = properties.Friction;
+        m_Continuous = properties.Continuous;
         m_UUID       = UUID();
 
         if(m_Static)
@@ -179,6 +182,12 @@ namespace Lumos
         case CollisionShapeType::CollisionHull:
             SetCollisionShape(CreateSharedPtr<HullCollisionShape>());
             break;
+        case CollisionShapeType::CollisionHeightField:
+            SetCollisionShape(CreateSharedPtr<HeightFieldCollisionShape>());
+            break;
+        case CollisionShapeType::CollisionMesh:
+            SetCollisionShape(CreateSharedPtr<MeshCollisionShape>());
+            break;
         default:
             LERROR("Unsupported Collision shape");
             break;
@@ -45,6 +45,7 @@ namespace Lumos
         float Friction       = 0.5f;
         bool AtRest          = false;
         bool isTrigger       = false;
+        bool Continuous      = false; // Sweep the body's motion each step so it can't pass through thin geometry
         SharedPtr<CollisionShape> Shape;
     };
 
@@ -111,6 +112,7 @@ namespace Lumos
         {
             m_Orientation            = v;
             m_WSTransformInvalidated = true;
+            m_WSAabbInvalidated      = true;
         }
 
         void SetAngularVelocity(const Vec3& v);
@@ -164,6 +166,11 @@ namespace Lumos
         float GetAngularFactor() const { return m_AngularFactor; }
         void SetAngularFactor(float factor) { m_AngularFactor = factor; }
 
+        // Continuous collision detection. Only worth enabling for small fast bodies such as projectiles,
+        // the sweep costs a shape cast against the scene for every step the body moves further than its size
+        bool GetIsContinuous() const { return m_Continuous; }
+        void SetIsContinuous(bool continuous) { m_Continuous = continuous; }
+
         bool GetIsStatic() const { return m_Static; }
         bool GetIsAtRest() const { return m_AtRest; }
         float GetElasticity() const { return m_Elasticity; }
@@ -219,6 +226,7 @@ namespace Lumos
         Vec3 m_LinearVelocity;
         bool m_Trigger = false;
         Vec3 m_Force;
+        bool m_Continuous = false;
 
         Quat m_Orientation;
         Vec3 m_AngularVelocity;
@@ -226,6 +234,8 @@ namespace Lumos
         Mat3 m_InvInertia;
 
         SharedPtr<CollisionShape> m_CollisionShape;
+        int32_t m_QueryProxy  = -1; // Proxy in the engine's query tree, -1 without a collision shape
+        uint32_t m_QueryIndex = 0;
         PhysicsCollisionCallback m_OnCollisionCallback;
         TDArray<OnCollisionManifoldCallback> m_OnCollisionManifoldCallbacks; //!< Collision callbacks post manifold generation
     };
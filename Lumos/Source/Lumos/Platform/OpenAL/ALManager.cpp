@@ -1,6 +1,7 @@
 #include "Precompiled.h"
 #include "ALManager.h"
 #include "ALSoundNode.h"
+#include "Audio/AudioStream.h"
 #include "Graphics/Camera/Camera.h"
 #include "Utilities/TimeStep.h"
 #include "Scene/Component/SoundComponent.h"
@@ -9,6 +10,7 @@
 
 #include <imgui/imgui.h>
 #include <entt/entity/registry.hpp>
+#include <algorithm>
 
 namespace Lumos
 {
@@ -20,10 +22,20 @@ namespace Lumos
             , m_NumChannels(numChannels)
         {
             m_DebugName = "OpenAL Audio";
+
+            Reads<Maths::Transform, Listener>();
+            Writes<SoundComponent>();
         }
 
         ALManager::~ALManager()
         {
+            while(!m_PhysicalVoices.Empty())
+                MakeVirtual(m_PhysicalVoices.Back());
+
+            for(ALuint source : m_FreeSources)
+                alDeleteSources(1, &source);
+
+            delete m_Streamer;
             alcDestroyContext(m_Context);
             alcCloseDevice(m_Device);
         }
@@ -43,6 +55,28 @@ namespace Lumos
             alcMakeContextCurrent(m_Context);
             alDistanceModel(AL_LINEAR_DISTANCE_CLAMPED);
 
+            // Decodes large sounds ahead of playback, see Sound::GetStreamingThreshold
+            m_Streamer = new AudioStreamer();
+
+            for(int i = 0; i < m_NumChannels; i++)
+            {
+                ALuint source = 0;
+                alGenSources(1, &source);
+                if(alGetError() != AL_NO_ERROR)
+                {
+                    LWARN("Only %i of %i audio sources available", i, m_NumChannels);
+                    m_NumChannels = i;
+                    break;
+                }
+                m_FreeSources.PushBack(source);
+            }
+
+            if(alIsExtensionPresent("AL_SOFT_deferred_updates"))
+            {
+                m_DeferUpdates   = (LPALDEFERUPDATESSOFT)alGetProcAddress("alDeferUpdatesSOFT");
+                m_ProcessUpdates = (LPALPROCESSUPDATESSOFT)alGetProcAddress("alProcessUpdatesSOFT");
+            }
+
             LINFO("Initialised AudioManager - %s", alcGetString(m_Device, ALC_DEVICE_SPECIFIER));
             return true;
         }
@@ -61,13 +95,100 @@ namespace Lumos
 
             auto soundsView = registry.view<SoundComponent, Maths::Transform>();
 
+            m_VoiceCandidates.Clear();
             for(auto entity : soundsView)
             {
-                auto soundNode = soundsView.get<SoundComponent>(entity).GetSoundNode();
+                auto soundNode = static_cast<ALSoundNode*>(soundsView.get<SoundComponent>(entity).GetSoundNode());
                 soundNode->SetPosition(soundsView.get<Maths::Transform>(entity).GetWorldPosition());
-                soundNode->OnUpdate((float)dt.GetMillis());
+
+                VoiceCandidate& candidate = m_VoiceCandidates.EmplaceBack();
+                candidate.Node            = soundNode;
+                candidate.Audibility      = soundNode->IsPlaying() ? soundNode->ComputeAudibility(m_ListenerPosition) : 0.0f;
+                candidate.Priority        = soundNode->GetPriority();
+
+                // Small bias towards voices that already have a source so close calls don't swap every frame
+                candidate.Score = candidate.Audibility * (soundNode->IsVirtual() ? 1.0f : 1.1f);
                 m_LatestNodeCount++;
             }
+
+            UpdateVoices();
+
+            if(m_DeferUpdates)
+                m_DeferUpdates();
+
+            float msec = (float)dt.GetMillis();
+            for(auto& candidate : m_VoiceCandidates)
+                candidate.Node->OnUpdate(msec);
+
+            if(m_ProcessUpdates)
+                m_ProcessUpdates();
+        }
+
+        void ALManager::UpdateVoices()
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            float minAudibility   = m_MinAudibility;
+            VoiceCandidate* first = m_VoiceCandidates.Data();
+            VoiceCandidate* last  = first + m_VoiceCandidates.Size();
+
+            // Audible voices first, then by priority and how loud they are at the listener
+            std::sort(first, last, [minAudibility](const VoiceCandidate& a, const VoiceCandidate& b)
+                      {
+                          bool aAudible = a.Audibility > minAudibility;
+                          bool bAudible = b.Audibility > minAudibility;
+                          if(aAudible != bAudible)
+                              return aAudible;
+                          if(a.Priority != b.Priority)
+                              return a.Priority > b.Priority;
+                          return a.Score > b.Score; });
+
+            size_t physicalCount = 0;
+            while(physicalCount < m_VoiceCandidates.Size() && physicalCount < (size_t)m_NumChannels && m_VoiceCandidates[physicalCount].Audibility > minAudibility)
+                physicalCount++;
+
+            // Release first so the sources are free for the voices that just became audible
+            for(size_t i = physicalCount; i < m_VoiceCandidates.Size(); i++)
+            {
+                if(!m_VoiceCandidates[i].Node->IsVirtual())
+                    MakeVirtual(m_VoiceCandidates[i].Node);
+            }
+
+            for(size_t i = 0; i < physicalCount; i++)
+            {
+                if(m_VoiceCandidates[i].Node->IsVirtual())
+                    MakePhysical(m_VoiceCandidates[i].Node);
+            }
+        }
+
+        void ALManager::MakePhysical(ALSoundNode* node)
+        {
+            if(m_FreeSources.Empty())
+                return;
+
+            ALuint source = m_FreeSources.Back();
+            m_FreeSources.PopBack();
+            m_PhysicalVoices.PushBack(node);
+            node->AcquireSource(this, source);
+        }
+
+        void ALManager::MakeVirtual(ALSoundNode* node)
+        {
+            for(size_t i = 0; i < m_PhysicalVoices.Size(); i++)
+            {
+                if(m_PhysicalVoices[i] == node)
+                {
+                    m_PhysicalVoices[i] = m_PhysicalVoices.Back();
+                    m_PhysicalVoices.PopBack();
+                    break;
+                }
+            }
+
+            m_FreeSources.PushBack(node->ReleaseSource());
+        }
+
+        void ALManager::OnVoiceDestroyed(ALSoundNode* node)
+        {
+            MakeVirtual(node);
         }
 
         void ALManager::UpdateListener(Scene* scene)
@@ -86,8 +207,9 @@ namespace Lumos
         {
             LUMOS_PROFILE_FUNCTION();
             {
-                Vec3 worldPos = listenerTransform.GetWorldPosition();
-                Vec3 velocity = Vec3(0.0f); // TODO: m_Listener->GetVelocity();
+                Vec3 worldPos      = listenerTransform.GetWorldPosition();
+                m_ListenerPosition = worldPos;
+                Vec3 velocity      = Vec3(0.0f); // TODO: m_Listener->GetVelocity();
 
                 ALfloat direction[6];
 
@@ -131,6 +253,41 @@ namespace Lumos
             ImGui::PopItemWidth();
             ImGui::NextColumn();
 
+            ImGui::AlignTextToFramePadding();
+            ImGui::TextUnformatted("Physical Voices");
+            ImGui::NextColumn();
+            ImGui::PushItemWidth(-1);
+            ImGui::Text("%5.2u", (u32)m_PhysicalVoices.Size());
+            ImGui::PopItemWidth();
+            ImGui::NextColumn();
+
+            ImGui::AlignTextToFramePadding();
+            ImGui::TextUnformatted("Virtual Voices");
+            ImGui::NextColumn();
+            ImGui::PushItemWidth(-1);
+            ImGui::Text("%5.2u", m_LatestNodeCount - (u32)m_PhysicalVoices.Size());
+            ImGui::PopItemWidth();
+            ImGui::NextColumn();
+
+            if(m_Streamer)
+            {
+                ImGui::AlignTextToFramePadding();
+                ImGui::TextUnformatted("Streaming Sources");
+                ImGui::NextColumn();
+                ImGui::PushItemWidth(-1);
+                ImGui::Text("%5.2u", m_Streamer->GetStreamCount());
+                ImGui::PopItemWidth();
+                ImGui::NextColumn();
+
+                ImGui::AlignTextToFramePadding();
+                ImGui::TextUnformatted("Stream Memory");
+                ImGui::NextColumn();
+                ImGui::PushItemWidth(-1);
+                ImGui::Text("%.1f / %.1f KB", m_Streamer->GetMemoryUsage() / 1024.0f, m_Streamer->GetMemoryBudget() / 1024.0f);
+                ImGui::PopItemWidth();
+                ImGui::NextColumn();
+            }
+
             ImGui::Columns(1);
             ImGui::Separator();
             ImGui::PopStyleVar();
@@ -1,11 +1,16 @@
 
 #include "Audio/AudioManager.h"
+#include "Maths/Vector3.h"
 
 #include <AL/al.h>
 #include <AL/alc.h>
+#include <AL/alext.h>
 
 namespace Lumos
 {
+    class AudioStreamer;
+    class ALSoundNode;
+
     namespace Maths
     {
         class Transform;
@@ -13,10 +18,12 @@ namespace Lumos
 
     namespace Audio
     {
+        // Only the most audible voices, ordered by priority then audibility, own one of the
+        // numChannels OpenAL sources. The rest are virtual and just track their playback time.
         class ALManager : public AudioManager
         {
         public:
-            ALManager(int numChannels = 8);
+            ALManager(int numChannels = 32);
             ~ALManager();
 
             bool OnInit() override;
@@ -25,12 +32,38 @@ namespace Lumos
             void UpdateListener(Maths::Transform& listenerTransform);
             void OnImGui() override;
 
+            // Returns the voice's source to the pool
+            void OnVoiceDestroyed(ALSoundNode* node);
+
         private:
+            struct VoiceCandidate
+            {
+                ALSoundNode* Node;
+                float Audibility;
+                float Score;
+                int Priority;
+            };
+
+            void UpdateVoices();
+            void MakePhysical(ALSoundNode* node);
+            void MakeVirtual(ALSoundNode* node);
+
             ALCcontext* m_Context;
             ALCdevice* m_Device;
+            AudioStreamer* m_Streamer = nullptr;
 
             int m_NumChannels     = 0;
             u32 m_LatestNodeCount = 0;
+
+            TDArray<ALuint> m_FreeSources;
+            TDArray<ALSoundNode*> m_PhysicalVoices;
+            TDArray<VoiceCandidate> m_VoiceCandidates;
+            Vec3 m_ListenerPosition = Vec3(0.0f);
+            float m_MinAudibility   = 0.001f;
+
+            // AL_SOFT_deferred_updates, batches the per voice parameter changes into one mixer update
+            LPALDEFERUPDATESSOFT m_DeferUpdates     = nullptr;
+            LPALPROCESSUPDATESSOFT m_ProcessUpdates = nullptr;
         };
     }
 }
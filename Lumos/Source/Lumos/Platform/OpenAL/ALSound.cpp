@@ -3,13 +3,25 @@
 
 #include "Audio/WavLoader.h"
 #include "Audio/OggLoader.h"
+#include "Audio/AudioStream.h"
 
 namespace Lumos
 {
     ALSound::ALSound(const std::string& fileName, const std::string& format)
-        : m_Format(0)
+        : m_Buffer(0)
+        , m_Format(0)
     {
         m_FilePath = fileName;
+
+        // Large sounds keep only their format, each node playing them streams its own decode
+        AudioData streamFormat;
+        if(AudioStreamer::Get() && AudioStream::ReadFormat(fileName, streamFormat) && streamFormat.Size > GetStreamingThreshold())
+        {
+            m_Data      = streamFormat;
+            m_Streaming = true;
+            return;
+        }
+
         if(format == "wav")
             m_Data = LoadWav(fileName);
         else if(format == "ogg")
@@ -21,7 +33,8 @@ namespace Lumos
 
     ALSound::~ALSound()
     {
-        alDeleteBuffers(1, &m_Buffer);
+        if(m_Buffer)
+            alDeleteBuffers(1, &m_Buffer);
     }
 
     ALenum ALSound::GetOALFormat(uint32_t bitRate, uint32_t channels)
@@ -17,8 +17,10 @@ namespace Lumos
             return m_Buffer;
         }
 
-    private:
+        ALenum GetOALFormat() const { return GetOALFormat(m_Data.BitRate, m_Data.Channels); }
         static ALenum GetOALFormat(uint32_t bitRate, uint32_t channels);
+
+    private:
         unsigned int m_Buffer;
         int m_Format;
     };
@@ -2,6 +2,7 @@
 #include "ALSoundNode.h"
 #include "ALSound.h"
 #include "ALManager.h"
+#include "Audio/AudioStream.h"
 
 #include "Core/Application.h"
 
@@ -11,20 +12,53 @@ namespace Lumos
 {
     ALSoundNode::ALSoundNode()
     {
-        alGenSources(1, &m_Source);
     }
 
     ALSoundNode::~ALSoundNode()
     {
-        alDeleteSources(1, &m_Source);
+        // Hands the source back to the pool, the manager also drops the stream
+        if(m_Source && m_Manager)
+            m_Manager->OnVoiceDestroyed(this);
+
+        StopStream();
+
+        if(m_StreamBuffers[0])
+            alDeleteBuffers(NUM_STREAM_BUFFERS, m_StreamBuffers);
     }
 
     void ALSoundNode::OnUpdate(float msec)
     {
-        alSourcef(m_Source, AL_GAIN, m_Volume);
-        alSourcef(m_Source, AL_PITCH, m_Pitch);
-        alSourcef(m_Source, AL_MAX_DISTANCE, m_Radius);
-        alSourcef(m_Source, AL_REFERENCE_DISTANCE, m_ReferenceDistance);
+        if(!m_Source)
+        {
+            UpdateVirtual(msec);
+            return;
+        }
+
+        if(m_SourceVolume != m_Volume)
+        {
+            alSourcef(m_Source, AL_GAIN, m_Volume);
+            m_SourceVolume = m_Volume;
+        }
+        if(m_SourcePitch != m_Pitch)
+        {
+            alSourcef(m_Source, AL_PITCH, m_Pitch);
+            m_SourcePitch = m_Pitch;
+        }
+        if(m_SourceRadius != m_Radius)
+        {
+            alSourcef(m_Source, AL_MAX_DISTANCE, m_Radius);
+            m_SourceRadius = m_Radius;
+        }
+        if(m_SourceReferenceDistance != m_ReferenceDistance)
+        {
+            alSourcef(m_Source, AL_REFERENCE_DISTANCE, m_ReferenceDistance);
+            m_SourceReferenceDistance = m_ReferenceDistance;
+        }
+        if(m_SourceRollOffFactor != m_RollOffFactor)
+        {
+            alSourcef(m_Source, AL_ROLLOFF_FACTOR, m_RollOffFactor);
+            m_SourceRollOffFactor = m_RollOffFactor;
+        }
 
         Vec3 position;
         Vec3 velocity;
@@ -49,39 +83,301 @@ namespace Lumos
 
         alSourcefv(m_Source, AL_POSITION, reinterpret_cast<float*>(&position));
         alSourcefv(m_Source, AL_VELOCITY, reinterpret_cast<float*>(&velocity));
+
+        if(m_Stream)
+        {
+            m_Stream->SetLooping(m_IsLooping);
+            UpdateStream();
+        }
+        else if(m_Playing)
+        {
+            ALint state = 0;
+            alGetSourcei(m_Source, AL_SOURCE_STATE, &state);
+            if(state == AL_STOPPED)
+                m_Playing = false;
+        }
+    }
+
+    void ALSoundNode::UpdateVirtual(float msec)
+    {
+        if(!m_Playing || !m_Sound)
+            return;
+
+        // Advance as if the source was playing, so it resumes in the right place once it becomes physical
+        double length = m_Sound->GetLength() / 1000.0;
+        m_StreamPos += msec / 1000.0 * m_Pitch;
+
+        if(m_StreamPos >= length)
+        {
+            if(m_IsLooping && length > 0.0)
+            {
+                m_StreamPos = fmod(m_StreamPos, length);
+            }
+            else
+            {
+                m_StreamPos = 0.0;
+                m_Playing   = false;
+            }
+        }
     }
 
     void ALSoundNode::Pause()
     {
-        alSourcePause(m_Source);
-        m_Paused = true;
+        if(m_Source)
+            alSourcePause(m_Source);
+
+        m_Paused  = true;
+        m_Playing = false;
     }
 
     void ALSoundNode::Resume()
     {
+        m_Paused  = false;
+        m_Playing = true;
+
+        // Virtual voices start once ALManager gives them a source
+        if(!m_Source)
+            return;
+
+        // Starts once the first buffers are queued if the decoder hasn't caught up yet
+        if(m_Stream && m_QueueCount == 0)
+            return;
+
         alSourcePlay(m_Source);
-        m_Paused = false;
     }
 
     void ALSoundNode::Stop()
     {
+        m_Playing   = false;
+        m_StreamPos = 0.0;
+
+        if(!m_Source)
+            return;
+
         alSourceStop(m_Source);
+
+        if(m_Stream)
+        {
+            UnqueueStreamBuffers();
+            m_Stream->Seek(0.0);
+        }
+    }
+
+    void ALSoundNode::Seek(double seconds)
+    {
+        m_StreamPos = seconds;
+
+        if(!m_Source)
+            return;
+
+        if(!m_Stream)
+        {
+            alSourcef(m_Source, AL_SEC_OFFSET, (float)seconds);
+            return;
+        }
+
+        // Queued buffers hold audio from the old position, drop them and decode from the new one
+        alSourceStop(m_Source);
+        UnqueueStreamBuffers();
+        m_Stream->Seek(seconds);
+
+        if(AudioStreamer* streamer = AudioStreamer::Get())
+            streamer->Wake();
+    }
+
+    double ALSoundNode::GetPlaybackPosition() const
+    {
+        if(!m_Source || m_Stream)
+            return m_StreamPos;
+
+        ALfloat offset = 0.0f;
+        alGetSourcef(m_Source, AL_SEC_OFFSET, &offset);
+        return offset;
     }
 
     void ALSoundNode::SetSound(SharedPtr<Sound> s)
     {
-        m_Sound = s;
+        StopStream();
+
+        m_Sound     = s;
+        m_StreamPos = 0.0;
         if(m_Sound)
         {
             m_TimeLeft = m_Sound->GetLength();
+            if(m_Source)
+                BindSource();
+            // alSourcePlay(m_Source);
+        }
+    }
+
+    void ALSoundNode::AcquireSource(Audio::ALManager* manager, ALuint source)
+    {
+        m_Manager = manager;
+        m_Source  = source;
+        m_Virtual = false;
+
+        // Force every parameter to be sent on the next update
+        m_SourceVolume            = -1.0f;
+        m_SourcePitch             = -1.0f;
+        m_SourceRadius            = -1.0f;
+        m_SourceReferenceDistance = -1.0f;
+        m_SourceRollOffFactor     = -1.0f;
+
+        if(!m_Sound)
+            return;
+
+        BindSource();
+
+        if(m_Playing && !m_Stream)
+            alSourcePlay(m_Source);
+    }
+
+    ALuint ALSoundNode::ReleaseSource()
+    {
+        m_StreamPos = GetPlaybackPosition();
+
+        StopStream();
+        alSourceStop(m_Source);
+        alSourcei(m_Source, AL_BUFFER, 0);
+
+        ALuint source = m_Source;
+        m_Source      = 0;
+        m_Manager     = nullptr;
+        m_Virtual     = true;
+        return source;
+    }
+
+    void ALSoundNode::BindSource()
+    {
+        if(m_Sound->IsStreaming())
+        {
+            // Looping is handled by the decoder, AL would only loop the queued buffers
+            alSourcei(m_Source, AL_BUFFER, 0);
+            alSourcei(m_Source, AL_LOOPING, 0);
+            StartStream();
+        }
+        else
+        {
             alSourcei(m_Source, AL_BUFFER, m_Sound.As<ALSound>()->GetBuffer());
-            alSourcef(m_Source, AL_MAX_DISTANCE, m_Radius);
-            alSourcef(m_Source, AL_ROLLOFF_FACTOR, m_RollOffFactor);
-            alSourcef(m_Source, AL_REFERENCE_DISTANCE, m_ReferenceDistance);
             alSourcei(m_Source, AL_LOOPING, m_IsLooping ? 1 : 0);
-            alSourcef(m_Source, AL_GAIN, m_Volume);
-            alSourcef(m_Source, AL_PITCH, m_Pitch);
-            // alSourcePlay(m_Source);
+            alSourcef(m_Source, AL_SEC_OFFSET, (float)m_StreamPos);
         }
     }
+
+    void ALSoundNode::StartStream()
+    {
+        AudioStreamer* streamer = AudioStreamer::Get();
+        if(!streamer)
+            return;
+
+        m_Stream = new AudioStream(m_Sound->GetFilePath());
+        m_Stream->SetLooping(m_IsLooping);
+        if(!streamer->AddStream(m_Stream))
+        {
+            delete m_Stream;
+            m_Stream = nullptr;
+            return;
+        }
+
+        if(m_StreamPos > 0.0)
+            m_Stream->Seek(m_StreamPos);
+
+        if(!m_StreamBuffers[0])
+            alGenBuffers(NUM_STREAM_BUFFERS, m_StreamBuffers);
+
+        m_QueueHead     = 0;
+        m_QueueCount    = 0;
+        m_FreeSlotCount = NUM_STREAM_BUFFERS;
+        for(uint32_t i = 0; i < NUM_STREAM_BUFFERS; i++)
+            m_FreeSlots[i] = i;
+    }
+
+    void ALSoundNode::StopStream()
+    {
+        if(!m_Stream)
+            return;
+
+        if(m_Source)
+        {
+            alSourceStop(m_Source);
+            UnqueueStreamBuffers();
+        }
+
+        // The streamer can already be gone when nodes outlive the audio manager
+        if(AudioStreamer* streamer = AudioStreamer::Get())
+            streamer->RemoveStream(m_Stream);
+        delete m_Stream;
+        m_Stream = nullptr;
+    }
+
+    void ALSoundNode::UnqueueStreamBuffers()
+    {
+        // Source must be stopped, detaching the buffer releases the whole queue
+        alSourcei(m_Source, AL_BUFFER, 0);
+
+        m_QueueHead     = 0;
+        m_QueueCount    = 0;
+        m_FreeSlotCount = NUM_STREAM_BUFFERS;
+        for(uint32_t i = 0; i < NUM_STREAM_BUFFERS; i++)
+            m_FreeSlots[i] = i;
+    }
+
+    void ALSoundNode::UpdateStream()
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        ALint processed = 0;
+        alGetSourcei(m_Source, AL_BUFFERS_PROCESSED, &processed);
+
+        for(ALint i = 0; i < processed && m_QueueCount > 0; i++)
+        {
+            uint32_t slot = m_QueuedSlots[m_QueueHead];
+            alSourceUnqueueBuffers(m_Source, 1, &m_StreamBuffers[slot]);
+
+            m_QueueHead                    = (m_QueueHead + 1) % NUM_STREAM_BUFFERS;
+            m_FreeSlots[m_FreeSlotCount++] = slot;
+            m_QueueCount--;
+        }
+
+        ALSound* sound = m_Sound.As<ALSound>().get();
+        bool queued    = false;
+        while(m_FreeSlotCount > 0)
+        {
+            const AudioStreamChunk* chunk = m_Stream->PeekChunk();
+            if(!chunk)
+                break;
+
+            uint32_t slot = m_FreeSlots[--m_FreeSlotCount];
+            alBufferData(m_StreamBuffers[slot], sound->GetOALFormat(), chunk->Data.Data(), chunk->Size, static_cast<ALsizei>(sound->GetFrequency()));
+            alSourceQueueBuffers(m_Source, 1, &m_StreamBuffers[slot]);
+
+            m_StreamBufferTimes[slot]                                        = chunk->StartTime;
+            m_QueuedSlots[(m_QueueHead + m_QueueCount) % NUM_STREAM_BUFFERS] = slot;
+            m_QueueCount++;
+
+            m_Stream->PopChunk();
+            queued = true;
+        }
+
+        AudioStreamer* streamer = AudioStreamer::Get();
+        if(queued && streamer)
+            streamer->Wake();
+
+        if(m_QueueCount > 0)
+        {
+            ALfloat offset = 0.0f;
+            alGetSourcef(m_Source, AL_SEC_OFFSET, &offset);
+            m_StreamPos = m_StreamBufferTimes[m_QueuedSlots[m_QueueHead]] + offset;
+        }
+
+        if(!m_Playing)
+            return;
+
+        // Restart after the decoder fell behind, or finish once it has nothing left
+        ALint state = 0;
+        alGetSourcei(m_Source, AL_SOURCE_STATE, &state);
+        if(state != AL_PLAYING && m_QueueCount > 0)
+            alSourcePlay(m_Source);
+        else if(m_QueueCount == 0 && m_Stream->IsFinished())
+            m_Playing = false;
+    }
 }
@@ -8,6 +8,13 @@
 
 namespace Lumos
 {
+    class AudioStream;
+
+    namespace Audio
+    {
+        class ALManager;
+    }
+
     class ALSoundNode : public SoundNode
     {
     public:
@@ -18,10 +25,47 @@ namespace Lumos
         void Pause() override;
         void Resume() override;
         void Stop() override;
+        void Seek(double seconds) override;
         void SetSound(SharedPtr<Sound> s) override;
 
+        double GetPlaybackPosition() const override;
+
+        // Playing or waiting to play, as opposed to paused, stopped or finished
+        bool IsPlaying() const { return m_Playing; }
+
+        // Called by ALManager when the voice becomes physical or virtual
+        void AcquireSource(Audio::ALManager* manager, ALuint source);
+        ALuint ReleaseSource();
+
     private:
-        ALuint m_Source;
-        ALuint m_StreamBuffers[NUM_STREAM_BUFFERS];
+        void BindSource();
+        void UpdateVirtual(float msec);
+        void StartStream();
+        void StopStream();
+        void UpdateStream();
+        void UnqueueStreamBuffers();
+
+        ALuint m_Source             = 0;
+        Audio::ALManager* m_Manager = nullptr;
+        bool m_Playing              = false;
+
+        // Last values sent to the source, so unchanged parameters aren't resent every frame
+        float m_SourceVolume            = -1.0f;
+        float m_SourcePitch             = -1.0f;
+        float m_SourceRadius            = -1.0f;
+        float m_SourceReferenceDistance = -1.0f;
+        float m_SourceRollOffFactor     = -1.0f;
+
+        ALuint m_StreamBuffers[NUM_STREAM_BUFFERS] = {};
+
+        // Buffers are queued and unqueued in order, slots index m_StreamBuffers
+        double m_StreamBufferTimes[NUM_STREAM_BUFFERS] = {};
+        uint32_t m_QueuedSlots[NUM_STREAM_BUFFERS]     = {};
+        uint32_t m_FreeSlots[NUM_STREAM_BUFFERS]       = {};
+        uint32_t m_QueueHead                           = 0;
+        uint32_t m_QueueCount                          = 0;
+        uint32_t m_FreeSlotCount                       = 0;
+
+        AudioStream* m_Stream = nullptr;
     };
 }
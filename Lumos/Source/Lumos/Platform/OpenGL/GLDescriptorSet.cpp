@@ -15,7 +15,7 @@ namespace Lumos
 
             for(auto& descriptor : m_Descriptors)
             {
-                if(descriptor.type == DescriptorType::UNIFORM_BUFFER)
+                if(descriptor.type == DescriptorType::UNIFORM_BUFFER || descriptor.type == DescriptorType::STORAGE_BUFFER)
                 {
                     auto buffer = SharedPtr<Graphics::UniformBuffer>(Graphics::UniformBuffer::Create());
                     buffer->Init(descriptor.size, nullptr);
@@ -32,7 +32,14 @@ namespace Lumos
                     info.m_Members    = descriptor.m_Members;
                     m_UniformBuffers.emplace(descriptor.name, info);
 
-                    if(descriptor.name != "")
+                    if(descriptor.name != "" && descriptor.type == DescriptorType::STORAGE_BUFFER)
+                    {
+                        LUMOS_PROFILE_SCOPE("glShaderStorageBlockBinding");
+                        auto slot = descriptor.binding;
+                        auto loc  = glGetProgramResourceIndex(m_Shader->GetHandleInternal(), GL_SHADER_STORAGE_BLOCK, descriptor.name.c_str());
+                        GLCall(glShaderStorageBlockBinding(m_Shader->GetHandleInternal(), loc, slot));
+                    }
+                    else if(descriptor.name != "")
                     {
                         LUMOS_PROFILE_SCOPE("glUniformBlockBinding");
                         auto slot = descriptor.binding;
@@ -230,15 +237,16 @@ namespace Lumos
                         // buffer->SetData(size, data);
                         auto bufferHandle = static_cast<GLUniformBuffer*>(buffer)->GetHandle();
                         auto slot         = descriptor.binding;
+                        auto target       = descriptor.type == DescriptorType::STORAGE_BUFFER ? GL_SHADER_STORAGE_BUFFER : GL_UNIFORM_BUFFER;
                         {
                             LUMOS_PROFILE_SCOPE("glBindBufferBase");
-                            GLCall(glBindBufferBase(GL_UNIFORM_BUFFER, slot, bufferHandle));
+                            GLCall(glBindBufferBase(target, slot, bufferHandle));
                         }
 
                         // if(buffer->GetDynamic())
                         {
                             LUMOS_PROFILE_SCOPE("glBindBufferRange");
-                            GLCall(glBindBufferRange(GL_UNIFORM_BUFFER, slot, bufferHandle, offset, size));
+                            GLCall(glBindBufferRange(target, slot, bufferHandle, offset, size));
                         }
 
                         //                        if(descriptor.name != "")
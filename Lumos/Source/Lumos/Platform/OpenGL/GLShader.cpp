@@ -272,6 +272,13 @@ namespace Lumos
             }
         }
 
+        void GLShader::BindPushConstantData(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const void* data)
+        {
+            // GL only records on the main thread, so the uniform buffer path is reused
+            memcpy(m_PushConstants[index].data, data, m_PushConstants[index].size);
+            BindPushConstants(commandBuffer, pipeline);
+        }
+
         void GLShader::BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline)
         {
             LUMOS_PROFILE_FUNCTION();
@@ -825,7 +832,7 @@ namespace Lumos
             //                    auto set { glsl->get_decoration(input.id, spv::Decoration::DecorationDescriptorSet) };
             //                    glsl->set_decoration(input.id, spv::Decoration::DecorationDescriptorSet, DESCRIPTOR_TABLE_INITIAL_SPACE + 2 * set);
             //                }
-            for(auto const& uniform_buffer : resources.uniform_buffers)
+            auto ReflectBuffer = [&](const spirv_cross::Resource& uniform_buffer, Graphics::DescriptorType descriptorType)
             {
                 auto set { glsl->get_decoration(uniform_buffer.id, spv::Decoration::DecorationDescriptorSet) };
                 glsl->set_decoration(uniform_buffer.id, spv::Decoration::DecorationDescriptorSet, DESCRIPTOR_TABLE_INITIAL_SPACE + 2 * set);
@@ -843,7 +850,7 @@ namespace Lumos
                 descriptor.name       = uniform_buffer.name;
                 descriptor.offset     = 0;
                 descriptor.shaderType = type;
-                descriptor.type       = Graphics::DescriptorType::UNIFORM_BUFFER;
+                descriptor.type       = descriptorType;
                 descriptor.buffer     = nullptr;
 
                 for(int i = 0; i < memberCount; i++)
@@ -862,12 +869,15 @@ namespace Lumos
                     member.fullName = uniformName;
                     member.name     = memberName;
                 }
-            }
-            //                for(auto const& storage_buffer : resources.storage_buffers)
-            //                {
-            //                    auto set { glsl->get_decoration(storage_buffer.id, spv::Decoration::DecorationDescriptorSet) };
-            //                    glsl->set_decoration(storage_buffer.id, spv::Decoration::DecorationDescriptorSet, DESCRIPTOR_TABLE_INITIAL_SPACE + 2 * set);
-            //                }
+            };
+
+            for(auto const& uniform_buffer : resources.uniform_buffers)
+                ReflectBuffer(uniform_buffer, Graphics::DescriptorType::UNIFORM_BUFFER);
+
+            // Needs GL 4.3, or ARB_shader_storage_buffer_object which SPIRV-Cross requests when targeting 410
+            for(auto const& storage_buffer : resources.storage_buffers)
+                ReflectBuffer(storage_buffer, Graphics::DescriptorType::STORAGE_BUFFER);
+
             //                for(auto const& storage_image : resources.storage_images)
             //                {
             //                    auto set { glsl->get_decoration(storage_image.id, spv::Decoration::DecorationDescriptorSet) };
@@ -924,8 +934,9 @@ namespace Lumos
                 }
             }
 
-            int imageCount[16]  = { 0 };
-            int bufferCount[16] = { 0 };
+            int imageCount[16]   = { 0 };
+            int bufferCount[16]  = { 0 };
+            int storageCount[16] = { 0 };
 
             for(int i = 0; i < m_DescriptorInfos.size(); i++)
             {
@@ -946,6 +957,13 @@ namespace Lumos
                         if(i > 0)
                             descriptor.binding = descriptor.binding + bufferCount[i - 1];
                     }
+                    else if(descriptor.type == DescriptorType::STORAGE_BUFFER)
+                    {
+                        storageCount[i]++;
+
+                        if(i > 0)
+                            descriptor.binding = descriptor.binding + storageCount[i - 1];
+                    }
                 }
             }
 
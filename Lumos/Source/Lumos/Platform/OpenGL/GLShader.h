@@ -95,6 +95,7 @@ namespace Lumos
             }
             TDArray<PushConstant>& GetPushConstants() override { return m_PushConstants; }
             void BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline) override;
+            void BindPushConstantData(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const void* data) override;
 
             DescriptorSetInfo GetDescriptorInfo(uint32_t index) override
             {
@@ -56,7 +56,6 @@ namespace Lumos
             return false;
         if(size < 0)
             size = GetFileSize(path);
-        buffer      = new uint8_t[size + 1];
         FILE* file  = fopen(path.c_str(), FileSystem::GetFileOpenModeString(FileOpenFlags::READ));
         bool result = false;
         if(file)
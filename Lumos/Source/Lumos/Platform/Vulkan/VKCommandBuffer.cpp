@@ -7,6 +7,9 @@
 #include "VKPipeline.h"
 #include "VKInitialisers.h"
 #include "VKSemaphore.h"
+#include "VKRenderPass.h"
+#include "Core/Engine.h"
+#include "Maths/MathsUtilities.h"
 #include "Core/JobSystem.h"
 
 #if LUMOS_PROFILE
@@ -95,7 +98,8 @@ namespace Lumos
             LUMOS_PROFILE_FUNCTION_LOW();
             VKUtilities::WaitIdle();
 
-            if(m_State == CommandBufferState::Submitted)
+            // Secondary buffers are never submitted to a queue, their fence is unused
+            if(m_Primary && m_State == CommandBufferState::Submitted)
                 Wait();
 
             m_Fence     = nullptr;
@@ -132,6 +136,62 @@ namespace Lumos
             VK_CHECK_RESULT(vkBeginCommandBuffer(m_CommandBuffer, &beginCreateInfo));
         }
 
+        void VKCommandBuffer::BeginRecordingInRenderPass(CommandBuffer* primaryCmdBuffer)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            ASSERT(!m_Primary, "BeginRecordingInRenderPass() called from a primary command buffer!");
+
+            VKCommandBuffer* primary = static_cast<VKCommandBuffer*>(primaryCmdBuffer);
+            ASSERT(primary->m_BoundRenderPass && primary->m_BoundContents == SubPassContents::SECONDARY, "Primary command buffer has no render pass begun for secondary buffers");
+
+            m_State                 = CommandBufferState::Recording;
+            m_BoundPipeline         = nullptr;
+            m_BoundPipelineLayer    = 0;
+            m_BoundRenderPass       = primary->m_BoundRenderPass;
+            m_BoundFrameBuffer      = primary->m_BoundFrameBuffer;
+            m_BoundRenderPassWidth  = primary->m_BoundRenderPassWidth;
+            m_BoundRenderPassHeight = primary->m_BoundRenderPassHeight;
+            m_BoundContents         = SubPassContents::INLINE;
+            m_InheritedRenderPass   = true;
+
+            VkCommandBufferInheritanceInfo inheritanceInfo = VKInitialisers::CommandBufferInheritanceInfo();
+            inheritanceInfo.subpass                        = 0;
+            inheritanceInfo.renderPass                     = static_cast<VKRenderPass*>(m_BoundRenderPass)->GetHandle();
+            inheritanceInfo.framebuffer                    = static_cast<VKFramebuffer*>(m_BoundFrameBuffer)->GetFramebuffer();
+
+            VkCommandBufferBeginInfo beginCreateInfo = VKInitialisers::CommandBufferBeginInfo();
+            beginCreateInfo.flags                    = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            beginCreateInfo.pInheritanceInfo         = &inheritanceInfo;
+
+            VK_CHECK_RESULT(vkBeginCommandBuffer(m_CommandBuffer, &beginCreateInfo));
+
+            // Dynamic state isn't inherited from the primary
+            uint32_t width  = Maths::Max(m_BoundRenderPassWidth, 1u);
+            uint32_t height = Maths::Max(m_BoundRenderPassHeight, 1u);
+            UpdateViewport(width, height, static_cast<VKRenderPass*>(m_BoundRenderPass)->IsSwapchainTarget());
+        }
+
+        bool VKCommandBuffer::BeginSecondaryRenderPass(Pipeline* pipeline, uint32_t layer)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            ASSERT(m_Primary, "BeginSecondaryRenderPass() called from a secondary command buffer!");
+
+            VKPipeline* vkPipeline = static_cast<VKPipeline*>(pipeline);
+            if(vkPipeline->IsCompute())
+                return false;
+
+            // Always restart the pass, it may already be open with inline contents
+            if(m_BoundPipeline)
+                m_BoundPipeline->End(this);
+            m_BoundPipeline = nullptr;
+
+            EndCurrentRenderPass();
+
+            vkPipeline->TransitionAttachments();
+            BeginRenderPass(vkPipeline->GetRenderPass(), pipeline->m_Description.clearColour, vkPipeline->GetFramebuffer(layer), vkPipeline->GetWidth(), vkPipeline->GetHeight(), SubPassContents::SECONDARY);
+            return true;
+        }
+
         void VKCommandBuffer::EndRecording()
         {
             LUMOS_PROFILE_FUNCTION_LOW();
@@ -141,9 +201,19 @@ namespace Lumos
                 m_BoundPipeline->End((CommandBuffer*)this);
 
             m_BoundPipeline = nullptr;
+
+            // The primary owns the render pass, the secondary just stops recording into it
+            if(m_InheritedRenderPass)
+            {
+                m_BoundRenderPass     = nullptr;
+                m_BoundFrameBuffer    = nullptr;
+                m_InheritedRenderPass = false;
+            }
+
 #if LUMOS_PROFILE
 #if LUMOS_PROFILE_GPU_TIMINGS
-            TracyVkCollect(VKDevice::Get().GetTracyContext(), m_CommandBuffer);
+            if(m_Primary)
+                TracyVkCollect(VKDevice::Get().GetTracyContext(), m_CommandBuffer);
 #endif
 #endif
 
@@ -188,6 +258,37 @@ namespace Lumos
             m_State = CommandBufferState::Submitted;
 
             vkCmdExecuteCommands(static_cast<VKCommandBuffer*>(primaryCmdBuffer)->GetHandle(), 1, &m_CommandBuffer);
+
+            auto& stats = Engine::Get().Statistics();
+            stats.NumDrawCalls += m_DrawCalls;
+            stats.TriangleCount += m_Triangles;
+            stats.BoundPipelines += m_BoundPipelines;
+
+            m_DrawCalls      = 0;
+            m_Triangles      = 0;
+            m_BoundPipelines = 0;
+        }
+
+        void VKCommandBuffer::AddDrawStats(uint32_t drawCalls, uint32_t triangles)
+        {
+            if(m_Primary)
+            {
+                Engine::Get().Statistics().NumDrawCalls += drawCalls;
+                Engine::Get().Statistics().TriangleCount += triangles;
+            }
+            else
+            {
+                m_DrawCalls += drawCalls;
+                m_Triangles += triangles;
+            }
+        }
+
+        void VKCommandBuffer::AddBoundPipeline()
+        {
+            if(m_Primary)
+                Engine::Get().Statistics().BoundPipelines++;
+            else
+                m_BoundPipelines++;
         }
 
         void VKCommandBuffer::BindPipeline(Pipeline* pipeline)
@@ -226,7 +327,7 @@ namespace Lumos
                 m_BoundPipeline->End(this);
             m_BoundPipeline = nullptr;
 
-            if(m_BoundRenderPass)
+            if(m_BoundRenderPass && !m_InheritedRenderPass)
                 m_BoundRenderPass->EndRenderPass(this);
             m_BoundRenderPass = nullptr;
         }
@@ -234,17 +335,20 @@ namespace Lumos
         void VKCommandBuffer::EndCurrentRenderPass()
         {
             LUMOS_PROFILE_FUNCTION();
-            if(m_BoundRenderPass)
+            if(m_BoundRenderPass && !m_InheritedRenderPass)
                 m_BoundRenderPass->EndRenderPass(this);
 
             m_BoundRenderPass = nullptr;
+            m_BoundContents   = SubPassContents::INLINE;
         }
 
-        void VKCommandBuffer::BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height)
+        void VKCommandBuffer::BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height, SubPassContents contents)
         {
             LUMOS_PROFILE_FUNCTION();
-            if(m_BoundRenderPass != renderpass || m_BoundFrameBuffer != framebuffer || m_BoundRenderPassWidth != width || m_BoundRenderPassHeight != height)
+            if(m_BoundRenderPass != renderpass || m_BoundFrameBuffer != framebuffer || m_BoundRenderPassWidth != width || m_BoundRenderPassHeight != height || m_BoundContents != contents)
             {
+                ASSERT(!m_InheritedRenderPass, "Pipeline isn't compatible with the render pass inherited by this secondary command buffer");
+
                 if(m_BoundRenderPass)
                     m_BoundRenderPass->EndRenderPass(this);
 
@@ -252,8 +356,9 @@ namespace Lumos
                 m_BoundFrameBuffer      = framebuffer;
                 m_BoundRenderPassWidth  = width;
                 m_BoundRenderPassHeight = height;
+                m_BoundContents         = contents;
 
-                m_BoundRenderPass->BeginRenderPass(this, clearColour, framebuffer, SubPassContents::INLINE, width, height);
+                m_BoundRenderPass->BeginRenderPass(this, clearColour, framebuffer, contents, width, height);
             }
         }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "VK.h"
 #include "Graphics/RHI/CommandBuffer.h"
+#include "Graphics/RHI/RHIDefinitions.h"
 #include "VKFence.h"
 #include "Core/Reference.h"
 
@@ -44,7 +45,10 @@ namespace Lumos
             void UnBindPipeline() override;
             void EndCurrentRenderPass() override;
 
-            void BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height);
+            bool BeginSecondaryRenderPass(Pipeline* pipeline, uint32_t layer) override;
+            void BeginRecordingInRenderPass(CommandBuffer* primaryCmdBuffer) override;
+
+            void BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height, SubPassContents contents = SubPassContents::INLINE);
 
             bool Execute(VkPipelineStageFlags flags, VkSemaphore signalSemaphore, bool waitFence);
 
@@ -56,6 +60,12 @@ namespace Lumos
 
             VkSemaphore GetSemaphore() const;
 
+            bool IsInheritingRenderPass() const { return m_InheritedRenderPass; }
+
+            // Secondary buffers keep their statistics until executed, so worker threads never touch the engine's
+            void AddDrawStats(uint32_t drawCalls, uint32_t triangles);
+            void AddBoundPipeline();
+
             static void MakeDefault();
 
         protected:
@@ -76,6 +86,12 @@ namespace Lumos
             uint32_t m_BoundRenderPassWidth  = 0;
             uint32_t m_BoundRenderPassHeight = 0;
             Framebuffer* m_BoundFrameBuffer  = nullptr;
+            SubPassContents m_BoundContents  = SubPassContents::INLINE;
+            bool m_InheritedRenderPass       = false;
+
+            uint32_t m_DrawCalls      = 0;
+            uint32_t m_Triangles      = 0;
+            uint32_t m_BoundPipelines = 0;
         };
     }
 }
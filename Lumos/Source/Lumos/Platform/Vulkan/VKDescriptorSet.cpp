@@ -30,13 +30,16 @@ namespace Lumos
                 info.Desc          = descriptor;
                 info.Binding       = descriptor.binding;
 
-                if(descriptor.type == DescriptorType::UNIFORM_BUFFER)
+                if(descriptor.type == DescriptorType::UNIFORM_BUFFER || descriptor.type == DescriptorType::STORAGE_BUFFER)
                 {
                     for(uint32_t frame = 0; frame < m_FramesInFlight; frame++)
                     {
                         // Uniform Buffer per frame in flight
                         auto buffer = SharedPtr<Graphics::UniformBuffer>(Graphics::UniformBuffer::Create());
-                        buffer->Init(descriptor.size, nullptr);
+                        if(descriptor.type == DescriptorType::STORAGE_BUFFER)
+                            buffer.As<VKUniformBuffer>()->Init(descriptor.size, nullptr, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+                        else
+                            buffer->Init(descriptor.size, nullptr);
                         m_UniformBuffers[frame][descriptor.binding] = buffer;
                     }
 
@@ -135,7 +138,10 @@ namespace Lumos
             {
                 if(bufferInfo.valid && !bufferInfo.Desc.m_Members.Empty() && bufferInfo.HasUpdated[currentFrame])
                 {
-                    m_UniformBuffers[currentFrame][bufferInfo.Binding]->SetData(bufferInfo.LocalStorage.Data);
+                    if(bufferInfo.UploadSize)
+                        m_UniformBuffers[currentFrame][bufferInfo.Binding]->SetData(bufferInfo.UploadSize, bufferInfo.LocalStorage.Data);
+                    else
+                        m_UniformBuffers[currentFrame][bufferInfo.Binding]->SetData(bufferInfo.LocalStorage.Data);
                     bufferInfo.HasUpdated[currentFrame] = false;
                 }
             }
@@ -220,7 +226,7 @@ namespace Lumos
                         descriptorWritesCount++;
                     }
 
-                    else if(imageInfo.Desc.type == DescriptorType::UNIFORM_BUFFER)
+                    else if(imageInfo.Desc.type == DescriptorType::UNIFORM_BUFFER || imageInfo.Desc.type == DescriptorType::STORAGE_BUFFER)
                     {
                         VKUniformBuffer* vkUniformBuffer = m_UniformBuffers[currentFrame][imageInfo.Desc.binding].As<VKUniformBuffer>().get();
                         bufferInfos[index].buffer        = *vkUniformBuffer->GetBuffer();
@@ -598,6 +604,7 @@ namespace Lumos
             if(lBufferInfo)
             {
                 lBufferInfo->LocalStorage.Write(data, lBufferInfo->LocalStorage.GetSize(), 0);
+                lBufferInfo->UploadSize    = 0;
                 lBufferInfo->HasUpdated[0] = true;
                 lBufferInfo->HasUpdated[1] = true;
                 lBufferInfo->HasUpdated[2] = true;
@@ -616,6 +623,7 @@ namespace Lumos
             {
                 ASSERT(size <= lBufferInfo->LocalStorage.GetSize());
                 lBufferInfo->LocalStorage.Write(data, size, 0);
+                lBufferInfo->UploadSize    = uint32_t(size); // Only the written part is copied on update
                 lBufferInfo->HasUpdated[0] = true;
                 lBufferInfo->HasUpdated[1] = true;
                 lBufferInfo->HasUpdated[2] = true;
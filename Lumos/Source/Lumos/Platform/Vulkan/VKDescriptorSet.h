@@ -71,7 +71,8 @@ namespace Lumos
                 Descriptor Desc;
                 Buffer LocalStorage;
                 u8 Binding;
-                bool valid = false;
+                bool valid          = false;
+                uint32_t UploadSize = 0; // Bytes copied to the GPU buffer on update, 0 for all of LocalStorage
                 // Per frame in flight
                 bool HasUpdated[MAX_FRAMES_FLIGHT];
             };
@@ -8,11 +8,14 @@
 #include "VKRenderer.h"
 #include "VKCommandPool.h"
 #include "Core/Algorithms/Sort.h"
+#include "Core/OS/FileSystem.h"
+#include "Utilities/Hash.h"
 
 #if LUMOS_PROFILE && defined(TRACY_ENABLE)
 #include <Tracy/public/tracy/TracyVulkan.hpp>
 #endif
 #include <stb/stb_sprintf.h>
+#include <filesystem>
 
 #define LOG_VMA_ALLOCATIONS 0
 namespace Lumos
@@ -386,15 +389,16 @@ namespace Lumos
         VKDevice::~VKDevice()
         {
             m_CommandPool.reset();
+            SavePipelineCache();
             vkDestroyPipelineCache(m_Device, m_PipelineCache, VK_NULL_HANDLE);
 
 #ifdef USE_VMA_ALLOCATOR
 
-            ForHashMapEach(uint32_t, VmaPool, &m_SmallAllocPools, it)
+            for(auto& pool : m_SmallAllocPools)
             {
-                VmaPool value = *it.value;
-                vmaDestroyPool(m_Allocator, value);
+                vmaDestroyPool(m_Allocator, pool.Value);
             }
+            m_SmallAllocPools.Clear();
 #ifdef LUMOS_DEBUG
             for(int i = 0; i < 3; i++)
             {
@@ -424,11 +428,6 @@ namespace Lumos
             VkPhysicalDeviceFeatures supportedFeatures;
             memset(&supportedFeatures, 0, sizeof(VkPhysicalDeviceFeatures));
             memset(&m_EnabledFeatures, 0, sizeof(VkPhysicalDeviceFeatures));
-#ifdef USE_VMA_ALLOCATOR
-            m_SmallAllocPools.data     = 0;
-            m_SmallAllocPools.length   = 0;
-            m_SmallAllocPools.capacity = 0;
-#endif
             vkGetPhysicalDeviceFeatures(m_PhysicalDevice->GetHandle(), &supportedFeatures);
 
             if(supportedFeatures.wideLines)
@@ -619,12 +618,128 @@ namespace Lumos
             return VK_SUCCESS;
         }
 
+        // Written in front of the driver's cache data. The driver validates its own header too,
+        // but some drivers crash on data from another device instead of ignoring it
+        struct PipelineCacheFileHeader
+        {
+            uint32_t Magic;
+            uint32_t Version;
+            uint32_t VendorID;
+            uint32_t DeviceID;
+            uint32_t DriverVersion;
+            uint8_t PipelineCacheUUID[VK_UUID_SIZE];
+            uint64_t DataSize;
+            uint64_t DataHash;
+        };
+
+        static const uint32_t PipelineCacheMagic   = 0x4B56504C; // "LPVK"
+        static const uint32_t PipelineCacheVersion = 1;
+
+        static void FillPipelineCacheHeader(const VkPhysicalDeviceProperties& properties, PipelineCacheFileHeader& header)
+        {
+            memset(&header, 0, sizeof(PipelineCacheFileHeader));
+            header.Magic         = PipelineCacheMagic;
+            header.Version       = PipelineCacheVersion;
+            header.VendorID      = properties.vendorID;
+            header.DeviceID      = properties.deviceID;
+            header.DriverVersion = properties.driverVersion;
+            memcpy(header.PipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+        }
+
+        std::string VKDevice::GetCacheDirectory(const std::string& subDirectory)
+        {
+            std::string directory = Application::Get().GetProjectSettings().m_ProjectRoot + "Cache/Vulkan/" + subDirectory;
+
+            std::error_code ec;
+            std::filesystem::create_directories(directory, ec);
+            if(ec)
+            {
+                LWARN("Failed to create cache directory %s : %s", directory.c_str(), ec.message().c_str());
+                return "";
+            }
+
+            return directory;
+        }
+
         void VKDevice::CreatePipelineCache()
         {
+            LUMOS_PROFILE_FUNCTION();
+            std::string cacheDirectory = GetCacheDirectory();
+            std::string cachePath      = cacheDirectory + "PipelineCache.bin";
+
+            PipelineCacheFileHeader expected;
+            FillPipelineCacheHeader(m_PhysicalDevice->GetProperties(), expected);
+
+            uint8_t* fileData = nullptr;
+            int64_t fileSize  = !cacheDirectory.empty() && FileSystem::FileExists(cachePath) ? FileSystem::GetFileSize(cachePath) : 0;
+            if(fileSize > (int64_t)sizeof(PipelineCacheFileHeader))
+                fileData = FileSystem::ReadFile(cachePath);
+
             VkPipelineCacheCreateInfo pipelineCacheCI = {};
             pipelineCacheCI.sType                     = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
             pipelineCacheCI.pNext                     = NULL;
-            vkCreatePipelineCache(m_Device, &pipelineCacheCI, VK_NULL_HANDLE, &m_PipelineCache);
+
+            if(fileData)
+            {
+                PipelineCacheFileHeader header;
+                memcpy(&header, fileData, sizeof(PipelineCacheFileHeader));
+                const uint8_t* cacheData = fileData + sizeof(PipelineCacheFileHeader);
+
+                bool valid = header.Magic == expected.Magic && header.Version == expected.Version
+                    && header.VendorID == expected.VendorID && header.DeviceID == expected.DeviceID
+                    && header.DriverVersion == expected.DriverVersion
+                    && memcmp(header.PipelineCacheUUID, expected.PipelineCacheUUID, VK_UUID_SIZE) == 0
+                    && header.DataSize == uint64_t(fileSize - sizeof(PipelineCacheFileHeader))
+                    && header.DataHash == MurmurHash64A(cacheData, (int)header.DataSize, 0);
+
+                if(valid)
+                {
+                    pipelineCacheCI.initialDataSize = (size_t)header.DataSize;
+                    pipelineCacheCI.pInitialData    = cacheData;
+                    LINFO("Loaded pipeline cache (%llu bytes)", (unsigned long long)header.DataSize);
+                }
+                else
+                    LINFO("Pipeline cache is from a different device or driver, rebuilding");
+            }
+
+            VkResult result = vkCreatePipelineCache(m_Device, &pipelineCacheCI, VK_NULL_HANDLE, &m_PipelineCache);
+            if(result != VK_SUCCESS && pipelineCacheCI.pInitialData)
+            {
+                LWARN("Failed to create pipeline cache from saved data, rebuilding");
+                pipelineCacheCI.initialDataSize = 0;
+                pipelineCacheCI.pInitialData    = nullptr;
+                vkCreatePipelineCache(m_Device, &pipelineCacheCI, VK_NULL_HANDLE, &m_PipelineCache);
+            }
+
+            delete[] fileData;
+        }
+
+        void VKDevice::SavePipelineCache()
+        {
+            LUMOS_PROFILE_FUNCTION();
+            std::string cacheDirectory = GetCacheDirectory();
+            if(m_PipelineCache == VK_NULL_HANDLE || cacheDirectory.empty())
+                return;
+
+            size_t dataSize = 0;
+            if(vkGetPipelineCacheData(m_Device, m_PipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0)
+                return;
+
+            uint8_t* fileData  = new uint8_t[sizeof(PipelineCacheFileHeader) + dataSize];
+            uint8_t* cacheData = fileData + sizeof(PipelineCacheFileHeader);
+            if(vkGetPipelineCacheData(m_Device, m_PipelineCache, &dataSize, cacheData) == VK_SUCCESS)
+            {
+                PipelineCacheFileHeader header;
+                FillPipelineCacheHeader(m_PhysicalDevice->GetProperties(), header);
+                header.DataSize = dataSize;
+                header.DataHash = MurmurHash64A(cacheData, (int)dataSize, 0);
+                memcpy(fileData, &header, sizeof(PipelineCacheFileHeader));
+
+                if(!FileSystem::WriteFile(cacheDirectory + "PipelineCache.bin", fileData, uint32_t(sizeof(PipelineCacheFileHeader) + dataSize)))
+                    LWARN("Failed to save pipeline cache");
+            }
+
+            delete[] fileData;
         }
 
         void VKDevice::CreateTracyContext()
@@ -666,7 +781,7 @@ namespace Lumos
         VmaPool VKDevice::GetOrCreateSmallAllocPool(uint32_t memTypeIndex)
         {
             VmaPool pool = VK_NULL_HANDLE;
-            if(HashMapFind(&m_SmallAllocPools, memTypeIndex, &pool))
+            if(m_SmallAllocPools.Find(memTypeIndex, pool))
                 return pool;
 
             LINFO("Creating VMA small objects pool for memory type index %i", memTypeIndex);
@@ -681,7 +796,7 @@ namespace Lumos
             pci.minAllocationAlignment = 0;
             pci.pMemoryAllocateNext    = nullptr;
             VK_CHECK_RESULT(vmaCreatePool(m_Allocator, &pci, &pool));
-            HashMapInsert(&m_SmallAllocPools, memTypeIndex, pool);
+            m_SmallAllocPools.Insert(memTypeIndex, pool);
             return pool;
         }
 #endif
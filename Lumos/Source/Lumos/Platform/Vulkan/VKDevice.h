@@ -104,8 +104,13 @@ namespace Lumos
 
             bool Init();
             void CreatePipelineCache();
+            void SavePipelineCache();
             void CreateTracyContext();
 
+            // Per project folder for the pipeline and shader reflection caches, created with any parents.
+            // Empty if it can't be created, in which case callers run without the on disk cache
+            static std::string GetCacheDirectory(const std::string& subDirectory = "");
+
             VkDevice GetDevice() const
             {
                 return m_Device;
@@ -182,7 +187,7 @@ namespace Lumos
             VkQueue m_ComputeQueue;
             VkQueue m_GraphicsQueue;
             VkQueue m_PresentQueue;
-            VkPipelineCache m_PipelineCache;
+            VkPipelineCache m_PipelineCache = VK_NULL_HANDLE;
             VkDescriptorPool m_DescriptorPool;
             VkPhysicalDeviceFeatures m_EnabledFeatures;
 
@@ -200,7 +205,7 @@ namespace Lumos
 
 #ifdef USE_VMA_ALLOCATOR
             VmaAllocator m_Allocator {};
-            HashMap(uint32_t, VmaPool) m_SmallAllocPools;
+            FlatHashMap<uint32_t, VmaPool> m_SmallAllocPools;
 #endif
         };
 
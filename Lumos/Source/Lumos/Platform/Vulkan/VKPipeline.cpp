@@ -277,31 +277,29 @@ namespace Lumos
             return true;
         }
 
+        VKFramebuffer* VKPipeline::GetFramebuffer(uint32_t layer) const
+        {
+            if(m_Description.swapchainTarget)
+                return m_Framebuffers[Renderer::GetMainSwapChain()->GetCurrentImageIndex()];
+            else if(m_Description.depthArrayTarget || m_Description.cubeMapTarget)
+                return m_Framebuffers[layer];
+
+            return m_Framebuffers[0];
+        }
+
         void VKPipeline::Bind(CommandBuffer* commandBuffer, uint32_t layer)
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            Engine::Get().Statistics().BoundPipelines++;
-
-            VKFramebuffer* framebuffer;
+            VKCommandBuffer* vkCommandBuffer = static_cast<VKCommandBuffer*>(commandBuffer);
+            vkCommandBuffer->AddBoundPipeline();
 
             if(!m_Compute)
             {
-                TransitionAttachments();
-
-                if(m_Description.swapchainTarget)
-                {
-                    framebuffer = m_Framebuffers[Renderer::GetMainSwapChain()->GetCurrentImageIndex()];
-                }
-                else if(m_Description.depthArrayTarget || m_Description.cubeMapTarget)
-                {
-                    framebuffer = m_Framebuffers[layer];
-                }
-                else
-                {
-                    framebuffer = m_Framebuffers[0];
-                }
+                // Secondary buffers continue a render pass the primary already began, and transitioned the attachments for
+                if(!vkCommandBuffer->IsInheritingRenderPass())
+                    TransitionAttachments();
 
-                ((VKCommandBuffer*)commandBuffer)->BeginRenderPass(m_RenderPass, m_Description.clearColour, framebuffer, GetWidth(), GetHeight());
+                vkCommandBuffer->BeginRenderPass(m_RenderPass, m_Description.clearColour, GetFramebuffer(layer), GetWidth(), GetHeight());
                 // m_RenderPass->BeginRenderPass(commandBuffer, m_Description.clearColour, framebuffer, Graphics::INLINE, GetWidth(), GetHeight());
             }
             else
@@ -38,6 +38,13 @@ namespace Lumos
                 return m_Shader.get();
             }
 
+            RenderPass* GetRenderPass() const override
+            {
+                return m_RenderPass.get();
+            }
+
+            VKFramebuffer* GetFramebuffer(uint32_t layer) const;
+
             void CreateFramebuffers();
             void ClearRenderTargets(CommandBuffer* commandBuffer) override;
             void TransitionAttachments();
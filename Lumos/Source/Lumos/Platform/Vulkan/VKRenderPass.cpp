@@ -308,7 +308,10 @@ namespace Lumos
             }
 
             vkCmdBeginRenderPass(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), &rpBegin, SubPassContentsToVK(contents));
-            commandBuffer->UpdateViewport(RenderPassWidth, RenderPassHeight, m_SwapchainTarget);
+
+            // Secondary buffers set their own viewport, only vkCmdExecuteCommands may follow in the primary
+            if(contents == SubPassContents::INLINE)
+                commandBuffer->UpdateViewport(RenderPassWidth, RenderPassHeight, m_SwapchainTarget);
 
             s_ActiveCount++;
             Engine::Get().Statistics().BoundSceneRenderer++;
@@ -19,6 +19,7 @@ namespace Lumos
             const VkRenderPass& GetHandle() const { return m_RenderPass; };
             int GetAttachmentCount() const override { return m_ClearCount; };
             int GetColourAttachmentCount() const { return m_ColourAttachmentCount; }
+            bool IsSwapchainTarget() const { return m_SwapchainTarget; }
 
             static void MakeDefault();
 
@@ -443,20 +443,18 @@ file.close();
             vkCmdBindDescriptorSets(static_cast<Graphics::VKCommandBuffer*>(commandBuffer)->GetHandle(), static_cast<Graphics::VKPipeline*>(pipeline)->IsCompute() ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS, static_cast<Graphics::VKPipeline*>(pipeline)->GetPipelineLayout(), 0, numDescriptorSets, lCurrentDescriptorSets, numDynamicDescriptorSets, &dynamicOffset);
         }
 
-        void VKRenderer::DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start) const
+        void VKRenderer::DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start, uint32_t instanceCount) const
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            Engine::Get().Statistics().NumDrawCalls++;
-            Engine::Get().Statistics().TriangleCount += count / 3;
+            static_cast<VKCommandBuffer*>(commandBuffer)->AddDrawStats(1, (count / 3) * instanceCount);
 
-            vkCmdDrawIndexed(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), count, 1, 0, 0, 0);
+            vkCmdDrawIndexed(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), count, instanceCount, 0, 0, 0);
         }
 
         void VKRenderer::DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            Engine::Get().Statistics().NumDrawCalls++;
-            Engine::Get().Statistics().TriangleCount += count / 3;
+            static_cast<VKCommandBuffer*>(commandBuffer)->AddDrawStats(1, count / 3);
 
             vkCmdDraw(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), count, 1, 0, 0);
         }
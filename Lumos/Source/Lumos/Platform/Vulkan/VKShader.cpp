@@ -11,12 +11,15 @@
 #include "Utilities/CombineHash.h"
 #include "Core/OS/FileSystem.h"
 #include "Core/OS/FileSystem.h"
+#include "Utilities/Hash.h"
 #include "Utilities/StringUtilities.h"
 #include "Maths/Vector3.h"
 #include "Maths/IVector4.h"
 #include "Core/Algorithms/Sort.h"
+#include "Core/DataStructures/Map.h"
 
 #include <spirv_cross.hpp>
+#include <mutex>
 
 #define SHADER_LOG_ENABLED 0
 
@@ -597,164 +600,403 @@ namespace Lumos
             return "UNKNOWN";
         }
 
-        void VKShader::LoadFromData(const uint32_t* source, uint32_t fileSize, ShaderType shaderType, int currentShaderStage)
+        // Everything LoadFromData needs from SPIRV-Cross. Saved next to the pipeline cache, keyed by the SPIR-V hash,
+        // so later runs skip reflection entirely
+        struct ShaderReflectionMember
         {
-            LUMOS_PROFILE_FUNCTION_LOW();
-            VkShaderModuleCreateInfo shaderCreateInfo = {};
-            shaderCreateInfo.sType                    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-            shaderCreateInfo.codeSize                 = fileSize;
-            shaderCreateInfo.pCode                    = source;
-            shaderCreateInfo.pNext                    = VK_NULL_HANDLE;
+            std::string Name;
+            uint32_t Offset = 0;
+            uint32_t Size   = 0;
+            uint32_t Type   = 0;
+        };
+
+        struct ShaderReflectionResource
+        {
+            DescriptorType Type = DescriptorType::UNIFORM_BUFFER;
+            std::string Name;
+            uint32_t Set     = 0;
+            uint32_t Binding = 0;
+            uint32_t Count   = 1;
+            uint32_t Size    = 0; // Declared size for uniform and storage buffers, accessed range for push constants
+            TDArray<ShaderReflectionMember> Members;
+        };
+
+        struct ShaderReflectionData
+        {
+            TDArray<VkVertexInputAttributeDescription> VertexInputs; // Offsets are assigned when applied
+            TDArray<ShaderReflectionResource> Resources;             // Uniform and storage buffers, then sampled and storage images
+            TDArray<ShaderReflectionResource> PushConstants;
+        };
+
+        static const uint32_t ShaderReflectionMagic   = 0x5253464C; // "LFSR"
+        static const uint32_t ShaderReflectionVersion = 2;
+
+        static std::mutex s_ReflectionMutex;
+        static FlatHashMap<uint64_t, UniquePtr<ShaderReflectionData>> s_ReflectionCache; // Boxed so returned references survive a rehash
+
+        static void ReflectBuffer(spirv_cross::Compiler& comp, const spirv_cross::Resource& u, DescriptorType descriptorType, ShaderReflectionData& outData)
+        {
+            auto& type       = comp.get_type(u.type_id);
+            auto& bufferType = comp.get_type(u.base_type_id);
+            int memberCount  = (int)bufferType.member_types.size();
+
+            auto& resource   = outData.Resources.EmplaceBack();
+            resource.Type    = descriptorType;
+            resource.Name    = u.name;
+            resource.Set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+            resource.Binding = comp.get_decoration(u.id, spv::DecorationBinding);
+            resource.Count   = type.array.size() ? uint32_t(type.array[0]) : 1;
+            resource.Size    = (uint32_t)comp.get_declared_struct_size(bufferType);
+
+            for(int i = 0; i < memberCount; i++)
+            {
+                auto& member  = resource.Members.EmplaceBack();
+                member.Name   = comp.get_member_name(bufferType.self, i);
+                member.Offset = comp.type_struct_member_offset(bufferType, i);
+                member.Size   = (uint32_t)comp.get_declared_struct_member_size(bufferType, i);
+            }
+        }
 
+        static void ReflectShader(Shader* shader, const uint32_t* source, uint32_t fileSize, ShaderReflectionData& outData)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
             spirv_cross::Compiler comp(source, size_t(fileSize / sizeof(uint32_t)));
             // The SPIR-V is now parsed, and we can perform reflection on it.
             spirv_cross::ShaderResources resources = comp.get_shader_resources();
 
-            if(shaderType == ShaderType::VERTEX)
+            for(const spirv_cross::Resource& resource : resources.stage_inputs)
             {
-                // Vertex Layout
-                m_VertexInputStride = 0;
+                const spirv_cross::SPIRType& InputType = comp.get_type(resource.type_id);
 
-                for(const spirv_cross::Resource& resource : resources.stage_inputs)
-                {
-                    const spirv_cross::SPIRType& InputType = comp.get_type(resource.type_id);
+                VkVertexInputAttributeDescription Description = {};
+                Description.binding                           = comp.get_decoration(resource.id, spv::DecorationBinding);
+                Description.location                          = comp.get_decoration(resource.id, spv::DecorationLocation);
+                Description.format                            = GetVulkanFormat(InputType);
+                outData.VertexInputs.PushBack(Description);
+            }
 
-                    VkVertexInputAttributeDescription Description = {};
-                    Description.binding                           = comp.get_decoration(resource.id, spv::DecorationBinding);
-                    Description.location                          = comp.get_decoration(resource.id, spv::DecorationLocation);
-                    Description.offset                            = m_VertexInputStride;
-                    Description.format                            = GetVulkanFormat(InputType);
-                    m_VertexInputAttributeDescriptions.PushBack(Description);
+            for(auto& u : resources.uniform_buffers)
+                ReflectBuffer(comp, u, DescriptorType::UNIFORM_BUFFER, outData);
 
-                    m_VertexInputStride += GetStrideFromVulkanFormat(Description.format);
-                }
+            // Storage buffers are read only in the shaders and filled from the CPU, the same as uniform buffers
+            for(auto& u : resources.storage_buffers)
+                ReflectBuffer(comp, u, DescriptorType::STORAGE_BUFFER, outData);
+
+            for(auto& u : resources.sampled_images)
+            {
+                auto& type       = comp.get_type(u.type_id);
+                auto& resource   = outData.Resources.EmplaceBack();
+                resource.Type    = DescriptorType::IMAGE_SAMPLER;
+                resource.Name    = u.name;
+                resource.Set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+                resource.Binding = comp.get_decoration(u.id, spv::DecorationBinding);
+                resource.Count   = type.array.size() ? uint32_t(type.array[0]) : 1;
             }
 
-            // Descriptor Layout
-            for(auto& u : resources.uniform_buffers)
+            for(auto& u : resources.storage_images)
             {
-                uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
-                uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
                 auto& type       = comp.get_type(u.type_id);
+                auto& resource   = outData.Resources.EmplaceBack();
+                resource.Type    = DescriptorType::IMAGE_STORAGE;
+                resource.Name    = u.name;
+                resource.Set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+                resource.Binding = comp.get_decoration(u.id, spv::DecorationBinding);
+                resource.Count   = type.array.size() ? uint32_t(type.array[0]) : 1;
+            }
 
-                SHADER_LOG(LINFO("Found UBO %s at set = %i, binding = %i", u.name.c_str(), set, binding));
-                m_DescriptorLayoutInfo.PushBack({ Graphics::DescriptorType::UNIFORM_BUFFER, shaderType, binding, set, type.array.size() ? uint32_t(type.array[0]) : 1 });
-
-                auto& bufferType      = comp.get_type(u.base_type_id);
-                auto bufferSize       = comp.get_declared_struct_size(bufferType);
-                int memberCount       = (int)bufferType.member_types.size();
-                auto& descriptorInfo  = m_DescriptorInfos[set];
-                auto& descriptor      = descriptorInfo.descriptors.EmplaceBack();
-                descriptor.binding    = binding;
-                descriptor.size       = (uint32_t)bufferSize;
-                descriptor.name       = u.name;
-                descriptor.offset     = 0;
-                descriptor.shaderType = shaderType;
-                descriptor.type       = Graphics::DescriptorType::UNIFORM_BUFFER;
-                descriptor.buffer     = nullptr;
+            for(auto& u : resources.push_constant_buffers)
+            {
+                auto& bufferType = comp.get_type(u.base_type_id);
+                int memberCount  = (int)bufferType.member_types.size();
+
+                auto& pushConstant = outData.PushConstants.EmplaceBack();
+                pushConstant.Name  = u.name;
+
+                for(auto& range : comp.get_active_buffer_ranges(u.id))
+                    pushConstant.Size += uint32_t(range.range);
 
                 for(int i = 0; i < memberCount; i++)
                 {
-                    auto type              = comp.get_type(bufferType.member_types[i]);
-                    const auto& memberName = comp.get_member_name(bufferType.self, i);
-                    auto size              = comp.get_declared_struct_member_size(bufferType, i);
-                    auto offset            = comp.type_struct_member_offset(bufferType, i);
+                    auto& member  = pushConstant.Members.EmplaceBack();
+                    member.Name   = comp.get_member_name(bufferType.self, i);
+                    member.Offset = comp.type_struct_member_offset(bufferType, i);
+                    member.Size   = (uint32_t)comp.get_declared_struct_member_size(bufferType, i);
+                    member.Type   = (uint32_t)shader->SPIRVTypeToLumosDataType(comp.get_type(bufferType.member_types[i]));
+                }
+            }
+        }
 
-                    std::string uniformName = u.name + "." + memberName;
+        static void WriteReflectionU32(std::string& buffer, uint32_t value)
+        {
+            buffer.append((const char*)&value, sizeof(uint32_t));
+        }
 
-                    auto& member  = descriptor.m_Members.EmplaceBack();
-                    member.name   = memberName;
-                    member.offset = offset;
-                    member.size   = (uint32_t)size;
+        static void WriteReflectionString(std::string& buffer, const std::string& value)
+        {
+            WriteReflectionU32(buffer, (uint32_t)value.size());
+            buffer.append(value);
+        }
 
-                    SHADER_LOG(LINFO("%s - Size %i, offset %i", uniformName.c_str(), size, offset));
+        static void WriteReflectionResources(std::string& buffer, const TDArray<ShaderReflectionResource>& resources)
+        {
+            WriteReflectionU32(buffer, (uint32_t)resources.Size());
+            for(auto& resource : resources)
+            {
+                WriteReflectionU32(buffer, (uint32_t)resource.Type);
+                WriteReflectionString(buffer, resource.Name);
+                WriteReflectionU32(buffer, resource.Set);
+                WriteReflectionU32(buffer, resource.Binding);
+                WriteReflectionU32(buffer, resource.Count);
+                WriteReflectionU32(buffer, resource.Size);
+                WriteReflectionU32(buffer, (uint32_t)resource.Members.Size());
+                for(auto& member : resource.Members)
+                {
+                    WriteReflectionString(buffer, member.Name);
+                    WriteReflectionU32(buffer, member.Offset);
+                    WriteReflectionU32(buffer, member.Size);
+                    WriteReflectionU32(buffer, member.Type);
                 }
             }
+        }
 
-            for(auto& u : resources.push_constant_buffers)
+        // Bounds checked reads, a truncated or stale file just fails the load
+        struct ReflectionReader
+        {
+            const uint8_t* Data;
+            uint64_t Size;
+            uint64_t Offset = 0;
+            bool Valid      = true;
+
+            uint32_t U32()
             {
-                uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
-                uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
+                uint32_t value = 0;
+                if(Offset + sizeof(uint32_t) > Size)
+                {
+                    Valid = false;
+                    return 0;
+                }
+                memcpy(&value, Data + Offset, sizeof(uint32_t));
+                Offset += sizeof(uint32_t);
+                return value;
+            }
 
-                uint32_t binding3 = comp.get_decoration(u.id, spv::DecorationOffset);
+            std::string String()
+            {
+                uint32_t length = U32();
+                if(!Valid || Offset + length > Size)
+                {
+                    Valid = false;
+                    return std::string();
+                }
+                std::string value((const char*)Data + Offset, length);
+                Offset += length;
+                return value;
+            }
 
-                auto& type = comp.get_type(u.type_id);
+            void Resources(TDArray<ShaderReflectionResource>& outResources)
+            {
+                uint32_t count = U32();
+                for(uint32_t i = 0; i < count && Valid; i++)
+                {
+                    auto& resource   = outResources.EmplaceBack();
+                    resource.Type    = (DescriptorType)U32();
+                    resource.Name    = String();
+                    resource.Set     = U32();
+                    resource.Binding = U32();
+                    resource.Count   = U32();
+                    resource.Size    = U32();
+
+                    uint32_t memberCount = U32();
+                    for(uint32_t m = 0; m < memberCount && Valid; m++)
+                    {
+                        auto& member  = resource.Members.EmplaceBack();
+                        member.Name   = String();
+                        member.Offset = U32();
+                        member.Size   = U32();
+                        member.Type   = U32();
+                    }
+                }
+            }
+        };
 
-                auto ranges = comp.get_active_buffer_ranges(u.id);
+        // Empty when the cache directory can't be created
+        static std::string GetReflectionCachePath(uint64_t spirvHash)
+        {
+            std::string directory = VKDevice::GetCacheDirectory("Shaders/");
+            if(directory.empty())
+                return directory;
 
-                uint32_t size = 0;
-                for(auto& range : ranges)
+            char fileName[32];
+            sprintf(fileName, "%016llx.lsr", (unsigned long long)spirvHash);
+            return directory + fileName;
+        }
+
+        static bool LoadShaderReflection(uint64_t spirvHash, ShaderReflectionData& outData)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            std::string path = GetReflectionCachePath(spirvHash);
+            if(path.empty() || !FileSystem::FileExists(path))
+                return false;
+
+            int64_t fileSize  = FileSystem::GetFileSize(path);
+            uint8_t* fileData = FileSystem::ReadFile(path);
+            if(!fileData)
+                return false;
+
+            ReflectionReader reader = { fileData, (uint64_t)fileSize };
+            bool valid              = reader.U32() == ShaderReflectionMagic && reader.U32() == ShaderReflectionVersion;
+            uint32_t hashLow        = reader.U32();
+            uint32_t hashHigh       = reader.U32();
+            valid                   = valid && (((uint64_t)hashHigh << 32) | hashLow) == spirvHash;
+
+            if(valid)
+            {
+                uint32_t inputCount = reader.U32();
+                for(uint32_t i = 0; i < inputCount && reader.Valid; i++)
                 {
-                    SHADER_LOG(LINFO("Accessing Member %i offset %i, size %i", range.index, range.offset, range.range));
-                    size += uint32_t(range.range);
+                    VkVertexInputAttributeDescription description = {};
+                    description.binding                           = reader.U32();
+                    description.location                          = reader.U32();
+                    description.format                            = (VkFormat)reader.U32();
+                    outData.VertexInputs.PushBack(description);
                 }
 
-                SHADER_LOG(LINFO("Found Push Constant %s at set = %i, binding = %i", u.name.c_str(), set, binding, type.array.size() ? uint32_t(type.array[0]) : 1));
+                reader.Resources(outData.Resources);
+                reader.Resources(outData.PushConstants);
+                valid = reader.Valid;
+            }
 
-                m_PushConstants.PushBack({ size, shaderType });
-                m_PushConstants.Back().data = new uint8_t[size];
+            delete[] fileData;
 
-                auto& bufferType = comp.get_type(u.base_type_id);
-                auto bufferSize  = comp.get_declared_struct_size(bufferType);
-                int memberCount  = (int)bufferType.member_types.size();
+            if(!valid)
+            {
+                outData = ShaderReflectionData();
+                LWARN("Ignoring stale shader reflection cache %s", path.c_str());
+            }
 
-                for(int i = 0; i < memberCount; i++)
-                {
-                    auto type               = comp.get_type(bufferType.member_types[i]);
-                    const auto& memberName  = comp.get_member_name(bufferType.self, i);
-                    auto size               = comp.get_declared_struct_member_size(bufferType, i);
-                    auto offset             = comp.type_struct_member_offset(bufferType, i);
-                    std::string uniformName = u.name + "." + memberName;
-                    auto& member            = m_PushConstants.Back().m_Members.EmplaceBack();
-                    member.size             = (uint32_t)size;
-                    member.offset           = offset;
-                    member.type             = SPIRVTypeToLumosDataType(type);
-                    member.fullName         = uniformName;
-                    member.name             = memberName;
-                }
+            return valid;
+        }
+
+        static void SaveShaderReflection(uint64_t spirvHash, const ShaderReflectionData& data)
+        {
+            std::string buffer;
+            WriteReflectionU32(buffer, ShaderReflectionMagic);
+            WriteReflectionU32(buffer, ShaderReflectionVersion);
+            WriteReflectionU32(buffer, (uint32_t)spirvHash);
+            WriteReflectionU32(buffer, (uint32_t)(spirvHash >> 32));
+
+            WriteReflectionU32(buffer, (uint32_t)data.VertexInputs.Size());
+            for(auto& input : data.VertexInputs)
+            {
+                WriteReflectionU32(buffer, input.binding);
+                WriteReflectionU32(buffer, input.location);
+                WriteReflectionU32(buffer, (uint32_t)input.format);
             }
 
-            for(auto& u : resources.sampled_images)
+            WriteReflectionResources(buffer, data.Resources);
+            WriteReflectionResources(buffer, data.PushConstants);
+
+            std::string path = GetReflectionCachePath(spirvHash);
+            if(!path.empty())
+                FileSystem::WriteFile(path, (uint8_t*)buffer.data(), (uint32_t)buffer.size());
+        }
+
+        // Memory first, then the on disk cache, then SPIRV-Cross
+        static const ShaderReflectionData& GetShaderReflection(Shader* shader, const uint32_t* source, uint32_t fileSize)
+        {
+            uint64_t spirvHash = MurmurHash64A(source, (int)fileSize, 0);
+
+            std::lock_guard<std::mutex> lock(s_ReflectionMutex);
+            if(auto found = s_ReflectionCache.Find(spirvHash))
+                return **found;
+
+            UniquePtr<ShaderReflectionData>& entry = s_ReflectionCache[spirvHash];
+            entry                                  = CreateUniquePtr<ShaderReflectionData>();
+            ShaderReflectionData& data             = *entry;
+            if(!LoadShaderReflection(spirvHash, data))
             {
-                uint32_t set         = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
-                uint32_t binding     = comp.get_decoration(u.id, spv::DecorationBinding);
-                auto& descriptorInfo = m_DescriptorInfos[set];
-                auto& descriptor     = descriptorInfo.descriptors.EmplaceBack();
+                ReflectShader(shader, source, fileSize, data);
+                SaveShaderReflection(spirvHash, data);
+            }
 
-                auto& type = comp.get_type(u.type_id);
-                SHADER_LOG(LINFO("Found Sampled Image %s at set = %i, binding = %i", u.name.c_str(), set, binding));
+            return data;
+        }
 
-                m_DescriptorLayoutInfo.PushBack({ Graphics::DescriptorType::IMAGE_SAMPLER, shaderType, binding, set, type.array.size() ? uint32_t(type.array[0]) : 1 });
+        void VKShader::LoadFromData(const uint32_t* source, uint32_t fileSize, ShaderType shaderType, int currentShaderStage)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            VkShaderModuleCreateInfo shaderCreateInfo = {};
+            shaderCreateInfo.sType                    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+            shaderCreateInfo.codeSize                 = fileSize;
+            shaderCreateInfo.pCode                    = source;
+            shaderCreateInfo.pNext                    = VK_NULL_HANDLE;
 
-                descriptor.binding      = binding;
-                descriptor.textureCount = 1;
-                descriptor.name         = u.name;
-                descriptor.texture      = Graphics::Material::GetDefaultTexture().get(); // TODO: Move
+            const ShaderReflectionData& reflection = GetShaderReflection(this, source, fileSize);
+
+            if(shaderType == ShaderType::VERTEX)
+            {
+                // Vertex Layout
+                m_VertexInputStride = 0;
+
+                for(auto Description : reflection.VertexInputs)
+                {
+                    Description.offset = m_VertexInputStride;
+                    m_VertexInputAttributeDescriptions.PushBack(Description);
+
+                    m_VertexInputStride += GetStrideFromVulkanFormat(Description.format);
+                }
             }
 
-            for(auto& u : resources.storage_images)
+            // Descriptor Layout
+            for(auto& resource : reflection.Resources)
             {
-                const auto& name       = u.name;
-                auto& type             = comp.get_type(u.type_id);
-                uint32_t binding       = comp.get_decoration(u.id, spv::DecorationBinding);
-                uint32_t descriptorSet = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
-                uint32_t dimension     = type.image.dim;
-                uint32_t arraySize     = type.array[0];
-                if(arraySize == 0)
-                    arraySize = 1;
+                SHADER_LOG(LINFO("Found %s at set = %i, binding = %i", resource.Name.c_str(), resource.Set, resource.Binding));
+                m_DescriptorLayoutInfo.PushBack({ resource.Type, shaderType, resource.Binding, resource.Set, resource.Count });
+
+                auto& descriptorInfo    = m_DescriptorInfos[resource.Set];
+                auto& descriptor        = descriptorInfo.descriptors.EmplaceBack();
+                descriptor.binding      = resource.Binding;
+                descriptor.name         = resource.Name;
+                descriptor.type         = resource.Type;
+                descriptor.textureCount = 1;
 
-                auto& descriptorInfo = m_DescriptorInfos[descriptorSet];
-                auto& descriptor     = descriptorInfo.descriptors.EmplaceBack();
+                if(resource.Type == DescriptorType::UNIFORM_BUFFER || resource.Type == DescriptorType::STORAGE_BUFFER)
+                {
+                    descriptor.size       = resource.Size;
+                    descriptor.offset     = 0;
+                    descriptor.shaderType = shaderType;
+                    descriptor.buffer     = nullptr;
 
-                SHADER_LOG(LINFO("Found Storage Image %s at set = %i, binding = %i", u.name.c_str(), descriptorSet, binding));
+                    for(auto& reflectedMember : resource.Members)
+                    {
+                        auto& member  = descriptor.m_Members.EmplaceBack();
+                        member.name   = reflectedMember.Name;
+                        member.offset = reflectedMember.Offset;
+                        member.size   = reflectedMember.Size;
 
-                m_DescriptorLayoutInfo.PushBack({ Graphics::DescriptorType::IMAGE_STORAGE, shaderType, binding, descriptorSet, type.array.size() ? uint32_t(type.array[0]) : 1 });
+                        SHADER_LOG(LINFO("%s.%s - Size %i, offset %i", resource.Name.c_str(), member.name.c_str(), member.size, member.offset));
+                    }
+                }
+                else
+                    descriptor.texture = Graphics::Material::GetDefaultTexture().get(); // TODO: Move
+            }
 
-                descriptor.type         = Graphics::DescriptorType::IMAGE_STORAGE;
-                descriptor.binding      = binding;
-                descriptor.textureCount = 1;
-                descriptor.name         = u.name;
-                descriptor.texture      = Graphics::Material::GetDefaultTexture().get(); // TODO: Move
+            for(auto& pushConstant : reflection.PushConstants)
+            {
+                SHADER_LOG(LINFO("Found Push Constant %s, size %i", pushConstant.Name.c_str(), pushConstant.Size));
+
+                m_PushConstants.PushBack({ pushConstant.Size, shaderType });
+                m_PushConstants.Back().data = new uint8_t[pushConstant.Size];
+
+                for(auto& reflectedMember : pushConstant.Members)
+                {
+                    auto& member    = m_PushConstants.Back().m_Members.EmplaceBack();
+                    member.size     = reflectedMember.Size;
+                    member.offset   = reflectedMember.Offset;
+                    member.type     = (ShaderDataType)reflectedMember.Type;
+                    member.fullName = pushConstant.Name + "." + reflectedMember.Name;
+                    member.name     = reflectedMember.Name;
+                }
             }
 
             m_ShaderStages[currentShaderStage].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -819,6 +1061,13 @@ namespace Lumos
             }
         }
 
+        void VKShader::BindPushConstantData(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const void* data)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            const auto& pc = m_PushConstants[index];
+            vkCmdPushConstants(static_cast<Graphics::VKCommandBuffer*>(commandBuffer)->GetHandle(), static_cast<Graphics::VKPipeline*>(pipeline)->GetPipelineLayout(), VKUtilities::ShaderTypeToVK(pc.shaderStage), pc.offset, pc.size, data);
+        }
+
         VkPipelineShaderStageCreateInfo* VKShader::GetShaderStages() const
         {
             return m_ShaderStages;
@@ -83,6 +83,7 @@ namespace Lumos
             const TDArray<DescriptorLayoutInfo>& GetDescriptorLayout() const { return m_DescriptorLayoutInfo; }
             const TDArray<VkDescriptorSetLayout>& GetDescriptorLayouts() const { return m_DescriptorSetLayouts; }
             void BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline) override;
+            void BindPushConstantData(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const void* data) override;
 
             static void PreProcess(const std::string& source, std::map<ShaderType, std::string>* sources);
             static void ReadShaderFile(const TDArray<std::string>& lines, std::map<ShaderType, std::string>* shaders);
@@ -35,6 +35,12 @@ namespace Lumos
                 if(m_Frames[i].MainCommandBuffer)
                     m_Frames[i].MainCommandBuffer->Flush();
 
+                for(uint32_t slot = 0; slot < MAX_RECORDING_SLOTS; slot++)
+                {
+                    m_Frames[i].SecondaryCommandBuffers[slot].Clear();
+                    m_Frames[i].SecondaryCommandPools[slot] = nullptr;
+                }
+
                 m_Frames[i].MainCommandBuffer     = nullptr;
                 m_Frames[i].CommandPool           = nullptr;
                 m_Frames[i].ImageAcquireSemaphore = nullptr;
@@ -337,6 +343,27 @@ namespace Lumos
             return GetCurrentFrameData().MainCommandBuffer.get();
         }
 
+        CommandBuffer* VKSwapChain::GetSecondaryCommandBuffer(uint32_t slot)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            ASSERT(slot < MAX_RECORDING_SLOTS, "Invalid recording slot");
+
+            FrameData& frameData = GetCurrentFrameData();
+            if(!frameData.SecondaryCommandPools[slot])
+                frameData.SecondaryCommandPools[slot] = CreateSharedPtr<VKCommandPool>(VKDevice::Get().GetPhysicalDevice()->GetGraphicsQueueFamilyIndex(), VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+
+            auto& commandBuffers = frameData.SecondaryCommandBuffers[slot];
+            uint32_t& used       = frameData.SecondaryCommandBuffersUsed[slot];
+            if(used == commandBuffers.Size())
+            {
+                auto commandBuffer = CreateSharedPtr<VKCommandBuffer>();
+                commandBuffer->Init(false, frameData.SecondaryCommandPools[slot]->GetHandle());
+                commandBuffers.PushBack(commandBuffer);
+            }
+
+            return commandBuffers[used++].get();
+        }
+
         bool VKSwapChain::Begin()
         {
             LUMOS_PROFILE_FUNCTION();
@@ -354,6 +381,18 @@ namespace Lumos
             }
 
             commandBuffer->Reset();
+
+            // The frame's fence has signalled, so its secondary buffers can be recorded again
+            FrameData& frameData = GetCurrentFrameData();
+            for(uint32_t slot = 0; slot < MAX_RECORDING_SLOTS; slot++)
+            {
+                if(frameData.SecondaryCommandBuffersUsed[slot] == 0)
+                    continue;
+
+                frameData.SecondaryCommandPools[slot]->Reset();
+                frameData.SecondaryCommandBuffersUsed[slot] = 0;
+            }
+
             VKRenderer::GetDeletionQueue(m_CurrentBuffer).Flush();
 
             if(!AcquireNextImage())
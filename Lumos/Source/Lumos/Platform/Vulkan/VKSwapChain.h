@@ -20,6 +20,11 @@ namespace Lumos
             SharedPtr<VKSemaphore> ImageAcquireSemaphore;
             SharedPtr<VKCommandPool> CommandPool;
             SharedPtr<VKCommandBuffer> MainCommandBuffer;
+
+            // Parallel recording, one pool per slot so slots never share a pool across threads
+            SharedPtr<VKCommandPool> SecondaryCommandPools[MAX_RECORDING_SLOTS];
+            TDArray<SharedPtr<VKCommandBuffer>> SecondaryCommandBuffers[MAX_RECORDING_SLOTS];
+            uint32_t SecondaryCommandBuffersUsed[MAX_RECORDING_SLOTS] = {};
         };
 
         class Texture2D;
@@ -50,6 +55,7 @@ namespace Lumos
 
             VkSurfaceKHR CreatePlatformSurface(VkInstance vkInstance, Window* window);
             CommandBuffer* GetCurrentCommandBuffer() override;
+            CommandBuffer* GetSecondaryCommandBuffer(uint32_t slot) override;
             void SetVSync(bool vsync) override { m_VSyncEnabled = vsync; }
 
             FrameData& GetCurrentFrameData();
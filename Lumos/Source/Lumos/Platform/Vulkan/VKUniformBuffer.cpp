@@ -28,6 +28,11 @@ namespace Lumos
             VKBuffer::Init(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, size, data);
         }
 
+        void VKUniformBuffer::Init(uint32_t size, const void* data, VkBufferUsageFlags usage)
+        {
+            VKBuffer::Init(usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, size, data);
+        }
+
         void VKUniformBuffer::SetData(uint32_t size, const void* data)
         {
             VKBuffer::Map();
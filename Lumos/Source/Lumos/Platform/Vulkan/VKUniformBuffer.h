@@ -15,6 +15,7 @@ namespace Lumos
             ~VKUniformBuffer();
 
             void Init(uint32_t size, const void* data) override;
+            void Init(uint32_t size, const void* data, VkBufferUsageFlags usage);
 
             void SetData(uint32_t size, const void* data) override;
             void SetData(const void* data) override { SetData((uint32_t)m_Size, data); }
@@ -587,6 +587,8 @@ namespace Lumos
                 return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
             case DescriptorType::IMAGE_STORAGE:
                 return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            case DescriptorType::STORAGE_BUFFER:
+                return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             }
 
             LINFO("Unsupported Descriptor Type");
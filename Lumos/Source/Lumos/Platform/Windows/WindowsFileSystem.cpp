@@ -58,15 +58,16 @@ namespace Lumos
     bool FileSystem::ReadFile(const std::string& path, void* buffer, int64_t size)
     {
         std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        if(!stream)
+            return false;
 
         auto end = stream.tellg();
         stream.seekg(0, std::ios::beg);
-        size   = end - stream.tellg();
-        buffer = new char[size];
+        if(size < 0)
+            size = end - stream.tellg();
         stream.read((char*)buffer, size);
-        stream.close();
 
-        return buffer;
+        return stream.gcount() == size;
     }
 
     uint8_t* FileSystem::ReadFile(const std::string& path)
@@ -132,8 +132,7 @@ namespace Lumos
             return false;
         if(size < 0)
             size = GetFileSize(path);
-        buffer = new uint8_t[size + 1];
-        FILE* file = fopen(path.c_str(), "r");
+        FILE* file = fopen(path.c_str(), "rb");
         bool result = false;
         if(file)
         {
@@ -30,6 +30,7 @@ namespace Lumos
         auto paused            = m_SoundNode->GetPaused();
         auto pitch             = m_SoundNode->GetPitch();
         auto referenceDistance = m_SoundNode->GetReferenceDistance();
+        auto priority          = m_SoundNode->GetPriority();
 
         ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(2, 2));
         ImGui::Columns(2);
@@ -75,6 +76,24 @@ namespace Lumos
         ImGui::PopItemWidth();
         ImGui::NextColumn();
 
+        ImGui::AlignTextToFramePadding();
+        ImGui::TextUnformatted("Priority");
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+        if(ImGui::DragInt("##Priority", &priority, 1.0f, 0, 255))
+            m_SoundNode->SetPriority(priority);
+
+        ImGui::PopItemWidth();
+        ImGui::NextColumn();
+
+        ImGui::AlignTextToFramePadding();
+        ImGui::TextUnformatted("Virtual");
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+        ImGui::TextUnformatted(m_SoundNode->IsVirtual() ? "Yes" : "No");
+        ImGui::PopItemWidth();
+        ImGui::NextColumn();
+
         ImGui::AlignTextToFramePadding();
         ImGui::TextUnformatted("Paused");
         ImGui::NextColumn();
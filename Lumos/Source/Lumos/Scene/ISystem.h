@@ -1,10 +1,51 @@
 #pragma once
+#include "Core/DataStructures/TDArray.h"
+#include <entt/entity/fwd.hpp>
+#include <typeinfo>
 
 namespace Lumos
 {
     class TimeStep;
     class Scene;
 
+    // Components and shared resources a system touches in OnUpdate, keyed by typeid hash.
+    // SystemManager runs systems whose access doesn't conflict at the same time.
+    // A system that declares nothing is exclusive and runs on its own.
+    struct SystemAccess
+    {
+        typedef void (*StorageFunc)(entt::registry& registry);
+
+        TDArray<size_t> Reads;
+        TDArray<size_t> Writes;
+
+        // Creates the component pools up front, entt adds missing pools to the registry on first view
+        TDArray<StorageFunc> Storages;
+        bool Exclusive = true;
+
+        bool ConflictsWith(const SystemAccess& other) const
+        {
+            if(Exclusive || other.Exclusive)
+                return true;
+
+            for(size_t write : Writes)
+            {
+                for(size_t otherWrite : other.Writes)
+                    if(write == otherWrite)
+                        return true;
+                for(size_t otherRead : other.Reads)
+                    if(write == otherRead)
+                        return true;
+            }
+
+            for(size_t read : Reads)
+                for(size_t otherWrite : other.Writes)
+                    if(read == otherWrite)
+                        return true;
+
+            return false;
+        }
+    };
+
     class LUMOS_EXPORT ISystem
     {
     public:
@@ -21,7 +62,48 @@ namespace Lumos
             return m_DebugName;
         }
 
+        const SystemAccess& GetAccess() const { return m_Access; }
+
     protected:
+        template <typename T, typename Registry>
+        static void AssureStorage(Registry& registry)
+        {
+            registry.template storage<T>();
+        }
+
+        // Component access
+        template <typename... T>
+        void Reads()
+        {
+            (m_Access.Reads.PushBack(typeid(T).hash_code()), ...);
+            (m_Access.Storages.PushBack(&AssureStorage<T, entt::registry>), ...);
+            m_Access.Exclusive = false;
+        }
+
+        template <typename... T>
+        void Writes()
+        {
+            (m_Access.Writes.PushBack(typeid(T).hash_code()), ...);
+            (m_Access.Storages.PushBack(&AssureStorage<T, entt::registry>), ...);
+            m_Access.Exclusive = false;
+        }
+
+        // Shared state outside the registry, e.g. the lua state
+        template <typename... T>
+        void ReadsResource()
+        {
+            (m_Access.Reads.PushBack(typeid(T).hash_code()), ...);
+            m_Access.Exclusive = false;
+        }
+
+        template <typename... T>
+        void WritesResource()
+        {
+            (m_Access.Writes.PushBack(typeid(T).hash_code()), ...);
+            m_Access.Exclusive = false;
+        }
+
         const char* m_DebugName;
+        SystemAccess m_Access;
     };
 }
@@ -15,6 +15,8 @@
 #include "Physics/LumosPhysicsEngine/CollisionShapes/PyramidCollisionShape.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/HullCollisionShape.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/CapsuleCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/HeightFieldCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/MeshCollisionShape.h"
 
 #include "Events/Event.h"
 #include "Events/ApplicationEvent.h"
@@ -34,7 +36,9 @@
 #include "Scene/Component/SoundComponent.h"
 #include "Scene/Component/ModelComponent.h"
 #include "SceneGraph.h"
+#include "SceneBVH.h"
 #include "Serialisation/SerialisationImplementation.h"
+#include "Serialisation/SceneBinarySerialiser.h"
 
 #include "Scene/Component/SoundComponent.h"
 #include "Scene/Component/TextureMatrixComponent.h"
@@ -56,12 +60,16 @@ CEREAL_REGISTER_TYPE(Lumos::CuboidCollisionShape);
 CEREAL_REGISTER_TYPE(Lumos::PyramidCollisionShape);
 CEREAL_REGISTER_TYPE(Lumos::HullCollisionShape);
 CEREAL_REGISTER_TYPE(Lumos::CapsuleCollisionShape);
+CEREAL_REGISTER_TYPE(Lumos::HeightFieldCollisionShape);
+CEREAL_REGISTER_TYPE(Lumos::MeshCollisionShape);
 
 CEREAL_REGISTER_POLYMORPHIC_RELATION(Lumos::CollisionShape, Lumos::SphereCollisionShape);
 CEREAL_REGISTER_POLYMORPHIC_RELATION(Lumos::CollisionShape, Lumos::CuboidCollisionShape);
 CEREAL_REGISTER_POLYMORPHIC_RELATION(Lumos::CollisionShape, Lumos::PyramidCollisionShape);
 CEREAL_REGISTER_POLYMORPHIC_RELATION(Lumos::CollisionShape, Lumos::HullCollisionShape);
 CEREAL_REGISTER_POLYMORPHIC_RELATION(Lumos::CollisionShape, Lumos::CapsuleCollisionShape);
+CEREAL_REGISTER_POLYMORPHIC_RELATION(Lumos::CollisionShape, Lumos::HeightFieldCollisionShape);
+CEREAL_REGISTER_POLYMORPHIC_RELATION(Lumos::CollisionShape, Lumos::MeshCollisionShape);
 
 #define MIN_SCENE_VERSION 24
 
@@ -237,6 +245,8 @@ namespace Lumos
 
         m_SceneGraph = CreateUniquePtr<SceneGraph>();
         m_SceneGraph->Init(m_EntityManager->GetRegistry());
+
+        m_SceneBVH = CreateUniquePtr<SceneBVH>(m_EntityManager->GetRegistry());
     }
 
     Scene::~Scene()
@@ -269,6 +279,7 @@ namespace Lumos
     {
         LUMOS_PROFILE_FUNCTION();
         m_EntityManager->Clear();
+        m_SceneBVH->Clear();
         LuaManager::Get().CollectGarbage();
     };
 
@@ -298,6 +309,7 @@ namespace Lumos
         }
 
         m_SceneGraph->Update(m_EntityManager->GetRegistry());
+        m_SceneBVH->Update();
 
         auto animatedSpriteView = m_EntityManager->GetEntitiesWithType<Graphics::AnimatedSprite>();
 
@@ -386,15 +398,8 @@ namespace Lumos
         {
             path += std::string(".bin");
 
-            std::ofstream file(path, std::ios::binary);
-
-            {
-                // output finishes flushing its contents when it goes out of scope
-                cereal::BinaryOutputArchive output { file };
-                output(*this);
-                entt::snapshot { m_EntityManager->GetRegistry() }.get<entt::entity>(output).ALL_COMPONENTSENTTV10(output);
-            }
-            file.close();
+            if(!SerialiseSceneBinary(path, *this))
+                LERROR("Failed to save scene - %s", path.c_str());
         }
         else
         {
@@ -429,89 +434,98 @@ namespace Lumos
                 return;
             }
 
-            try
+            if(IsSceneBinaryFile(path))
             {
-                std::ifstream file(path, std::ios::binary);
-                cereal::BinaryInputArchive input(file);
-                input(*this);
-                if(m_SceneSerialisationVersion == 0)
-                    LERROR("Invalid Scene Version");
-                else if(m_SceneSerialisationVersion < MIN_SCENE_VERSION)
-                    LERROR("Invalid Scene Version - Version too low %d. Minimum version supported %d", m_SceneSerialisationVersion, MIN_SCENE_VERSION);
+                if(!DeserialiseSceneBinary(path, *this))
+                    LERROR("Failed to load scene - %s", path.c_str());
+            }
+            else
+            {
+                try
+                {
+                    // Binary scenes saved before the sectioned format
+                    std::ifstream file(path, std::ios::binary);
+                    cereal::BinaryInputArchive input(file);
+                    input(*this);
+                    if(m_SceneSerialisationVersion == 0)
+                        LERROR("Invalid Scene Version");
+                    else if(m_SceneSerialisationVersion < MIN_SCENE_VERSION)
+                        LERROR("Invalid Scene Version - Version too low %d. Minimum version supported %d", m_SceneSerialisationVersion, MIN_SCENE_VERSION);
 #if MIN_SCENE_VERSION <= 2
-                else if(m_SceneSerialisationVersion < 2)
-                    entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV1>(input).orphans();
+                    else if(m_SceneSerialisationVersion < 2)
+                        entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV1>(input).orphans();
 #endif
 #if MIN_SCENE_VERSION <= 3
-                else if(m_SceneSerialisationVersion == 3)
-                    entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV2>(input).orphans();
+                    else if(m_SceneSerialisationVersion == 3)
+                        entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV2>(input).orphans();
 #endif
 #if MIN_SCENE_VERSION <= 4
-                else if(m_SceneSerialisationVersion == 4)
-                    entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV3>(input).orphans();
+                    else if(m_SceneSerialisationVersion == 4)
+                        entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV3>(input).orphans();
 #endif
 #if MIN_SCENE_VERSION <= 5
-                else if(m_SceneSerialisationVersion == 5)
-                    entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV4>(input);
+                    else if(m_SceneSerialisationVersion == 5)
+                        entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV4>(input);
 #endif
 #if MIN_SCENE_VERSION <= 6
-                else if(m_SceneSerialisationVersion == 6)
-                    entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV5>(input);
+                    else if(m_SceneSerialisationVersion == 6)
+                        entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV5>(input);
 #endif
 #if MIN_SCENE_VERSION <= 7
-                else if(m_SceneSerialisationVersion == 7)
-                    entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV6>(input);
+                    else if(m_SceneSerialisationVersion == 7)
+                        entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV6>(input);
 #endif
 #if MIN_SCENE_VERSION <= 13
-                else if(m_SceneSerialisationVersion >= 8 && m_SceneSerialisationVersion < 14)
-                    entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV7>(input);
+                    else if(m_SceneSerialisationVersion >= 8 && m_SceneSerialisationVersion < 14)
+                        entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSV7>(input);
 #endif
 #if MIN_SCENE_VERSION <= 20
-                else if(m_SceneSerialisationVersion >= 14 && m_SceneSerialisationVersion < 21)
-                    entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSLISTV8>(input);
+                    else if(m_SceneSerialisationVersion >= 14 && m_SceneSerialisationVersion < 21)
+                        entt::basic_snapshot_loader_legacy { m_EntityManager->GetRegistry() }.entities(input).component<ALL_COMPONENTSLISTV8>(input);
 #endif
 #if MIN_SCENE_VERSION <= 21
-                else if(m_SceneSerialisationVersion >= 21 && m_SceneSerialisationVersion < 22)
-                    entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).ALL_COMPONENTSENTTV8(input);
+                    else if(m_SceneSerialisationVersion >= 21 && m_SceneSerialisationVersion < 22)
+                        entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).ALL_COMPONENTSENTTV8(input);
 #endif
 #if MIN_SCENE_VERSION <= 25
-                else if(m_SceneSerialisationVersion >= 22 && m_SceneSerialisationVersion < 25)
-                    entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).ALL_COMPONENTSENTTV9(input);
+                    else if(m_SceneSerialisationVersion >= 22 && m_SceneSerialisationVersion < 25)
+                        entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).ALL_COMPONENTSENTTV9(input);
 #endif
-                else if(m_SceneSerialisationVersion >= 25)
-                    entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).ALL_COMPONENTSENTTV10(input);
+                    else if(m_SceneSerialisationVersion >= 25)
+                        entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).ALL_COMPONENTSENTTV10(input);
 
 #if MIN_SCENE_VERSION <= 6
-                if(m_SceneSerialisationVersion < 6)
-                {
-                    // m_EntityManager->GetRegistry().each([&](auto entity)
-                    for(auto [entity] : m_EntityManager->GetRegistry().storage<entt::entity>().each())
+                    if(m_SceneSerialisationVersion < 6)
                     {
-                        m_EntityManager->GetRegistry().emplace<IDComponent>(entity, Random64::Rand(0, std::numeric_limits<uint64_t>::max()));
+                        // m_EntityManager->GetRegistry().each([&](auto entity)
+                        for(auto [entity] : m_EntityManager->GetRegistry().storage<entt::entity>().each())
+                        {
+                            m_EntityManager->GetRegistry().emplace<IDComponent>(entity, Random64::Rand(0, std::numeric_limits<uint64_t>::max()));
+                        }
                     }
-                }
 #endif
 
 #if MIN_SCENE_VERSION <= 7
-                if(m_SceneSerialisationVersion < 7)
-                {
-                    // m_EntityManager->GetRegistry().each([&](auto entity)
-                    for(auto [entity] : m_EntityManager->GetRegistry().storage<entt::entity>().each())
+                    if(m_SceneSerialisationVersion < 7)
                     {
-                        Graphics::Model* model;
-                        if(model = m_EntityManager->GetRegistry().try_get<Graphics::Model>(entity))
+                        // m_EntityManager->GetRegistry().each([&](auto entity)
+                        for(auto [entity] : m_EntityManager->GetRegistry().storage<entt::entity>().each())
                         {
-                            Graphics::Model* modelCopy = new Graphics::Model(*model);
-                            m_EntityManager->GetRegistry().emplace<Graphics::ModelComponent>(entity, SharedPtr<Graphics::Model>(modelCopy));
-                            m_EntityManager->GetRegistry().remove<Graphics::Model>(entity);
+                            Graphics::Model* model;
+                            if(model = m_EntityManager->GetRegistry().try_get<Graphics::Model>(entity))
+                            {
+                                Graphics::Model* modelCopy = new Graphics::Model(*model);
+                                m_EntityManager->GetRegistry().emplace<Graphics::ModelComponent>(entity, SharedPtr<Graphics::Model>(modelCopy));
+                                m_EntityManager->GetRegistry().remove<Graphics::Model>(entity);
+                            }
                         }
                     }
-                }
 #endif
-            }
-            catch(...)
-            {
-                LERROR("Failed to load scene - %s", path.c_str());
+                }
+                catch(...)
+                {
+                    LERROR("Failed to load scene - %s", path.c_str());
+                }
             }
         }
         else
@@ -618,6 +632,7 @@ namespace Lumos
     {
         LUMOS_PROFILE_FUNCTION();
         m_SceneGraph->Update(m_EntityManager->GetRegistry());
+        m_SceneBVH->Update();
     }
 
     template <typename T>
@@ -13,6 +13,7 @@ namespace Lumos
     class EntityManager;
     class Entity;
     class SceneGraph;
+    class SceneBVH;
     class Event;
     class WindowResizeEvent;
 
@@ -104,6 +105,7 @@ namespace Lumos
         void SavePrefab(Entity entity, const std::string& path);
 
         EntityManager* GetEntityManager() { return m_EntityManager.get(); }
+        SceneBVH* GetSceneBVH() { return m_SceneBVH.get(); }
 
         virtual void Serialise(const std::string& filePath, bool binary = false);
         virtual void Deserialise(const std::string& filePath, bool binary = false);
@@ -215,6 +217,7 @@ namespace Lumos
 
         UniquePtr<EntityManager> m_EntityManager;
         UniquePtr<SceneGraph> m_SceneGraph;
+        UniquePtr<SceneBVH> m_SceneBVH;
 
         uint32_t m_ScreenWidth;
         uint32_t m_ScreenHeight;
@@ -228,5 +231,6 @@ namespace Lumos
         bool OnWindowResize(WindowResizeEvent& e);
 
         friend class Entity;
+        friend class SceneSnapshot;
     };
 }
@@ -0,0 +1,270 @@
+#include "Precompiled.h"
+#include "SceneBVH.h"
+#include "Scene/Component/ModelComponent.h"
+#include "Graphics/Model.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Sprite.h"
+#include "Graphics/AnimatedSprite.h"
+#include "Maths/Transform.h"
+#include "Maths/TriangleBVH.h"
+#include "Maths/Rect.h"
+#include "Maths/Ray.h"
+#include "Maths/Vector4.h"
+
+#include <entt/entity/registry.hpp>
+#include <algorithm>
+
+namespace Lumos
+{
+    static bool SphereIntersectsBox(const Vec3& centre, float radius, const Maths::BoundingBox& box)
+    {
+        float distanceSquared = 0.0f;
+        for(int axis = 0; axis < 3; axis++)
+        {
+            float value = centre[axis];
+            if(value < box.m_Min[axis])
+                distanceSquared += (box.m_Min[axis] - value) * (box.m_Min[axis] - value);
+            else if(value > box.m_Max[axis])
+                distanceSquared += (value - box.m_Max[axis]) * (value - box.m_Max[axis]);
+        }
+
+        return distanceSquared <= radius * radius;
+    }
+
+    static Vec3 InverseDirection(const Vec3& direction)
+    {
+        return Vec3(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+    }
+
+    SceneBVH::SceneBVH(entt::registry& registry)
+        : m_Registry(registry)
+    {
+    }
+
+    void SceneBVH::Update()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_UpdateStamp++;
+        m_LastUpdateMoves = 0;
+
+        auto modelView = m_Registry.view<Graphics::ModelComponent, Maths::Transform>();
+        for(auto entity : modelView)
+        {
+            const auto& [model, transform] = modelView.get<Graphics::ModelComponent, Maths::Transform>(entity);
+            if(!model.ModelRef || model.ModelRef->GetMeshes().Empty())
+                continue;
+
+            // The merged mesh bounds are only recalculated when the model is swapped
+            const uint32_t* index = m_EntityIndices.Find((uint32_t)entity);
+            if(index && m_Entities[*index].Model == model.ModelRef.get())
+            {
+                UpdateEntity(entity, transform.GetWorldMatrix(), model.ModelRef.get(), m_Entities[*index].LocalBounds);
+                continue;
+            }
+
+            Maths::BoundingBox localBounds;
+            for(auto& mesh : model.ModelRef->GetMeshes())
+                localBounds.Merge(mesh->GetBoundingBox());
+
+            UpdateEntity(entity, transform.GetWorldMatrix(), model.ModelRef.get(), localBounds);
+        }
+
+        auto spriteView = m_Registry.view<Graphics::Sprite, Maths::Transform>();
+        for(auto entity : spriteView)
+        {
+            const auto& [sprite, transform] = spriteView.get<Graphics::Sprite, Maths::Transform>(entity);
+            UpdateEntity(entity, transform.GetWorldMatrix(), nullptr, Maths::BoundingBox(Maths::Rect(sprite.GetPosition(), sprite.GetPosition() + sprite.GetScale())));
+        }
+
+        auto animatedSpriteView = m_Registry.view<Graphics::AnimatedSprite, Maths::Transform>();
+        for(auto entity : animatedSpriteView)
+        {
+            const auto& [sprite, transform] = animatedSpriteView.get<Graphics::AnimatedSprite, Maths::Transform>(entity);
+            UpdateEntity(entity, transform.GetWorldMatrix(), nullptr, Maths::BoundingBox(Maths::Rect(sprite.GetPosition(), sprite.GetPosition() + sprite.GetScale())));
+        }
+
+        // Anything not seen this update was destroyed or lost its components. Backwards so the swap
+        // in RemoveEntity only moves entities that have already been checked
+        for(uint32_t i = (uint32_t)m_Entities.Size(); i-- > 0;)
+        {
+            if(m_Entities[i].LastSeen != m_UpdateStamp)
+                RemoveEntity(i);
+        }
+    }
+
+    void SceneBVH::UpdateEntity(entt::entity entity, const Mat4& worldMatrix, const Graphics::Model* model, const Maths::BoundingBox& localBounds)
+    {
+        const uint32_t* found = m_EntityIndices.Find((uint32_t)entity);
+        if(!found)
+        {
+            uint32_t index         = (uint32_t)m_Entities.Size();
+            TrackedEntity& tracked = m_Entities.EmplaceBack();
+            tracked.Entity         = entity;
+            tracked.LastSeen       = m_UpdateStamp;
+            tracked.Model          = model;
+            tracked.WorldMatrix    = worldMatrix;
+            tracked.LocalBounds    = localBounds;
+            tracked.WorldBounds    = localBounds.Transformed(worldMatrix);
+            tracked.Proxy          = m_Tree.CreateProxy(tracked.WorldBounds, index);
+
+            m_EntityIndices.Insert((uint32_t)entity, index);
+            m_LastUpdateMoves++;
+            return;
+        }
+
+        TrackedEntity& tracked = m_Entities[*found];
+
+        // An entity with both a model and a sprite is tracked by its model
+        if(tracked.LastSeen == m_UpdateStamp)
+            return;
+
+        tracked.LastSeen = m_UpdateStamp;
+
+        bool boundsChanged = tracked.Model != model || !(tracked.LocalBounds.m_Min == localBounds.m_Min) || !(tracked.LocalBounds.m_Max == localBounds.m_Max);
+        if(!boundsChanged && tracked.WorldMatrix == worldMatrix)
+            return;
+
+        tracked.Model       = model;
+        tracked.WorldMatrix = worldMatrix;
+        tracked.LocalBounds = localBounds;
+        tracked.WorldBounds = localBounds.Transformed(worldMatrix);
+        m_Tree.MoveProxy(tracked.Proxy, tracked.WorldBounds);
+        m_LastUpdateMoves++;
+    }
+
+    void SceneBVH::RemoveEntity(uint32_t index)
+    {
+        m_Tree.DestroyProxy(m_Entities[index].Proxy);
+        m_EntityIndices.Remove((uint32_t)m_Entities[index].Entity);
+
+        uint32_t last = (uint32_t)m_Entities.Size() - 1;
+        if(index != last)
+        {
+            m_Entities[index]                                   = m_Entities[last];
+            m_EntityIndices[(uint32_t)m_Entities[index].Entity] = index;
+            m_Tree.SetUserData(m_Entities[index].Proxy, index);
+        }
+
+        m_Entities.PopBack();
+    }
+
+    void SceneBVH::Clear()
+    {
+        m_Tree.Clear();
+        m_Entities.Clear();
+        m_EntityIndices.Clear();
+    }
+
+    bool SceneBVH::RaycastEntity(const TrackedEntity& tracked, const Maths::Ray& ray, float maxDistance, bool exact, float& outDistance) const
+    {
+        float boundsDistance;
+        if(!Maths::DynamicAABBTree::RayIntersectsBox(ray.Origin, InverseDirection(ray.Direction), tracked.WorldBounds, maxDistance, boundsDistance))
+            return false;
+
+        const Graphics::ModelComponent* model = tracked.Model ? m_Registry.try_get<Graphics::ModelComponent>(tracked.Entity) : nullptr;
+        if(!exact || !model || !model->ModelRef)
+        {
+            outDistance = boundsDistance;
+            return true;
+        }
+
+        // The direction isn't renormalised, so distances along the local ray match the world ray
+        Mat4 inverse = Mat4::Inverse(tracked.WorldMatrix);
+        Maths::Ray localRay(Vec3(inverse * Vec4(ray.Origin, 1.0f)), Vec3(inverse * Vec4(ray.Direction, 0.0f)));
+        Vec3 inverseDirection = InverseDirection(localRay.Direction);
+
+        bool hit      = false;
+        float closest = maxDistance;
+        for(auto& mesh : model->ModelRef->GetMeshes())
+        {
+            float distance;
+            const SharedPtr<Maths::TriangleBVH>& triangleBVH = mesh->GetTriangleBVH();
+            if(triangleBVH)
+            {
+                if(!triangleBVH->Raycast(localRay, closest, distance))
+                    continue;
+            }
+            else if(!Maths::DynamicAABBTree::RayIntersectsBox(localRay.Origin, inverseDirection, mesh->GetBoundingBox(), closest, distance))
+                continue;
+
+            closest = distance;
+            hit     = true;
+        }
+
+        outDistance = closest;
+        return hit;
+    }
+
+    bool SceneBVH::Raycast(const Maths::Ray& ray, float maxDistance, SceneRayHit& outHit, bool exact) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        bool hit = false;
+
+        m_Tree.QueryRay(ray, maxDistance, [&](uint32_t index, float closest)
+                        {
+                            float distance;
+                            if(!RaycastEntity(m_Entities[index], ray, closest, exact, distance))
+                                return closest;
+
+                            hit             = true;
+                            outHit.Entity   = m_Entities[index].Entity;
+                            outHit.Distance = distance;
+                            return distance; });
+
+        if(hit)
+            outHit.Point = ray.Origin + ray.Direction * outHit.Distance;
+        return hit;
+    }
+
+    void SceneBVH::RaycastAll(const Maths::Ray& ray, float maxDistance, TDArray<SceneRayHit>& outHits, bool exact) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        outHits.Clear();
+
+        m_Tree.QueryRay(ray, maxDistance, [&](uint32_t index, float closest)
+                        {
+                            float distance;
+                            if(RaycastEntity(m_Entities[index], ray, closest, exact, distance))
+                            {
+                                SceneRayHit& hit = outHits.EmplaceBack();
+                                hit.Entity       = m_Entities[index].Entity;
+                                hit.Distance     = distance;
+                                hit.Point        = ray.Origin + ray.Direction * distance;
+                            }
+                            return closest; });
+
+        std::sort(outHits.Data(), outHits.Data() + outHits.Size(), [](const SceneRayHit& a, const SceneRayHit& b)
+                  { return a.Distance < b.Distance; });
+    }
+
+    void SceneBVH::QuerySphere(const Vec3& centre, float radius, TDArray<entt::entity>& outEntities) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        outEntities.Clear();
+
+        m_Tree.QuerySphere(centre, radius, [&](uint32_t index)
+                           {
+                               // The tree holds fattened boxes, so check the exact bounds as well
+                               if(SphereIntersectsBox(centre, radius, m_Entities[index].WorldBounds))
+                                   outEntities.PushBack(m_Entities[index].Entity);
+                               return true; });
+    }
+
+    void SceneBVH::QueryBox(const Maths::BoundingBox& box, TDArray<entt::entity>& outEntities) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        outEntities.Clear();
+
+        m_Tree.QueryBox(box, [&](uint32_t index)
+                        {
+                            if(m_Entities[index].WorldBounds.IsInsideFast(box))
+                                outEntities.PushBack(m_Entities[index].Entity);
+                            return true; });
+    }
+
+    const Maths::BoundingBox* SceneBVH::GetBounds(entt::entity entity) const
+    {
+        const uint32_t* index = m_EntityIndices.Find((uint32_t)entity);
+        return index ? &m_Entities[*index].WorldBounds : nullptr;
+    }
+}
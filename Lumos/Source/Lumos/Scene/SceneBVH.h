@@ -0,0 +1,77 @@
+#pragma once
+#include "Maths/DynamicAABBTree.h"
+#include "Maths/Matrix4.h"
+#include "Core/DataStructures/Map.h"
+#include <entt/entity/fwd.hpp>
+#include <entt/entity/entity.hpp>
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        class Model;
+    }
+
+    struct SceneRayHit
+    {
+        entt::entity Entity = entt::null;
+        float Distance      = 0.0f;
+        Vec3 Point;
+    };
+
+    // Spatial index over the render bounds of every model and sprite in a scene, used for editor picking,
+    // line of sight checks and overlap queries from gameplay code and Lua.
+    // Update compares each entity's world matrix with the one it was last inserted with, so only entities that
+    // moved are refitted, and a small move that stays inside the tree's fattened box doesn't touch the tree.
+    class LUMOS_EXPORT SceneBVH
+    {
+    public:
+        explicit SceneBVH(entt::registry& registry);
+        ~SceneBVH() = default;
+
+        // Call after the scene graph update so world matrices are current
+        void Update();
+        void Clear();
+
+        // Closest hit along the ray. With exact set, models are tested against their mesh triangle BVHs where they
+        // have one and against their mesh bounds otherwise. Distances are in units of ray.Direction
+        bool Raycast(const Maths::Ray& ray, float maxDistance, SceneRayHit& outHit, bool exact = true) const;
+
+        // Every hit along the ray, closest first
+        void RaycastAll(const Maths::Ray& ray, float maxDistance, TDArray<SceneRayHit>& outHits, bool exact = true) const;
+
+        // Entities whose world bounds overlap the sphere or box
+        void QuerySphere(const Vec3& centre, float radius, TDArray<entt::entity>& outEntities) const;
+        void QueryBox(const Maths::BoundingBox& box, TDArray<entt::entity>& outEntities) const;
+
+        // World bounds the entity was last updated with, nullptr if it isn't tracked
+        const Maths::BoundingBox* GetBounds(entt::entity entity) const;
+
+        uint32_t GetEntityCount() const { return (uint32_t)m_Entities.Size(); }
+        uint32_t GetLastUpdateMoves() const { return m_LastUpdateMoves; }
+        const Maths::DynamicAABBTree& GetTree() const { return m_Tree; }
+
+    private:
+        struct TrackedEntity
+        {
+            entt::entity Entity;
+            int32_t Proxy;
+            uint32_t LastSeen;
+            const Graphics::Model* Model; // Only compared to notice a model being swapped, never dereferenced
+            Mat4 WorldMatrix;
+            Maths::BoundingBox LocalBounds;
+            Maths::BoundingBox WorldBounds;
+        };
+
+        void UpdateEntity(entt::entity entity, const Mat4& worldMatrix, const Graphics::Model* model, const Maths::BoundingBox& localBounds);
+        void RemoveEntity(uint32_t index);
+        bool RaycastEntity(const TrackedEntity& tracked, const Maths::Ray& ray, float maxDistance, bool exact, float& outDistance) const;
+
+        entt::registry& m_Registry;
+        Maths::DynamicAABBTree m_Tree;
+        TDArray<TrackedEntity> m_Entities;
+        FlatHashMap<uint32_t, uint32_t> m_EntityIndices; // Entity to index in m_Entities, which is the proxy user data
+        uint32_t m_UpdateStamp     = 0;
+        uint32_t m_LastUpdateMoves = 0;
+    };
+}
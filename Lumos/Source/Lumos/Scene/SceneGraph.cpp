@@ -25,6 +25,12 @@ namespace Lumos
         m_Prev   = entt::null;
     }
 
+    static void BumpHierarchyVersion(entt::registry& registry, entt::entity entity)
+    {
+        if(auto* version = registry.ctx().find<HierarchyVersion>())
+            version->Value++;
+    }
+
     SceneGraph::SceneGraph()
     {
     }
@@ -34,6 +40,18 @@ namespace Lumos
         registry.on_construct<Hierarchy>().connect<&Hierarchy::OnConstruct>();
         registry.on_update<Hierarchy>().connect<&Hierarchy::OnUpdate>();
         registry.on_destroy<Hierarchy>().connect<&Hierarchy::OnDestroy>();
+
+        registry.ctx().emplace<HierarchyVersion>();
+        registry.on_construct<entt::entity>().connect<&BumpHierarchyVersion>();
+        registry.on_destroy<entt::entity>().connect<&BumpHierarchyVersion>();
+        registry.on_construct<Hierarchy>().connect<&BumpHierarchyVersion>();
+        registry.on_destroy<Hierarchy>().connect<&BumpHierarchyVersion>();
+    }
+
+    u64 SceneGraph::GetHierarchyVersion(const entt::registry& registry)
+    {
+        const auto* version = registry.ctx().find<HierarchyVersion>();
+        return version ? version->Value : 0;
     }
 
     void SceneGraph::Update(entt::registry& registry)
@@ -110,6 +128,9 @@ namespace Lumos
             hierarchy.m_Parent = parent;
             Hierarchy::OnConstruct(registry, entity);
         }
+
+        // Relinks the existing component in place, so no construct or destroy signal fires
+        BumpHierarchyVersion(registry, entity);
     }
 
     bool Hierarchy::Compare(const entt::registry& registry, const entt::entity rhs) const
@@ -211,6 +211,13 @@ namespace Lumos
         }
     };
 
+    // Counts entity creation and destruction and every Hierarchy added, removed or reparented in a registry.
+    // Kept in the registry context by SceneGraph::Init so tools that cache the tree can tell when to rebuild it
+    struct HierarchyVersion
+    {
+        u64 Value = 0;
+    };
+
     class SceneGraph
     {
     public:
@@ -219,6 +226,9 @@ namespace Lumos
 
         void Init(entt::registry& registry);
 
+        // Zero for a registry that wasn't initialised by a SceneGraph
+        static u64 GetHierarchyVersion(const entt::registry& registry);
+
         void DisableOnConstruct(bool disable, entt::registry& registry);
 
         void Update(entt::registry& registry);
@@ -0,0 +1,403 @@
+#include "Precompiled.h"
+#include "SceneSnapshot.h"
+#include "Scene.h"
+#include "SceneGraph.h"
+#include "Serialisation/SerialisationImplementation.h"
+#include "Scene/Component/Components.h"
+#include "Scene/Component/SoundComponent.h"
+#include "Scene/Component/ModelComponent.h"
+#include "Scene/Component/RigidBody2DComponent.h"
+#include "Scene/Component/RigidBody3DComponent.h"
+#include "Scripting/Lua/LuaScriptComponent.h"
+#include "Graphics/Light.h"
+#include "Graphics/Model.h"
+#include "Graphics/Environment.h"
+#include "Graphics/ParticleManager.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/SphereCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/CuboidCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/PyramidCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/HullCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/CapsuleCollisionShape.h"
+
+#include <cereal/types/polymorphic.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/archives/binary.hpp>
+#include <entt/entity/registry.hpp>
+#include <sstream>
+#include <tuple>
+
+namespace Lumos
+{
+    namespace
+    {
+        enum class SnapshotMode : uint8_t
+        {
+            // Copy assigned back. Trivially copyable types are compared first and only written when changed
+            Copy,
+            // Body is kept alive, properties and dynamic state are written back through the setters
+            RigidBody,
+            // Not safely copyable (owns script state, sources or raw buffers). Round tripped through cereal
+            Archive
+        };
+
+        template <typename T>
+        struct SceneSnapshotTraits
+        {
+            static constexpr SnapshotMode Mode = SnapshotMode::Copy;
+        };
+
+#define SCENE_SNAPSHOT_MODE(Type, ModeValue)             \
+    template <>                                          \
+    struct SceneSnapshotTraits<Type>                     \
+    {                                                    \
+        static constexpr SnapshotMode Mode = ModeValue;  \
+    };
+
+        SCENE_SNAPSHOT_MODE(RigidBody3DComponent, SnapshotMode::RigidBody)
+        SCENE_SNAPSHOT_MODE(LuaScriptComponent, SnapshotMode::Archive)
+        SCENE_SNAPSHOT_MODE(RigidBody2DComponent, SnapshotMode::Archive)
+        SCENE_SNAPSHOT_MODE(SoundComponent, SnapshotMode::Archive)
+        SCENE_SNAPSHOT_MODE(ParticleEmitter, SnapshotMode::Archive)
+
+#undef SCENE_SNAPSHOT_MODE
+
+        // Transform first so dependency listeners (get_or_emplace<Transform>) find the restored value
+#define SCENE_SNAPSHOT_COMPONENTS Maths::Transform, NameComponent, ActiveComponent, Hierarchy, IDComponent, Camera, Graphics::Light, Listener, LuaScriptComponent, Graphics::Model, RigidBody3DComponent, Graphics::Environment, Graphics::Sprite, RigidBody2DComponent, DefaultCameraController, Graphics::AnimatedSprite, SoundComponent, Graphics::ModelComponent, AxisConstraintComponent, TextComponent, ParticleEmitter, SpringConstraintComponent
+
+        struct RigidBody3DState
+        {
+            RigidBody3DProperties Properties;
+            float InverseMass;
+            float AngularFactor;
+            uint16_t CollisionLayer;
+        };
+
+        template <typename T>
+        struct StorageSnapshot
+        {
+            using ComponentType = T;
+
+            entt::sparse_set Entities;
+            std::vector<T> Components;
+            TDArray<RigidBody3DState> Bodies;
+            std::string Archive;
+            bool Captured = false;
+        };
+
+        template <typename... Component>
+        using StorageSnapshotTuple = std::tuple<StorageSnapshot<Component>...>;
+
+        void CaptureRigidBody(const RigidBody3D* body, RigidBody3DState& state)
+        {
+            RigidBody3DProperties& properties = state.Properties;
+            properties.Position               = body->GetPosition();
+            properties.LinearVelocity         = body->GetLinearVelocity();
+            properties.Force                  = body->GetForce();
+            properties.Orientation            = body->GetOrientation();
+            properties.AngularVelocity        = body->GetAngularVelocity();
+            properties.Torque                 = body->GetTorque();
+            properties.Static                 = body->GetIsStatic();
+            properties.Elasticity             = body->GetElasticity();
+            properties.Friction               = body->GetFriction();
+            properties.AtRest                 = body->GetIsAtRest();
+            properties.isTrigger              = body->GetIsTrigger();
+            properties.Continuous             = body->GetIsContinuous();
+            properties.Shape                  = body->GetCollisionShape();
+            properties.Mass                   = body->GetInverseMass() > 0.0f ? 1.0f / body->GetInverseMass() : 0.0f;
+            state.InverseMass                 = body->GetInverseMass();
+            state.AngularFactor               = body->GetAngularFactor();
+            state.CollisionLayer              = body->GetCollisionLayer();
+        }
+
+        void RestoreRigidBody(RigidBody3D* body, const RigidBody3DState& state)
+        {
+            const RigidBody3DProperties& properties = state.Properties;
+
+            if(body->GetCollisionShape() != properties.Shape && properties.Shape)
+                body->SetCollisionShape(properties.Shape);
+
+            // Velocity/force setters are ignored on static bodies
+            body->SetIsStatic(false);
+            body->SetInverseMass(state.InverseMass);
+            body->SetPosition(properties.Position);
+            body->SetOrientation(properties.Orientation);
+            body->SetLinearVelocity(properties.LinearVelocity);
+            body->SetAngularVelocity(properties.AngularVelocity);
+            body->SetForce(properties.Force);
+            body->SetTorque(properties.Torque);
+            body->SetElasticity(properties.Elasticity);
+            body->SetFriction(properties.Friction);
+            body->SetIsTrigger(properties.isTrigger);
+            body->SetIsContinuous(properties.Continuous);
+            body->SetAngularFactor(state.AngularFactor);
+            body->SetCollisionLayer(state.CollisionLayer);
+            body->SetIsStatic(properties.Static);
+            body->SetIsAtRest(properties.AtRest);
+        }
+    }
+
+    struct SceneSnapshotData
+    {
+        entt::sparse_set Entities;
+        StorageSnapshotTuple<SCENE_SNAPSHOT_COMPONENTS> Storages;
+        TDArray<entt::entity> Scratch;
+    };
+
+    namespace
+    {
+        template <typename Snapshot>
+        void CaptureStorage(const entt::registry& registry, Snapshot& snapshot, uint8_t flags)
+        {
+            using T                     = typename Snapshot::ComponentType;
+            constexpr SnapshotMode Mode = SceneSnapshotTraits<T>::Mode;
+
+            snapshot.Entities.clear();
+            snapshot.Components.clear();
+            snapshot.Bodies.Clear();
+            snapshot.Archive.clear();
+            snapshot.Captured = !(Mode == SnapshotMode::Archive && (flags & SceneSnapshot_StateOnly));
+
+            const auto* storage = registry.storage<T>();
+            if(!snapshot.Captured || !storage)
+                return;
+
+            const size_t count = storage->size();
+            const auto* data   = storage->data();
+
+            if constexpr(Mode == SnapshotMode::Copy)
+                snapshot.Components.reserve(count);
+            else if constexpr(Mode == SnapshotMode::RigidBody)
+                snapshot.Bodies.Resize((uint32_t)count);
+
+            std::ostringstream stream(std::ios::binary);
+            cereal::BinaryOutputArchive output(stream);
+
+            for(size_t i = 0; i < count; i++)
+            {
+                const entt::entity entity = data[i];
+                snapshot.Entities.push(entity);
+
+                if constexpr(Mode == SnapshotMode::Copy)
+                    snapshot.Components.push_back(storage->get(entity));
+                else if constexpr(Mode == SnapshotMode::RigidBody)
+                    CaptureRigidBody(storage->get(entity).GetRigidBody(), snapshot.Bodies[(uint32_t)i]);
+                else
+                    output(storage->get(entity));
+            }
+
+            if constexpr(Mode == SnapshotMode::Archive)
+                snapshot.Archive = stream.str();
+        }
+
+        template <typename Snapshot>
+        void RestoreStorage(entt::registry& registry, Snapshot& snapshot, TDArray<entt::entity>& scratch)
+        {
+            using T                     = typename Snapshot::ComponentType;
+            constexpr SnapshotMode Mode = SceneSnapshotTraits<T>::Mode;
+
+            if(!snapshot.Captured)
+                return;
+
+            auto& storage                = registry.storage<T>();
+            const entt::sparse_set& pool = storage;
+
+            // Remove components added since the capture
+            scratch.Clear();
+            for(auto entity : pool)
+            {
+                if(!snapshot.Entities.contains(entity))
+                    scratch.PushBack(entity);
+            }
+
+            if(!scratch.Empty())
+                registry.remove<T>(scratch.Data(), scratch.Data() + scratch.Size());
+
+            std::istringstream stream(snapshot.Archive, std::ios::binary);
+            cereal::BinaryInputArchive input(stream);
+
+            const size_t count = snapshot.Entities.size();
+            const auto* data   = snapshot.Entities.data();
+
+            for(size_t i = 0; i < count; i++)
+            {
+                const entt::entity entity = data[i];
+
+                if constexpr(Mode == SnapshotMode::Copy)
+                {
+                    const T& captured = snapshot.Components[i];
+                    if(storage.contains(entity))
+                    {
+                        T& current = storage.get(entity);
+                        if constexpr(std::is_trivially_copyable_v<T>)
+                        {
+                            if(memcmp(&current, &captured, sizeof(T)) == 0)
+                                continue;
+                        }
+                        current = captured;
+                    }
+                    else
+                        registry.emplace<T>(entity, captured);
+                }
+                else if constexpr(Mode == SnapshotMode::RigidBody)
+                {
+                    const RigidBody3DState& state = snapshot.Bodies[(uint32_t)i];
+                    if(!storage.contains(entity))
+                        registry.emplace<T>(entity, state.Properties);
+                    RestoreRigidBody(storage.get(entity).GetRigidBody(), state);
+                }
+                else
+                {
+                    input(registry.emplace_or_replace<T>(entity));
+                }
+            }
+        }
+    }
+
+    SceneSnapshot::SceneSnapshot()
+        : m_Data(CreateUniquePtr<SceneSnapshotData>())
+    {
+    }
+
+    SceneSnapshot::~SceneSnapshot()
+    {
+    }
+
+    void SceneSnapshot::Capture(Scene* scene, uint8_t flags)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_Scene = scene;
+        m_Flags = flags;
+
+        // Archived components are encoded with the current layout
+        Serialisation::CurrentSceneVersion = SceneSerialisationVersion;
+
+        const entt::registry& registry = scene->GetRegistry();
+        const auto* entities           = registry.storage<entt::entity>();
+
+        m_Data->Entities.clear();
+        for(auto [entity] : entities->each())
+            m_Data->Entities.push(entity);
+
+        std::apply([&](auto&... storage)
+                   { (CaptureStorage(registry, storage, flags), ...); },
+                   m_Data->Storages);
+    }
+
+    void SceneSnapshot::Restore(Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(!IsValid(scene))
+        {
+            LWARN("Restoring scene snapshot to a different scene");
+            return;
+        }
+
+        Serialisation::CurrentSceneVersion = SceneSerialisationVersion;
+
+        entt::registry& registry        = scene->GetRegistry();
+        TDArray<entt::entity>& scratch  = m_Data->Scratch;
+        const entt::sparse_set& capture = m_Data->Entities;
+
+        // Hierarchy links are restored as data, don't let the construct listener rewire them
+        scene->m_SceneGraph->DisableOnConstruct(true, registry);
+
+        // Destroy entities created since the capture
+        scratch.Clear();
+        for(auto [entity] : registry.storage<entt::entity>().each())
+        {
+            if(!capture.contains(entity))
+                scratch.PushBack(entity);
+        }
+
+        for(auto entity : scratch)
+        {
+            if(registry.valid(entity))
+                registry.destroy(entity);
+        }
+
+        // Recreate entities destroyed since the capture with their original identifiers
+        for(auto entity : capture)
+        {
+            if(!registry.valid(entity))
+            {
+                entt::entity created = registry.create(entity);
+                if(created != entity)
+                    LWARN("Failed to recreate entity %u from scene snapshot", (uint32_t)entity);
+            }
+        }
+
+        std::apply([&](auto&... storage)
+                   { (RestoreStorage(registry, storage, scratch), ...); },
+                   m_Data->Storages);
+
+        scene->m_SceneGraph->DisableOnConstruct(false, registry);
+    }
+
+    void SceneSnapshot::Clear()
+    {
+        m_Data  = CreateUniquePtr<SceneSnapshotData>();
+        m_Scene = nullptr;
+    }
+
+    uint32_t SceneSnapshot::GetEntityCount() const
+    {
+        return m_Scene ? (uint32_t)m_Data->Entities.size() : 0;
+    }
+
+    SceneRollbackBuffer::~SceneRollbackBuffer()
+    {
+        Clear();
+    }
+
+    void SceneRollbackBuffer::Init(uint32_t frameCount, uint8_t flags)
+    {
+        Clear();
+        m_Flags = flags;
+
+        m_Snapshots.Reserve(frameCount);
+        for(uint32_t i = 0; i < frameCount; i++)
+            m_Snapshots.PushBack(new SceneSnapshot());
+    }
+
+    void SceneRollbackBuffer::Capture(Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const uint32_t capacity = GetCapacity();
+        if(capacity == 0)
+            return;
+
+        m_Snapshots[m_Head]->Capture(scene, m_Flags);
+        m_Head  = (m_Head + 1) % capacity;
+        m_Count = std::min(m_Count + 1, capacity);
+    }
+
+    bool SceneRollbackBuffer::Rollback(Scene* scene, uint32_t framesBack)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(framesBack >= m_Count)
+            return false;
+
+        const uint32_t capacity = GetCapacity();
+        const uint32_t index    = (m_Head + capacity - 1 - framesBack) % capacity;
+
+        SceneSnapshot* snapshot = m_Snapshots[index];
+        if(!snapshot->IsValid(scene))
+            return false;
+
+        snapshot->Restore(scene);
+
+        m_Head = (index + 1) % capacity;
+        m_Count -= framesBack;
+        return true;
+    }
+
+    void SceneRollbackBuffer::Clear()
+    {
+        for(auto snapshot : m_Snapshots)
+            delete snapshot;
+
+        m_Snapshots.Clear();
+        m_Head  = 0;
+        m_Count = 0;
+    }
+}
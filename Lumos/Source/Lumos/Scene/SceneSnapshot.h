@@ -0,0 +1,66 @@
+#pragma once
+#include "Core/DataStructures/TDArray.h"
+
+namespace Lumos
+{
+    class Scene;
+    struct SceneSnapshotData;
+
+    enum SceneSnapshotFlags : uint8_t
+    {
+        SceneSnapshot_Default = 0,
+        // Skip components that are restored by reloading them (scripts, audio, 2D bodies, particles).
+        // Used for per frame gameplay rollback where reinitialising scripts is not wanted.
+        SceneSnapshot_StateOnly = BIT(0)
+    };
+
+    // In memory copy of a scene's entities and component pools.
+    // Restoring only rewrites what differs from the current registry:
+    //  - entities created since the capture are destroyed, destroyed ones are recreated with the same identifier
+    //  - plain data components are compared and only written back when changed
+    //  - 3D rigid bodies keep their physics body and only have their dynamic state reset
+    class LUMOS_EXPORT SceneSnapshot
+    {
+    public:
+        SceneSnapshot();
+        ~SceneSnapshot();
+
+        void Capture(Scene* scene, uint8_t flags = SceneSnapshot_Default);
+        void Restore(Scene* scene);
+        void Clear();
+
+        bool IsValid(Scene* scene) const { return m_Scene && m_Scene == scene; }
+        uint32_t GetEntityCount() const;
+
+    private:
+        NONCOPYABLE(SceneSnapshot)
+
+        UniquePtr<SceneSnapshotData> m_Data;
+        Scene* m_Scene  = nullptr;
+        uint8_t m_Flags = SceneSnapshot_Default;
+    };
+
+    // Ring of N scene snapshots for gameplay rollback. Snapshot memory is reused between captures.
+    class LUMOS_EXPORT SceneRollbackBuffer
+    {
+    public:
+        SceneRollbackBuffer() = default;
+        ~SceneRollbackBuffer();
+
+        void Init(uint32_t frameCount, uint8_t flags = SceneSnapshot_StateOnly);
+        void Capture(Scene* scene);
+
+        // Restore the state captured framesBack captures ago (0 = most recent) and discard newer captures
+        bool Rollback(Scene* scene, uint32_t framesBack = 0);
+        void Clear();
+
+        uint32_t GetCapturedFrameCount() const { return m_Count; }
+        uint32_t GetCapacity() const { return (uint32_t)m_Snapshots.Size(); }
+
+    private:
+        TDArray<SceneSnapshot*> m_Snapshots;
+        uint32_t m_Head  = 0;
+        uint32_t m_Count = 0;
+        uint8_t m_Flags  = SceneSnapshot_StateOnly;
+    };
+}
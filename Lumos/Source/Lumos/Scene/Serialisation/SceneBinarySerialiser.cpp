@@ -0,0 +1,589 @@
+#include "Precompiled.h"
+#include "SceneBinarySerialiser.h"
+#include "SerialisationImplementation.h"
+#include "Scene/Scene.h"
+#include "Scene/Entity.h"
+#include "Scene/SceneGraph.h"
+#include "Scene/Component/Components.h"
+#include "Scene/Component/SoundComponent.h"
+#include "Scene/Component/ModelComponent.h"
+#include "Scene/Component/RigidBody2DComponent.h"
+#include "Scene/Component/RigidBody3DComponent.h"
+#include "Scripting/Lua/LuaScriptComponent.h"
+#include "Graphics/Light.h"
+#include "Graphics/Model.h"
+#include "Graphics/Environment.h"
+#include "Graphics/ParticleManager.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/SphereCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/CuboidCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/PyramidCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/HullCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/CapsuleCollisionShape.h"
+#include "Core/JobSystem.h"
+#include "Core/Buffer.h"
+#include "Core/OS/FileSystem.h"
+#include "Utilities/Hash.h"
+
+#include <cereal/types/polymorphic.hpp>
+#include <cereal/archives/binary.hpp>
+#include <entt/entity/registry.hpp>
+#include <fstream>
+#include <streambuf>
+#include <tuple>
+
+namespace Lumos
+{
+    namespace
+    {
+        constexpr uint32_t SceneBinaryMagic         = 0x424E534C; // "LSNB"
+        constexpr uint32_t SceneBinaryFormatVersion = 1;
+
+        struct SceneBinaryHeader
+        {
+            uint32_t Magic;
+            uint32_t FormatVersion;
+            uint32_t SceneVersion;
+            uint32_t SectionCount;
+        };
+
+        struct SceneBinarySection
+        {
+            uint32_t NameHash;
+            uint32_t Count;
+            uint64_t Offset;
+            uint64_t Size;
+        };
+
+        // Read-only view over a section blob so cereal can decode straight from the file buffer
+        struct MemoryStreamBuffer : std::streambuf
+        {
+            MemoryStreamBuffer(const uint8_t* data, uint64_t size)
+            {
+                char* begin = (char*)data;
+                setg(begin, begin, begin + size);
+            }
+        };
+
+        // WorkerSafe sections only touch their own component data while loading and can be
+        // decoded (and inserted, when the storage has no construct listeners) on any thread.
+        template <typename T>
+        struct SceneBinarySectionTraits;
+
+#define SCENE_BINARY_SECTION(Type, SectionName, IsWorkerSafe) \
+    template <>                                               \
+    struct SceneBinarySectionTraits<Type>                     \
+    {                                                         \
+        static constexpr const char* Name = SectionName;      \
+        static constexpr bool WorkerSafe  = IsWorkerSafe;     \
+    };
+
+        SCENE_BINARY_SECTION(Maths::Transform, "Transform", true)
+        SCENE_BINARY_SECTION(NameComponent, "Name", true)
+        SCENE_BINARY_SECTION(ActiveComponent, "Active", true)
+        SCENE_BINARY_SECTION(Hierarchy, "Hierarchy", true)
+        SCENE_BINARY_SECTION(IDComponent, "ID", true)
+        SCENE_BINARY_SECTION(Camera, "Camera", true)
+        SCENE_BINARY_SECTION(Graphics::Light, "Light", true)
+        SCENE_BINARY_SECTION(Listener, "Listener", true)
+        SCENE_BINARY_SECTION(LuaScriptComponent, "LuaScript", false)
+        SCENE_BINARY_SECTION(Graphics::Model, "Model", false)
+        SCENE_BINARY_SECTION(RigidBody3DComponent, "RigidBody3D", false)
+        SCENE_BINARY_SECTION(Graphics::Environment, "Environment", false)
+        SCENE_BINARY_SECTION(Graphics::Sprite, "Sprite", false)
+        SCENE_BINARY_SECTION(RigidBody2DComponent, "RigidBody2D", false)
+        SCENE_BINARY_SECTION(DefaultCameraController, "CameraController", false)
+        SCENE_BINARY_SECTION(Graphics::AnimatedSprite, "AnimatedSprite", false)
+        SCENE_BINARY_SECTION(SoundComponent, "Sound", false)
+        SCENE_BINARY_SECTION(Graphics::ModelComponent, "ModelComponent", false)
+        SCENE_BINARY_SECTION(AxisConstraintComponent, "AxisConstraint", false)
+        SCENE_BINARY_SECTION(TextComponent, "Text", false)
+        SCENE_BINARY_SECTION(ParticleEmitter, "ParticleEmitter", false)
+        SCENE_BINARY_SECTION(SpringConstraintComponent, "SpringConstraint", false)
+
+#undef SCENE_BINARY_SECTION
+
+#define SCENE_BINARY_COMPONENTS Maths::Transform, NameComponent, ActiveComponent, Hierarchy, IDComponent, Camera, Graphics::Light, Listener, LuaScriptComponent, Graphics::Model, RigidBody3DComponent, Graphics::Environment, Graphics::Sprite, RigidBody2DComponent, DefaultCameraController, Graphics::AnimatedSprite, SoundComponent, Graphics::ModelComponent, AxisConstraintComponent, TextComponent, ParticleEmitter, SpringConstraintComponent
+
+        uint32_t SectionNameHash(const char* name)
+        {
+            return MurmurHash3(name, (int)strlen(name), 0);
+        }
+
+        struct StringTable
+        {
+            TDArray<std::string> Strings;
+            std::unordered_map<std::string, uint32_t> Lookup;
+
+            uint32_t Add(const std::string& str)
+            {
+                auto it = Lookup.find(str);
+                if(it != Lookup.end())
+                    return it->second;
+
+                uint32_t index = (uint32_t)Strings.Size();
+                Strings.PushBack(str);
+                Lookup[str] = index;
+                return index;
+            }
+        };
+
+        template <typename T>
+        struct TypeTag
+        {
+            using Type = T;
+        };
+
+        template <typename... Component, typename Func>
+        void ForEachComponentType(Func&& func)
+        {
+            (func(TypeTag<Component> {}), ...);
+        }
+
+        template <typename T>
+        uint32_t WriteComponentSection(std::ostream& stream, const entt::registry& registry, StringTable& strings)
+        {
+            auto* storage = registry.storage<T>();
+            if(!storage || storage->empty())
+                return 0;
+
+            // Entities are written in packed order so they can be bulk inserted on load
+            uint32_t count               = (uint32_t)storage->size();
+            const entt::entity* entities = storage->data();
+
+            cereal::BinaryOutputArchive output(stream);
+            output(count);
+            output(cereal::binary_data(entities, sizeof(entt::entity) * count));
+
+            for(uint32_t i = 0; i < count; i++)
+            {
+                if constexpr(std::is_same_v<T, NameComponent>)
+                    output(strings.Add(storage->get(entities[i]).name));
+                else
+                    output(storage->get(entities[i]));
+            }
+
+            return count;
+        }
+
+        template <typename T>
+        struct SectionStaging
+        {
+            using ComponentType = T;
+
+            const SceneBinarySection* Section = nullptr;
+            TDArray<entt::entity> Entities;
+            std::vector<T> Components;
+            bool Inserted = false;
+        };
+
+        struct LoadState
+        {
+            const uint8_t* Data                 = nullptr;
+            const TDArray<std::string>* Strings = nullptr;
+            std::atomic<bool> Failed { false };
+        };
+
+        template <typename... Component>
+        using SectionStagingTuple = std::tuple<SectionStaging<Component>...>;
+
+        template <typename T>
+        void DecodeSection(SectionStaging<T>& staging, LoadState& state)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            try
+            {
+                MemoryStreamBuffer buffer(state.Data + staging.Section->Offset, staging.Section->Size);
+                std::istream stream(&buffer);
+                cereal::BinaryInputArchive input(stream);
+
+                uint32_t count;
+                input(count);
+
+                staging.Entities.Resize(count);
+                staging.Components.resize(count);
+                input(cereal::binary_data(staging.Entities.Data(), sizeof(entt::entity) * count));
+
+                for(uint32_t i = 0; i < count; i++)
+                {
+                    if constexpr(std::is_same_v<T, NameComponent>)
+                    {
+                        uint32_t index;
+                        input(index);
+                        if(index < state.Strings->Size())
+                            staging.Components[i].name = (*state.Strings)[index];
+                    }
+                    else
+                        input(staging.Components[i]);
+                }
+            }
+            catch(...)
+            {
+                staging.Entities.Clear();
+                staging.Components.clear();
+                state.Failed = true;
+            }
+        }
+
+        template <typename T, typename Storage>
+        void InsertSection(SectionStaging<T>& staging, Storage& storage)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            if(!staging.Entities.Empty())
+            {
+                entt::entity* entities = staging.Entities.Data();
+                storage.insert(entities, entities + staging.Entities.Size(), std::make_move_iterator(staging.Components.begin()));
+            }
+
+            staging.Components.clear();
+            staging.Inserted = true;
+        }
+
+        const SceneBinarySection* FindSection(const SceneBinarySection* sections, uint32_t sectionCount, const char* name)
+        {
+            uint32_t hash = SectionNameHash(name);
+            for(uint32_t i = 0; i < sectionCount; i++)
+            {
+                if(sections[i].NameHash == hash)
+                    return &sections[i];
+            }
+            return nullptr;
+        }
+    }
+
+    bool IsSceneBinaryFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        SceneBinaryHeader header = {};
+        if(!file.read((char*)&header, sizeof(SceneBinaryHeader)))
+            return false;
+
+        return header.Magic == SceneBinaryMagic;
+    }
+
+    bool SerialiseSceneBinary(const std::string& path, Scene& scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        entt::registry& registry = scene.GetRegistry();
+
+        TDArray<SceneBinarySection> sections;
+        TDArray<std::string> blobs;
+        StringTable strings;
+
+        auto addSection = [&](const char* name, uint32_t count, std::stringstream& stream)
+        {
+            SceneBinarySection& section = sections.EmplaceBack();
+            section.NameHash            = SectionNameHash(name);
+            section.Count               = count;
+            section.Offset              = 0;
+            blobs.PushBack(stream.str());
+            section.Size = blobs.Back().size();
+        };
+
+        {
+            std::stringstream stream;
+            {
+                cereal::BinaryOutputArchive output(stream);
+                output(scene);
+            }
+            addSection("Scene", 1, stream);
+        }
+
+        {
+            auto& entityStorage = registry.storage<entt::entity>();
+            uint32_t count      = (uint32_t)entityStorage.size();
+            uint32_t inUse      = (uint32_t)entityStorage.in_use();
+
+            std::stringstream stream;
+            {
+                cereal::BinaryOutputArchive output(stream);
+                output(count, inUse);
+                output(cereal::binary_data(entityStorage.data(), sizeof(entt::entity) * count));
+            }
+            addSection("Entities", count, stream);
+        }
+
+        ForEachComponentType<SCENE_BINARY_COMPONENTS>([&](auto tag)
+                                                      {
+            using T = typename decltype(tag)::Type;
+            std::stringstream stream;
+            uint32_t count = WriteComponentSection<T>(stream, registry, strings);
+            if(count > 0)
+                addSection(SceneBinarySectionTraits<T>::Name, count, stream); });
+
+        {
+            std::stringstream stream;
+            {
+                cereal::BinaryOutputArchive output(stream);
+                uint32_t count = (uint32_t)strings.Strings.Size();
+                output(count);
+                for(auto& str : strings.Strings)
+                    output(str);
+            }
+            addSection("Strings", (uint32_t)strings.Strings.Size(), stream);
+        }
+
+        SceneBinaryHeader header;
+        header.Magic         = SceneBinaryMagic;
+        header.FormatVersion = SceneBinaryFormatVersion;
+        header.SceneVersion  = SceneSerialisationVersion;
+        header.SectionCount  = (uint32_t)sections.Size();
+
+        uint64_t offset = sizeof(SceneBinaryHeader) + sizeof(SceneBinarySection) * sections.Size();
+        for(auto& section : sections)
+        {
+            section.Offset = offset;
+            offset += section.Size;
+        }
+
+        std::ofstream file(path, std::ios::binary);
+        if(!file)
+        {
+            LERROR("Failed to open %s for writing", path.c_str());
+            return false;
+        }
+
+        file.write((const char*)&header, sizeof(SceneBinaryHeader));
+        file.write((const char*)sections.Data(), sizeof(SceneBinarySection) * sections.Size());
+        for(auto& blob : blobs)
+            file.write(blob.data(), blob.size());
+
+        return file.good();
+    }
+
+    bool DeserialiseSceneBinary(const std::string& path, Scene& scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        int64_t fileSize = FileSystem::GetFileSize(path);
+        if(fileSize < (int64_t)sizeof(SceneBinaryHeader))
+            return false;
+
+        Buffer fileData;
+        fileData.Allocate((uint32_t)fileSize);
+        if(!FileSystem::ReadFile(path, fileData.Data, fileSize))
+        {
+            fileData.Release();
+            return false;
+        }
+
+        const SceneBinaryHeader& header = fileData.Read<SceneBinaryHeader>();
+        if(header.Magic != SceneBinaryMagic || header.FormatVersion > SceneBinaryFormatVersion)
+        {
+            LERROR("Invalid binary scene file %s", path.c_str());
+            fileData.Release();
+            return false;
+        }
+
+        // Component loaders gate newer fields on the version the scene was written with
+        Serialisation::CurrentSceneVersion = (int)header.SceneVersion;
+
+        const SceneBinarySection* sections = (const SceneBinarySection*)(fileData.Data + sizeof(SceneBinaryHeader));
+        uint64_t tableEnd                  = sizeof(SceneBinaryHeader) + sizeof(SceneBinarySection) * (uint64_t)header.SectionCount;
+        bool valid                         = tableEnd <= (uint64_t)fileSize;
+        for(uint32_t i = 0; valid && i < header.SectionCount; i++)
+            valid = sections[i].Offset + sections[i].Size <= (uint64_t)fileSize;
+
+        if(!valid)
+        {
+            LERROR("Corrupt binary scene file %s", path.c_str());
+            fileData.Release();
+            return false;
+        }
+
+        LoadState state;
+        state.Data = fileData.Data;
+
+        auto openSection = [&](const SceneBinarySection* section, auto&& func)
+        {
+            MemoryStreamBuffer buffer(state.Data + section->Offset, section->Size);
+            std::istream stream(&buffer);
+            cereal::BinaryInputArchive input(stream);
+            func(input);
+        };
+
+        TDArray<std::string> strings;
+        entt::registry& registry = scene.GetRegistry();
+
+        try
+        {
+            const SceneBinarySection* sceneSection    = FindSection(sections, header.SectionCount, "Scene");
+            const SceneBinarySection* entitiesSection = FindSection(sections, header.SectionCount, "Entities");
+            const SceneBinarySection* stringsSection  = FindSection(sections, header.SectionCount, "Strings");
+
+            if(!sceneSection || !entitiesSection)
+            {
+                LERROR("Binary scene file missing required sections %s", path.c_str());
+                fileData.Release();
+                return false;
+            }
+
+            openSection(sceneSection, [&](cereal::BinaryInputArchive& input)
+                        { input(scene); });
+
+            if(stringsSection)
+            {
+                openSection(stringsSection, [&](cereal::BinaryInputArchive& input)
+                            {
+                    uint32_t count;
+                    input(count);
+                    strings.Resize(count);
+                    for(auto& str : strings)
+                        input(str); });
+            }
+
+            openSection(entitiesSection, [&](cereal::BinaryInputArchive& input)
+                        {
+                uint32_t count, inUse;
+                input(count, inUse);
+
+                TDArray<entt::entity> entities(count);
+                input(cereal::binary_data(entities.Data(), sizeof(entt::entity) * count));
+
+                auto& entityStorage = registry.storage<entt::entity>();
+                entityStorage.reserve(count);
+                for(auto entity : entities)
+                    entityStorage.emplace(entity);
+                entityStorage.in_use(inUse); });
+        }
+        catch(...)
+        {
+            LERROR("Failed to load scene - %s", path.c_str());
+            fileData.Release();
+            return false;
+        }
+
+        state.Strings = &strings;
+
+        SectionStagingTuple<SCENE_BINARY_COMPONENTS> stagingTuple;
+        System::JobSystem::Context ctx;
+
+        // Create and reserve every storage up front on this thread, then hand the plain data
+        // sections to workers. Storages with construct listeners (dependencies, scene graph)
+        // are filled on this thread once the workers are done.
+        std::apply([&](auto&... staging)
+                   {
+            auto launch = [&](auto& staging)
+            {
+                using T         = typename std::remove_reference_t<decltype(staging)>::ComponentType;
+                staging.Section = FindSection(sections, header.SectionCount, SceneBinarySectionTraits<T>::Name);
+                if(!staging.Section)
+                    return;
+
+                auto& storage = registry.storage<T>();
+                storage.reserve(storage.size() + staging.Section->Count);
+
+                if(SceneBinarySectionTraits<T>::WorkerSafe)
+                {
+                    bool insertOnWorker = storage.on_construct().empty();
+                    auto* stagingPtr    = &staging;
+                    auto* storagePtr    = &storage;
+                    auto* statePtr      = &state;
+                    System::JobSystem::Execute(ctx, [stagingPtr, storagePtr, statePtr, insertOnWorker](JobDispatchArgs args)
+                                               {
+                        DecodeSection(*stagingPtr, *statePtr);
+                        if(insertOnWorker)
+                            InsertSection(*stagingPtr, *storagePtr); });
+                }
+            };
+            (launch(staging), ...); },
+                   stagingTuple);
+
+        std::apply([&](auto&... staging)
+                   {
+            auto decode = [&](auto& staging)
+            {
+                using T = typename std::remove_reference_t<decltype(staging)>::ComponentType;
+                if(staging.Section && !SceneBinarySectionTraits<T>::WorkerSafe)
+                    DecodeSection(staging, state);
+            };
+            (decode(staging), ...); },
+                   stagingTuple);
+
+        System::JobSystem::Wait(ctx);
+
+        std::apply([&](auto&... staging)
+                   {
+            auto insert = [&](auto& staging)
+            {
+                using T = typename std::remove_reference_t<decltype(staging)>::ComponentType;
+                if(staging.Section && !staging.Inserted)
+                    InsertSection(staging, registry.storage<T>());
+            };
+            (insert(staging), ...); },
+                   stagingTuple);
+
+        fileData.Release();
+
+        if(state.Failed)
+            LERROR("Failed to load some components from scene - %s", path.c_str());
+
+        return true;
+    }
+
+    bool TestSceneBinaryRoundTrip(const std::string& directory)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const std::string sceneName = "SceneBinaryRoundTrip";
+        const uint32_t entityCount  = 64;
+
+        // Roots every eighth entity, with a few point lights, so hierarchy and light sections are written too
+        Scene source(sceneName);
+        Entity root;
+        for(uint32_t i = 0; i < entityCount; i++)
+        {
+            Entity entity = source.CreateEntity("Entity " + std::to_string(i));
+            entity.AddComponent<Maths::Transform>(Vec3((float)i, (float)i * 0.5f, -(float)i));
+            if(i % 4 == 0)
+                entity.AddComponent<Graphics::Light>(Vec3(0.0f, -1.0f, 0.0f), Vec4(1.0f), (float)i, Graphics::LightType::PointLight, Vec3(), (float)i + 1.0f);
+
+            if(i % 8 == 0)
+                root = entity;
+            else
+                entity.SetParent(root);
+        }
+
+        source.Serialise(directory, true);
+
+        Scene loaded(sceneName);
+        loaded.Deserialise(directory, true);
+        std::remove((directory + sceneName + ".bin").c_str());
+
+        uint32_t mismatches = 0;
+        if(loaded.GetRegistry().view<IDComponent>().size() != entityCount)
+        {
+            LERROR("Scene binary round trip loaded %u entities, expected %u", (uint32_t)loaded.GetRegistry().view<IDComponent>().size(), entityCount);
+            mismatches++;
+        }
+
+        for(auto handle : source.GetRegistry().view<IDComponent>())
+        {
+            Entity entity(handle, &source);
+            Entity copy = loaded.GetEntityByUUID(entity.GetID());
+            if(!copy.Valid())
+            {
+                mismatches++;
+                continue;
+            }
+
+            Entity parent     = entity.GetParent();
+            Entity copyParent = copy.GetParent();
+            Graphics::Light* light     = entity.TryGetComponent<Graphics::Light>();
+            Graphics::Light* copyLight = copy.TryGetComponent<Graphics::Light>();
+
+            bool match = copy.GetName() == entity.GetName();
+            match &= copy.GetTransform().GetLocalPosition() == entity.GetTransform().GetLocalPosition();
+            match &= parent.Valid() == copyParent.Valid() && (!parent.Valid() || parent.GetID() == copyParent.GetID());
+            match &= (light == nullptr) == (copyLight == nullptr) && (!light || light->Radius == copyLight->Radius);
+
+            if(!match)
+            {
+                LERROR("Scene binary round trip mismatch on %s", entity.GetName().c_str());
+                mismatches++;
+            }
+        }
+
+        if(mismatches == 0)
+            LINFO("Scene binary round trip passed, %u entities", entityCount);
+
+        return mismatches == 0;
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+namespace Lumos
+{
+    class Scene;
+
+    // Chunked binary scene format (.bin)
+    //  - Header, followed by a section table and one blob per section
+    //  - One section per component type, plus scene settings, entity list and a shared string table
+    //  - Sections for plain data components are decoded and inserted on the JobSystem in parallel
+    //  - Sections that touch assets/scripting are decoded on the main thread while workers run
+    bool IsSceneBinaryFile(const std::string& path);
+    bool SerialiseSceneBinary(const std::string& path, Scene& scene);
+    bool DeserialiseSceneBinary(const std::string& path, Scene& scene);
+
+    // Saves a small generated scene to directory as .bin, loads it back into a new scene and compares the two.
+    // Mismatches are logged, the file is removed afterwards
+    bool TestSceneBinaryRoundTrip(const std::string& directory);
+}
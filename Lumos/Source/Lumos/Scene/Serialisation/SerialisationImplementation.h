@@ -45,6 +45,7 @@ namespace Lumos
 
         archive(cereal::make_nvp("Position", node.m_Position), cereal::make_nvp("Radius", node.m_Radius), cereal::make_nvp("Pitch", node.m_Pitch), cereal::make_nvp("Volume", node.m_Volume), cereal::make_nvp("Velocity", node.m_Velocity), cereal::make_nvp("Looping", node.m_IsLooping), cereal::make_nvp("Paused", node.m_Paused), cereal::make_nvp("ReferenceDistance", node.m_ReferenceDistance), cereal::make_nvp("Global", node.m_IsGlobal), cereal::make_nvp("TimeLeft", node.m_TimeLeft), cereal::make_nvp("Stationary", node.m_Stationary),
                 cereal::make_nvp("SoundNodePath", path), cereal::make_nvp("RollOffFactor", node.m_RollOffFactor));
+        archive(cereal::make_nvp("Priority", node.m_Priority));
     }
 
     template <typename Archive>
@@ -54,6 +55,9 @@ namespace Lumos
         archive(cereal::make_nvp("Position", node.m_Position), cereal::make_nvp("Radius", node.m_Radius), cereal::make_nvp("Pitch", node.m_Pitch), cereal::make_nvp("Volume", node.m_Volume), cereal::make_nvp("Velocity", node.m_Velocity), cereal::make_nvp("Looping", node.m_IsLooping), cereal::make_nvp("Paused", node.m_Paused), cereal::make_nvp("ReferenceDistance", node.m_ReferenceDistance), cereal::make_nvp("Global", node.m_IsGlobal), cereal::make_nvp("TimeLeft", 0.0f), cereal::make_nvp("Stationary", node.m_Stationary),
                 cereal::make_nvp("SoundNodePath", soundFilePath), cereal::make_nvp("RollOffFactor", node.m_RollOffFactor));
 
+        if(Serialisation::CurrentSceneVersion > 26)
+            archive(cereal::make_nvp("Priority", node.m_Priority));
+
         if(!soundFilePath.empty())
         {
             node.SetSound(Sound::Create(soundFilePath, StringUtilities::GetFilePathExtension(soundFilePath)));
@@ -139,11 +143,12 @@ namespace Lumos
     {
         auto shape = std::unique_ptr<CollisionShape>(rigidBody.m_CollisionShape.get());
 
-        const int Version = 2;
+        const int Version = 3;
 
         archive(cereal::make_nvp("Version", Version));
         archive(cereal::make_nvp("Position", rigidBody.m_Position), cereal::make_nvp("Orientation", rigidBody.m_Orientation), cereal::make_nvp("LinearVelocity", rigidBody.m_LinearVelocity), cereal::make_nvp("Force", rigidBody.m_Force), cereal::make_nvp("Mass", 1.0f / rigidBody.m_InvMass), cereal::make_nvp("AngularVelocity", rigidBody.m_AngularVelocity), cereal::make_nvp("Torque", rigidBody.m_Torque), cereal::make_nvp("Static", rigidBody.m_Static), cereal::make_nvp("Friction", rigidBody.m_Friction), cereal::make_nvp("Elasticity", rigidBody.m_Elasticity), cereal::make_nvp("CollisionShape", shape), cereal::make_nvp("Trigger", rigidBody.m_Trigger), cereal::make_nvp("AngularFactor", rigidBody.m_AngularFactor));
         archive(cereal::make_nvp("UUID", (uint64_t)rigidBody.m_UUID));
+        archive(cereal::make_nvp("Continuous", rigidBody.m_Continuous));
         shape.release();
     }
 
@@ -162,6 +167,9 @@ namespace Lumos
 
         if(Version > 1)
             archive(cereal::make_nvp("UUID", (uint64_t)rigidBody.m_UUID));
+
+        if(Version > 2)
+            archive(cereal::make_nvp("Continuous", rigidBody.m_Continuous));
     }
 
     template <typename Archive>
@@ -1,32 +1,128 @@
 #include "Precompiled.h"
 #include "SystemManager.h"
+#include "Scene/Scene.h"
+#include "Core/JobSystem.h"
+#include "Utilities/Timer.h"
+#include "Maths/MathsUtilities.h"
 #include <imgui/imgui.h>
+#include <entt/entity/registry.hpp>
 
 namespace Lumos
 {
     SystemManager::SystemManager()
     {
-        m_Arena         = ArenaAlloc(Kilobytes(64));
-        m_Systems       = {};
-        m_Systems.arena = m_Arena;
+        m_Arena = ArenaAlloc(Kilobytes(64));
+        m_Systems.SetArena(m_Arena);
     }
     SystemManager::~SystemManager()
     {
-        ForHashMapEach(size_t, ISystem*, &m_Systems, it)
+        for(auto& system : m_Systems)
         {
-            ISystem* value = *it.value;
-            delete value;
+            delete system.Value;
+        }
+    }
+
+    void SystemManager::BuildSchedule()
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        m_Schedule.Resize(m_SystemOrder.Size(), { nullptr, 0, 0.0f });
+        m_StageCount = 0;
+
+        // A system runs one stage after the last earlier system it conflicts with
+        for(uint32_t i = 0; i < (uint32_t)m_SystemOrder.Size(); i++)
+        {
+            const SystemAccess& access = m_SystemOrder[i]->GetAccess();
+            uint32_t stage             = 0;
+            for(uint32_t j = 0; j < i; j++)
+            {
+                if(m_Schedule[j].Stage >= stage && access.ConflictsWith(m_SystemOrder[j]->GetAccess()))
+                    stage = m_Schedule[j].Stage + 1;
+            }
+
+            ScheduledSystem& scheduled = m_Schedule[i];
+            if(scheduled.System != m_SystemOrder[i])
+                scheduled.LastUpdateMS = 0.0f;
+
+            scheduled.System = m_SystemOrder[i];
+            scheduled.Stage  = stage;
+            m_StageCount     = Maths::Max(m_StageCount, stage + 1);
+        }
+    }
+
+    void SystemManager::OnUpdate(const TimeStep& dt, Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        BuildSchedule();
+
+        auto& registry = scene->GetRegistry();
+        for(auto system : m_SystemOrder)
+        {
+            for(auto storage : system->GetAccess().Storages)
+                storage(registry);
+        }
+
+        const TimeStep* timeStep = &dt;
+        auto& stageSystems       = m_StageSystems;
+        for(uint32_t stage = 0; stage < m_StageCount; stage++)
+        {
+            stageSystems.Clear();
+            for(auto& scheduled : m_Schedule)
+            {
+                if(scheduled.Stage == stage)
+                    stageSystems.PushBack(&scheduled);
+            }
+
+            if(!m_ParallelUpdate || stageSystems.Size() == 1)
+            {
+                for(auto scheduled : stageSystems)
+                {
+                    Timer timer;
+                    scheduled->System->OnUpdate(dt, scene);
+                    scheduled->LastUpdateMS = timer.GetElapsedMS();
+                }
+                continue;
+            }
+
+            ScheduledSystem** systems = stageSystems.Data();
+            System::JobSystem::Context context;
+            System::JobSystem::Dispatch(context, (uint32_t)stageSystems.Size(), 1, [systems, timeStep, scene](JobDispatchArgs args)
+                                        {
+                                            ScheduledSystem* scheduled = systems[args.jobIndex];
+                                            Timer timer;
+                                            scheduled->System->OnUpdate(*timeStep, scene);
+                                            scheduled->LastUpdateMS = timer.GetElapsedMS(); });
+            System::JobSystem::Wait(context);
         }
     }
 
     void SystemManager::OnImGui()
     {
-        ForHashMapEach(size_t, ISystem*, &m_Systems, it)
+        ImGui::Checkbox("Parallel Update", &m_ParallelUpdate);
+
+        if(ImGui::TreeNode("Schedule"))
+        {
+            for(uint32_t stage = 0; stage < m_StageCount; stage++)
+            {
+                ImGui::Text("Stage %u", stage);
+                ImGui::Indent();
+                for(auto& scheduled : m_Schedule)
+                {
+                    if(scheduled.Stage != stage)
+                        continue;
+
+                    const SystemAccess& access = scheduled.System->GetAccess();
+                    ImGui::Text("%s  %.3f ms%s", scheduled.System->GetName(), scheduled.LastUpdateMS, access.Exclusive ? "  (exclusive)" : "");
+                }
+                ImGui::Unindent();
+            }
+            ImGui::TreePop();
+        }
+
+        for(auto system : m_SystemOrder)
         {
-            ISystem* value = *it.value;
-            if(ImGui::TreeNode(value->GetName()))
+            if(ImGui::TreeNode(system->GetName()))
             {
-                value->OnImGui();
+                system->OnImGui();
                 ImGui::TreePop();
             }
         }
@@ -20,7 +20,8 @@ namespace Lumos
 
             // Create a pointer to the system and return it so it can be used externally
             ISystem* system = new T(std::forward<Args>(args)...);
-            HashMapInsert(&m_Systems, typeName, system);
+            m_Systems.Insert(typeName, system);
+            m_SystemOrder.PushBack(system);
             return system;
         }
 
@@ -33,7 +34,8 @@ namespace Lumos
 
             // Create a pointer to the system and return it so it can be used externally
             ISystem* system = t;
-            HashMapInsert(&m_Systems, typeName, system);
+            m_Systems.Insert(typeName, system);
+            m_SystemOrder.PushBack(system);
             return system;
         }
 
@@ -42,7 +44,13 @@ namespace Lumos
         {
             std::scoped_lock<std::mutex> lock(m_Mutex);
             auto typeName = typeid(T).hash_code();
-            HashMapRemove(&m_Systems, typeName);
+            if(ISystem** find = m_Systems.Find(typeName))
+            {
+                ISystem* system = *find;
+                m_SystemOrder.RemoveIf([system](ISystem* other)
+                                       { return other == system; });
+                m_Systems.Remove(typeName);
+            }
         }
 
         template <typename T>
@@ -50,10 +58,9 @@ namespace Lumos
         {
             auto typeName = typeid(T).hash_code();
 
-            ISystem* find;
-            if(HashMapFind(&m_Systems, typeName, &find))
+            if(ISystem** find = m_Systems.Find(typeName))
             {
-                return dynamic_cast<T*>(find);
+                return dynamic_cast<T*>(*find);
             }
 
             LWARN("Failed to find system");
@@ -65,34 +72,46 @@ namespace Lumos
         bool HasSystem()
         {
             auto typeName = typeid(T).hash_code();
-            ISystem* find;
-            return HashMapFind(&m_Systems, typeName, &find);
+            return m_Systems.Contains(typeName);
         }
 
-        void OnUpdate(const TimeStep& dt, Scene* scene)
-        {
-            ForHashMapEach(size_t, ISystem*, &m_Systems, it)
-            {
-                ISystem* value = *it.value;
-                value->OnUpdate(dt, scene);
-            }
-        }
+        // Runs systems in stages, systems within a stage don't conflict and run on the JobSystem.
+        // Conflicting systems keep their registration order, so the result doesn't depend on threading.
+        void OnUpdate(const TimeStep& dt, Scene* scene);
 
         void OnImGui();
 
         void OnDebugDraw()
         {
-            ForHashMapEach(size_t, ISystem*, &m_Systems, it)
+            for(auto system : m_SystemOrder)
             {
-                ISystem* value = *it.value;
-                value->OnDebugDraw();
+                system->OnDebugDraw();
             }
         }
 
+        void SetParallelUpdate(bool parallel) { m_ParallelUpdate = parallel; }
+        bool GetParallelUpdate() const { return m_ParallelUpdate; }
+
     private:
+        struct ScheduledSystem
+        {
+            ISystem* System;
+            uint32_t Stage;
+            float LastUpdateMS;
+        };
+
+        void BuildSchedule();
+
         std::mutex m_Mutex;
         Arena* m_Arena;
 
-        HashMap(size_t, ISystem*) m_Systems;
+        FlatHashMap<size_t, ISystem*> m_Systems;
+        TDArray<ISystem*> m_SystemOrder; // Registration order
+
+        // Rebuilt every update, in registration order
+        TDArray<ScheduledSystem> m_Schedule;
+        TDArray<ScheduledSystem*> m_StageSystems;
+        uint32_t m_StageCount = 0;
+        bool m_ParallelUpdate = true;
     };
 }
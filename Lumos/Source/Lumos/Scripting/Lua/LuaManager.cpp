@@ -10,6 +10,7 @@
 #include "Scene/SceneManager.h"
 #include "LuaScriptComponent.h"
 #include "Scene/SceneGraph.h"
+#include "Scene/SceneBVH.h"
 #include "Graphics/Camera/ThirdPersonCamera.h"
 #include "Graphics/UI.h"
 
@@ -35,6 +36,8 @@
 #include "Scene/Component/AIComponent.h"
 #include "Physics/LumosPhysicsEngine/LumosPhysicsEngine.h"
 #include "Physics/LumosPhysicsEngine/RigidBody3D.h"
+#include "Utilities/Timer.h"
+#include "Core/Telemetry.h"
 
 #include "ImGuiLua.h"
 #include "PhysicsLua.h"
@@ -42,6 +45,7 @@
 
 #include <imgui/imgui.h>
 #include <sol/sol.hpp>
+#include <unordered_map>
 #if LUMOS_PROFILE
 #include <Tracy/public/tracy/TracyLua.hpp>
 #endif
@@ -170,12 +174,26 @@ namespace Lumos
     {
     }
 #endif
+    struct LuaScriptBatch
+    {
+        TDArray<entt::entity> Entities;
+        SharedPtr<sol::protected_function> BatchFunc;
+        sol::table EntityTable;    // Entity handles, built with the batch
+        sol::table TransformTable; // Refreshed every update, component addresses can move
+    };
+
     void LuaManager::OnInit()
     {
         LUMOS_PROFILE_FUNCTION();
 
         m_State = new sol::state();
         m_State->open_libraries(sol::lib::base, sol::lib::package, sol::lib::math, sol::lib::table, sol::lib::os, sol::lib::string);
+#ifdef LUMOS_LUAJIT
+        m_State->open_libraries(sol::lib::ffi, sol::lib::jit, sol::lib::bit32);
+#endif
+
+        // Collection is stepped manually once per frame, see StepGarbageCollector
+        lua_gc(m_State->lua_state(), LUA_GCSTOP, 0);
 #if LUMOS_PROFILE && defined(TRACY_ENABLE)
         tracy::LuaRegister(m_State->lua_state());
 #else
@@ -236,11 +254,14 @@ namespace Lumos
         BindPhysicsLua(*m_State);
         BindUILua(*m_State);
 
+        m_LastGCMemory = GetMemoryUsage();
+
         LINFO("Initialised Lua Manager");
     }
 
     LuaManager::~LuaManager()
     {
+        m_ScriptBatches.clear();
         delete m_State;
     }
 
@@ -277,28 +298,155 @@ namespace Lumos
         }
     }
 
+    void LuaManager::RebuildScriptBatches(Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        auto& registry = scene->GetRegistry();
+        auto view      = registry.view<LuaScriptComponent>();
+
+        m_ScriptBatches.clear();
+        m_ScriptStats.clear();
+
+        // Group instances by script file so each file can be updated (and profiled) together
+        std::unordered_map<std::string, size_t> batchIndices;
+        for(auto entity : view)
+        {
+            const auto& luaScript = view.get<LuaScriptComponent>(entity);
+            if(!luaScript.HasUpdateFunction() && !luaScript.GetBatchUpdateFunction())
+                continue;
+
+            auto it = batchIndices.find(luaScript.GetFilePath());
+            if(it == batchIndices.end())
+            {
+                it = batchIndices.emplace(luaScript.GetFilePath(), m_ScriptBatches.size()).first;
+
+                auto& batch     = m_ScriptBatches.emplace_back();
+                batch.BatchFunc = luaScript.GetBatchUpdateFunction();
+
+                auto& stats    = m_ScriptStats.emplace_back();
+                stats.FilePath = luaScript.GetFilePath();
+                stats.Batched  = batch.BatchFunc != nullptr;
+            }
+
+            m_ScriptBatches[it->second].Entities.PushBack(entity);
+        }
+
+        for(size_t i = 0; i < m_ScriptBatches.size(); i++)
+        {
+            auto& batch                    = m_ScriptBatches[i];
+            const int count                = (int)batch.Entities.Size();
+            m_ScriptStats[i].InstanceCount = (uint32_t)count;
+
+            if(!batch.BatchFunc)
+                continue;
+
+            batch.EntityTable    = m_State->create_table(count, 0);
+            batch.TransformTable = m_State->create_table(count, 0);
+
+            for(int j = 0; j < count; j++)
+                batch.EntityTable.raw_set(j + 1, Entity(batch.Entities[j], scene));
+        }
+
+        m_BatchScene         = scene;
+        m_BatchScriptVersion = LuaScriptComponent::GetScriptVersion();
+        m_BatchScriptCount   = view.size();
+    }
+
     void LuaManager::OnUpdate(Scene* scene)
     {
         LUMOS_PROFILE_FUNCTION();
+        LUMOS_TELEMETRY_SCOPE("Lua::OnUpdate");
         auto& registry = scene->GetRegistry();
 
         auto view = registry.view<LuaScriptComponent>();
 
         if(view.empty())
+        {
+            StepGarbageCollector();
             return;
+        }
 
-        float dt = (float)Engine::Get().GetTimeStep().GetSeconds();
+        if(m_BatchScene != scene || m_BatchScriptVersion != LuaScriptComponent::GetScriptVersion() || m_BatchScriptCount != view.size())
+            RebuildScriptBatches(scene);
 
-        for(auto entity : view)
+        float dt         = (float)Engine::Get().GetTimeStep().GetSeconds();
+        auto& scripts    = registry.storage<LuaScriptComponent>();
+        auto& transforms = registry.storage<Maths::Transform>();
+
+        for(size_t i = 0; i < m_ScriptBatches.size(); i++)
         {
-            auto& luaScript = registry.get<LuaScriptComponent>(entity);
-            luaScript.OnUpdate(dt);
+            LUMOS_PROFILE_SCOPE("Lua Script Update");
+            auto& batch = m_ScriptBatches[i];
+            auto& stats = m_ScriptStats[i];
+            LUMOS_PROFILE_ZONE_NAME(stats.FilePath.c_str(), stats.FilePath.size());
+
+            TimeStamp start     = Timer::Now();
+            int64_t memoryStart = GetMemoryUsage();
+            stats.CallCount     = 0;
+
+            if(batch.BatchFunc)
+            {
+                for(uint32_t j = 0; j < batch.Entities.Size(); j++)
+                {
+                    entt::entity entity = batch.Entities[j];
+                    if(transforms.contains(entity))
+                        batch.TransformTable.raw_set(j + 1, &transforms.get(entity));
+                    else
+                        batch.TransformTable.raw_set(j + 1, sol::lua_nil);
+                }
+
+                sol::protected_function_result result = (*batch.BatchFunc)(batch.EntityTable, batch.TransformTable, dt);
+                if(!result.valid())
+                {
+                    sol::error err = result;
+                    LERROR("Failed to Execute Script Lua OnUpdateBatch");
+                    LERROR("Error : %s", err.what());
+                }
+                stats.CallCount = 1;
+            }
+            else
+            {
+                for(auto entity : batch.Entities)
+                {
+                    // Scripts can destroy entities during the update
+                    if(!scripts.contains(entity))
+                        continue;
+
+                    scripts.get(entity).OnUpdate(dt);
+                    stats.CallCount++;
+                }
+            }
+
+            stats.UpdateTimeMs   = Timer::Duration(start, Timer::Now(), 1000.0f);
+            stats.AllocatedBytes = GetMemoryUsage() - memoryStart;
         }
+
+        StepGarbageCollector();
     }
 
     void LuaManager::CollectGarbage()
     {
         m_State->collect_garbage();
+        m_LastGCMemory = GetMemoryUsage();
+    }
+
+    void LuaManager::StepGarbageCollector()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        lua_State* L = m_State->lua_state();
+
+        const int64_t allocatedKB = (GetMemoryUsage() - m_LastGCMemory) / 1024;
+        const int stepKB          = (int)std::max<int64_t>(m_GCStepSizeKB, allocatedKB);
+        lua_gc(L, LUA_GCSTEP, stepKB);
+
+        m_LastGCMemory = GetMemoryUsage();
+        LUMOS_PROFILE_PLOT("Lua Memory (KB)", m_LastGCMemory / 1024);
+    }
+
+    int64_t LuaManager::GetMemoryUsage() const
+    {
+        lua_State* L = m_State->lua_state();
+        return (int64_t)lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
     }
 
     void LuaManager::OnNewProject(const std::string& projectPath)
@@ -725,6 +873,54 @@ namespace Lumos
         scene_type.set_function("GetRegistry", &Scene::GetRegistry);
         scene_type.set_function("GetEntityManager", &Scene::GetEntityManager);
 
+        // Queries against the scene BVH, which is refreshed after the scene graph each update
+        auto rayHitToTable = [](sol::state_view lua, Scene* scene, const SceneRayHit& hit)
+        {
+            sol::table table  = lua.create_table();
+            table["Entity"]   = Entity(hit.Entity, scene);
+            table["Distance"] = hit.Distance;
+            table["Point"]    = hit.Point;
+            return table;
+        };
+
+        auto entitiesToTable = [](sol::state_view lua, Scene* scene, const TDArray<entt::entity>& entities)
+        {
+            sol::table table = lua.create_table();
+            for(auto entity : entities)
+                table.add(Entity(entity, scene));
+            return table;
+        };
+
+        scene_type.set_function("Raycast", [rayHitToTable](Scene* scene, sol::this_state s, const Vec3& origin, const Vec3& direction, float maxDistance) -> sol::object
+                                {
+                                    SceneRayHit hit;
+                                    if(!scene->GetSceneBVH()->Raycast(Maths::Ray(origin, direction), maxDistance, hit))
+                                        return sol::nil;
+                                    return rayHitToTable(s, scene, hit); });
+
+        scene_type.set_function("RaycastAll", [rayHitToTable](Scene* scene, sol::this_state s, const Vec3& origin, const Vec3& direction, float maxDistance)
+                                {
+                                    TDArray<SceneRayHit> hits;
+                                    scene->GetSceneBVH()->RaycastAll(Maths::Ray(origin, direction), maxDistance, hits);
+
+                                    sol::state_view lua(s);
+                                    sol::table result = lua.create_table();
+                                    for(auto& hit : hits)
+                                        result.add(rayHitToTable(s, scene, hit));
+                                    return result; });
+
+        scene_type.set_function("QuerySphere", [entitiesToTable](Scene* scene, sol::this_state s, const Vec3& centre, float radius)
+                                {
+                                    TDArray<entt::entity> entities;
+                                    scene->GetSceneBVH()->QuerySphere(centre, radius, entities);
+                                    return entitiesToTable(s, scene, entities); });
+
+        scene_type.set_function("QueryBox", [entitiesToTable](Scene* scene, sol::this_state s, const Vec3& min, const Vec3& max)
+                                {
+                                    TDArray<entt::entity> entities;
+                                    scene->GetSceneBVH()->QueryBox(Maths::BoundingBox(min, max), entities);
+                                    return entitiesToTable(s, scene, entities); });
+
         sol::usertype<Graphics::Texture2D> texture2D_type = state.new_usertype<Graphics::Texture2D>("Texture2D");
         texture2D_type.set_function("CreateFromFile", &Graphics::Texture2D::CreateFromFile);
 
@@ -776,6 +972,47 @@ namespace Lumos
 
         app_type.set_function("GetWindowSize", &Application::GetWindowSize);
         state.set_function("GetAppInstance", &Application::Get);
+
+        auto telemetryStatsToTable = [](sol::state_view lua, const TelemetryStats& stats)
+        {
+            sol::table table   = lua.create_table();
+            table["Name"]      = std::string(stats.Name);
+            table["IsCounter"] = stats.IsCounter;
+            table["Calls"]     = stats.Calls;
+            table["Last"]      = stats.Last;
+            table["Average"]   = stats.Average;
+            table["P95"]       = stats.P95;
+            table["Max"]       = stats.Max;
+            return table;
+        };
+
+        auto telemetry = state.create_table("Telemetry");
+        telemetry.set_function("GetStats", [telemetryStatsToTable](sol::this_state s, const std::string& name) -> sol::object
+                               {
+                                   TelemetryStats stats;
+                                   if(!Telemetry::GetStats(name.c_str(), stats))
+                                       return sol::nil;
+                                   return telemetryStatsToTable(s, stats); });
+
+        telemetry.set_function("GetAllStats", [telemetryStatsToTable](sol::this_state s)
+                               {
+                                   TDArray<TelemetryStats> allStats;
+                                   Telemetry::GetAllStats(allStats);
+
+                                   sol::state_view lua(s);
+                                   sol::table result = lua.create_table();
+                                   for(auto& stats : allStats)
+                                       result.add(telemetryStatsToTable(s, stats));
+                                   return result; });
+
+        telemetry.set_function("AddCounter", [](const std::string& name, int64_t value)
+                               { Telemetry::AddCounter(Telemetry::RegisterCounter(name.c_str()), value); });
+        telemetry.set_function("SetCounter", [](const std::string& name, int64_t value)
+                               { Telemetry::SetCounter(Telemetry::RegisterCounter(name.c_str()), value); });
+        telemetry.set_function("RecordScope", [](const std::string& name, double milliseconds)
+                               { Telemetry::RecordScope(Telemetry::RegisterScope(name.c_str()), (uint64_t)(milliseconds * 1000000.0)); });
+        telemetry.set_function("Dump", [](const std::string& path)
+                               { return Telemetry::Dump(path); });
     }
 
     void LuaManager::BindUILua(sol::state& lua)
@@ -11,6 +11,17 @@ namespace sol
 namespace Lumos
 {
     class Scene;
+    struct LuaScriptBatch;
+
+    struct LuaScriptStats
+    {
+        std::string FilePath;
+        uint32_t InstanceCount = 0;
+        uint32_t CallCount     = 0; // Lua calls made during the last update
+        float UpdateTimeMs     = 0.0f;
+        int64_t AllocatedBytes = 0; // Lua heap growth during the last update
+        bool Batched           = false;
+    };
 
     class LUMOS_EXPORT LuaManager : public ThreadSafeSingleton<LuaManager>
     {
@@ -24,8 +35,19 @@ namespace Lumos
         void OnInit(Scene* scene);
         void OnUpdate(Scene* scene);
 
+        // Full collection, for scene changes. Per frame collection is done with StepGarbageCollector
         void CollectGarbage();
 
+        // The automatic collector is stopped and stepped once per frame instead.
+        // Each step covers at least what was allocated since the previous one so the heap can't run away
+        void StepGarbageCollector();
+        void SetGCStepSize(uint32_t kiloBytes) { m_GCStepSizeKB = kiloBytes; }
+        uint32_t GetGCStepSize() const { return m_GCStepSizeKB; }
+        int64_t GetMemoryUsage() const;
+
+        // One entry per script file, in update order
+        const std::vector<LuaScriptStats>& GetScriptStats() const { return m_ScriptStats; }
+
         void OnNewProject(const std::string& projectPath);
 
         void BindECSLua(sol::state& state);
@@ -43,8 +65,18 @@ namespace Lumos
         }
 
     private:
+        void RebuildScriptBatches(Scene* scene);
+
         static TDArray<std::string> s_Identifiers;
 
         sol::state* m_State;
+
+        std::vector<LuaScriptBatch> m_ScriptBatches;
+        std::vector<LuaScriptStats> m_ScriptStats;
+        Scene* m_BatchScene           = nullptr;
+        uint32_t m_BatchScriptVersion = 0;
+        size_t m_BatchScriptCount     = 0;
+        uint32_t m_GCStepSizeKB       = 64;
+        int64_t m_LastGCMemory        = 0;
     };
 }
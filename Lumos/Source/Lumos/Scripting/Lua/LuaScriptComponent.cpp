@@ -11,6 +11,8 @@
 
 namespace Lumos
 {
+    uint32_t LuaScriptComponent::s_ScriptVersion = 0;
+
     LuaScriptComponent::LuaScriptComponent()
     {
         m_Scene    = nullptr;
@@ -37,6 +39,8 @@ namespace Lumos
     {
         if(m_Env)
         {
+            s_ScriptVersion++;
+
             sol::protected_function releaseFunc = (*m_Env)["OnRelease"];
             if(releaseFunc.valid())
                 releaseFunc.call();
@@ -45,6 +49,7 @@ namespace Lumos
 
     void LuaScriptComponent::LoadScript(const std::string& fileName)
     {
+        s_ScriptVersion++;
         m_FileName = fileName;
         std::string physicalPath;
         if(!FileSystem::Get().ResolvePhysicalPath(fileName, physicalPath))
@@ -94,6 +99,10 @@ namespace Lumos
         if(!m_UpdateFunc->valid())
             m_UpdateFunc.reset();
 
+        m_BatchUpdateFunc = CreateSharedPtr<sol::protected_function>((*m_Env)["OnUpdateBatch"]);
+        if(!m_BatchUpdateFunc->valid())
+            m_BatchUpdateFunc.reset();
+
         m_Phys2DBeginFunc = CreateSharedPtr<sol::protected_function>((*m_Env)["OnCollision2DBegin"]);
         if(!m_Phys2DBeginFunc->valid())
             m_Phys2DBeginFunc.reset();
@@ -109,8 +118,6 @@ namespace Lumos
         m_Phys3DEndFunc = CreateSharedPtr<sol::protected_function>((*m_Env)["OnCollision3DEnd"]);
         if(!m_Phys3DEndFunc->valid())
             m_Phys3DEndFunc.reset();
-
-        LuaManager::Get().GetState().collect_garbage();
     }
 
     void LuaScriptComponent::OnInit()
@@ -61,6 +61,24 @@ namespace Lumos
             return m_Env.get() != nullptr;
         }
 
+        bool HasUpdateFunction() const
+        {
+            return m_UpdateFunc != nullptr;
+        }
+
+        // OnUpdateBatch(entities, transforms, dt) : called once for every instance of this script.
+        // Runs in the environment of the first instance, so it shouldn't rely on per instance globals
+        const SharedPtr<sol::protected_function>& GetBatchUpdateFunction() const
+        {
+            return m_BatchUpdateFunc;
+        }
+
+        // Incremented when any script is loaded or released, used to invalidate cached update batches
+        static uint32_t GetScriptVersion()
+        {
+            return s_ScriptVersion;
+        }
+
         template <typename Archive>
         void save(Archive& archive) const
         {
@@ -90,11 +108,14 @@ namespace Lumos
         SharedPtr<sol::environment> m_Env;
         SharedPtr<sol::protected_function> m_OnInitFunc;
         SharedPtr<sol::protected_function> m_UpdateFunc;
+        SharedPtr<sol::protected_function> m_BatchUpdateFunc;
         SharedPtr<sol::protected_function> m_OnReleaseFunc;
 
         SharedPtr<sol::protected_function> m_Phys2DBeginFunc;
         SharedPtr<sol::protected_function> m_Phys3DBeginFunc;
         SharedPtr<sol::protected_function> m_Phys2DEndFunc;
         SharedPtr<sol::protected_function> m_Phys3DEndFunc;
+
+        static uint32_t s_ScriptVersion;
     };
 }
@@ -10,8 +10,70 @@
 #include "Maths/Quaternion.h"
 #include "Maths/MathsUtilities.h"
 
+#include <tuple>
+
 namespace Lumos
 {
+#ifdef LUMOS_LUAJIT
+    // FFI views over the engine maths types. Fields read and write straight into engine memory
+    // and temporaries are cdata that the JIT can sink, instead of a userdata allocation per value.
+    static const char* s_MathsFFI = R"(
+local ffi = require("ffi")
+
+ffi.cdef[[
+typedef struct __attribute__((aligned(16))) LumosVec2 { float x, y, _p0, _p1; } LumosVec2;
+typedef struct __attribute__((aligned(16))) LumosVec3 { float x, y, z, _p0; } LumosVec3;
+typedef struct __attribute__((aligned(16))) LumosVec4 { float x, y, z, w; } LumosVec4;
+typedef struct __attribute__((aligned(16))) LumosQuat { float x, y, z, w; } LumosQuat;
+]]
+
+local Vec3
+local Vec3Methods = {
+    Length = function(a) return math.sqrt(a.x * a.x + a.y * a.y + a.z * a.z) end,
+    Length2 = function(a) return a.x * a.x + a.y * a.y + a.z * a.z end,
+    Dot = function(a, b) return a.x * b.x + a.y * b.y + a.z * b.z end,
+    Set = function(a, x, y, z) a.x, a.y, a.z = x, y, z end,
+    Normalise = function(a)
+        local len = math.sqrt(a.x * a.x + a.y * a.y + a.z * a.z)
+        if len > 0 then a.x, a.y, a.z = a.x / len, a.y / len, a.z / len end
+        return a
+    end,
+}
+
+Vec3 = ffi.metatype("LumosVec3", {
+    __add = function(a, b) return Vec3(a.x + b.x, a.y + b.y, a.z + b.z) end,
+    __sub = function(a, b) return Vec3(a.x - b.x, a.y - b.y, a.z - b.z) end,
+    __unm = function(a) return Vec3(-a.x, -a.y, -a.z) end,
+    __mul = function(a, b)
+        if type(a) == "number" then return Vec3(a * b.x, a * b.y, a * b.z) end
+        if type(b) == "number" then return Vec3(a.x * b, a.y * b, a.z * b) end
+        return Vec3(a.x * b.x, a.y * b.y, a.z * b.z)
+    end,
+    __div = function(a, b)
+        if type(b) == "number" then return Vec3(a.x / b, a.y / b, a.z / b) end
+        return Vec3(a.x / b.x, a.y / b.y, a.z / b.z)
+    end,
+    __index = Vec3Methods,
+})
+
+LumosFFI = {
+    Vec2 = ffi.typeof("LumosVec2"),
+    Vec3 = Vec3,
+    Vec4 = ffi.typeof("LumosVec4"),
+    Quat = ffi.typeof("LumosQuat"),
+
+    -- Views into a Transform component. Only valid until the component storage changes (add/remove)
+    LocalPosition = function(transform) return ffi.cast("LumosVec3*", transform:LocalPositionPtr()) end,
+    LocalScale = function(transform) return ffi.cast("LumosVec3*", transform:LocalScalePtr()) end,
+    LocalOrientation = function(transform) return ffi.cast("LumosQuat*", transform:LocalOrientationPtr()) end,
+}
+)";
+
+    static_assert(sizeof(Vec2) == 16 && offsetof(Vec2, y) == 4, "LumosVec2 FFI layout mismatch");
+    static_assert(sizeof(Vec3) == 16 && offsetof(Vec3, z) == 8, "LumosVec3 FFI layout mismatch");
+    static_assert(sizeof(Vec4) == 16 && offsetof(Vec4, w) == 12, "LumosVec4 FFI layout mismatch");
+    static_assert(sizeof(Quat) == 16 && offsetof(Quat, w) == 12, "LumosQuat FFI layout mismatch");
+#endif
 
     void BindMathsLua(sol::state& state)
     {
@@ -122,6 +184,24 @@ namespace Lumos
             return Maths::Distance2(a, b);
         };
 
+        // In place vector maths, avoids a new userdata per operation
+        Vector3type["Set"] = [](Vec3& v, float x, float y, float z)
+        {
+            v = Vec3(x, y, z);
+        };
+        Vector3type["AddInPlace"] = [](Vec3& v, const Vec3& o)
+        {
+            v += o;
+        };
+        Vector3type["SubInPlace"] = [](Vec3& v, const Vec3& o)
+        {
+            v -= o;
+        };
+        Vector3type["ScaleInPlace"] = [](Vec3& v, float f)
+        {
+            v *= f;
+        };
+
         auto Vector4type = state.new_usertype<Vec4>("Vector4", sol::constructors<Vec4(), Vec4(float, float, float, float)>());
 
         // Fields
@@ -259,6 +339,58 @@ namespace Lumos
         TransformType["GetForwardDirection"] = &Maths::Transform::GetForwardDirection;
         TransformType["GetRightDirection"]   = &Maths::Transform::GetRightDirection;
 
+        // Allocation free access, values are passed as multiple returns/arguments instead of userdata
+        TransformType["GetLocalPositionXYZ"] = [](const Maths::Transform& t)
+        {
+            const Vec3& p = t.GetLocalPosition();
+            return std::make_tuple(p.x, p.y, p.z);
+        };
+        TransformType["SetLocalPositionXYZ"] = [](Maths::Transform& t, float x, float y, float z)
+        {
+            t.SetLocalPosition(Vec3(x, y, z));
+        };
+        TransformType["GetLocalScaleXYZ"] = [](const Maths::Transform& t)
+        {
+            const Vec3& s = t.GetLocalScale();
+            return std::make_tuple(s.x, s.y, s.z);
+        };
+        TransformType["SetLocalScaleXYZ"] = [](Maths::Transform& t, float x, float y, float z)
+        {
+            t.SetLocalScale(Vec3(x, y, z));
+        };
+        TransformType["GetLocalOrientationXYZW"] = [](const Maths::Transform& t)
+        {
+            const Quat& q = t.GetLocalOrientation();
+            return std::make_tuple(q.x, q.y, q.z, q.w);
+        };
+        TransformType["SetLocalOrientationXYZW"] = [](Maths::Transform& t, float x, float y, float z, float w)
+        {
+            t.SetLocalOrientation(Quat(x, y, z, w));
+        };
+
+#ifdef LUMOS_LUAJIT
+        TransformType["LocalPositionPtr"] = [](Maths::Transform& t)
+        {
+            return (void*)&t.GetLocalPosition();
+        };
+        TransformType["LocalScalePtr"] = [](Maths::Transform& t)
+        {
+            return (void*)&t.GetLocalScale();
+        };
+        TransformType["LocalOrientationPtr"] = [](Maths::Transform& t)
+        {
+            return (void*)&t.GetLocalOrientation();
+        };
+
+        auto result = state.safe_script(s_MathsFFI, sol::script_pass_on_error);
+        if(!result.valid())
+        {
+            sol::error err = result;
+            LERROR("Failed to create Lua FFI maths types");
+            LERROR("Error : %s", err.what());
+        }
+#endif
+
         state["SineOut"]          = Maths::SineOut;
         state["SineIn"]           = Maths::SineIn;
         state["SineInOut"]        = Maths::SineInOut;
@@ -4,6 +4,8 @@
 #include "Scene/Component/RigidBody3DComponent.h"
 #include "Core/Application.h"
 #include "Physics/B2PhysicsEngine/B2PhysicsEngine.h"
+#include "Physics/LumosPhysicsEngine/LumosPhysicsEngine.h"
+#include "Physics/LumosPhysicsEngine/RigidBody3D.h"
 
 #include <box2d/box2d.h>
 #include <sol/sol.hpp>
@@ -49,6 +51,115 @@ namespace Lumos
         return SharedPtr<RigidBody3D>(Application::Get().GetSystem<LumosPhysicsEngine>()->CreateBody({}));
     }
 
+    static PhysicsQueryFilter GetQueryFilter(sol::optional<uint32_t> layerMask, sol::optional<bool> includeTriggers)
+    {
+        PhysicsQueryFilter filter;
+        filter.LayerMask       = layerMask.value_or(~0u);
+        filter.IncludeTriggers = includeTriggers.value_or(false);
+        return filter;
+    }
+
+    static sol::object RaycastHitToTable(sol::this_state s, const RaycastHit3D& hit)
+    {
+        if(!hit.Body)
+            return sol::make_object(s, false);
+
+        sol::state_view lua(s);
+        sol::table table  = lua.create_table();
+        table["Body"]     = hit.Body;
+        table["Point"]    = hit.Point;
+        table["Normal"]   = hit.Normal;
+        table["Distance"] = hit.Distance;
+        return table;
+    }
+
+    static sol::table BodiesToTable(sol::this_state s, const TDArray<RigidBody3D*>& bodies)
+    {
+        sol::state_view lua(s);
+        sol::table table = lua.create_table((int)bodies.Size(), 0);
+        for(auto body : bodies)
+            table.add(body);
+        return table;
+    }
+
+    static void BindPhysics3DQueries(sol::state& state)
+    {
+        // Misses return nil, except in RaycastBatch where they are false so the result has no holes.
+        // The optional layerMask has bit n set for each collision layer n to hit
+        sol::table physics3D = state.create_named_table("Physics3D");
+
+        physics3D.set_function("Raycast", [](sol::this_state s, const Vec3& origin, const Vec3& direction, float maxDistance, sol::optional<uint32_t> layerMask, sol::optional<bool> includeTriggers) -> sol::object
+                               {
+                                   RaycastHit3D hit;
+                                   if(!Application::Get().GetSystem<LumosPhysicsEngine>()->Raycast(origin, direction, maxDistance, hit, GetQueryFilter(layerMask, includeTriggers)))
+                                       return sol::nil;
+                                   return RaycastHitToTable(s, hit); });
+
+        physics3D.set_function("SphereCast", [](sol::this_state s, const Vec3& origin, float radius, const Vec3& direction, float maxDistance, sol::optional<uint32_t> layerMask, sol::optional<bool> includeTriggers) -> sol::object
+                               {
+                                   RaycastHit3D hit;
+                                   if(!Application::Get().GetSystem<LumosPhysicsEngine>()->SphereCast(origin, radius, direction, maxDistance, hit, GetQueryFilter(layerMask, includeTriggers)))
+                                       return sol::nil;
+                                   return RaycastHitToTable(s, hit); });
+
+        physics3D.set_function("CapsuleCast", [](sol::this_state s, const Vec3& pointA, const Vec3& pointB, float radius, const Vec3& direction, float maxDistance, sol::optional<uint32_t> layerMask, sol::optional<bool> includeTriggers) -> sol::object
+                               {
+                                   RaycastHit3D hit;
+                                   if(!Application::Get().GetSystem<LumosPhysicsEngine>()->CapsuleCast(pointA, pointB, radius, direction, maxDistance, hit, GetQueryFilter(layerMask, includeTriggers)))
+                                       return sol::nil;
+                                   return RaycastHitToTable(s, hit); });
+
+        physics3D.set_function("BoxCast", [](sol::this_state s, const Vec3& centre, const Vec3& halfExtents, const Quat& orientation, const Vec3& direction, float maxDistance, sol::optional<uint32_t> layerMask, sol::optional<bool> includeTriggers) -> sol::object
+                               {
+                                   RaycastHit3D hit;
+                                   if(!Application::Get().GetSystem<LumosPhysicsEngine>()->BoxCast(centre, halfExtents, orientation, direction, maxDistance, hit, GetQueryFilter(layerMask, includeTriggers)))
+                                       return sol::nil;
+                                   return RaycastHitToTable(s, hit); });
+
+        physics3D.set_function("OverlapSphere", [](sol::this_state s, const Vec3& centre, float radius, sol::optional<uint32_t> layerMask, sol::optional<bool> includeTriggers)
+                               {
+                                   TDArray<RigidBody3D*> bodies;
+                                   Application::Get().GetSystem<LumosPhysicsEngine>()->OverlapSphere(centre, radius, bodies, GetQueryFilter(layerMask, includeTriggers));
+                                   return BodiesToTable(s, bodies); });
+
+        physics3D.set_function("OverlapCapsule", [](sol::this_state s, const Vec3& pointA, const Vec3& pointB, float radius, sol::optional<uint32_t> layerMask, sol::optional<bool> includeTriggers)
+                               {
+                                   TDArray<RigidBody3D*> bodies;
+                                   Application::Get().GetSystem<LumosPhysicsEngine>()->OverlapCapsule(pointA, pointB, radius, bodies, GetQueryFilter(layerMask, includeTriggers));
+                                   return BodiesToTable(s, bodies); });
+
+        physics3D.set_function("OverlapBox", [](sol::this_state s, const Vec3& centre, const Vec3& halfExtents, const Quat& orientation, sol::optional<uint32_t> layerMask, sol::optional<bool> includeTriggers)
+                               {
+                                   TDArray<RigidBody3D*> bodies;
+                                   Application::Get().GetSystem<LumosPhysicsEngine>()->OverlapBox(centre, halfExtents, orientation, bodies, GetQueryFilter(layerMask, includeTriggers));
+                                   return BodiesToTable(s, bodies); });
+
+        // rays is an array of { Origin = Vec3, Direction = Vec3, MaxDistance = number }, traced in parallel
+        physics3D.set_function("RaycastBatch", [](sol::this_state s, const sol::table& rays, sol::optional<uint32_t> layerMask, sol::optional<bool> includeTriggers)
+                               {
+                                   PhysicsQueryFilter filter = GetQueryFilter(layerMask, includeTriggers);
+                                   uint32_t count            = (uint32_t)rays.size();
+
+                                   TDArray<PhysicsRaycast> queries(count);
+                                   for(uint32_t i = 0; i < count; i++)
+                                   {
+                                       sol::table ray         = rays[i + 1];
+                                       queries[i].Origin      = ray.get<Vec3>("Origin");
+                                       queries[i].Direction   = ray.get<Vec3>("Direction");
+                                       queries[i].MaxDistance = ray.get_or("MaxDistance", FLT_MAX);
+                                       queries[i].Filter      = filter;
+                                   }
+
+                                   TDArray<RaycastHit3D> hits(count);
+                                   Application::Get().GetSystem<LumosPhysicsEngine>()->RaycastBatch(queries.Data(), count, hits.Data());
+
+                                   sol::state_view lua(s);
+                                   sol::table result = lua.create_table((int)count, 0);
+                                   for(uint32_t i = 0; i < count; i++)
+                                       result.add(RaycastHitToTable(s, hits[i]));
+                                   return result; });
+    }
+
     void BindPhysicsLua(sol::state& state)
     {
         sol::usertype<RigidBodyParameters> physicsObjectParameters_type = state.new_usertype<RigidBodyParameters>("RigidBodyParameters");
@@ -79,6 +190,20 @@ namespace Lumos
         physics3D_type.set_function("GetFriction", &RigidBody3D::GetFriction);
         physics3D_type.set_function("GetIsStatic", &RigidBody3D::GetIsStatic);
 
+        // Allocation free variants, values are passed as multiple returns/arguments instead of userdata
+        physics3D_type.set_function("GetPositionXYZ", [](const RigidBody3D& body)
+                                    {
+                                        const Vec3& p = body.GetPosition();
+                                        return std::make_tuple(p.x, p.y, p.z); });
+        physics3D_type.set_function("SetPositionXYZ", [](RigidBody3D& body, float x, float y, float z)
+                                    { body.SetPosition(Vec3(x, y, z)); });
+        physics3D_type.set_function("GetLinearVelocityXYZ", [](const RigidBody3D& body)
+                                    {
+                                        const Vec3& v = body.GetLinearVelocity();
+                                        return std::make_tuple(v.x, v.y, v.z); });
+        physics3D_type.set_function("SetLinearVelocityXYZ", [](RigidBody3D& body, float x, float y, float z)
+                                    { body.SetLinearVelocity(Vec3(x, y, z)); });
+
         std::initializer_list<std::pair<sol::string_view, Shape>> shapes = {
             { "Square", Shape::Square },
             { "Circle", Shape::Circle },
@@ -106,5 +231,7 @@ namespace Lumos
 
         state.set_function("SetCallback", &SetCallback);
         state.set_function("SetB2DGravity", &SetB2DGravity);
+
+        BindPhysics3DQueries(state);
     }
 }
@@ -36,4 +36,11 @@ namespace Lumos
         m_LastTime = currentTime;
         m_Elapsed += m_Timestep;
     }
+
+    void TimeStep::OnUpdate(double fixedMillis)
+    {
+        m_Timestep = fixedMillis;
+        m_LastTime = m_Timer->GetElapsedMSD();
+        m_Elapsed += m_Timestep;
+    }
 }
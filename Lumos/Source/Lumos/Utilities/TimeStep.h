@@ -10,6 +10,9 @@ namespace Lumos
         ~TimeStep();
 
         void OnUpdate();
+
+        // Advances by a fixed step instead of the measured frame time, for deterministic runs
+        void OnUpdate(double fixedMillis);
         inline double GetMillis() const { return m_Timestep; }
         inline double GetElapsedMillis() const { return m_Elapsed; }
 
@@ -67,6 +67,12 @@ project "Lumos"
 		"ozz_animation_offline"
 	}
 
+	if _OPTIONS["luajit"] then
+		removelinks { "lua" }
+		links { "luajit" }
+		libdirs { "%{LibraryDir.luajit}" }
+	end
+
 	defines
 	{
 		"LUMOS_ENGINE",
@@ -50,6 +50,12 @@ project "Runtime"
 		"ozz_base"
 	}
 
+	if _OPTIONS["luajit"] then
+		removelinks { "lua" }
+		links { "luajit" }
+		libdirs { "%{LibraryDir.luajit}" }
+	end
+
 	defines
 	{
 	}
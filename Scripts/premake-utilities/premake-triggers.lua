@@ -40,6 +40,12 @@ newoption
 	description = "Target tvOS"
 }
 
+newoption
+{
+	trigger     = "luajit",
+	description = "Use LuaJIT (Lumos/External/luajit, built with its own makefile) instead of the bundled Lua"
+}
+
 newaction
 {
 	trigger     = "clean",
@@ -21,5 +21,10 @@ IncludeDir["msdfgen"] = "%{wks.location}/Lumos/External/msdf-atlas-gen/msdfgen"
 IncludeDir["ozz"] = "%{wks.location}/Lumos/External/ozz-animation/include"
 IncludeDir["VulkanSDK"] = "%{VULKAN_SDK}/Include"
 
+if _OPTIONS["luajit"] then
+	IncludeDir["lua"] = "%{wks.location}/Lumos/External/luajit/src/"
+end
+
 LibraryDir = {}
 LibraryDir["VulkanSDK"] = "%{VULKAN_SDK}/Lib"
+LibraryDir["luajit"] = "%{wks.location}/Lumos/External/luajit/src"
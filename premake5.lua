@@ -30,6 +30,10 @@ workspace( settings.workspace_name )
 	targetdir ("bin/%{outputdir}/")
 	objdir ("bin-int/%{outputdir}/obj/")
 
+	if _OPTIONS["luajit"] then
+		defines { "LUMOS_LUAJIT", "SOL_LUAJIT=1" }
+	end
+
 	gradleversion "com.android.tools.build:gradle:7.0.0"
 
 	if Arch == "arm" then
@@ -57,8 +61,10 @@ workspace( settings.workspace_name )
 	group "External"
 		require("Lumos/External/box2dpremake5")
 			SetRecommendedSettings()
-		require("Lumos/External/lua/premake5")
+		if not _OPTIONS["luajit"] then
+			require("Lumos/External/lua/premake5")
 			SetRecommendedSettings()
+		end
 		require("Lumos/External/imguipremake5")
 			SetRecommendedSettings()
 		require("Lumos/External/freetype/premake5")
@@ -85,3 +91,7 @@ workspace( settings.workspace_name )
 		   SetRecommendedSettings()
 	include "Editor/premake5"
 		   SetRecommendedSettings()
+	if not os.istarget(premake.IOS) and not os.istarget(premake.ANDROID) then
+		include "Benchmark/premake5"
+			SetRecommendedSettings()
+	end